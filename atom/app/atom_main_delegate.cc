@@ -166,10 +166,28 @@ content::ContentBrowserClient* AtomMainDelegate::CreateContentBrowserClient() {
 
 content::ContentRendererClient*
 AtomMainDelegate::CreateContentRendererClient() {
-  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
-          switches::kEnableSandbox) ||
-      !base::CommandLine::ForCurrentProcess()->HasSwitch(
-          ::switches::kNoSandbox)) {
+  auto* command_line = base::CommandLine::ForCurrentProcess();
+  bool use_sandboxed_client =
+      command_line->HasSwitch(switches::kEnableSandbox) ||
+      !command_line->HasSwitch(::switches::kNoSandbox);
+
+  // A guest renderer with node integration disabled and no preload script
+  // never runs any user code in the Node environment, so there is no point
+  // booting one per guest: give it the lightweight sandboxed client, which
+  // still provides the IPC bindings the webview machinery needs. Session
+  // preload scripts (--preload-scripts) count too: only the full renderer
+  // client runs them.
+  if (!use_sandboxed_client &&
+      command_line->HasSwitch(switches::kGuestInstanceID) &&
+      command_line->GetSwitchValueASCII(switches::kNodeIntegration) ==
+          "false" &&
+      !command_line->HasSwitch(switches::kNodeIntegrationInWorker) &&
+      !command_line->HasSwitch(switches::kPreloadScript) &&
+      !command_line->HasSwitch(switches::kPreloadScripts)) {
+    use_sandboxed_client = true;
+  }
+
+  if (use_sandboxed_client) {
     renderer_client_.reset(new AtomSandboxedRendererClient);
   } else {
     renderer_client_.reset(new AtomRendererClient);
@@ -2,31 +2,39 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <utility>
 
 #include "atom/app/uv_task_runner.h"
 
-#include "base/stl_util.h"
-
 namespace atom {
 
-UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {}
+UvTaskRunner::UvTaskRunner(uv_loop_t* loop) : loop_(loop) {
+  timer_.data = this;
+  uv_timer_init(loop_, &timer_);
+}
 
 UvTaskRunner::~UvTaskRunner() {
-  for (auto& iter : tasks_) {
-    uv_unref(reinterpret_cast<uv_handle_t*>(iter.first));
-    delete iter.first;
-  }
+  uv_unref(reinterpret_cast<uv_handle_t*>(&timer_));
+}
+
+// static
+bool UvTaskRunner::LaterDeadline(const PendingTask& a, const PendingTask& b) {
+  if (a.run_time != b.run_time)
+    return a.run_time > b.run_time;
+  return a.sequence > b.sequence;
 }
 
 bool UvTaskRunner::PostDelayedTask(const base::Location& from_here,
                                    base::OnceClosure task,
                                    base::TimeDelta delay) {
-  auto* timer = new uv_timer_t;
-  timer->data = this;
-  uv_timer_init(loop_, timer);
-  uv_timer_start(timer, UvTaskRunner::OnTimeout, delay.InMilliseconds(), 0);
-  tasks_[timer] = std::move(task);
+  PendingTask pending;
+  pending.run_time = uv_now(loop_) + delay.InMilliseconds();
+  pending.sequence = next_sequence_++;
+  pending.task = std::move(task);
+  tasks_.push_back(std::move(pending));
+  std::push_heap(tasks_.begin(), tasks_.end(), LaterDeadline);
+  ScheduleWakeup();
   return true;
 }
 
@@ -40,21 +48,33 @@ bool UvTaskRunner::PostNonNestableDelayedTask(const base::Location& from_here,
   return PostDelayedTask(from_here, std::move(task), delay);
 }
 
-// static
-void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
-  UvTaskRunner* self = static_cast<UvTaskRunner*>(timer->data);
-  if (!ContainsKey(self->tasks_, timer))
+void UvTaskRunner::ScheduleWakeup() {
+  if (tasks_.empty()) {
+    uv_timer_stop(&timer_);
     return;
+  }
 
-  std::move(self->tasks_[timer]).Run();
-  self->tasks_.erase(timer);
-  uv_timer_stop(timer);
-  uv_close(reinterpret_cast<uv_handle_t*>(timer), UvTaskRunner::OnClose);
+  uint64_t now = uv_now(loop_);
+  uint64_t run_time = tasks_.front().run_time;
+  uv_timer_start(&timer_, UvTaskRunner::OnTimeout,
+                 run_time > now ? run_time - now : 0, 0);
 }
 
 // static
-void UvTaskRunner::OnClose(uv_handle_t* handle) {
-  delete reinterpret_cast<uv_timer_t*>(handle);
+void UvTaskRunner::OnTimeout(uv_timer_t* timer) {
+  UvTaskRunner* self = static_cast<UvTaskRunner*>(timer->data);
+
+  uint64_t now = uv_now(self->loop_);
+  while (!self->tasks_.empty() && self->tasks_.front().run_time <= now) {
+    std::pop_heap(self->tasks_.begin(), self->tasks_.end(), LaterDeadline);
+    base::OnceClosure task = std::move(self->tasks_.back().task);
+    self->tasks_.pop_back();
+    // Running the task may post new tasks; the heap stays valid because the
+    // loop re-reads the front on every iteration.
+    std::move(task).Run();
+  }
+
+  self->ScheduleWakeup();
 }
 
 }  // namespace atom
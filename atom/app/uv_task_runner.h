@@ -5,7 +5,7 @@
 #ifndef ATOM_APP_UV_TASK_RUNNER_H_
 #define ATOM_APP_UV_TASK_RUNNER_H_
 
-#include <map>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/location.h"
@@ -14,7 +14,9 @@
 
 namespace atom {
 
-// TaskRunner implementation that posts tasks into libuv's default loop.
+// TaskRunner implementation that posts tasks into libuv's default loop. All
+// pending tasks share one uv timer, ordered by a min-heap on their deadline,
+// so posting a task never allocates a uv handle.
 class UvTaskRunner : public base::SingleThreadTaskRunner {
  public:
   explicit UvTaskRunner(uv_loop_t* loop);
@@ -29,13 +31,33 @@ class UvTaskRunner : public base::SingleThreadTaskRunner {
                                   base::TimeDelta delay) override;
 
  private:
+  struct PendingTask {
+    // Deadline in uv loop time (milliseconds).
+    uint64_t run_time;
+    // Keeps FIFO order among tasks with equal deadlines.
+    uint64_t sequence;
+    base::OnceClosure task;
+  };
+
+  // Heap comparator; makes |tasks_| a min-heap on (run_time, sequence).
+  static bool LaterDeadline(const PendingTask& a, const PendingTask& b);
+
   ~UvTaskRunner() override;
   static void OnTimeout(uv_timer_t* timer);
-  static void OnClose(uv_handle_t* handle);
+
+  // (Re)arms |timer_| for the earliest pending deadline, or stops it when
+  // nothing is pending.
+  void ScheduleWakeup();
 
   uv_loop_t* loop_;
 
-  std::map<uv_timer_t*, base::OnceClosure> tasks_;
+  // The one timer shared by every pending task.
+  uv_timer_t timer_;
+
+  // Min-heap of pending tasks, earliest deadline at the front.
+  std::vector<PendingTask> tasks_;
+
+  uint64_t next_sequence_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(UvTaskRunner);
 };
@@ -12,7 +12,12 @@
 #include "atom/browser/api/atom_api_web_contents.h"
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/atom_browser_main_parts.h"
+#include "atom/browser/javascript_environment.h"
 #include "atom/browser/login_handler.h"
+#include "atom/browser/long_task_watchdog.h"
+#include "atom/browser/ipc_metrics.h"
+#include "atom/browser/startup_timing.h"
+#include "atom/browser/task_latency_metrics.h"
 #include "atom/browser/relauncher.h"
 #include "atom/common/atom_command_line.h"
 #include "atom/common/native_mate_converters/callback.h"
@@ -24,10 +29,12 @@
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_includes.h"
 #include "atom/common/options_switches.h"
+#include "base/allocator/allocator_extension.h"
 #include "base/command_line.h"
 #include "base/environment.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "base/path_service.h"
 #include "base/strings/string_util.h"
 #include "base/sys_info.h"
@@ -61,6 +68,15 @@
 #include "atom/browser/ui/cocoa/atom_bundle_mover.h"
 #endif
 
+#if defined(OS_LINUX)
+#include <unistd.h>
+
+#include "base/files/file_enumerator.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+#include "base/strings/stringprintf.h"
+#endif
+
 using atom::Browser;
 
 namespace mate {
@@ -423,6 +439,117 @@ int GetPathConstant(const std::string& name) {
     return -1;
 }
 
+#if defined(OS_LINUX)
+// Value of the "<key>:\t<number>" line in a /proc status file, or 0.
+uint64_t ReadProcStatusField(const std::string& status, const char* key) {
+  size_t pos = status.find(key);
+  if (pos == std::string::npos)
+    return 0;
+  pos = status.find(':', pos);
+  if (pos == std::string::npos)
+    return 0;
+  size_t end = status.find('\n', pos);
+  uint64_t value = 0;
+  base::StringToUint64(
+      base::TrimWhitespaceASCII(status.substr(pos + 1, end - pos - 1),
+                                base::TRIM_ALL),
+      &value);
+  return value;
+}
+
+// Reads the private, shared and swap counters (in KB) for |pid| from the
+// cheap per-process rollups: /proc/<pid>/smaps_rollup on 4.14+ kernels,
+// falling back to the RssAnon/RssFile/RssShmem/VmSwap fields of
+// /proc/<pid>/status on older ones. Either way it is a single small read
+// instead of the tens-of-milliseconds walk over every mapping in smaps.
+bool GetProcessMemoryCounters(base::ProcessId pid,
+                              uint64_t* private_kb,
+                              uint64_t* shared_kb,
+                              uint64_t* swap_kb) {
+  std::string rollup;
+  if (base::ReadFileToString(
+          base::FilePath(base::StringPrintf("/proc/%d/smaps_rollup", pid)),
+          &rollup)) {
+    *private_kb = ReadProcStatusField(rollup, "Private_Clean") +
+                  ReadProcStatusField(rollup, "Private_Dirty");
+    *shared_kb = ReadProcStatusField(rollup, "Shared_Clean") +
+                 ReadProcStatusField(rollup, "Shared_Dirty");
+    *swap_kb = ReadProcStatusField(rollup, "Swap");
+    return true;
+  }
+
+  std::string status;
+  if (!base::ReadFileToString(
+          base::FilePath(base::StringPrintf("/proc/%d/status", pid)), &status))
+    return false;
+  // Anonymous memory is private to the process; file-backed and shmem
+  // pages are the shareable part of the resident set.
+  *private_kb = ReadProcStatusField(status, "RssAnon");
+  *shared_kb = ReadProcStatusField(status, "RssFile") +
+               ReadProcStatusField(status, "RssShmem");
+  *swap_kb = ReadProcStatusField(status, "VmSwap");
+  return true;
+}
+
+// Collects cumulative per-thread CPU time and context-switch counts for
+// |pid| from /proc/<pid>/task. The counters only ever grow, so callers
+// polling getAppMetrics() can diff successive samples.
+std::vector<mate::Dictionary> GetThreadMetrics(v8::Isolate* isolate,
+                                               base::ProcessId pid) {
+  std::vector<mate::Dictionary> threads;
+  const long ticks_per_second = sysconf(_SC_CLK_TCK);
+  base::FileEnumerator enumerator(
+      base::FilePath(base::StringPrintf("/proc/%d/task", pid)),
+      false /* recursive */, base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    int tid;
+    if (!base::StringToInt(path.BaseName().value(), &tid))
+      continue;
+
+    std::string stat;
+    if (!base::ReadFileToString(path.Append("stat"), &stat))
+      continue;
+
+    // The thread name in parentheses may contain spaces, so count fields
+    // from the closing parenthesis: utime and stime are fields 14 and 15
+    // of the full line, i.e. 11 and 12 past the name.
+    size_t open_paren = stat.find('(');
+    size_t close_paren = stat.rfind(')');
+    if (open_paren == std::string::npos || close_paren == std::string::npos ||
+        close_paren < open_paren)
+      continue;
+    std::vector<base::StringPiece> fields = base::SplitStringPiece(
+        base::StringPiece(stat).substr(close_paren + 1), " ",
+        base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    uint64_t utime = 0, stime = 0;
+    if (fields.size() < 13 || !base::StringToUint64(fields[11], &utime) ||
+        !base::StringToUint64(fields[12], &stime))
+      continue;
+
+    std::string status;
+    base::ReadFileToString(path.Append("status"), &status);
+
+    mate::Dictionary thread_dict = mate::Dictionary::CreateEmpty(isolate);
+    thread_dict.Set("id", tid);
+    thread_dict.Set("name",
+                    stat.substr(open_paren + 1, close_paren - open_paren - 1));
+    thread_dict.Set("cpuTimeMs", static_cast<double>((utime + stime) * 1000 /
+                                                     ticks_per_second));
+    thread_dict.Set(
+        "voluntaryContextSwitches",
+        static_cast<double>(
+            ReadProcStatusField(status, "voluntary_ctxt_switches")));
+    thread_dict.Set(
+        "nonvoluntaryContextSwitches",
+        static_cast<double>(
+            ReadProcStatusField(status, "nonvoluntary_ctxt_switches")));
+    threads.push_back(thread_dict);
+  }
+  return threads;
+}
+#endif  // defined(OS_LINUX)
+
 bool NotificationCallbackWrapper(
     const base::Callback<
         void(const base::CommandLine::StringVector& command_line,
@@ -890,10 +1017,16 @@ bool App::RequestSingleInstanceLock() {
   process_singleton_.reset(new ProcessSingleton(
       user_dir, base::Bind(NotificationCallbackWrapper, cb)));
 
-  switch (process_singleton_->NotifyOtherProcessOrCreate()) {
+  const auto result = process_singleton_->NotifyOtherProcessOrCreate();
+  switch (result) {
     case ProcessSingleton::NotifyResult::LOCK_ERROR:
     case ProcessSingleton::NotifyResult::PROFILE_IN_USE:
     case ProcessSingleton::NotifyResult::PROCESS_NOTIFIED: {
+      if (result == ProcessSingleton::NotifyResult::PROCESS_NOTIFIED) {
+        VLOG(1) << "Handed off command line to the running instance in "
+                << process_singleton_->last_notify_duration().InMillisecondsF()
+                << " ms";
+      }
       process_singleton_.reset();
       return false;
     }
@@ -1123,12 +1256,26 @@ std::vector<mate::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
         static_cast<double>(
             process_metric.second->metrics->GetPeakWorkingSetSize() >> 10));
 
+#if defined(OS_LINUX)
+    // GetMemoryBytes walks every mapping in /proc/<pid>/smaps, which costs
+    // tens of milliseconds per process; the kernel's per-process rollups
+    // give the same counters (plus swap) from one small read, so polling
+    // the whole fleet every few seconds stays cheap.
+    uint64_t private_kb, shared_kb, swap_kb;
+    if (GetProcessMemoryCounters(process_metric.second->pid, &private_kb,
+                                 &shared_kb, &swap_kb)) {
+      memory_dict.Set("privateBytes", static_cast<double>(private_kb));
+      memory_dict.Set("sharedBytes", static_cast<double>(shared_kb));
+      memory_dict.Set("swapBytes", static_cast<double>(swap_kb));
+    }
+#else
     size_t private_bytes, shared_bytes;
     if (process_metric.second->metrics->GetMemoryBytes(&private_bytes,
                                                        &shared_bytes)) {
       memory_dict.Set("privateBytes", static_cast<double>(private_bytes >> 10));
       memory_dict.Set("sharedBytes", static_cast<double>(shared_bytes >> 10));
     }
+#endif
 
     pid_dict.Set("memory", memory_dict);
     cpu_dict.Set(
@@ -1150,12 +1297,133 @@ std::vector<mate::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
     pid_dict.Set("pid", process_metric.second->pid);
     pid_dict.Set("type", content::GetProcessTypeNameInEnglish(
                              process_metric.second->type));
+
+#if defined(OS_LINUX)
+    pid_dict.Set("threads",
+                 GetThreadMetrics(isolate, process_metric.second->pid));
+#endif
+
+    if (process_metric.second->pid == base::GetCurrentProcId()) {
+      pid_dict.Set("mainThreadLatency",
+                   *TaskLatencyMetrics::GetInstance()->GetMetrics());
+    }
+
     result.push_back(pid_dict);
   }
 
   return result;
 }
 
+v8::Local<v8::Value> App::GetAllocatorStats(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+
+  size_t allocated = 0;
+  size_t heap_size = 0;
+  // The generic properties are only answered when the process runs on an
+  // instrumented allocator (tcmalloc); with the system allocator there is
+  // nothing below RSS to report.
+  bool supported = base::allocator::GetNumericProperty(
+                       "generic.current_allocated_bytes", &allocated) &&
+                   base::allocator::GetNumericProperty("generic.heap_size",
+                                                       &heap_size);
+  dict.Set("supported", supported);
+  if (!supported)
+    return dict.GetHandle();
+
+  dict.Set("allocatedSize", static_cast<double>(allocated >> 10));
+  dict.Set("heapSize", static_cast<double>(heap_size >> 10));
+
+  size_t value = 0;
+  if (base::allocator::GetNumericProperty("tcmalloc.pageheap_free_bytes",
+                                          &value))
+    dict.Set("pageHeapFreeSize", static_cast<double>(value >> 10));
+  size_t unmapped = 0;
+  if (base::allocator::GetNumericProperty("tcmalloc.pageheap_unmapped_bytes",
+                                          &unmapped)) {
+    dict.Set("pageHeapUnmappedSize", static_cast<double>(unmapped >> 10));
+    // What the heap actually holds in memory: everything not yet returned
+    // to the OS. The gap to allocatedSize is reclaimable via
+    // releaseFreeMemory().
+    dict.Set("residentSize", static_cast<double>((heap_size - unmapped) >> 10));
+  }
+  if (base::allocator::GetNumericProperty(
+          "tcmalloc.current_total_thread_cache_bytes", &value))
+    dict.Set("threadCacheSize", static_cast<double>(value >> 10));
+
+  return dict.GetHandle();
+}
+
+void App::ReleaseFreeMemory() {
+  base::allocator::ReleaseFreeMemory();
+}
+
+void App::NotifyMemoryPressure(const std::string& level,
+                               mate::Arguments* args) {
+  if (level != "moderate" && level != "critical") {
+    args->ThrowError("Invalid memory pressure level " + level);
+    return;
+  }
+  bool critical = level == "critical";
+  base::MemoryPressureListener::NotifyMemoryPressure(
+      critical ? base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
+               : base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  // Pressure listeners do not reach the isolate Node runs in; collect
+  // it explicitly on a critical signal.
+  if (critical)
+    AtomBrowserMainParts::Get()->js_env()->NotifyLowMemory();
+}
+
+v8::Local<v8::Value> App::GetIPCMetrics(v8::Isolate* isolate) {
+  return mate::ConvertToV8(isolate, *IPCMetrics::GetInstance()->GetMetrics());
+}
+
+void App::StartLongTaskMonitoring(mate::Arguments* args) {
+  int threshold_ms = 50;
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("threshold", &threshold_ms);
+  if (threshold_ms < 1)
+    threshold_ms = 1;
+
+  if (!long_task_watchdog_)
+    long_task_watchdog_.reset(new LongTaskWatchdog);
+  long_task_watchdog_->Start(
+      base::TimeDelta::FromMilliseconds(threshold_ms),
+      base::Bind(&App::OnLongTask, base::Unretained(this)));
+}
+
+void App::StopLongTaskMonitoring() {
+  if (long_task_watchdog_)
+    long_task_watchdog_->Stop();
+}
+
+void App::OnLongTask(const std::string& location, base::TimeDelta duration) {
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  mate::Dictionary details = mate::Dictionary::CreateEmpty(isolate());
+  details.Set("location", location);
+  details.Set("duration", duration.InMillisecondsF());
+  Emit("long-task", details);
+}
+
+v8::Local<v8::Value> App::GetLongTaskMetrics(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  LongTaskWatchdog* watchdog = long_task_watchdog_.get();
+  dict.Set("longTaskCount", watchdog ? watchdog->long_task_count() : 0);
+  dict.Set("totalDuration",
+           watchdog ? watchdog->total_long_task_time().InMillisecondsF() : 0.0);
+  dict.Set("maxDuration",
+           watchdog ? watchdog->max_task_duration().InMillisecondsF() : 0.0);
+  return dict.GetHandle();
+}
+
+mate::Dictionary App::GetStartupTimings(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  for (const auto& pair : startup_timing::GetTimings())
+    dict.Set(pair.first, pair.second);
+  return dict;
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   auto status = content::GetFeatureStatus();
   base::DictionaryValue temp;
@@ -1280,8 +1548,20 @@ void App::BuildPrototype(v8::Isolate* isolate,
                  &App::DisableHardwareAcceleration)
       .SetMethod("disableDomainBlockingFor3DAPIs",
                  &App::DisableDomainBlockingFor3DAPIs)
+      .SetMethod("setDefaultRendererAffinity",
+                 &AtomBrowserClient::SetDefaultRendererAffinity)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("getAllocatorStats", &App::GetAllocatorStats)
+      .SetMethod("releaseFreeMemory", &App::ReleaseFreeMemory)
+      .SetMethod("notifyMemoryPressure", &App::NotifyMemoryPressure)
+      .SetMethod("setHiddenWindowGCTimeout",
+                 base::Bind(&Browser::SetHiddenWindowGCTimeout, browser))
+      .SetMethod("getIPCMetrics", &App::GetIPCMetrics)
+      .SetMethod("startLongTaskMonitoring", &App::StartLongTaskMonitoring)
+      .SetMethod("stopLongTaskMonitoring", &App::StopLongTaskMonitoring)
+      .SetMethod("getLongTaskMetrics", &App::GetLongTaskMetrics)
+      .SetMethod("getStartupTimings", &App::GetStartupTimings)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
 // TODO(juturu): Remove in 2.0, deprecate before then with warnings
 #if defined(OS_MACOSX)
@@ -17,6 +17,7 @@
 #include "atom/common/native_mate_converters/callback.h"
 #include "base/process/process_iterator.h"
 #include "base/task/cancelable_task_tracker.h"
+#include "base/time/time.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/browser/process_singleton.h"
 #include "content/public/browser/browser_child_process_observer.h"
@@ -41,6 +42,8 @@ class Arguments;
 
 namespace atom {
 
+class LongTaskWatchdog;
+
 #if defined(OS_WIN)
 enum class JumpListResult : int;
 #endif
@@ -196,6 +199,14 @@ class App : public AtomBrowserClient::Delegate,
   void GetFileIcon(const base::FilePath& path, mate::Arguments* args);
 
   std::vector<mate::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  v8::Local<v8::Value> GetAllocatorStats(v8::Isolate* isolate);
+  void ReleaseFreeMemory();
+  void NotifyMemoryPressure(const std::string& level, mate::Arguments* args);
+  v8::Local<v8::Value> GetIPCMetrics(v8::Isolate* isolate);
+  void StartLongTaskMonitoring(mate::Arguments* args);
+  void StopLongTaskMonitoring();
+  v8::Local<v8::Value> GetLongTaskMetrics(v8::Isolate* isolate);
+  mate::Dictionary GetStartupTimings(v8::Isolate* isolate);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   void EnableMixedSandbox(mate::Arguments* args);
 
@@ -216,8 +227,14 @@ class App : public AtomBrowserClient::Delegate,
   JumpListResult SetJumpList(v8::Local<v8::Value> val, mate::Arguments* args);
 #endif  // defined(OS_WIN)
 
+  // Emits the 'long-task' event for tasks recorded by the watchdog.
+  void OnLongTask(const std::string& location, base::TimeDelta duration);
+
   std::unique_ptr<ProcessSingleton> process_singleton_;
 
+  // Created lazily by startLongTaskMonitoring().
+  std::unique_ptr<LongTaskWatchdog> long_task_watchdog_;
+
 #if defined(USE_NSS_CERTS)
   std::unique_ptr<CertificateManagerModel> certificate_manager_model_;
 #endif
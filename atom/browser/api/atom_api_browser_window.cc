@@ -232,7 +232,30 @@ void BrowserWindow::OnCloseButtonClicked(bool* prevent_default) {
     web_contents()->Close();
 }
 
+void BrowserWindow::OnWindowShow() {
+  hidden_gc_timer_.Stop();
+  api_web_contents_->SetBackgroundPriority(false);
+  TopLevelWindow::OnWindowShow();
+}
+
+void BrowserWindow::OnWindowHide() {
+  // Demote the renderer so this window does not compete for CPU with the
+  // visible ones; windows that opted out of background throttling keep
+  // their priority.
+  if (api_web_contents_->background_throttling())
+    api_web_contents_->SetBackgroundPriority(true);
+  int timeout = Browser::Get()->hidden_window_gc_timeout();
+  if (timeout > 0) {
+    hidden_gc_timer_.Start(
+        FROM_HERE, base::TimeDelta::FromSeconds(timeout),
+        base::Bind(&BrowserWindow::OnHiddenWindowGCTimeout,
+                   base::Unretained(this)));
+  }
+  TopLevelWindow::OnWindowHide();
+}
+
 void BrowserWindow::OnWindowClosed() {
+  hidden_gc_timer_.Stop();
   Cleanup();
   TopLevelWindow::OnWindowClosed();
 }
@@ -262,6 +285,21 @@ void BrowserWindow::OnWindowFocus() {
   TopLevelWindow::OnWindowFocus();
 }
 
+void BrowserWindow::OnWindowOcclusionChange(bool occluded) {
+  // Stop rastering and throttle timers while nobody can see the page,
+  // unless the app opted out with backgroundThrottling: false.
+  // Offscreen contents manage their own visibility.
+  if (web_contents() && api_web_contents_->background_throttling() &&
+      !api_web_contents_->IsOffScreen()) {
+    if (occluded)
+      web_contents()->WasOccluded();
+    else
+      web_contents()->WasShown();
+  }
+
+  TopLevelWindow::OnWindowOcclusionChange(occluded);
+}
+
 void BrowserWindow::OnWindowResize() {
 #if defined(OS_MACOSX)
   if (!draggable_regions_.empty())
@@ -373,6 +411,13 @@ void BrowserWindow::NotifyWindowUnresponsive() {
   }
 }
 
+void BrowserWindow::OnHiddenWindowGCTimeout() {
+  // The window has been hidden long enough; have its renderer collect
+  // as if under critical memory pressure.
+  if (api_web_contents_)
+    api_web_contents_->SendMemoryPressure(true /* critical */);
+}
+
 void BrowserWindow::Cleanup() {
   auto* host = web_contents()->GetRenderViewHost();
   if (host)
@@ -11,6 +11,7 @@
 #include "atom/browser/api/atom_api_top_level_window.h"
 #include "atom/browser/api/atom_api_web_contents.h"
 #include "base/cancelable_callback.h"
+#include "base/timer/timer.h"
 
 namespace atom {
 
@@ -62,9 +63,12 @@ class BrowserWindow : public TopLevelWindow,
   void OnCloseButtonClicked(bool* prevent_default) override;
 
   // TopLevelWindow:
+  void OnWindowShow() override;
+  void OnWindowHide() override;
   void OnWindowClosed() override;
   void OnWindowBlur() override;
   void OnWindowFocus() override;
+  void OnWindowOcclusionChange(bool occluded) override;
   void OnWindowResize() override;
   void OnWindowLeaveFullScreen() override;
   void Focus() override;
@@ -99,10 +103,18 @@ class BrowserWindow : public TopLevelWindow,
   // Cleanup our WebContents observers.
   void Cleanup();
 
+  // Fired by |hidden_gc_timer_| once the window has stayed hidden for the
+  // timeout set with app.setHiddenWindowGCTimeout().
+  void OnHiddenWindowGCTimeout();
+
   // Closure that would be called when window is unresponsive when closing,
   // it should be cancelled when we can prove that the window is responsive.
   base::CancelableClosure window_unresponsive_closure_;
 
+  // Tells the renderer to shed memory after the window stays hidden for a
+  // while; stopped as soon as the window shows again.
+  base::OneShotTimer hidden_gc_timer_;
+
 #if defined(OS_MACOSX)
   std::vector<DraggableRegion> draggable_regions_;
 #endif
@@ -2,15 +2,23 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "base/bind.h"
 #include "base/files/file_util.h"
+#include "base/json/json_writer.h"
+#include "base/macros.h"
+#include "base/task_scheduler/post_task.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/tracing_controller.h"
+#include "native_mate/arguments.h"
 #include "native_mate/dictionary.h"
+#include "third_party/zlib/zlib.h"
 
 #include "atom/common/node_includes.h"
 
@@ -41,21 +49,153 @@ namespace {
 
 using CompletionCallback = base::Callback<void(const base::FilePath&)>;
 
-scoped_refptr<TracingController::TraceDataEndpoint> GetTraceDataEndpoint(
-    const base::FilePath& path,
-    const CompletionCallback& callback) {
+// Writes trace chunks to the result file as they arrive instead of
+// accumulating the whole trace in memory, keeping memory usage flat no
+// matter how long the trace ran. Optionally streams the output through
+// zlib's gzip compressor.
+class StreamingTraceDataEndpoint
+    : public TracingController::TraceDataEndpoint {
+ public:
+  StreamingTraceDataEndpoint(const base::FilePath& path,
+                             bool compress,
+                             const CompletionCallback& callback)
+      : path_(path),
+        compress_(compress),
+        callback_(callback),
+        task_runner_(base::CreateSequencedTaskRunnerWithTraits(
+            {base::MayBlock(), base::TaskPriority::BACKGROUND})) {}
+
+  // TracingController::TraceDataEndpoint:
+  void ReceiveTraceChunk(std::unique_ptr<std::string> chunk) override {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&StreamingTraceDataEndpoint::WriteChunk,
+                                  this, std::move(chunk)));
+  }
+
+  void ReceiveTraceFinalContents(
+      std::unique_ptr<const base::DictionaryValue> metadata) override {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&StreamingTraceDataEndpoint::Close, this,
+                                  std::move(metadata)));
+  }
+
+ private:
+  ~StreamingTraceDataEndpoint() override = default;
+
+  bool OpenIfNeeded() {
+    if (file_)
+      return true;
+    if (open_failed_)
+      return false;
+    file_ = base::OpenFile(path_, "wb");
+    if (!file_) {
+      LOG(ERROR) << "Failed to open trace file " << path_.value();
+      open_failed_ = true;
+      return false;
+    }
+    if (compress_) {
+      memset(&stream_, 0, sizeof(stream_));
+      // 16 + MAX_WBITS makes zlib emit a gzip wrapper instead of a raw
+      // deflate stream.
+      if (deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
+                       16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        compress_ = false;
+    }
+    const char kPreamble[] = "{\"traceEvents\":[";
+    Write(kPreamble, sizeof(kPreamble) - 1);
+    return true;
+  }
+
+  void WriteChunk(std::unique_ptr<std::string> chunk) {
+    if (!OpenIfNeeded())
+      return;
+    if (had_chunk_)
+      Write(",", 1);
+    had_chunk_ = true;
+    Write(chunk->data(), chunk->size());
+  }
+
+  void Write(const char* data, size_t size) {
+    if (!compress_) {
+      ignore_result(fwrite(data, 1, size, file_));
+      return;
+    }
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream_.avail_in = size;
+    Deflate(Z_NO_FLUSH);
+  }
+
+  void Deflate(int flush) {
+    char buffer[16 * 1024];
+    do {
+      stream_.next_out = reinterpret_cast<Bytef*>(buffer);
+      stream_.avail_out = sizeof(buffer);
+      deflate(&stream_, flush);
+      size_t produced = sizeof(buffer) - stream_.avail_out;
+      if (produced > 0)
+        ignore_result(fwrite(buffer, 1, produced, file_));
+    } while (stream_.avail_out == 0);
+  }
+
+  void Close(std::unique_ptr<const base::DictionaryValue> metadata) {
+    if (OpenIfNeeded()) {
+      Write("]", 1);
+      if (metadata) {
+        std::string json;
+        base::JSONWriter::Write(*metadata, &json);
+        const char kMetadataKey[] = ",\"metadata\":";
+        Write(kMetadataKey, sizeof(kMetadataKey) - 1);
+        Write(json.data(), json.size());
+      }
+      Write("}", 1);
+      if (compress_) {
+        stream_.next_in = nullptr;
+        stream_.avail_in = 0;
+        Deflate(Z_FINISH);
+        deflateEnd(&stream_);
+      }
+      base::CloseFile(file_);
+      file_ = nullptr;
+    }
+    content::BrowserThread::PostTask(content::BrowserThread::UI, FROM_HERE,
+                                     base::BindOnce(callback_, path_));
+  }
+
+  const base::FilePath path_;
+  bool compress_;
+  CompletionCallback callback_;
+  FILE* file_ = nullptr;
+  bool open_failed_ = false;
+  bool had_chunk_ = false;
+  z_stream stream_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamingTraceDataEndpoint);
+};
+
+void StopRecording(mate::Arguments* args) {
+  // stopRecording(resultFilePath[, options], callback)
+  base::FilePath path;
+  args->GetNext(&path);
+  bool compress = false;
+  CompletionCallback callback;
+  if (!args->GetNext(&callback)) {
+    mate::Dictionary options;
+    if (args->GetNext(&options))
+      options.Get("compress", &compress);
+    args->GetNext(&callback);
+  }
+  if (callback.is_null()) {
+    args->ThrowError();
+    return;
+  }
+
   base::FilePath result_file_path = path;
   if (result_file_path.empty() && !base::CreateTemporaryFile(&result_file_path))
     LOG(ERROR) << "Creating temporary file failed";
 
-  return TracingController::CreateFileEndpoint(
-      result_file_path, base::Bind(callback, result_file_path));
-}
-
-void StopRecording(const base::FilePath& path,
-                   const CompletionCallback& callback) {
-  TracingController::GetInstance()->StopTracing(
-      GetTraceDataEndpoint(path, callback));
+  TracingController::GetInstance()->StopTracing(new StreamingTraceDataEndpoint(
+      result_file_path, compress, callback));
 }
 
 void Initialize(v8::Local<v8::Object> exports,
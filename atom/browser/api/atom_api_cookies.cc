@@ -4,14 +4,19 @@
 
 #include "atom/browser/api/atom_api_cookies.h"
 
+#include <utility>
+#include <vector>
+
 #include "atom/browser/atom_browser_context.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_thread.h"
+#include "native_mate/arguments.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
 #include "net/cookies/canonical_cookie.h"
@@ -76,6 +81,19 @@ struct Converter<net::CookieChangeCause> {
   }
 };
 
+template <>
+struct Converter<atom::api::Cookies::ChangedCookie> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      const atom::api::Cookies::ChangedCookie& val) {
+    mate::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("cookie", val.cookie);
+    dict.Set("cause", val.cause);
+    dict.Set("removed", val.removed);
+    return dict.GetHandle();
+  }
+};
+
 }  // namespace mate
 
 namespace atom {
@@ -186,10 +204,12 @@ void FlushCookieStoreOnIOThread(
   GetCookieStore(getter)->FlushStore(base::BindOnce(RunCallbackInUI, callback));
 }
 
-// Sets cookie with |details| in IO thread.
-void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
-                   std::unique_ptr<base::DictionaryValue> details,
-                   const Cookies::SetCallback& callback) {
+// Sets one cookie described by |details| in |store|, invoking
+// |completion_callback| with whether it succeeded. |details| is only read
+// before the asynchronous store call is issued.
+void SetCookieInStore(net::CookieStore* store,
+                      const base::DictionaryValue* details,
+                      base::OnceCallback<void(bool)> completion_callback) {
   std::string url, name, value, domain, path;
   bool secure = false;
   bool http_only = false;
@@ -230,7 +250,6 @@ void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
           GURL(url), name, value, domain, path, creation_time, expiration_time,
           last_access_time, secure, http_only,
           net::CookieSameSite::DEFAULT_MODE, net::COOKIE_PRIORITY_DEFAULT));
-  auto completion_callback = base::BindOnce(OnSetCookie, callback);
   if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
     std::move(completion_callback).Run(false);
     return;
@@ -243,15 +262,112 @@ void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
     std::move(completion_callback).Run(false);
     return;
   }
-  GetCookieStore(getter)->SetCanonicalCookieAsync(
-      std::move(canonical_cookie), secure, http_only,
-      std::move(completion_callback));
+  store->SetCanonicalCookieAsync(std::move(canonical_cookie), secure,
+                                 http_only, std::move(completion_callback));
+}
+
+// Sets cookie with |details| in IO thread.
+void SetCookieOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                   std::unique_ptr<base::DictionaryValue> details,
+                   const Cookies::SetCallback& callback) {
+  SetCookieInStore(GetCookieStore(getter), details.get(),
+                   base::BindOnce(OnSetCookie, callback));
+}
+
+// Tracks completion of a batch of SetCookieInStore calls and fires the JS
+// callback once, after the last one. Owned by its own completion callbacks;
+// deleted when the last one runs.
+struct BatchSetContext {
+  int remaining;
+  bool failed = false;
+  Cookies::SetCallback callback;
+};
+
+void OnBatchSetCookie(BatchSetContext* context, bool success) {
+  if (!success)
+    context->failed = true;
+  if (--context->remaining == 0) {
+    RunCallbackInUI(base::Bind(
+        context->callback, context->failed ? Cookies::FAILED : Cookies::SUCCESS));
+    delete context;
+  }
+}
+
+// Sets every cookie of |details_list| in IO thread with a single hop from
+// the UI thread, running |callback| once after the last store write.
+void SetManyCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                        std::unique_ptr<base::ListValue> details_list,
+                        const Cookies::SetCallback& callback) {
+  auto* context = new BatchSetContext;
+  context->remaining = static_cast<int>(details_list->GetSize());
+  context->callback = callback;
+  if (context->remaining == 0) {
+    RunCallbackInUI(base::Bind(callback, Cookies::SUCCESS));
+    delete context;
+    return;
+  }
+
+  net::CookieStore* store = GetCookieStore(getter);
+  for (size_t i = 0; i < details_list->GetSize(); ++i) {
+    const base::DictionaryValue* details = nullptr;
+    if (!details_list->GetDictionary(i, &details)) {
+      OnBatchSetCookie(context, false);
+      continue;
+    }
+    SetCookieInStore(store, details,
+                     base::BindOnce(OnBatchSetCookie, context));
+  }
+}
+
+// Applies each filter of |filters| to the single cookie list fetched from
+// the store, and passes the per-filter results to |callback|.
+void FilterCookiesForMany(std::unique_ptr<base::ListValue> filters,
+                          const Cookies::GetManyCallback& callback,
+                          const net::CookieList& list) {
+  std::vector<net::CookieList> results(filters->GetSize());
+  for (size_t i = 0; i < filters->GetSize(); ++i) {
+    base::DictionaryValue* filter = nullptr;
+    if (!filters->GetDictionary(i, &filter))
+      continue;
+    // Approximate the per-URL store query of get() by matching against the
+    // URL's host, so one GetAllCookiesAsync call serves the whole batch.
+    std::string url;
+    if (filter->GetString("url", &url) && !filter->HasKey("domain"))
+      filter->SetString("domain", GURL(url).host());
+    for (const auto& cookie : list) {
+      if (MatchesCookie(filter, cookie))
+        results[i].push_back(cookie);
+    }
+  }
+  RunCallbackInUI(base::Bind(callback, Cookies::SUCCESS, results));
+}
+
+// Receives cookies matching each filter of |filters| in IO thread with a
+// single cookie store query.
+void GetManyCookiesOnIO(scoped_refptr<net::URLRequestContextGetter> getter,
+                        std::unique_ptr<base::ListValue> filters,
+                        const Cookies::GetManyCallback& callback) {
+  GetCookieStore(getter)->GetAllCookiesAsync(
+      base::Bind(FilterCookiesForMany, base::Passed(&filters), callback));
+}
+
+// Runs every queued write-behind callback with the batch result.
+void RunBatchedSetCallbacks(const std::vector<Cookies::SetCallback>& callbacks,
+                            Cookies::Error error) {
+  for (const auto& callback : callbacks) {
+    if (!callback.is_null())
+      callback.Run(error);
+  }
 }
 
+// Write-behind defaults.
+const int kDefaultWriteBehindIntervalMs = 100;
+const size_t kDefaultWriteBehindMaxPending = 512;
+
 }  // namespace
 
 Cookies::Cookies(v8::Isolate* isolate, AtomBrowserContext* browser_context)
-    : browser_context_(browser_context) {
+    : browser_context_(browser_context), weak_factory_(this) {
   Init(isolate);
   auto subscription = browser_context->RegisterCookieChangeCallback(
       base::Bind(&Cookies::OnCookieChanged, base::Unretained(this)));
@@ -270,6 +386,16 @@ void Cookies::Get(const base::DictionaryValue& filter,
                      std::move(copied), callback));
 }
 
+void Cookies::GetMany(const base::ListValue& filters,
+                      const GetManyCallback& callback) {
+  std::unique_ptr<base::ListValue> copied(filters.CreateDeepCopy());
+  auto* getter = browser_context_->GetRequestContext();
+  content::BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(GetManyCookiesOnIO, base::RetainedRef(getter),
+                     std::move(copied), callback));
+}
+
 void Cookies::Remove(const GURL& url,
                      const std::string& name,
                      const base::Closure& callback) {
@@ -283,6 +409,23 @@ void Cookies::Remove(const GURL& url,
 void Cookies::Set(const base::DictionaryValue& details,
                   const SetCallback& callback) {
   std::unique_ptr<base::DictionaryValue> copied(details.CreateDeepCopy());
+
+  if (write_behind_enabled_) {
+    pending_sets_->Append(std::move(copied));
+    pending_set_callbacks_.push_back(callback);
+    if (pending_sets_->GetSize() >= write_behind_max_pending_) {
+      FlushWriteBehind();
+    } else if (!write_behind_flush_scheduled_) {
+      write_behind_flush_scheduled_ = true;
+      base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+          FROM_HERE,
+          base::BindOnce(&Cookies::FlushWriteBehind,
+                         weak_factory_.GetWeakPtr()),
+          write_behind_interval_);
+    }
+    return;
+  }
+
   auto* getter = browser_context_->GetRequestContext();
   content::BrowserThread::PostTask(
       BrowserThread::IO, FROM_HERE,
@@ -290,7 +433,21 @@ void Cookies::Set(const base::DictionaryValue& details,
                      std::move(copied), callback));
 }
 
+void Cookies::SetMany(const base::ListValue& details_list,
+                      const SetCallback& callback) {
+  std::unique_ptr<base::ListValue> copied(details_list.CreateDeepCopy());
+  auto* getter = browser_context_->GetRequestContext();
+  content::BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(SetManyCookiesOnIO, base::RetainedRef(getter),
+                     std::move(copied), callback));
+}
+
 void Cookies::FlushStore(const base::Closure& callback) {
+  // Drain queued write-behind mutations first; the cookie store processes
+  // its tasks in order, so the flush below covers them.
+  FlushWriteBehind();
+
   auto* getter = browser_context_->GetRequestContext();
   content::BrowserThread::PostTask(
       BrowserThread::IO, FROM_HERE,
@@ -298,8 +455,73 @@ void Cookies::FlushStore(const base::Closure& callback) {
                      callback));
 }
 
+void Cookies::SetWriteBehind(mate::Arguments* args) {
+  bool enabled = false;
+  if (!args->GetNext(&enabled)) {
+    args->ThrowError("enabled must be a boolean");
+    return;
+  }
+
+  int interval_ms = kDefaultWriteBehindIntervalMs;
+  int max_pending = static_cast<int>(kDefaultWriteBehindMaxPending);
+  mate::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("intervalMs", &interval_ms);
+    options.Get("maxPending", &max_pending);
+  }
+  if (interval_ms <= 0 || max_pending <= 0) {
+    args->ThrowError("intervalMs and maxPending must be positive");
+    return;
+  }
+
+  // Turning the mode off (or re-configuring) delivers what is queued.
+  FlushWriteBehind();
+
+  write_behind_enabled_ = enabled;
+  write_behind_interval_ = base::TimeDelta::FromMilliseconds(interval_ms);
+  write_behind_max_pending_ = static_cast<size_t>(max_pending);
+  if (enabled && !pending_sets_)
+    pending_sets_.reset(new base::ListValue);
+}
+
+void Cookies::FlushWriteBehind() {
+  write_behind_flush_scheduled_ = false;
+  if (!pending_sets_ || pending_sets_->empty())
+    return;
+
+  std::unique_ptr<base::ListValue> batch = std::move(pending_sets_);
+  pending_sets_.reset(new base::ListValue);
+  std::vector<SetCallback> callbacks;
+  callbacks.swap(pending_set_callbacks_);
+
+  auto* getter = browser_context_->GetRequestContext();
+  content::BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(SetManyCookiesOnIO, base::RetainedRef(getter),
+                     std::move(batch),
+                     base::Bind(RunBatchedSetCallbacks, callbacks)));
+}
+
 void Cookies::OnCookieChanged(const CookieDetails* details) {
   Emit("changed", *(details->cookie), details->cause, details->removed);
+
+  // Also coalesce every change arriving in this loop iteration into one
+  // "changed-batch" event, so bulk mutations (e.g. restoring a few thousand
+  // cookies at login) do not fan out into as many individual emits for
+  // listeners that can process them in one go.
+  pending_changes_.push_back(
+      {*(details->cookie), details->cause, details->removed});
+  if (pending_changes_.size() == 1) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(&Cookies::EmitChangedBatch,
+                                  weak_factory_.GetWeakPtr()));
+  }
+}
+
+void Cookies::EmitChangedBatch() {
+  std::vector<ChangedCookie> changes;
+  changes.swap(pending_changes_);
+  Emit("changed-batch", changes);
 }
 
 // static
@@ -314,8 +536,11 @@ void Cookies::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(mate::StringToV8(isolate, "Cookies"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("get", &Cookies::Get)
+      .SetMethod("getMany", &Cookies::GetMany)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
+      .SetMethod("setMany", &Cookies::SetMany)
+      .SetMethod("setWriteBehind", &Cookies::SetWriteBehind)
       .SetMethod("flushStore", &Cookies::FlushStore);
 }
 
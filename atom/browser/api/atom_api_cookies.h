@@ -5,17 +5,26 @@
 #ifndef ATOM_BROWSER_API_ATOM_API_COOKIES_H_
 #define ATOM_BROWSER_API_ATOM_API_COOKIES_H_
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/net/cookie_details.h"
 #include "base/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "native_mate/handle.h"
 #include "net/cookies/canonical_cookie.h"
 
+namespace mate {
+class Arguments;
+}  // namespace mate
+
 namespace base {
 class DictionaryValue;
-}
+class ListValue;
+}  // namespace base
 
 namespace net {
 class URLRequestContextGetter;
@@ -35,8 +44,17 @@ class Cookies : public mate::TrackableObject<Cookies> {
   };
 
   using GetCallback = base::Callback<void(Error, const net::CookieList&)>;
+  using GetManyCallback =
+      base::Callback<void(Error, const std::vector<net::CookieList>&)>;
   using SetCallback = base::Callback<void(Error)>;
 
+  // One entry of the coalesced "changed-batch" event.
+  struct ChangedCookie {
+    net::CanonicalCookie cookie;
+    net::CookieChangeCause cause;
+    bool removed;
+  };
+
   static mate::Handle<Cookies> Create(v8::Isolate* isolate,
                                       AtomBrowserContext* browser_context);
 
@@ -49,18 +67,45 @@ class Cookies : public mate::TrackableObject<Cookies> {
   ~Cookies() override;
 
   void Get(const base::DictionaryValue& filter, const GetCallback& callback);
+  void GetMany(const base::ListValue& filters, const GetManyCallback& callback);
   void Remove(const GURL& url,
               const std::string& name,
               const base::Closure& callback);
   void Set(const base::DictionaryValue& details, const SetCallback& callback);
+  void SetMany(const base::ListValue& details_list,
+               const SetCallback& callback);
   void FlushStore(const base::Closure& callback);
+  void SetWriteBehind(mate::Arguments* args);
 
   // AtomBrowserContext::RegisterCookieChangeCallback subscription:
   void OnCookieChanged(const CookieDetails*);
 
  private:
+  // Emits the changes buffered during the current loop iteration as a single
+  // "changed-batch" event.
+  void EmitChangedBatch();
+
+  // Sends the queued write-behind mutations to the cookie store as one
+  // batch.
+  void FlushWriteBehind();
+
   scoped_refptr<AtomBrowserContext> browser_context_;
 
+  // Changes accumulated since the last "changed-batch" emit.
+  std::vector<ChangedCookie> pending_changes_;
+
+  // Write-behind state: while enabled, set() mutations are queued here and
+  // flushed as one batch every interval or once the queue reaches the
+  // mutation cap, whichever comes first.
+  bool write_behind_enabled_ = false;
+  base::TimeDelta write_behind_interval_;
+  size_t write_behind_max_pending_ = 0;
+  std::unique_ptr<base::ListValue> pending_sets_;
+  std::vector<SetCallback> pending_set_callbacks_;
+  bool write_behind_flush_scheduled_ = false;
+
+  base::WeakPtrFactory<Cookies> weak_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(Cookies);
 };
 
@@ -4,7 +4,10 @@
 
 #include "atom/browser/api/atom_api_debugger.h"
 
+#include <stdlib.h>
+
 #include <string>
+#include <vector>
 
 #include "atom/browser/atom_browser_main_parts.h"
 #include "atom/common/native_mate_converters/callback.h"
@@ -12,6 +15,9 @@
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/memory/ptr_util.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "content/public/browser/devtools_agent_host.h"
 #include "content/public/browser/web_contents.h"
 #include "native_mate/dictionary.h"
@@ -26,7 +32,7 @@ namespace atom {
 namespace api {
 
 Debugger::Debugger(v8::Isolate* isolate, content::WebContents* web_contents)
-    : web_contents_(web_contents) {
+    : web_contents_(web_contents), weak_ptr_factory_(this) {
   Init(isolate);
 }
 
@@ -41,6 +47,29 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
                                        const std::string& message) {
   DCHECK(agent_host == agent_host_.get());
 
+  // Fast paths that route on the leading bytes of the serialized message,
+  // so CDP-heavy tooling does not pay a JSON parse per message: batched
+  // events are queued raw, and responses to raw commands are handed back
+  // as the raw string.
+  if (message_batching_ &&
+      base::StartsWith(message, "{\"method\":", base::CompareCase::SENSITIVE)) {
+    QueueProtocolEvent(message);
+    return;
+  }
+  if (!pending_raw_requests_.empty() &&
+      base::StartsWith(message, "{\"id\":", base::CompareCase::SENSITIVE)) {
+    int id = strtol(message.c_str() + 6, nullptr, 10);
+    auto raw_iter = pending_raw_requests_.find(id);
+    if (raw_iter != pending_raw_requests_.end()) {
+      SendRawCommandCallback callback = raw_iter->second;
+      pending_raw_requests_.erase(raw_iter);
+      v8::Locker locker(isolate());
+      v8::HandleScope handle_scope(isolate());
+      callback.Run(message);
+      return;
+    }
+  }
+
   v8::Locker locker(isolate());
   v8::HandleScope handle_scope(isolate());
 
@@ -54,12 +83,25 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
     std::string method;
     if (!dict->GetString("method", &method))
       return;
+    if (message_batching_) {
+      // Events that did not match the serialized fast path above still get
+      // batched, just with the parse already paid.
+      QueueProtocolEvent(message);
+      return;
+    }
     base::DictionaryValue* params_value = nullptr;
     base::DictionaryValue params;
     if (dict->GetDictionary("params", &params_value))
       params.Swap(params_value);
     Emit("message", method, params);
   } else {
+    auto raw_iter = pending_raw_requests_.find(id);
+    if (raw_iter != pending_raw_requests_.end()) {
+      SendRawCommandCallback callback = raw_iter->second;
+      pending_raw_requests_.erase(raw_iter);
+      callback.Run(message);
+      return;
+    }
     auto send_command_callback = pending_requests_[id];
     pending_requests_.erase(id);
     if (send_command_callback.is_null())
@@ -138,6 +180,64 @@ void Debugger::SendCommand(mate::Arguments* args) {
   agent_host_->DispatchProtocolMessage(this, json_args);
 }
 
+void Debugger::SendRawCommand(mate::Arguments* args) {
+  if (!agent_host_.get())
+    return;
+
+  std::string method;
+  if (!args->GetNext(&method) ||
+      method.find_first_of("\"\\") != std::string::npos) {
+    args->ThrowError();
+    return;
+  }
+  SendRawCommandCallback callback;
+  std::string params_json;
+  // The parameters are an already serialized JSON object; try the callback
+  // first so sendRawCommand(method, callback) works too.
+  if (!args->GetNext(&callback)) {
+    args->GetNext(&params_json);
+    args->GetNext(&callback);
+  }
+
+  int request_id = ++previous_request_id_;
+  if (!callback.is_null())
+    pending_raw_requests_[request_id] = callback;
+
+  // The request is assembled by concatenation, so neither the parameters
+  // nor the response are ever parsed or re-serialized in the browser.
+  std::string request = base::StringPrintf("{\"id\":%d,\"method\":\"%s\"",
+                                           request_id, method.c_str());
+  if (!params_json.empty()) {
+    request += ",\"params\":";
+    request += params_json;
+  }
+  request += "}";
+  agent_host_->DispatchProtocolMessage(this, request);
+}
+
+void Debugger::SetMessageBatching(bool enabled) {
+  message_batching_ = enabled;
+  if (!enabled)
+    FlushPendingEvents();
+}
+
+void Debugger::QueueProtocolEvent(const std::string& message) {
+  pending_events_.push_back(message);
+  if (pending_events_.size() > 1)
+    return;  // A flush is already scheduled.
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::Bind(&Debugger::FlushPendingEvents,
+                            weak_ptr_factory_.GetWeakPtr()));
+}
+
+void Debugger::FlushPendingEvents() {
+  if (pending_events_.empty())
+    return;
+  std::vector<std::string> events;
+  events.swap(pending_events_);
+  Emit("messages", events);
+}
+
 // static
 mate::Handle<Debugger> Debugger::Create(v8::Isolate* isolate,
                                         content::WebContents* web_contents) {
@@ -152,7 +252,9 @@ void Debugger::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("attach", &Debugger::Attach)
       .SetMethod("isAttached", &Debugger::IsAttached)
       .SetMethod("detach", &Debugger::Detach)
-      .SetMethod("sendCommand", &Debugger::SendCommand);
+      .SetMethod("sendCommand", &Debugger::SendCommand)
+      .SetMethod("sendRawCommand", &Debugger::SendRawCommand)
+      .SetMethod("setMessageBatching", &Debugger::SetMessageBatching);
 }
 
 }  // namespace api
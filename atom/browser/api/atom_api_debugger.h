@@ -7,9 +7,11 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/trackable_object.h"
 #include "base/callback.h"
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "content/public/browser/devtools_agent_host_client.h"
 #include "native_mate/handle.h"
@@ -33,6 +35,7 @@ class Debugger : public mate::TrackableObject<Debugger>,
   using SendCommandCallback =
       base::Callback<void(const base::DictionaryValue&,
                           const base::DictionaryValue&)>;
+  using SendRawCommandCallback = base::Callback<void(const std::string&)>;
 
   static mate::Handle<Debugger> Create(v8::Isolate* isolate,
                                        content::WebContents* web_contents);
@@ -57,13 +60,29 @@ class Debugger : public mate::TrackableObject<Debugger>,
   bool IsAttached();
   void Detach();
   void SendCommand(mate::Arguments* args);
+  void SendRawCommand(mate::Arguments* args);
+  void SetMessageBatching(bool enabled);
+
+  // Queue a protocol event for batched delivery, scheduling a flush for
+  // the current loop iteration when the queue was empty.
+  void QueueProtocolEvent(const std::string& message);
+  void FlushPendingEvents();
 
   content::WebContents* web_contents_;  // Weak Reference.
   scoped_refptr<content::DevToolsAgentHost> agent_host_;
 
   PendingRequestMap pending_requests_;
+  std::map<int, SendRawCommandCallback> pending_raw_requests_;
   int previous_request_id_ = 0;
 
+  // When true, protocol events are delivered as raw JSON strings in one
+  // "messages" emission per loop iteration instead of a converted
+  // "message" emission per event.
+  bool message_batching_ = false;
+  std::vector<std::string> pending_events_;
+
+  base::WeakPtrFactory<Debugger> weak_ptr_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(Debugger);
 };
 
@@ -56,6 +56,11 @@ void EmitFinished(
   cap->Emit("finished", sources);
 }
 
+void EmitSourceReady(const atom::api::DesktopCapturer::Source& source,
+                     atom::api::DesktopCapturer* cap) {
+  cap->Emit("source-thumbnail-ready", source);
+}
+
 void StartHandlingTask(bool capture_window,
                        bool capture_screen,
                        const gfx::Size& thumbnail_size,
@@ -159,7 +164,22 @@ void DesktopCapturer::OnSourceMoved(int old_index, int new_index) {}
 
 void DesktopCapturer::OnSourceNameChanged(int index) {}
 
-void DesktopCapturer::OnSourceThumbnailChanged(int index) {}
+void DesktopCapturer::OnSourceThumbnailChanged(int index) {
+  // Called on |capture_thread_| as each source's thumbnail is captured;
+  // stream the source out right away instead of sitting on it until the
+  // whole refresh finishes.
+  Source source{media_list_->GetSource(index), std::string()};
+#if defined(OS_MACOSX)
+  if (source.media_list_source.id.type ==
+      content::DesktopMediaID::TYPE_SCREEN) {
+    source.display_id = base::Int64ToString(source.media_list_source.id.id);
+  }
+#endif  // defined(OS_MACOSX)
+  // On Windows the DirectX display id association is only available once the
+  // whole refresh is done; the "finished" result carries it.
+  content::BrowserThread::PostTask(content::BrowserThread::UI, FROM_HERE,
+                                   base::Bind(EmitSourceReady, source, this));
+}
 
 bool DesktopCapturer::OnRefreshFinished() {
   capture_thread_->PostTask(FROM_HERE,
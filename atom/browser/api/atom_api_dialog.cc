@@ -2,6 +2,8 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -15,6 +17,8 @@
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/image_converter.h"
 #include "atom/common/native_mate_converters/net_converter.h"
+#include "base/bind.h"
+#include "base/task_scheduler/post_task.h"
 #include "native_mate/dictionary.h"
 
 #include "atom/common/node_includes.h"
@@ -94,6 +98,83 @@ void ShowMessageBox(int type,
   }
 }
 
+// Streaming open dialog results. A huge multi-selection (e.g. 50k files
+// on a network share) would otherwise be converted into one giant V8
+// array in a single UI-thread task; instead the result paths are sliced
+// into batches, converted to UTF-8 on the worker pool, and delivered to
+// the callback one batch at a time so the UI thread only ever builds a
+// small array per task.
+const size_t kOpenDialogStreamBatchSize = 1024;
+
+// callback(result, paths, done)
+typedef base::Callback<
+    void(bool result, const std::vector<std::string>& paths, bool done)>
+    StreamOpenDialogCallback;
+
+std::vector<std::string> ConvertPathBatch(
+    const std::vector<base::FilePath>& paths,
+    size_t offset,
+    size_t count) {
+  std::vector<std::string> converted;
+  converted.reserve(count);
+  for (size_t i = offset; i < offset + count; ++i)
+    converted.push_back(paths[i].AsUTF8Unsafe());
+  return converted;
+}
+
+void StreamNextBatch(const StreamOpenDialogCallback& callback,
+                     std::shared_ptr<std::vector<base::FilePath>> paths,
+                     size_t offset);
+
+void DeliverBatch(const StreamOpenDialogCallback& callback,
+                  std::shared_ptr<std::vector<base::FilePath>> paths,
+                  size_t next_offset,
+                  std::vector<std::string> batch) {
+  bool done = next_offset >= paths->size();
+  callback.Run(true, batch, done);
+  if (!done)
+    StreamNextBatch(callback, paths, next_offset);
+}
+
+void StreamNextBatch(const StreamOpenDialogCallback& callback,
+                     std::shared_ptr<std::vector<base::FilePath>> paths,
+                     size_t offset) {
+  size_t count =
+      std::min(kOpenDialogStreamBatchSize, paths->size() - offset);
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::Bind(&ConvertPathBatch, *paths, offset, count),
+      base::Bind(&DeliverBatch, callback, paths, offset + count));
+}
+
+#if defined(MAS_BUILD)
+void OnStreamOpenDialogDone(const StreamOpenDialogCallback& callback,
+                            bool result,
+                            const std::vector<base::FilePath>& paths,
+                            const std::vector<std::string>& bookmarks) {
+#else
+void OnStreamOpenDialogDone(const StreamOpenDialogCallback& callback,
+                            bool result,
+                            const std::vector<base::FilePath>& paths) {
+#endif
+  if (!result) {
+    callback.Run(false, std::vector<std::string>(), true);
+    return;
+  }
+  if (paths.empty()) {
+    callback.Run(true, std::vector<std::string>(), true);
+    return;
+  }
+  StreamNextBatch(callback,
+                  std::make_shared<std::vector<base::FilePath>>(paths), 0);
+}
+
+void ShowOpenDialogStream(const file_dialog::DialogSettings& settings,
+                          const StreamOpenDialogCallback& callback) {
+  file_dialog::ShowOpenDialog(settings,
+                              base::Bind(&OnStreamOpenDialogDone, callback));
+}
+
 void ShowOpenDialog(const file_dialog::DialogSettings& settings,
                     mate::Arguments* args) {
   v8::Local<v8::Value> peek = args->PeekNext();
@@ -130,6 +211,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("showMessageBox", &ShowMessageBox);
   dict.SetMethod("showErrorBox", &atom::ShowErrorBox);
   dict.SetMethod("showOpenDialog", &ShowOpenDialog);
+  dict.SetMethod("showOpenDialogStream", &ShowOpenDialogStream);
   dict.SetMethod("showSaveDialog", &ShowSaveDialog);
 #if defined(OS_MACOSX) || defined(OS_WIN)
   dict.SetMethod("showCertificateTrustDialog",
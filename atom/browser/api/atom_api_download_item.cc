@@ -55,11 +55,18 @@ namespace {
 
 std::map<uint32_t, v8::Global<v8::Object>> g_download_item_objects;
 
+// Default spacing of 'updated' events; roughly one animation frame, which
+// is as often as a progress UI can usefully repaint.
+const int kDefaultUpdateIntervalMs = 16;
+
 }  // namespace
 
 DownloadItem::DownloadItem(v8::Isolate* isolate,
                            download::DownloadItem* download_item)
-    : download_item_(download_item) {
+    : download_item_(download_item),
+      update_interval_(
+          base::TimeDelta::FromMilliseconds(kDefaultUpdateIntervalMs)),
+      weak_ptr_factory_(this) {
   download_item_->AddObserver(this);
   Init(isolate);
   AttachAsUserData(download_item);
@@ -82,9 +89,42 @@ void DownloadItem::OnDownloadUpdated(download::DownloadItem* item) {
     // Destroy the item once item is downloaded.
     base::ThreadTaskRunnerHandle::Get()->PostTask(FROM_HERE,
                                                   GetDestroyClosure());
-  } else {
+    return;
+  }
+
+  if (update_interval_.is_zero()) {
+    Emit("updated", item->GetState());
+    return;
+  }
+
+  // Fast downloads can deliver hundreds of progress notifications a second;
+  // coalesce them so JS sees at most one 'updated' per interval carrying the
+  // latest byte counts.
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (now - last_update_time_ >= update_interval_) {
+    last_update_time_ = now;
     Emit("updated", item->GetState());
+    return;
   }
+
+  if (update_pending_)
+    return;
+
+  update_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&DownloadItem::EmitUpdate,
+                     weak_ptr_factory_.GetWeakPtr()),
+      update_interval_ - (now - last_update_time_));
+}
+
+void DownloadItem::EmitUpdate() {
+  update_pending_ = false;
+  if (!download_item_ || download_item_->IsDone())
+    return;
+
+  last_update_time_ = base::TimeTicks::Now();
+  Emit("updated", download_item_->GetState());
 }
 
 void DownloadItem::OnDownloadDestroyed(download::DownloadItem* download_item) {
@@ -177,6 +217,16 @@ double DownloadItem::GetStartTime() const {
   return download_item_->GetStartTime().ToDoubleT();
 }
 
+int64_t DownloadItem::GetCurrentBytesPerSecond() const {
+  return download_item_->CurrentSpeed();
+}
+
+void DownloadItem::SetUpdateInterval(int interval_ms) {
+  if (interval_ms < 0)
+    interval_ms = 0;
+  update_interval_ = base::TimeDelta::FromMilliseconds(interval_ms);
+}
+
 // static
 void DownloadItem::BuildPrototype(v8::Isolate* isolate,
                                   v8::Local<v8::FunctionTemplate> prototype) {
@@ -202,7 +252,10 @@ void DownloadItem::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("getSavePath", &DownloadItem::GetSavePath)
       .SetMethod("getLastModifiedTime", &DownloadItem::GetLastModifiedTime)
       .SetMethod("getETag", &DownloadItem::GetETag)
-      .SetMethod("getStartTime", &DownloadItem::GetStartTime);
+      .SetMethod("getStartTime", &DownloadItem::GetStartTime)
+      .SetMethod("getCurrentBytesPerSecond",
+                 &DownloadItem::GetCurrentBytesPerSecond)
+      .SetMethod("setUpdateInterval", &DownloadItem::SetUpdateInterval);
 }
 
 // static
@@ -10,6 +10,8 @@
 
 #include "atom/browser/api/trackable_object.h"
 #include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/download/public/common/download_item.h"
 #include "native_mate/handle.h"
 #include "url/gurl.h"
@@ -47,6 +49,8 @@ class DownloadItem : public mate::TrackableObject<DownloadItem>,
   std::string GetLastModifiedTime() const;
   std::string GetETag() const;
   double GetStartTime() const;
+  int64_t GetCurrentBytesPerSecond() const;
+  void SetUpdateInterval(int interval_ms);
 
  protected:
   DownloadItem(v8::Isolate* isolate, download::DownloadItem* download_item);
@@ -57,9 +61,22 @@ class DownloadItem : public mate::TrackableObject<DownloadItem>,
   void OnDownloadDestroyed(download::DownloadItem* download) override;
 
  private:
+  // Emits a coalesced 'updated' event. Progress notifications arriving
+  // faster than |update_interval_| only schedule this; byte counts live in
+  // the native item, so nothing is lost by skipping intermediate events.
+  void EmitUpdate();
+
   base::FilePath save_path_;
   download::DownloadItem* download_item_;
 
+  // Minimum spacing between 'updated' events; zero emits every progress
+  // notification.
+  base::TimeDelta update_interval_;
+  base::TimeTicks last_update_time_;
+  bool update_pending_ = false;
+
+  base::WeakPtrFactory<DownloadItem> weak_ptr_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(DownloadItem);
 };
 
@@ -5,7 +5,9 @@
 #include "atom/browser/api/atom_api_global_shortcut.h"
 
 #include <string>
+#include <vector>
 
+#include "atom/browser/ui/accelerator_util.h"
 #include "atom/common/native_mate_converters/accelerator_converter.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "base/stl_util.h"
@@ -49,6 +51,23 @@ bool GlobalShortcut::Register(const ui::Accelerator& accelerator,
   return true;
 }
 
+std::vector<std::string> GlobalShortcut::RegisterAll(
+    const std::vector<std::string>& accelerators,
+    const base::Closure& callback) {
+  std::vector<std::string> failed;
+  for (const std::string& shortcut : accelerators) {
+    ui::Accelerator accelerator;
+    if (!accelerator_util::StringToAccelerator(shortcut, &accelerator) ||
+        !GlobalShortcutListener::GetInstance()->RegisterAccelerator(accelerator,
+                                                                    this)) {
+      failed.push_back(shortcut);
+      continue;
+    }
+    accelerator_callback_map_[accelerator] = callback;
+  }
+  return failed;
+}
+
 void GlobalShortcut::Unregister(const ui::Accelerator& accelerator) {
   if (!ContainsKey(accelerator_callback_map_, accelerator))
     return;
@@ -58,6 +77,15 @@ void GlobalShortcut::Unregister(const ui::Accelerator& accelerator) {
                                                                this);
 }
 
+void GlobalShortcut::UnregisterSome(
+    const std::vector<std::string>& accelerators) {
+  for (const std::string& shortcut : accelerators) {
+    ui::Accelerator accelerator;
+    if (accelerator_util::StringToAccelerator(shortcut, &accelerator))
+      Unregister(accelerator);
+  }
+}
+
 bool GlobalShortcut::IsRegistered(const ui::Accelerator& accelerator) {
   return ContainsKey(accelerator_callback_map_, accelerator);
 }
@@ -78,8 +106,10 @@ void GlobalShortcut::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(mate::StringToV8(isolate, "GlobalShortcut"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("register", &GlobalShortcut::Register)
+      .SetMethod("registerAll", &GlobalShortcut::RegisterAll)
       .SetMethod("isRegistered", &GlobalShortcut::IsRegistered)
       .SetMethod("unregister", &GlobalShortcut::Unregister)
+      .SetMethod("unregisterSome", &GlobalShortcut::UnregisterSome)
       .SetMethod("unregisterAll", &GlobalShortcut::UnregisterAll);
 }
 
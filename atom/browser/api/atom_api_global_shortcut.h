@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/trackable_object.h"
 #include "base/callback.h"
@@ -35,8 +36,15 @@ class GlobalShortcut : public extensions::GlobalShortcutListener::Observer,
 
   bool Register(const ui::Accelerator& accelerator,
                 const base::Closure& callback);
+  // Registers all |accelerators| for |callback| in one native call. Returns
+  // the accelerator strings that could not be parsed or registered.
+  std::vector<std::string> RegisterAll(
+      const std::vector<std::string>& accelerators,
+      const base::Closure& callback);
   bool IsRegistered(const ui::Accelerator& accelerator);
   void Unregister(const ui::Accelerator& accelerator);
+  // Unregisters all |accelerators| in one native call.
+  void UnregisterSome(const std::vector<std::string>& accelerators);
   void UnregisterAll();
 
   // GlobalShortcutListener::Observer implementation.
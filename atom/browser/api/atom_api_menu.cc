@@ -119,6 +119,10 @@ void Menu::InsertSubMenuAt(int index,
   model_->InsertSubMenuAt(index, command_id, label, menu->model_.get());
 }
 
+void Menu::RemoveItemAt(int index) {
+  model_->RemoveItemAt(index);
+}
+
 void Menu::SetIcon(int index, const gfx::Image& image) {
   model_->SetIcon(index, image);
 }
@@ -186,6 +190,7 @@ void Menu::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("insertRadioItem", &Menu::InsertRadioItemAt)
       .SetMethod("insertSeparator", &Menu::InsertSeparatorAt)
       .SetMethod("insertSubMenu", &Menu::InsertSubMenuAt)
+      .SetMethod("removeItem", &Menu::RemoveItemAt)
       .SetMethod("setIcon", &Menu::SetIcon)
       .SetMethod("setSublabel", &Menu::SetSublabel)
       .SetMethod("setRole", &Menu::SetRole)
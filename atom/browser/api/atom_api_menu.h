@@ -82,6 +82,7 @@ class Menu : public mate::TrackableObject<Menu>,
                        int command_id,
                        const base::string16& label,
                        Menu* menu);
+  void RemoveItemAt(int index);
   void SetIcon(int index, const gfx::Image& image);
   void SetSublabel(int index, const base::string16& sublabel);
   void SetRole(int index, const base::string16& role);
@@ -3,14 +3,187 @@
 // found in the LICENSE file.
 
 #include "atom/browser/api/atom_api_net.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "atom/browser/api/atom_api_url_request.h"
-#include "atom/common/node_includes.h"
+#include "atom/browser/atom_browser_context.h"
+#include "atom/common/native_mate_converters/callback.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
+#include "content/public/browser/browser_thread.h"
+#include "native_mate/arguments.h"
 #include "native_mate/dictionary.h"
+#include "net/base/address_list.h"
+#include "net/base/host_port_pair.h"
+#include "net/base/net_errors.h"
+#include "net/dns/host_resolver.h"
+#include "net/log/net_log_with_source.h"
+#include "net/url_request/url_request_context.h"
+#include "net/url_request/url_request_context_getter.h"
+
+#include "atom/common/node_includes.h"
 
 namespace atom {
 
 namespace api {
 
+namespace {
+
+using ResolveHostCallback =
+    base::Callback<void(const std::string& error,
+                        const std::vector<std::string>& addresses)>;
+
+// App-level cache of resolved hosts, living on the UI thread where the
+// net module runs. The browser resolver's own cache still applies
+// underneath; this layer keeps hot service hostnames answerable without
+// an IO-thread round trip, with an expiry the app controls.
+class HostCache {
+ public:
+  static HostCache* GetInstance() {
+    static HostCache* instance = new HostCache;
+    return instance;
+  }
+
+  bool Lookup(const std::string& host, std::vector<std::string>* addresses) {
+    auto iter = entries_.find(host);
+    if (iter == entries_.end() ||
+        iter->second.expires <= base::TimeTicks::Now()) {
+      misses_++;
+      return false;
+    }
+    hits_++;
+    *addresses = iter->second.addresses;
+    return true;
+  }
+
+  void Store(const std::string& host,
+             const std::vector<std::string>& addresses) {
+    if (entries_.size() >= max_entries_ && !entries_.count(host))
+      EvictClosestToExpiry();
+    Entry& entry = entries_[host];
+    entry.addresses = addresses;
+    entry.expires = base::TimeTicks::Now() + ttl_;
+  }
+
+  void Configure(base::TimeDelta ttl, size_t max_entries) {
+    ttl_ = ttl;
+    max_entries_ = max_entries;
+    while (entries_.size() > max_entries_)
+      EvictClosestToExpiry();
+  }
+
+  size_t size() const { return entries_.size(); }
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+  uint32_t evictions() const { return evictions_; }
+
+ private:
+  struct Entry {
+    std::vector<std::string> addresses;
+    base::TimeTicks expires;
+  };
+
+  HostCache() = default;
+
+  void EvictClosestToExpiry() {
+    auto victim = entries_.begin();
+    for (auto iter = entries_.begin(); iter != entries_.end(); ++iter) {
+      if (iter->second.expires < victim->second.expires)
+        victim = iter;
+    }
+    if (victim != entries_.end()) {
+      entries_.erase(victim);
+      evictions_++;
+    }
+  }
+
+  std::map<std::string, Entry> entries_;
+  base::TimeDelta ttl_ = base::TimeDelta::FromSeconds(60);
+  size_t max_entries_ = 256;
+  uint32_t hits_ = 0;
+  uint32_t misses_ = 0;
+  uint32_t evictions_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(HostCache);
+};
+
+// Resolves one host through the browser resolver on the IO thread and
+// reports back on the thread it was created on. Self-deleting, like
+// ResolveProxyHelper in atom_api_session.cc.
+class ResolveHostHelper {
+ public:
+  ResolveHostHelper(AtomBrowserContext* browser_context,
+                    const std::string& host,
+                    const ResolveHostCallback& callback)
+      : callback_(callback),
+        original_thread_(base::ThreadTaskRunnerHandle::Get()) {
+    scoped_refptr<net::URLRequestContextGetter> context_getter =
+        browser_context->url_request_context_getter();
+    context_getter->GetNetworkTaskRunner()->PostTask(
+        FROM_HERE, base::BindOnce(&ResolveHostHelper::Resolve,
+                                  base::Unretained(this), context_getter,
+                                  host));
+  }
+
+  void OnResolved(int result) {
+    std::string error;
+    std::vector<std::string> addresses;
+    if (result == net::OK) {
+      for (const auto& endpoint : address_list_)
+        addresses.push_back(endpoint.ToStringWithoutPort());
+    } else {
+      error = net::ErrorToString(result);
+    }
+    original_thread_->PostTask(FROM_HERE,
+                               base::BindOnce(callback_, error, addresses));
+    delete this;
+  }
+
+ private:
+  void Resolve(scoped_refptr<net::URLRequestContextGetter> context_getter,
+               const std::string& host) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+
+    net::HostResolver* resolver =
+        context_getter->GetURLRequestContext()->host_resolver();
+    net::HostResolver::RequestInfo info(net::HostPortPair(host, 80));
+    net::CompletionCallback completion_callback =
+        base::Bind(&ResolveHostHelper::OnResolved, base::Unretained(this));
+
+    int result =
+        resolver->Resolve(info, net::DEFAULT_PRIORITY, &address_list_,
+                          completion_callback, &request_,
+                          net::NetLogWithSource());
+
+    // Completed synchronously.
+    if (result != net::ERR_IO_PENDING)
+      completion_callback.Run(result);
+  }
+
+  ResolveHostCallback callback_;
+  net::AddressList address_list_;
+  std::unique_ptr<net::HostResolver::Request> request_;
+  scoped_refptr<base::SingleThreadTaskRunner> original_thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(ResolveHostHelper);
+};
+
+void OnHostResolved(const std::string& host,
+                    const ResolveHostCallback& callback,
+                    const std::string& error,
+                    const std::vector<std::string>& addresses) {
+  if (error.empty())
+    HostCache::GetInstance()->Store(host, addresses);
+  if (!callback.is_null())
+    callback.Run(error, addresses);
+}
+
+}  // namespace
+
 Net::Net(v8::Isolate* isolate) {
   Init(isolate);
 }
@@ -27,13 +200,81 @@ void Net::BuildPrototype(v8::Isolate* isolate,
                          v8::Local<v8::FunctionTemplate> prototype) {
   prototype->SetClassName(mate::StringToV8(isolate, "Net"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
-      .SetProperty("URLRequest", &Net::URLRequest);
+      .SetProperty("URLRequest", &Net::URLRequest)
+      .SetMethod("_resolveHost", &Net::ResolveHost)
+      .SetMethod("configureHostResolver", &Net::ConfigureHostResolver)
+      .SetMethod("getHostResolverStats", &Net::GetHostResolverStats);
 }
 
 v8::Local<v8::Value> Net::URLRequest(v8::Isolate* isolate) {
   return URLRequest::GetConstructor(isolate)->GetFunction();
 }
 
+void Net::ResolveHost(mate::Arguments* args) {
+  std::string host;
+  if (!args->GetNext(&host)) {
+    args->ThrowError("host must be a string");
+    return;
+  }
+  ResolveHostCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError("callback must be a function");
+    return;
+  }
+
+  std::vector<std::string> cached;
+  if (HostCache::GetInstance()->Lookup(host, &cached)) {
+    callback.Run("", cached);
+    return;
+  }
+
+  new ResolveHostHelper(AtomBrowserContext::From("", false).get(), host,
+                        base::Bind(&OnHostResolved, host, callback));
+}
+
+void Net::ConfigureHostResolver(mate::Arguments* args) {
+  mate::Dictionary options;
+  if (!args->GetNext(&options)) {
+    args->ThrowError("Must specify options object");
+    return;
+  }
+
+  auto* cache = HostCache::GetInstance();
+
+  int cache_ttl = 0;
+  int max_cache_entries = 0;
+  options.Get("cacheTtl", &cache_ttl);
+  options.Get("maxCacheEntries", &max_cache_entries);
+  if (cache_ttl > 0 || max_cache_entries > 0) {
+    cache->Configure(cache_ttl > 0 ? base::TimeDelta::FromSeconds(cache_ttl)
+                                   : base::TimeDelta::FromSeconds(60),
+                     max_cache_entries > 0
+                         ? static_cast<size_t>(max_cache_entries)
+                         : 256);
+  }
+
+  // Resolve the prewarm list right away, so the first real lookups for
+  // these hosts are already warm in the cache.
+  std::vector<std::string> prewarm;
+  if (options.Get("prewarm", &prewarm)) {
+    for (const std::string& host : prewarm) {
+      new ResolveHostHelper(
+          AtomBrowserContext::From("", false).get(), host,
+          base::Bind(&OnHostResolved, host, ResolveHostCallback()));
+    }
+  }
+}
+
+v8::Local<v8::Value> Net::GetHostResolverStats(v8::Isolate* isolate) {
+  auto* cache = HostCache::GetInstance();
+  mate::Dictionary dict(isolate, v8::Object::New(isolate));
+  dict.Set("size", static_cast<uint32_t>(cache->size()));
+  dict.Set("hits", cache->hits());
+  dict.Set("misses", cache->misses());
+  dict.Set("evictions", cache->evictions());
+  return dict.GetHandle();
+}
+
 }  // namespace api
 
 }  // namespace atom
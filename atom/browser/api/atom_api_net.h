@@ -7,6 +7,10 @@
 
 #include "atom/browser/api/event_emitter.h"
 
+namespace mate {
+class Arguments;
+}
+
 namespace atom {
 
 namespace api {
@@ -20,6 +24,10 @@ class Net : public mate::EventEmitter<Net> {
 
   v8::Local<v8::Value> URLRequest(v8::Isolate* isolate);
 
+  void ResolveHost(mate::Arguments* args);
+  void ConfigureHostResolver(mate::Arguments* args);
+  v8::Local<v8::Value> GetHostResolverStats(v8::Isolate* isolate);
+
  protected:
   explicit Net(v8::Isolate* isolate);
   ~Net() override;
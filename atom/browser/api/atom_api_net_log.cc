@@ -55,6 +55,40 @@ void NetLog::StopLogging(mate::Arguments* args) {
   net_log_->StopDynamicLogging(std::move(callback));
 }
 
+void NetLog::StartRecording(mate::Arguments* args) {
+  int max_events = 65536;
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("maxEvents", &max_events);
+  if (max_events <= 0) {
+    args->ThrowError("maxEvents must be a positive number");
+    return;
+  }
+
+  net_log_->StartRingBufferLogging(static_cast<size_t>(max_events));
+}
+
+bool NetLog::IsRecording() {
+  return net_log_->IsRingBufferLogging();
+}
+
+void NetLog::StopRecording() {
+  net_log_->StopRingBufferLogging();
+}
+
+void NetLog::DumpRecording(mate::Arguments* args) {
+  base::FilePath path;
+  if (!args->GetNext(&path) || path.empty()) {
+    args->ThrowError("The first parameter must be a valid string");
+    return;
+  }
+
+  base::OnceCallback<void(bool)> callback;
+  args->GetNext(&callback);
+
+  net_log_->DumpRingBuffer(path, std::move(callback));
+}
+
 // static
 void NetLog::BuildPrototype(v8::Isolate* isolate,
                             v8::Local<v8::FunctionTemplate> prototype) {
@@ -63,7 +97,11 @@ void NetLog::BuildPrototype(v8::Isolate* isolate,
       .SetProperty("currentlyLogging", &NetLog::IsCurrentlyLogging)
       .SetProperty("currentlyLoggingPath", &NetLog::GetCurrentlyLoggingPath)
       .SetMethod("startLogging", &NetLog::StartLogging)
-      .SetMethod("_stopLogging", &NetLog::StopLogging);
+      .SetMethod("_stopLogging", &NetLog::StopLogging)
+      .SetProperty("recording", &NetLog::IsRecording)
+      .SetMethod("startRecording", &NetLog::StartRecording)
+      .SetMethod("stopRecording", &NetLog::StopRecording)
+      .SetMethod("dumpRecording", &NetLog::DumpRecording);
 }
 
 }  // namespace api
@@ -25,6 +25,13 @@ class NetLog : public mate::Wrappable<NetLog> {
   base::FilePath::StringType GetCurrentlyLoggingPath();
   void StopLogging(mate::Arguments* args);
 
+  // Bounded in-memory capture of recent events (see
+  // brightray::NetLog::StartRingBufferLogging).
+  void StartRecording(mate::Arguments* args);
+  bool IsRecording();
+  void StopRecording();
+  void DumpRecording(mate::Arguments* args);
+
  protected:
   explicit NetLog(v8::Isolate* isolate);
   ~NetLog() override;
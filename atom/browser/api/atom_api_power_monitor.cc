@@ -4,10 +4,14 @@
 
 #include "atom/browser/api/atom_api_power_monitor.h"
 
+#include <vector>
+
 #include "atom/browser/browser.h"
 #include "atom/common/native_mate_converters/callback.h"
+#include "base/lazy_instance.h"
 #include "base/power_monitor/power_monitor.h"
 #include "base/power_monitor/power_monitor_device_source.h"
+#include "native_mate/arguments.h"
 #include "native_mate/dictionary.h"
 
 #include "atom/common/node_includes.h"
@@ -36,6 +40,40 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+// How long an idle-time answer stays valid. Presence features in several
+// windows poll every few seconds; queries inside the window share one
+// platform call.
+const int kIdleTimeCacheMs = 1000;
+
+// Process-wide cache of the last platform idle-time answer, plus the
+// callbacks waiting for an in-flight query so concurrent callers
+// coalesce into a single platform call.
+struct IdleTimeCache {
+  base::TimeTicks fetched;
+  int idle_time = 0;  // seconds
+  bool query_in_flight = false;
+  std::vector<ui::IdleTimeCallback> pending;
+};
+
+base::LazyInstance<IdleTimeCache>::Leaky g_idle_time_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+void OnIdleTimeFetched(int idle_time) {
+  IdleTimeCache* cache = g_idle_time_cache.Pointer();
+  cache->fetched = base::TimeTicks::Now();
+  cache->idle_time = idle_time;
+  cache->query_in_flight = false;
+
+  std::vector<ui::IdleTimeCallback> pending;
+  pending.swap(cache->pending);
+  for (const auto& callback : pending)
+    callback.Run(idle_time);
+}
+
+}  // namespace
+
 PowerMonitor::PowerMonitor(v8::Isolate* isolate) {
 #if defined(OS_LINUX)
   SetShutdownHandler(
@@ -96,7 +134,57 @@ void PowerMonitor::QuerySystemIdleState(v8::Isolate* isolate,
 }
 
 void PowerMonitor::QuerySystemIdleTime(const ui::IdleTimeCallback& callback) {
-  ui::CalculateIdleTime(callback);
+  IdleTimeCache* cache = g_idle_time_cache.Pointer();
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (!cache->fetched.is_null() &&
+      now - cache->fetched <
+          base::TimeDelta::FromMilliseconds(kIdleTimeCacheMs)) {
+    // Answer from the cache, aged by the time since the real query. For
+    // a user who stayed idle this is exact; for one who just came back
+    // it is at most kIdleTimeCacheMs stale.
+    callback.Run(cache->idle_time + (now - cache->fetched).InSeconds());
+    return;
+  }
+
+  cache->pending.push_back(callback);
+  if (cache->query_in_flight)
+    return;
+  cache->query_in_flight = true;
+  ui::CalculateIdleTime(base::Bind(&OnIdleTimeFetched));
+}
+
+void PowerMonitor::SetIdleThreshold(int threshold, mate::Arguments* args) {
+  if (threshold < 0) {
+    args->ThrowError("Idle threshold must not be negative");
+    return;
+  }
+
+  idle_threshold_ = threshold;
+  is_idle_ = false;
+  if (threshold == 0) {
+    idle_timer_.Stop();
+    return;
+  }
+  idle_timer_.Start(FROM_HERE, base::TimeDelta::FromSeconds(1),
+                    base::Bind(&PowerMonitor::OnIdleCheck,
+                               base::Unretained(this)));
+}
+
+void PowerMonitor::OnIdleCheck() {
+  QuerySystemIdleTime(base::Bind(&PowerMonitor::OnIdleTimeForThreshold,
+                                 base::Unretained(this)));
+}
+
+void PowerMonitor::OnIdleTimeForThreshold(int idle_time) {
+  // The threshold may have been cleared while the query was in flight.
+  if (idle_threshold_ <= 0)
+    return;
+
+  bool idle = idle_time >= idle_threshold_;
+  if (idle == is_idle_)
+    return;
+  is_idle_ = idle;
+  Emit(idle ? "idle" : "active");
 }
 
 // static
@@ -123,7 +211,8 @@ void PowerMonitor::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("unblockShutdown", &PowerMonitor::UnblockShutdown)
 #endif
       .SetMethod("querySystemIdleState", &PowerMonitor::QuerySystemIdleState)
-      .SetMethod("querySystemIdleTime", &PowerMonitor::QuerySystemIdleTime);
+      .SetMethod("querySystemIdleTime", &PowerMonitor::QuerySystemIdleTime)
+      .SetMethod("setIdleThreshold", &PowerMonitor::SetIdleThreshold);
 }
 
 }  // namespace api
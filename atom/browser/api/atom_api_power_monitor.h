@@ -8,9 +8,14 @@
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/lib/power_observer.h"
 #include "base/compiler_specific.h"
+#include "base/timer/timer.h"
 #include "native_mate/handle.h"
 #include "ui/base/idle/idle.h"
 
+namespace mate {
+class Arguments;
+}
+
 namespace atom {
 
 namespace api {
@@ -50,6 +55,16 @@ class PowerMonitor : public mate::TrackableObject<PowerMonitor>,
                             int idle_threshold,
                             const ui::IdleCallback& callback);
   void QuerySystemIdleTime(const ui::IdleTimeCallback& callback);
+  void SetIdleThreshold(int threshold, mate::Arguments* args);
+
+  // Runs once per second while an idle threshold is set.
+  void OnIdleCheck();
+  void OnIdleTimeForThreshold(int idle_time);
+
+  // Idle threshold in seconds; 0 when threshold monitoring is off.
+  int idle_threshold_ = 0;
+  bool is_idle_ = false;
+  base::RepeatingTimer idle_timer_;
 
 #if defined(OS_WIN)
   // Static callback invoked when a message comes in to our messaging window.
@@ -7,6 +7,7 @@
 #include "atom/browser/atom_browser_client.h"
 #include "atom/browser/atom_browser_main_parts.h"
 #include "atom/browser/browser.h"
+#include "atom/browser/net/js_asker.h"
 #include "atom/browser/net/url_request_async_asar_job.h"
 #include "atom/browser/net/url_request_buffer_job.h"
 #include "atom/browser/net/url_request_fetch_job.h"
@@ -120,6 +121,14 @@ bool Protocol::IsProtocolHandledInIO(
   return request_context_getter->job_factory()->IsHandledProtocol(scheme);
 }
 
+void Protocol::ClearResponseCache(mate::Arguments* args) {
+  std::string url;
+  args->GetNext(&url);  // Optional; clears everything when omitted.
+  content::BrowserThread::PostTask(
+      content::BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&ClearJsAskerResponseCache, url));
+}
+
 void Protocol::UninterceptProtocol(const std::string& scheme,
                                    mate::Arguments* args) {
   CompletionCallback callback;
@@ -212,7 +221,8 @@ void Protocol::BuildPrototype(v8::Isolate* isolate,
                  &Protocol::InterceptProtocol<URLRequestFetchJob>)
       .SetMethod("interceptStreamProtocol",
                  &Protocol::InterceptProtocol<URLRequestStreamJob>)
-      .SetMethod("uninterceptProtocol", &Protocol::UninterceptProtocol);
+      .SetMethod("uninterceptProtocol", &Protocol::UninterceptProtocol)
+      .SetMethod("clearResponseCache", &Protocol::ClearResponseCache);
 }
 
 }  // namespace api
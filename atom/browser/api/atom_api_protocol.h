@@ -172,6 +172,10 @@ class Protocol : public mate::TrackableObject<Protocol> {
     return PROTOCOL_OK;
   }
 
+  // Drop cached handler responses (see the |ttl| response option), either
+  // for one URL or for all of them.
+  void ClearResponseCache(mate::Arguments* args);
+
   // Restore the |scheme| to its original protocol handler.
   void UninterceptProtocol(const std::string& scheme, mate::Arguments* args);
   static ProtocolError UninterceptProtocolInIO(
@@ -55,7 +55,7 @@ std::vector<std::string> MetricsToArray(uint32_t metrics) {
 }  // namespace
 
 Screen::Screen(v8::Isolate* isolate, display::Screen* screen)
-    : screen_(screen) {
+    : screen_(screen), cached_displays_(screen->GetAllDisplays()) {
   screen_->AddObserver(this);
   Init(isolate);
 }
@@ -73,10 +73,16 @@ display::Display Screen::GetPrimaryDisplay() {
 }
 
 std::vector<display::Display> Screen::GetAllDisplays() {
-  return screen_->GetAllDisplays();
+  return cached_displays_;
 }
 
 display::Display Screen::GetDisplayNearestPoint(const gfx::Point& point) {
+  // Fast path for cursor-position polling: when the point lies inside a
+  // cached display's bounds there is no need for a platform enumeration.
+  for (const auto& display : cached_displays_) {
+    if (display.bounds().Contains(point))
+      return display;
+  }
   return screen_->GetDisplayNearestPoint(point);
 }
 
@@ -101,15 +107,22 @@ static gfx::Rect DIPToScreenRect(atom::NativeWindow* window,
 #endif
 
 void Screen::OnDisplayAdded(const display::Display& new_display) {
+  cached_displays_.push_back(new_display);
   Emit("display-added", new_display);
 }
 
 void Screen::OnDisplayRemoved(const display::Display& old_display) {
+  auto iter = FindById(&cached_displays_, old_display.id());
+  if (iter != cached_displays_.end())
+    cached_displays_.erase(iter);
   Emit("display-removed", old_display);
 }
 
 void Screen::OnDisplayMetricsChanged(const display::Display& display,
                                      uint32_t changed_metrics) {
+  auto iter = FindById(&cached_displays_, display.id());
+  if (iter != cached_displays_.end())
+    *iter = display;
   Emit("display-metrics-changed", display, MetricsToArray(changed_metrics));
 }
 
@@ -49,6 +49,12 @@ class Screen : public mate::EventEmitter<Screen>,
  private:
   display::Screen* screen_;
 
+  // Cached display topology, kept up to date by the DisplayObserver
+  // notifications so hot paths like getAllDisplays and
+  // getDisplayNearestPoint do not have to enumerate displays through the
+  // platform APIs on every call.
+  std::vector<display::Display> cached_displays_;
+
   DISALLOW_COPY_AND_ASSIGN(Screen);
 };
 
@@ -4,6 +4,7 @@
 
 #include "atom/browser/api/atom_api_session.h"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -12,12 +13,15 @@
 #include "atom/browser/api/atom_api_download_item.h"
 #include "atom/browser/api/atom_api_protocol.h"
 #include "atom/browser/api/atom_api_web_request.h"
+#include "atom/browser/atom_browser_client.h"
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/atom_browser_main_parts.h"
 #include "atom/browser/atom_permission_manager.h"
 #include "atom/browser/browser.h"
 #include "atom/browser/net/atom_cert_verifier.h"
+#include "atom/browser/net/atom_network_delegate.h"
 #include "atom/browser/session_preferences.h"
+#include "atom/common/api/api_messages.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/content_converter.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
@@ -30,6 +34,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "brightray/browser/inspectable_web_contents_impl.h"
 #include "brightray/browser/media/media_device_id_salt.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/common/pref_names.h"
@@ -38,6 +43,7 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/download_item_utils.h"
 #include "content/public/browser/download_manager_delegate.h"
+#include "content/public/browser/render_process_host.h"
 #include "content/public/browser/storage_partition.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/object_template_builder.h"
@@ -46,6 +52,10 @@
 #include "net/dns/host_cache.h"
 #include "net/http/http_auth_handler_factory.h"
 #include "net/http/http_auth_preferences.h"
+#include "net/http/http_network_session.h"
+#include "net/http/http_request_info.h"
+#include "net/http/http_stream_factory.h"
+#include "net/http/http_transaction_factory.h"
 #include "net/proxy_resolution/proxy_config_service_fixed.h"
 #include "net/proxy_resolution/proxy_service.h"
 #include "net/url_request/static_http_user_agent_settings.h"
@@ -61,10 +71,15 @@ using content::StoragePartition;
 
 namespace {
 
+// Default chunk size used by Session::StreamBlobData.
+const int kDefaultBlobChunkSize = 1024 * 1024;
+
 struct ClearStorageDataOptions {
   GURL origin;
   uint32_t storage_types = StoragePartition::REMOVE_DATA_MASK_ALL;
   uint32_t quota_types = StoragePartition::QUOTA_MANAGED_STORAGE_MASK_ALL;
+  // Only data last modified before this point is cleared.
+  base::Time end_time = base::Time::Max();
 };
 
 struct ClearAuthCacheOptions {
@@ -155,6 +170,11 @@ struct Converter<ClearStorageDataOptions> {
       out->storage_types = GetStorageMask(types);
     if (options.Get("quotas", &types))
       out->quota_types = GetQuotaMask(types);
+    double max_age_ms = 0;
+    if (options.Get("maxAge", &max_age_ms) && max_age_ms > 0) {
+      out->end_time =
+          base::Time::Now() - base::TimeDelta::FromMillisecondsD(max_age_ms);
+    }
     return true;
   }
 };
@@ -210,6 +230,23 @@ struct Converter<net::ProxyConfig> {
   }
 };
 
+template <>
+struct Converter<atom::AtomNetworkDelegate::CacheStats> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      const atom::AtomNetworkDelegate::CacheStats& stats) {
+    mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+    dict.Set("hitCount", static_cast<double>(stats.hit_count));
+    dict.Set("missCount", static_cast<double>(stats.miss_count));
+    dict.Set("revalidationCount",
+             static_cast<double>(stats.revalidation_count));
+    dict.Set("cacheBytes", static_cast<double>(stats.cache_bytes));
+    dict.Set("networkBytes", static_cast<double>(stats.network_bytes));
+    dict.Set("entryCount", stats.entry_count);
+    return dict.GetHandle();
+  }
+};
+
 template <>
 struct Converter<atom::VerifyRequestParams> {
   static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
@@ -236,6 +273,15 @@ const char kPersistPrefix[] = "persist:";
 // Referenced session objects.
 std::map<uint32_t, v8::Global<v8::Object>> g_sessions;
 
+// Cap on cached proxy decisions; the cache is cleared wholesale when full.
+const size_t kMaxProxyCacheSize = 512;
+
+// PAC scripts almost always decide on scheme and host only, so that pair is
+// enough to key cached decisions.
+std::string ProxyCacheKey(const GURL& url) {
+  return url.scheme() + "://" + url.host();
+}
+
 class ResolveProxyHelper {
  public:
   ResolveProxyHelper(AtomBrowserContext* browser_context,
@@ -286,6 +332,26 @@ class ResolveProxyHelper {
   DISALLOW_COPY_AND_ASSIGN(ResolveProxyHelper);
 };
 
+// Pre-establishes |num_sockets| pooled connections to |url| so the first
+// real requests skip DNS + TCP + TLS setup.
+void PreconnectInIO(scoped_refptr<net::URLRequestContextGetter> context_getter,
+                    const GURL& url,
+                    int num_sockets) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+
+  net::HttpTransactionFactory* factory =
+      context_getter->GetURLRequestContext()->http_transaction_factory();
+  net::HttpNetworkSession* session = factory ? factory->GetSession() : nullptr;
+  if (!session)
+    return;
+
+  net::HttpRequestInfo request_info;
+  request_info.url = url;
+  request_info.method = "GET";
+  request_info.load_flags = net::LOAD_NORMAL;
+  session->http_stream_factory()->PreconnectStreams(num_sockets, request_info);
+}
+
 // Runs the callback in UI thread.
 void RunCallbackInUI(const base::Callback<void()>& callback) {
   BrowserThread::PostTask(BrowserThread::UI, FROM_HERE, callback);
@@ -343,6 +409,203 @@ void DoCacheActionInIO(
     on_get_backend.Run(net::OK);
 }
 
+using CacheStatsCallback =
+    base::Callback<void(const AtomNetworkDelegate::CacheStats&)>;
+
+// Callback of HttpCache::GetBackend for getCacheStats; merges the entry
+// count into the counters collected by the network delegate.
+void OnGetBackendForCacheStats(disk_cache::Backend** backend_ptr,
+                               AtomNetworkDelegate::CacheStats stats,
+                               const CacheStatsCallback& callback,
+                               int result) {
+  if (result == net::OK && backend_ptr && *backend_ptr)
+    stats.entry_count = (*backend_ptr)->GetEntryCount();
+  BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+                          base::BindOnce(callback, stats));
+}
+
+void GetCacheStatsInIO(
+    const scoped_refptr<net::URLRequestContextGetter>& context_getter,
+    const CacheStatsCallback& callback) {
+  auto* request_context = context_getter->GetURLRequestContext();
+  auto* network_delegate =
+      static_cast<AtomNetworkDelegate*>(request_context->network_delegate());
+  AtomNetworkDelegate::CacheStats stats = network_delegate->GetCacheStatsInIO();
+
+  auto* http_cache = request_context->http_transaction_factory()->GetCache();
+  if (!http_cache) {
+    BrowserThread::PostTask(BrowserThread::UI, FROM_HERE,
+                            base::BindOnce(callback, stats));
+    return;
+  }
+
+  using BackendPtr = disk_cache::Backend*;
+  auto** backend_ptr = new BackendPtr(nullptr);
+  net::CompletionCallback on_get_backend = base::Bind(
+      &OnGetBackendForCacheStats, base::Owned(backend_ptr), stats, callback);
+  int rv = http_cache->GetBackend(backend_ptr, on_get_backend);
+  if (rv != net::ERR_IO_PENDING)
+    on_get_backend.Run(rv);
+}
+
+void ResetCacheStatsInIO(
+    const scoped_refptr<net::URLRequestContextGetter>& context_getter,
+    const base::Closure& callback) {
+  auto* request_context = context_getter->GetURLRequestContext();
+  static_cast<AtomNetworkDelegate*>(request_context->network_delegate())
+      ->ResetCacheStatsInIO();
+  if (!callback.is_null())
+    RunCallbackInUI(callback);
+}
+
+// Walks the disk cache backend on the IO thread, dooming matching entries in
+// bounded batches with a pause between them so cache maintenance does not
+// monopolize disk I/O during foreground loads. Lives on the IO thread and
+// deletes itself when the walk finishes.
+class IncrementalCacheCleaner {
+ public:
+  IncrementalCacheCleaner(int batch_size,
+                          base::TimeDelta interval,
+                          base::Time used_before,
+                          const std::string& origin,
+                          const base::Callback<void(int)>& progress_callback,
+                          const net::CompletionCallback& callback)
+      : batch_size_(batch_size),
+        interval_(interval),
+        used_before_(used_before),
+        origin_(origin),
+        progress_callback_(progress_callback),
+        callback_(callback) {}
+
+  void Start(disk_cache::Backend* backend) {
+    iterator_ = backend->CreateIterator();
+    DoBatch();
+  }
+
+ private:
+  void DoBatch() {
+    while (true) {
+      int rv = iterator_->OpenNextEntry(
+          &entry_, base::Bind(&IncrementalCacheCleaner::OnEntryOpened,
+                              base::Unretained(this)));
+      if (rv == net::ERR_IO_PENDING)
+        return;
+      if (!ProcessEntry(rv))
+        return;
+    }
+  }
+
+  void OnEntryOpened(int result) {
+    if (ProcessEntry(result))
+      DoBatch();
+  }
+
+  // Dooms |entry_| if it passes the filters. Returns false when the walk is
+  // over or the current timeslice is used up.
+  bool ProcessEntry(int result) {
+    if (result != net::OK) {
+      // The iterator is exhausted (or the backend went away); either way we
+      // are done.
+      if (!progress_callback_.is_null())
+        RunCallbackInUI(progress_callback_, doomed_);
+      RunCallbackInUI<int>(callback_, net::OK);
+      delete this;
+      return false;
+    }
+
+    if (ShouldDoom(entry_)) {
+      entry_->Doom();
+      ++doomed_;
+    }
+    entry_->Close();
+    entry_ = nullptr;
+
+    if (++batch_count_ >= batch_size_) {
+      batch_count_ = 0;
+      if (!progress_callback_.is_null())
+        RunCallbackInUI(progress_callback_, doomed_);
+      BrowserThread::PostDelayedTask(
+          BrowserThread::IO, FROM_HERE,
+          base::BindOnce(&IncrementalCacheCleaner::DoBatch,
+                         base::Unretained(this)),
+          interval_);
+      return false;
+    }
+    return true;
+  }
+
+  bool ShouldDoom(disk_cache::Entry* entry) const {
+    if (!used_before_.is_null() && entry->GetLastUsed() >= used_before_)
+      return false;
+    if (!origin_.empty() &&
+        entry->GetKey().find(origin_) == std::string::npos)
+      return false;
+    return true;
+  }
+
+  const int batch_size_;
+  const base::TimeDelta interval_;
+  // Only entries last used before this point are doomed; null means no age
+  // filter.
+  const base::Time used_before_;
+  const std::string origin_;
+  base::Callback<void(int)> progress_callback_;
+  net::CompletionCallback callback_;
+
+  std::unique_ptr<disk_cache::Backend::Iterator> iterator_;
+  disk_cache::Entry* entry_ = nullptr;
+  int batch_count_ = 0;
+  int doomed_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(IncrementalCacheCleaner);
+};
+
+// Callback of HttpCache::GetBackend for the incremental clear.
+void OnGetBackendForIncrementalClear(
+    disk_cache::Backend** backend_ptr,
+    int batch_size,
+    base::TimeDelta interval,
+    base::Time used_before,
+    const std::string& origin,
+    const base::Callback<void(int)>& progress_callback,
+    const net::CompletionCallback& callback,
+    int result) {
+  if (result != net::OK || !backend_ptr || !*backend_ptr) {
+    RunCallbackInUI<int>(callback,
+                         result != net::OK ? result : net::ERR_FAILED);
+    return;
+  }
+  (new IncrementalCacheCleaner(batch_size, interval, used_before, origin,
+                               progress_callback, callback))
+      ->Start(*backend_ptr);
+}
+
+void ClearCacheIncrementallyInIO(
+    const scoped_refptr<net::URLRequestContextGetter>& context_getter,
+    int batch_size,
+    base::TimeDelta interval,
+    base::Time used_before,
+    const std::string& origin,
+    const base::Callback<void(int)>& progress_callback,
+    const net::CompletionCallback& callback) {
+  auto* request_context = context_getter->GetURLRequestContext();
+  auto* http_cache = request_context->http_transaction_factory()->GetCache();
+  if (!http_cache) {
+    RunCallbackInUI<int>(callback, net::ERR_FAILED);
+    return;
+  }
+
+  using BackendPtr = disk_cache::Backend*;
+  auto** backend_ptr = new BackendPtr(nullptr);
+  net::CompletionCallback on_get_backend =
+      base::Bind(&OnGetBackendForIncrementalClear, base::Owned(backend_ptr),
+                 batch_size, interval, used_before, origin, progress_callback,
+                 callback);
+  int rv = http_cache->GetBackend(backend_ptr, on_get_backend);
+  if (rv != net::ERR_IO_PENDING)
+    on_get_backend.Run(net::OK);
+}
+
 void SetProxyInIO(scoped_refptr<net::URLRequestContextGetter> getter,
                   const net::ProxyConfig& config,
                   const base::Closure& callback) {
@@ -483,11 +746,15 @@ void DestroyGlobalHandle(v8::Isolate* isolate,
 
 Session::Session(v8::Isolate* isolate, AtomBrowserContext* browser_context)
     : devtools_network_emulation_client_id_(base::GenerateGUID()),
-      browser_context_(browser_context) {
+      browser_context_(browser_context),
+      weak_ptr_factory_(this) {
   // Observe DownloadManager to get download notifications.
   content::BrowserContext::GetDownloadManager(browser_context)
       ->AddObserver(this);
 
+  // Cached proxy decisions go stale when the network changes.
+  net::NetworkChangeNotifier::AddNetworkChangeObserver(this);
+
   new SessionPreferences(browser_context);
 
   Init(isolate);
@@ -495,6 +762,7 @@ Session::Session(v8::Isolate* isolate, AtomBrowserContext* browser_context)
 }
 
 Session::~Session() {
+  net::NetworkChangeNotifier::RemoveNetworkChangeObserver(this);
   auto* getter = browser_context_->GetRequestContext();
   content::BrowserThread::PostTask(
       content::BrowserThread::IO, FROM_HERE,
@@ -526,8 +794,73 @@ void Session::OnDownloadCreated(content::DownloadManager* manager,
   }
 }
 
+void Session::OnNetworkChanged(
+    net::NetworkChangeNotifier::ConnectionType type) {
+  proxy_decision_cache_.clear();
+}
+
+// static
+void Session::CacheProxyDecision(base::WeakPtr<Session> self,
+                                 const std::string& key,
+                                 const ResolveProxyCallback& callback,
+                                 std::string proxy) {
+  if (self) {
+    if (self->proxy_decision_cache_.size() >= kMaxProxyCacheSize)
+      self->proxy_decision_cache_.clear();
+    self->proxy_decision_cache_[key] = proxy;
+  }
+  if (!callback.is_null())
+    callback.Run(proxy);
+}
+
 void Session::ResolveProxy(const GURL& url, ResolveProxyCallback callback) {
-  new ResolveProxyHelper(browser_context(), url, callback);
+  std::string key = ProxyCacheKey(url);
+  auto it = proxy_decision_cache_.find(key);
+  if (it != proxy_decision_cache_.end()) {
+    // Stay asynchronous even on a cache hit.
+    if (!callback.is_null()) {
+      base::ThreadTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE, base::BindOnce(callback, it->second));
+    }
+    return;
+  }
+
+  new ResolveProxyHelper(
+      browser_context(), url,
+      base::Bind(&Session::CacheProxyDecision, weak_ptr_factory_.GetWeakPtr(),
+                 key, callback));
+}
+
+void Session::PreResolveProxies(const std::vector<GURL>& urls) {
+  for (const GURL& url : urls) {
+    if (!url.is_valid())
+      continue;
+    if (proxy_decision_cache_.find(ProxyCacheKey(url)) !=
+        proxy_decision_cache_.end())
+      continue;
+    ResolveProxy(url, ResolveProxyCallback());
+  }
+}
+
+void Session::Preconnect(mate::Arguments* args) {
+  GURL url;
+  if (!args->GetNext(&url) || !url.is_valid() ||
+      !url.SchemeIsHTTPOrHTTPS()) {
+    args->ThrowError("Must pass a valid http(s) url to session.preconnect");
+    return;
+  }
+  int num_sockets = 1;
+  args->GetNext(&num_sockets);
+  if (num_sockets < 1 || num_sockets > 6) {
+    args->ThrowError("numSockets must be between 1 and 6");
+    return;
+  }
+
+  scoped_refptr<net::URLRequestContextGetter> context_getter =
+      browser_context_->url_request_context_getter();
+  context_getter->GetNetworkTaskRunner()->PostTask(
+      FROM_HERE, base::BindOnce(&PreconnectInIO, context_getter, url,
+                                num_sockets));
 }
 
 template <Session::CacheAction action>
@@ -539,6 +872,57 @@ void Session::DoCacheAction(const net::CompletionCallback& callback) {
                      action, callback));
 }
 
+void Session::GetCacheStats(
+    const base::Callback<void(const AtomNetworkDelegate::CacheStats&)>&
+        callback) {
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&GetCacheStatsInIO,
+                     WrapRefCounted(browser_context_->GetRequestContext()),
+                     callback));
+}
+
+void Session::ResetCacheStats(mate::Arguments* args) {
+  base::Closure callback;
+  args->GetNext(&callback);
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&ResetCacheStatsInIO,
+                     WrapRefCounted(browser_context_->GetRequestContext()),
+                     callback));
+}
+
+void Session::ClearCacheIncrementally(mate::Arguments* args) {
+  // clearCacheIncrementally([options, callback])
+  int batch_size = 32;
+  double interval_ms = 50;
+  double max_age_ms = 0;
+  std::string origin;
+  base::Callback<void(int)> progress_callback;
+  mate::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("batchSize", &batch_size);
+    options.Get("interval", &interval_ms);
+    options.Get("maxAge", &max_age_ms);
+    options.Get("origin", &origin);
+    options.Get("onProgress", &progress_callback);
+  }
+  net::CompletionCallback callback;
+  args->GetNext(&callback);
+
+  base::Time used_before;  // Null means no age filter.
+  if (max_age_ms > 0)
+    used_before =
+        base::Time::Now() - base::TimeDelta::FromMillisecondsD(max_age_ms);
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&ClearCacheIncrementallyInIO,
+                     WrapRefCounted(browser_context_->GetRequestContext()),
+                     std::max(1, batch_size),
+                     base::TimeDelta::FromMillisecondsD(interval_ms),
+                     used_before, origin, progress_callback, callback));
+}
+
 void Session::ClearStorageData(mate::Arguments* args) {
   // clearStorageData([options, callback])
   ClearStorageDataOptions options;
@@ -556,7 +940,7 @@ void Session::ClearStorageData(mate::Arguments* args) {
   storage_partition->ClearData(
       options.storage_types, options.quota_types, options.origin,
       content::StoragePartition::OriginMatcherFunction(), base::Time(),
-      base::Time::Max(), base::Bind(&OnClearStorageDataDone, callback));
+      options.end_time, base::Bind(&OnClearStorageDataDone, callback));
 }
 
 void Session::FlushStorageData() {
@@ -567,6 +951,7 @@ void Session::FlushStorageData() {
 
 void Session::SetProxy(const net::ProxyConfig& config,
                        const base::Closure& callback) {
+  proxy_decision_cache_.clear();
   auto* getter = browser_context_->GetRequestContext();
   BrowserThread::PostTask(
       BrowserThread::IO, FROM_HERE,
@@ -707,6 +1092,36 @@ void Session::GetBlobData(const std::string& uuid,
                      base::Unretained(blob_reader), uuid, callback));
 }
 
+void Session::StreamBlobData(mate::Arguments* args) {
+  std::string uuid;
+  if (!args->GetNext(&uuid)) {
+    args->ThrowError();
+    return;
+  }
+
+  int chunk_size = kDefaultBlobChunkSize;
+  if (!args->PeekNext().IsEmpty() && !args->PeekNext()->IsFunction()) {
+    mate::Dictionary options;
+    if (args->GetNext(&options))
+      options.Get("chunkSize", &chunk_size);
+  }
+  if (chunk_size <= 0)
+    chunk_size = kDefaultBlobChunkSize;
+
+  AtomBlobReader::CompletionCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  AtomBlobReader* blob_reader = browser_context()->GetBlobReader();
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&AtomBlobReader::StartStreaming,
+                     base::Unretained(blob_reader), uuid, chunk_size,
+                     callback));
+}
+
 void Session::CreateInterruptedDownload(const mate::Dictionary& options) {
   int64_t offset = 0, length = 0;
   double start_time = 0.0;
@@ -751,6 +1166,47 @@ std::vector<base::FilePath::StringType> Session::GetPreloads() const {
   return prefs->preloads();
 }
 
+int Session::AddInjectedStylesheet(const std::string& css) {
+  int key = browser_context_->AddInjectedStylesheet(css);
+  // Renderer processes launched later receive the current set in
+  // AtomBrowserClient::RenderProcessWillLaunch; existing ones are updated
+  // here.
+  for (auto iter = content::RenderProcessHost::AllHostsIterator();
+       !iter.IsAtEnd(); iter.Advance()) {
+    content::RenderProcessHost* host = iter.GetCurrentValue();
+    if (host->GetBrowserContext() == browser_context_.get())
+      host->Send(new AtomMsg_AddInjectedStylesheet(key, css));
+  }
+  return key;
+}
+
+void Session::RemoveInjectedStylesheet(int key) {
+  browser_context_->RemoveInjectedStylesheet(key);
+  for (auto iter = content::RenderProcessHost::AllHostsIterator();
+       !iter.IsAtEnd(); iter.Advance()) {
+    content::RenderProcessHost* host = iter.GetCurrentValue();
+    if (host->GetBrowserContext() == browser_context_.get())
+      host->Send(new AtomMsg_RemoveInjectedStylesheet(key));
+  }
+}
+
+void Session::SetDevToolsPrewarm(bool enabled) {
+  brightray::InspectableWebContentsImpl::SetDevToolsPrewarm(
+      browser_context_.get(), enabled);
+}
+
+void Session::SetSpareRendererPoolSize(int size) {
+  if (size < 0)
+    size = 0;
+  static_cast<AtomBrowserClient*>(AtomBrowserClient::Get())
+      ->SetSpareRendererPoolSize(browser_context_.get(), size);
+}
+
+int Session::GetSpareRendererPoolSize() {
+  return static_cast<AtomBrowserClient*>(AtomBrowserClient::Get())
+      ->GetSpareRendererPoolSize(browser_context_.get());
+}
+
 v8::Local<v8::Value> Session::Cookies(v8::Isolate* isolate) {
   if (cookies_.IsEmpty()) {
     auto handle = Cookies::Create(isolate, browser_context());
@@ -818,8 +1274,13 @@ void Session::BuildPrototype(v8::Isolate* isolate,
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .MakeDestroyable()
       .SetMethod("resolveProxy", &Session::ResolveProxy)
+      .SetMethod("preResolveProxies", &Session::PreResolveProxies)
+      .SetMethod("preconnect", &Session::Preconnect)
       .SetMethod("getCacheSize", &Session::DoCacheAction<CacheAction::STATS>)
+      .SetMethod("getCacheStats", &Session::GetCacheStats)
+      .SetMethod("resetCacheStats", &Session::ResetCacheStats)
       .SetMethod("clearCache", &Session::DoCacheAction<CacheAction::CLEAR>)
+      .SetMethod("clearCacheIncrementally", &Session::ClearCacheIncrementally)
       .SetMethod("clearStorageData", &Session::ClearStorageData)
       .SetMethod("flushStorageData", &Session::FlushStorageData)
       .SetMethod("setProxy", &Session::SetProxy)
@@ -836,10 +1297,19 @@ void Session::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setUserAgent", &Session::SetUserAgent)
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("streamBlobData", &Session::StreamBlobData)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
       .SetMethod("setPreloads", &Session::SetPreloads)
       .SetMethod("getPreloads", &Session::GetPreloads)
+      .SetMethod("addInjectedStylesheet", &Session::AddInjectedStylesheet)
+      .SetMethod("removeInjectedStylesheet",
+                 &Session::RemoveInjectedStylesheet)
+      .SetMethod("setDevToolsPrewarm", &Session::SetDevToolsPrewarm)
+      .SetMethod("setSpareRendererPoolSize",
+                 &Session::SetSpareRendererPoolSize)
+      .SetMethod("getSpareRendererPoolSize",
+                 &Session::GetSpareRendererPoolSize)
       .SetProperty("cookies", &Session::Cookies)
       .SetProperty("protocol", &Session::Protocol)
       .SetProperty("webRequest", &Session::WebRequest);
@@ -5,15 +5,19 @@
 #ifndef ATOM_BROWSER_API_ATOM_API_SESSION_H_
 #define ATOM_BROWSER_API_ATOM_API_SESSION_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/atom_blob_reader.h"
+#include "atom/browser/net/atom_network_delegate.h"
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "content/public/browser/download_manager.h"
 #include "native_mate/handle.h"
 #include "net/base/completion_callback.h"
+#include "net/base/network_change_notifier.h"
 
 class GURL;
 
@@ -37,7 +41,8 @@ class AtomBrowserContext;
 namespace api {
 
 class Session : public mate::TrackableObject<Session>,
-                public content::DownloadManager::Observer {
+                public content::DownloadManager::Observer,
+                public net::NetworkChangeNotifier::NetworkChangeObserver {
  public:
   using ResolveProxyCallback = base::Callback<void(std::string)>;
 
@@ -64,8 +69,15 @@ class Session : public mate::TrackableObject<Session>,
 
   // Methods.
   void ResolveProxy(const GURL& url, ResolveProxyCallback callback);
+  void PreResolveProxies(const std::vector<GURL>& urls);
+  void Preconnect(mate::Arguments* args);
   template <CacheAction action>
   void DoCacheAction(const net::CompletionCallback& callback);
+  void GetCacheStats(
+      const base::Callback<void(const AtomNetworkDelegate::CacheStats&)>&
+          callback);
+  void ResetCacheStats(mate::Arguments* args);
+  void ClearCacheIncrementally(mate::Arguments* args);
   void ClearStorageData(mate::Arguments* args);
   void FlushStorageData();
   void SetProxy(const net::ProxyConfig& config, const base::Closure& callback);
@@ -82,9 +94,15 @@ class Session : public mate::TrackableObject<Session>,
   std::string GetUserAgent();
   void GetBlobData(const std::string& uuid,
                    const AtomBlobReader::CompletionCallback& callback);
+  void StreamBlobData(mate::Arguments* args);
   void CreateInterruptedDownload(const mate::Dictionary& options);
   void SetPreloads(const std::vector<base::FilePath::StringType>& preloads);
   std::vector<base::FilePath::StringType> GetPreloads() const;
+  int AddInjectedStylesheet(const std::string& css);
+  void RemoveInjectedStylesheet(int key);
+  void SetDevToolsPrewarm(bool enabled);
+  void SetSpareRendererPoolSize(int size);
+  int GetSpareRendererPoolSize();
   v8::Local<v8::Value> Cookies(v8::Isolate* isolate);
   v8::Local<v8::Value> Protocol(v8::Isolate* isolate);
   v8::Local<v8::Value> WebRequest(v8::Isolate* isolate);
@@ -97,7 +115,18 @@ class Session : public mate::TrackableObject<Session>,
   void OnDownloadCreated(content::DownloadManager* manager,
                          download::DownloadItem* item) override;
 
+  // net::NetworkChangeNotifier::NetworkChangeObserver:
+  void OnNetworkChanged(
+      net::NetworkChangeNotifier::ConnectionType type) override;
+
  private:
+  // Records a freshly resolved proxy decision for |key| in |self|'s cache
+  // and forwards it to |callback|.
+  static void CacheProxyDecision(base::WeakPtr<Session> self,
+                                 const std::string& key,
+                                 const ResolveProxyCallback& callback,
+                                 std::string proxy);
+
   // Cached object.
   v8::Global<v8::Value> cookies_;
   v8::Global<v8::Value> protocol_;
@@ -108,6 +137,12 @@ class Session : public mate::TrackableObject<Session>,
 
   scoped_refptr<AtomBrowserContext> browser_context_;
 
+  // Proxy decisions keyed by scheme://host, cleared on network and proxy
+  // configuration changes.
+  std::map<std::string, std::string> proxy_decision_cache_;
+
+  base::WeakPtrFactory<Session> weak_ptr_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(Session);
 };
 
@@ -11,6 +11,7 @@
 #include "atom/browser/api/atom_api_menu.h"
 #include "atom/browser/api/atom_api_view.h"
 #include "atom/browser/api/atom_api_web_contents.h"
+#include "atom/browser/native_browser_view.h"
 #include "atom/common/color_util.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
@@ -178,6 +179,14 @@ void TopLevelWindow::OnWindowHide() {
   Emit("hide");
 }
 
+void TopLevelWindow::OnWindowOcclusionChange(bool occluded) {
+  Emit("occlusion-changed", occluded);
+}
+
+void TopLevelWindow::OnWindowBoundsAnimationFinished() {
+  Emit("bounds-animation-finished");
+}
+
 void TopLevelWindow::OnWindowMaximize() {
   Emit("maximize");
 }
@@ -308,6 +317,50 @@ bool TopLevelWindow::IsVisible() {
   return window_->IsVisible();
 }
 
+bool TopLevelWindow::IsOccluded() {
+  return window_->IsOccluded();
+}
+
+void TopLevelWindow::SetFrameRate(int frame_rate, mate::Arguments* args) {
+  if (frame_rate < 0 || frame_rate > 240) {
+    args->ThrowError("frameRate must be between 0 and 240");
+    return;
+  }
+  window_->SetFrameRate(frame_rate);
+}
+
+int TopLevelWindow::GetFrameRate() {
+  return window_->GetFrameRate();
+}
+
+void TopLevelWindow::AnimateBounds(const gfx::Rect& bounds,
+                                   int duration,
+                                   mate::Arguments* args) {
+  if (duration <= 0) {
+    args->ThrowError("duration must be a positive number of milliseconds");
+    return;
+  }
+
+  std::string easing = "linear";
+  args->GetNext(&easing);
+  gfx::Tween::Type tween_type;
+  if (easing == "linear") {
+    tween_type = gfx::Tween::LINEAR;
+  } else if (easing == "ease-in") {
+    tween_type = gfx::Tween::EASE_IN;
+  } else if (easing == "ease-out") {
+    tween_type = gfx::Tween::EASE_OUT;
+  } else if (easing == "ease-in-out") {
+    tween_type = gfx::Tween::EASE_IN_OUT;
+  } else {
+    args->ThrowError(
+        "easing must be one of linear, ease-in, ease-out, ease-in-out");
+    return;
+  }
+
+  window_->AnimateBounds(bounds, duration, tween_type);
+}
+
 bool TopLevelWindow::IsEnabled() {
   return window_->IsEnabled();
 }
@@ -648,6 +701,11 @@ void TopLevelWindow::SetBrowserView(v8::Local<v8::Value> value) {
   } else if (mate::ConvertFromV8(isolate(), value, &browser_view)) {
     window_->SetBrowserView(browser_view->view());
     browser_view->web_contents()->SetOwnerWindow(window_.get());
+    // The view may have been detached from another window before, wake its
+    // renderer up again so the page resumes painting and timers.
+    content::WebContents* web_contents = browser_view->view()->GetWebContents();
+    if (web_contents)
+      web_contents->WasShown();
     browser_view_.Reset(isolate(), value);
   }
 }
@@ -895,6 +953,13 @@ void TopLevelWindow::ResetBrowserView() {
   mate::Handle<BrowserView> browser_view;
   if (mate::ConvertFromV8(isolate(), GetBrowserView(), &browser_view) &&
       !browser_view.IsEmpty()) {
+    // A detached view keeps its web contents alive so it can be attached to
+    // any window later without reloading, but while it is not showing
+    // anywhere mark it hidden so the renderer stops painting and throttles
+    // timers.
+    content::WebContents* web_contents = browser_view->view()->GetWebContents();
+    if (web_contents)
+      web_contents->WasHidden();
     browser_view->web_contents()->SetOwnerWindow(nullptr);
   }
 
@@ -937,6 +1002,10 @@ void TopLevelWindow::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("showInactive", &TopLevelWindow::ShowInactive)
       .SetMethod("hide", &TopLevelWindow::Hide)
       .SetMethod("isVisible", &TopLevelWindow::IsVisible)
+      .SetMethod("isOccluded", &TopLevelWindow::IsOccluded)
+      .SetMethod("setFrameRate", &TopLevelWindow::SetFrameRate)
+      .SetMethod("getFrameRate", &TopLevelWindow::GetFrameRate)
+      .SetMethod("animateBounds", &TopLevelWindow::AnimateBounds)
       .SetMethod("isEnabled", &TopLevelWindow::IsEnabled)
       .SetMethod("setEnabled", &TopLevelWindow::SetEnabled)
       .SetMethod("maximize", &TopLevelWindow::Maximize)
@@ -56,6 +56,8 @@ class TopLevelWindow : public mate::TrackableObject<TopLevelWindow>,
   void OnWindowFocus() override;
   void OnWindowShow() override;
   void OnWindowHide() override;
+  void OnWindowOcclusionChange(bool occluded) override;
+  void OnWindowBoundsAnimationFinished() override;
   void OnWindowMaximize() override;
   void OnWindowUnmaximize() override;
   void OnWindowMinimize() override;
@@ -90,6 +92,12 @@ class TopLevelWindow : public mate::TrackableObject<TopLevelWindow>,
   void ShowInactive();
   void Hide();
   bool IsVisible();
+  bool IsOccluded();
+  void SetFrameRate(int frame_rate, mate::Arguments* args);
+  int GetFrameRate();
+  void AnimateBounds(const gfx::Rect& bounds,
+                     int duration,
+                     mate::Arguments* args);
   bool IsEnabled();
   void SetEnabled(bool enable);
   void Maximize();
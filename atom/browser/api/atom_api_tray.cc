@@ -5,6 +5,7 @@
 #include "atom/browser/api/atom_api_tray.h"
 
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/atom_api_menu.h"
 #include "atom/browser/browser.h"
@@ -138,6 +139,7 @@ void Tray::OnDragEnded() {
 }
 
 void Tray::SetImage(v8::Isolate* isolate, mate::Handle<NativeImage> image) {
+  StopAnimation();
 #if defined(OS_WIN)
   tray_icon_->SetImage(image->GetHICON(GetSystemMetrics(SM_CXSMICON)));
 #else
@@ -154,6 +156,60 @@ void Tray::SetPressedImage(v8::Isolate* isolate,
 #endif
 }
 
+void Tray::SetAnimation(mate::Arguments* args,
+                        const std::vector<mate::Handle<NativeImage>>& frames) {
+  if (frames.empty()) {
+    args->ThrowError("'frames' must contain at least one image");
+    return;
+  }
+
+  int interval = 100;
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("interval", &interval);
+  if (interval < 16)
+    interval = 16;
+
+  StopAnimation();
+
+  // Convert every frame to its platform representation up front so the
+  // timer only has to swap already converted images.
+  for (const auto& frame : frames) {
+    animation_frames_.emplace_back(args->isolate(), frame.ToV8());
+#if defined(OS_WIN)
+    animation_icons_.push_back(frame->GetHICON(GetSystemMetrics(SM_CXSMICON)));
+#else
+    animation_images_.push_back(frame->image());
+#endif
+  }
+
+  AdvanceAnimationFrame();
+  animation_timer_.Start(FROM_HERE,
+                         base::TimeDelta::FromMilliseconds(interval), this,
+                         &Tray::AdvanceAnimationFrame);
+}
+
+void Tray::StopAnimation() {
+  animation_timer_.Stop();
+  animation_frames_.clear();
+#if defined(OS_WIN)
+  animation_icons_.clear();
+#else
+  animation_images_.clear();
+#endif
+  animation_index_ = 0;
+}
+
+void Tray::AdvanceAnimationFrame() {
+#if defined(OS_WIN)
+  tray_icon_->SetImage(animation_icons_[animation_index_]);
+  animation_index_ = (animation_index_ + 1) % animation_icons_.size();
+#else
+  tray_icon_->SetImage(animation_images_[animation_index_]);
+  animation_index_ = (animation_index_ + 1) % animation_images_.size();
+#endif
+}
+
 void Tray::SetToolTip(const std::string& tool_tip) {
   tray_icon_->SetToolTip(tool_tip);
 }
@@ -225,6 +281,8 @@ void Tray::BuildPrototype(v8::Isolate* isolate,
       .MakeDestroyable()
       .SetMethod("setImage", &Tray::SetImage)
       .SetMethod("setPressedImage", &Tray::SetPressedImage)
+      .SetMethod("setAnimation", &Tray::SetAnimation)
+      .SetMethod("stopAnimation", &Tray::StopAnimation)
       .SetMethod("setToolTip", &Tray::SetToolTip)
       .SetMethod("setTitle", &Tray::SetTitle)
       .SetMethod("setHighlightMode", &Tray::SetHighlightMode)
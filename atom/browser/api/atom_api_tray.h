@@ -12,11 +12,9 @@
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/ui/tray_icon.h"
 #include "atom/browser/ui/tray_icon_observer.h"
+#include "base/timer/timer.h"
 #include "native_mate/handle.h"
-
-namespace gfx {
-class Image;
-}
+#include "ui/gfx/image/image.h"
 
 namespace mate {
 class Arguments;
@@ -67,6 +65,9 @@ class Tray : public mate::TrackableObject<Tray>, public TrayIconObserver {
 
   void SetImage(v8::Isolate* isolate, mate::Handle<NativeImage> image);
   void SetPressedImage(v8::Isolate* isolate, mate::Handle<NativeImage> image);
+  void SetAnimation(mate::Arguments* args,
+                    const std::vector<mate::Handle<NativeImage>>& frames);
+  void StopAnimation();
   void SetToolTip(const std::string& tool_tip);
   void SetTitle(const std::string& title);
   void SetHighlightMode(TrayIcon::HighlightMode mode);
@@ -78,9 +79,24 @@ class Tray : public mate::TrackableObject<Tray>, public TrayIconObserver {
   gfx::Rect GetBounds();
 
  private:
+  void AdvanceAnimationFrame();
+
   v8::Global<v8::Object> menu_;
   std::unique_ptr<TrayIcon> tray_icon_;
 
+  // Animation state used by setAnimation(). The frames are converted to
+  // their platform representation once when the animation starts; the v8
+  // references keep the source NativeImages (which own the converted
+  // icons on Windows) alive while the animation runs.
+  std::vector<v8::Global<v8::Value>> animation_frames_;
+#if defined(OS_WIN)
+  std::vector<HICON> animation_icons_;
+#else
+  std::vector<gfx::Image> animation_images_;
+#endif
+  size_t animation_index_ = 0;
+  base::RepeatingTimer animation_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(Tray);
 };
 
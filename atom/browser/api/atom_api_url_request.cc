@@ -13,6 +13,7 @@
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
+#include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_includes.h"
 #include "native_mate/dictionary.h"
 
@@ -20,13 +21,6 @@ namespace mate {
 
 template <>
 struct Converter<scoped_refptr<const net::IOBufferWithSize>> {
-  static v8::Local<v8::Value> ToV8(
-      v8::Isolate* isolate,
-      scoped_refptr<const net::IOBufferWithSize> buffer) {
-    return node::Buffer::Copy(isolate, buffer->data(), buffer->size())
-        .ToLocalChecked();
-  }
-
   static bool FromV8(v8::Isolate* isolate,
                      v8::Local<v8::Value> val,
                      scoped_refptr<const net::IOBufferWithSize>* out) {
@@ -59,6 +53,17 @@ struct Converter<scoped_refptr<const net::IOBufferWithSize>> {
 namespace atom {
 namespace api {
 
+namespace {
+
+// Drops the reference that keeps a received chunk's IOBuffer alive while
+// the JS Buffer wrapping its memory exists. Called by Node when the Buffer
+// is garbage collected.
+void ReleaseIOBuffer(char* data, void* hint) {
+  delete static_cast<scoped_refptr<const net::IOBuffer>*>(hint);
+}
+
+}  // namespace
+
 template <typename Flags>
 URLRequest::StateBase<Flags>::StateBase(Flags initialState)
     : state_(initialState) {}
@@ -145,11 +150,9 @@ mate::WrappableBase* URLRequest::New(mate::Arguments* args) {
   args->GetNext(&options);
   mate::Dictionary dict(isolate, options);
   std::string method;
-  dict.Get("method", &method);
   std::string url;
-  dict.Get("url", &url);
   std::string redirect_policy;
-  dict.Get("redirect", &redirect_policy);
+  dict.GetMany("method", &method, "url", &url, "redirect", &redirect_policy);
   std::string partition;
   mate::Handle<api::Session> session;
   if (dict.Get("session", &session)) {
@@ -190,7 +193,8 @@ void URLRequest::BuildPrototype(v8::Isolate* isolate,
       .SetProperty("statusMessage", &URLRequest::StatusMessage)
       .SetProperty("rawResponseHeaders", &URLRequest::RawResponseHeaders)
       .SetProperty("httpVersionMajor", &URLRequest::ResponseHttpVersionMajor)
-      .SetProperty("httpVersionMinor", &URLRequest::ResponseHttpVersionMinor);
+      .SetProperty("httpVersionMinor", &URLRequest::ResponseHttpVersionMinor)
+      .SetProperty("connectionInfo", &URLRequest::ConnectionInfo);
 }
 
 bool URLRequest::NotStarted() const {
@@ -356,29 +360,41 @@ void URLRequest::OnAuthenticationRequired(
 }
 
 void URLRequest::OnResponseStarted(
-    scoped_refptr<net::HttpResponseHeaders> response_headers) {
+    scoped_refptr<net::HttpResponseHeaders> response_headers,
+    std::unique_ptr<base::DictionaryValue> connection_info) {
   if (request_state_.Canceled() || request_state_.Failed() ||
       request_state_.Closed()) {
     // Don't emit any event after request cancel.
     return;
   }
   response_headers_ = response_headers;
+  connection_info_ = std::move(connection_info);
   response_state_.SetFlag(ResponseStateFlags::kStarted);
   Emit("response");
 }
 
-void URLRequest::OnResponseData(
-    scoped_refptr<const net::IOBufferWithSize> buffer) {
+void URLRequest::OnResponseData(scoped_refptr<const net::IOBuffer> buffer,
+                                int size) {
   if (request_state_.Canceled() || request_state_.Closed() ||
       request_state_.Failed() || response_state_.Failed()) {
     // In case we received an unexpected event from Chromium net,
     // don't emit any data event after request cancel/error/close.
     return;
   }
-  if (!buffer || !buffer->data() || !buffer->size()) {
+  if (!buffer || !buffer->data() || size <= 0) {
     return;
   }
-  Emit("data", buffer);
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  // Expose the IOBuffer's memory to JS directly instead of copying it into
+  // a fresh Buffer; the Buffer holds a reference on the IOBuffer and drops
+  // it through ReleaseIOBuffer when collected.
+  auto* ref = new scoped_refptr<const net::IOBuffer>(buffer);
+  v8::Local<v8::Value> data =
+      node::Buffer::New(isolate(), const_cast<char*>(buffer->data()), size,
+                        &ReleaseIOBuffer, ref)
+          .ToLocalChecked();
+  Emit("data", data);
 }
 
 void URLRequest::OnResponseCompleted() {
@@ -393,6 +409,15 @@ void URLRequest::OnResponseCompleted() {
   Close();
 }
 
+void URLRequest::OnUploadDrained() {
+  if (request_state_.Canceled() || request_state_.Failed() ||
+      request_state_.Closed()) {
+    // Don't emit any event after request cancel/error/close.
+    return;
+  }
+  EmitRequestEvent(true, "drain");
+}
+
 void URLRequest::OnError(const std::string& error, bool isRequestError) {
   auto error_object = v8::Exception::Error(mate::StringToV8(isolate(), error));
   if (isRequestError) {
@@ -438,6 +463,13 @@ uint32_t URLRequest::ResponseHttpVersionMinor() const {
   return 0;
 }
 
+v8::Local<v8::Value> URLRequest::ConnectionInfo(v8::Isolate* isolate) {
+  if (!connection_info_) {
+    return v8::Null(isolate);
+  }
+  return mate::ConvertToV8(isolate, *connection_info_);
+}
+
 void URLRequest::Close() {
   if (!request_state_.Closed()) {
     request_state_.SetFlag(RequestStateFlags::kClosed);
@@ -6,11 +6,13 @@
 #define ATOM_BROWSER_API_ATOM_API_URL_REQUEST_H_
 
 #include <array>
+#include <memory>
 #include <string>
 
 #include "atom/browser/api/event_emitter.h"
 #include "atom/browser/api/trackable_object.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/handle.h"
 #include "native_mate/wrappable_base.h"
@@ -108,10 +110,12 @@ class URLRequest : public mate::EventEmitter<URLRequest> {
   void OnAuthenticationRequired(
       scoped_refptr<const net::AuthChallengeInfo> auth_info);
   void OnResponseStarted(
-      scoped_refptr<net::HttpResponseHeaders> response_headers);
-  void OnResponseData(scoped_refptr<const net::IOBufferWithSize> data);
+      scoped_refptr<net::HttpResponseHeaders> response_headers,
+      std::unique_ptr<base::DictionaryValue> connection_info);
+  void OnResponseData(scoped_refptr<const net::IOBuffer> data, int size);
   void OnResponseCompleted();
   void OnError(const std::string& error, bool isRequestError);
+  void OnUploadDrained();
 
  protected:
   explicit URLRequest(v8::Isolate* isolate, v8::Local<v8::Object> wrapper);
@@ -187,6 +191,9 @@ class URLRequest : public mate::EventEmitter<URLRequest> {
   net::HttpResponseHeaders* RawResponseHeaders() const;
   uint32_t ResponseHttpVersionMajor() const;
   uint32_t ResponseHttpVersionMinor() const;
+  // Socket reuse, negotiated protocol and handshake timings of the current
+  // response, or null before the response starts.
+  v8::Local<v8::Value> ConnectionInfo(v8::Isolate* isolate);
 
   void Close();
   void Pin();
@@ -203,6 +210,7 @@ class URLRequest : public mate::EventEmitter<URLRequest> {
   // Used to implement pin/unpin.
   v8::Global<v8::Object> wrapper_;
   scoped_refptr<net::HttpResponseHeaders> response_headers_;
+  std::unique_ptr<base::DictionaryValue> connection_info_;
 
   DISALLOW_COPY_AND_ASSIGN(URLRequest);
 };
@@ -4,8 +4,11 @@
 
 #include "atom/browser/api/atom_api_web_contents.h"
 
+#include <algorithm>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
 
 // We have problems with redefinition of ssize_t between node.h and
 // port_chromium.h, and the latter was introduced by leveldb.mojom.h.
@@ -25,12 +28,14 @@
 #include "atom/browser/atom_browser_main_parts.h"
 #include "atom/browser/atom_javascript_dialog_manager.h"
 #include "atom/browser/child_web_contents_tracker.h"
+#include "atom/browser/ipc_metrics.h"
 #include "atom/browser/lib/bluetooth_chooser.h"
 #include "atom/browser/native_window.h"
 #include "atom/browser/net/atom_network_delegate.h"
 #if defined(ENABLE_OSR)
 #include "atom/browser/osr/osr_output_device.h"
 #include "atom/browser/osr/osr_render_widget_host_view.h"
+#include "atom/browser/osr/osr_video_encoder.h"
 #include "atom/browser/osr/osr_web_contents_view.h"
 #endif
 #include "atom/browser/ui/drag_util.h"
@@ -41,6 +46,7 @@
 #include "atom/common/api/api_messages.h"
 #include "atom/common/api/atom_api_native_image.h"
 #include "atom/common/api/event_emitter_caller.h"
+#include "atom/common/api/v8_value_serializer.h"
 #include "atom/common/color_util.h"
 #include "atom/common/mouse_util.h"
 #include "atom/common/native_mate_converters/blink_converter.h"
@@ -55,10 +61,16 @@
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/options_switches.h"
+#include "atom/common/shared_memory_ring_buffer.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/memory/shared_memory.h"
 #include "base/message_loop/message_loop.h"
+#include "base/process/process.h"
 #include "base/process/process_handle.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "brightray/browser/inspectable_web_contents.h"
 #include "brightray/browser/inspectable_web_contents_view.h"
@@ -71,10 +83,12 @@
 #include "content/browser/renderer_host/render_widget_host_impl.h"
 #include "content/browser/renderer_host/render_widget_host_view_base.h"
 #include "content/common/view_messages.h"
+#include "content/public/browser/browser_thread.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "content/public/browser/download_request_utils.h"
 #include "content/public/browser/favicon_status.h"
 #include "content/public/browser/native_web_keyboard_event.h"
+#include "content/public/browser/navigation_controller.h"
 #include "content/public/browser/navigation_details.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/navigation_handle.h"
@@ -285,6 +299,9 @@ namespace api {
 
 namespace {
 
+// Ring size of the per-WebContents input latency sample buffer.
+const size_t kInputLatencySamples = 512;
+
 content::ServiceWorkerContext* GetServiceWorkerContext(
     const content::WebContents* web_contents) {
   auto* context = web_contents->GetBrowserContext();
@@ -309,6 +326,79 @@ void OnCapturePageDone(const base::Callback<void(const gfx::Image&)>& callback,
   callback.Run(gfx::Image::CreateFrom1xBitmap(bitmap));
 }
 
+// Measures one message dispatch for IPCMetrics, from construction to
+// destruction. Does nothing (and computes no payload size) when the
+// metrics are not enabled.
+class ScopedIPCMetricsRecord {
+ public:
+  ScopedIPCMetricsRecord(const std::string& channel, size_t payload_bytes)
+      : channel_(channel), payload_bytes_(payload_bytes) {
+    if (IPCMetrics::GetInstance()->enabled())
+      start_ = base::TimeTicks::Now();
+  }
+
+  ScopedIPCMetricsRecord(const std::string& channel, const base::Value& args)
+      : channel_(channel) {
+    if (IPCMetrics::GetInstance()->enabled()) {
+      payload_bytes_ = IPCMetrics::EstimateValueSize(args);
+      start_ = base::TimeTicks::Now();
+    }
+  }
+
+  ~ScopedIPCMetricsRecord() {
+    if (!start_.is_null()) {
+      IPCMetrics::GetInstance()->RecordMessage(
+          channel_, payload_bytes_, base::TimeTicks::Now() - start_);
+    }
+  }
+
+ private:
+  std::string channel_;
+  size_t payload_bytes_ = 0;
+  base::TimeTicks start_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScopedIPCMetricsRecord);
+};
+
+// Keeps a heap buffer alive for as long as the ArrayBuffer wrapping it
+// is reachable from JS; deletes itself from the buffer's weak callback.
+class StreamBufferHolder {
+ public:
+  explicit StreamBufferHolder(std::string data) : data_(std::move(data)) {}
+
+  std::string& data() { return data_; }
+
+  void Attach(v8::Isolate* isolate, v8::Local<v8::ArrayBuffer> array_buffer) {
+    array_buffer_.Reset(isolate, array_buffer);
+    array_buffer_.SetWeak(this, &OnCollected,
+                          v8::WeakCallbackType::kParameter);
+  }
+
+ private:
+  static void OnCollected(
+      const v8::WeakCallbackInfo<StreamBufferHolder>& info) {
+    delete info.GetParameter();
+  }
+
+  std::string data_;
+  v8::Global<v8::ArrayBuffer> array_buffer_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamBufferHolder);
+};
+
+// Wraps a reassembled stream payload in an externalized ArrayBuffer,
+// handing ownership of the bytes to the holder so they are not copied
+// again.
+v8::Local<v8::Value> WrapStreamBuffer(v8::Isolate* isolate,
+                                      std::string data) {
+  auto* holder = new StreamBufferHolder(std::move(data));  // Deletes itself.
+  std::string& bytes = holder->data();
+  v8::Local<v8::ArrayBuffer> array_buffer = v8::ArrayBuffer::New(
+      isolate, bytes.empty() ? nullptr : &bytes[0], bytes.size());
+  holder->Attach(isolate, array_buffer);
+  return array_buffer;
+}
+
 }  // namespace
 
 struct WebContents::FrameDispatchHelper {
@@ -640,7 +730,9 @@ void WebContents::ActivateContents(content::WebContents* source) {
 
 void WebContents::UpdateTargetURL(content::WebContents* source,
                                   const GURL& url) {
-  Emit("update-target-url", url);
+  // Fires on every link hover; skip the GURL conversion when unobserved.
+  if (IsEventObserved("update-target-url"))
+    Emit("update-target-url", url);
 }
 
 bool WebContents::IsPopupOrPanel(const content::WebContents* source) const {
@@ -802,12 +894,49 @@ void WebContents::RenderViewCreated(content::RenderViewHost* render_view_host) {
       render_view_host->GetRoutingID());
   if (impl)
     impl->disable_hidden_ = !background_throttling_;
+  render_view_host->GetWidget()->AddInputEventObserver(this);
 }
 
 void WebContents::RenderViewDeleted(content::RenderViewHost* render_view_host) {
+  render_view_host->GetWidget()->RemoveInputEventObserver(this);
   Emit("render-view-deleted", render_view_host->GetProcess()->GetID());
 }
 
+void WebContents::OnInputEvent(const blink::WebInputEvent& event) {
+  auto& pending = pending_input_acks_[static_cast<int>(event.GetType())];
+  // Bound the bookkeeping in case acks stop coming (renderer hang).
+  if (pending.size() >= 64)
+    pending.pop_front();
+  PendingInputAck entry;
+  entry.trace_id = next_input_trace_id_++;
+  entry.dispatch_time = base::TimeTicks::Now();
+  TRACE_EVENT_ASYNC_BEGIN1("input", "atom::InputEventAck", entry.trace_id,
+                           "type", static_cast<int>(event.GetType()));
+  pending.push_back(entry);
+  ++input_event_count_;
+}
+
+void WebContents::OnInputEventAck(const blink::WebInputEvent& event) {
+  auto it = pending_input_acks_.find(static_cast<int>(event.GetType()));
+  if (it == pending_input_acks_.end() || it->second.empty())
+    return;
+  PendingInputAck entry = it->second.front();
+  it->second.pop_front();
+  TRACE_EVENT_ASYNC_END0("input", "atom::InputEventAck", entry.trace_id);
+
+  double latency_ms =
+      (base::TimeTicks::Now() - entry.dispatch_time).InMillisecondsF();
+  if (latency_ms > input_latency_max_ms_)
+    input_latency_max_ms_ = latency_ms;
+  if (input_latency_samples_ms_.size() < kInputLatencySamples) {
+    input_latency_samples_ms_.push_back(latency_ms);
+  } else {
+    input_latency_samples_ms_[input_latency_cursor_] = latency_ms;
+    input_latency_cursor_ =
+        (input_latency_cursor_ + 1) % kInputLatencySamples;
+  }
+}
+
 void WebContents::RenderProcessGone(base::TerminationStatus status) {
   Emit("crashed", status == base::TERMINATION_STATUS_PROCESS_WAS_KILLED);
 }
@@ -849,10 +978,11 @@ void WebContents::DocumentLoadedInFrame(
 void WebContents::DidFinishLoad(content::RenderFrameHost* render_frame_host,
                                 const GURL& validated_url) {
   bool is_main_frame = !render_frame_host->GetParent();
-  int frame_process_id = render_frame_host->GetProcess()->GetID();
-  int frame_routing_id = render_frame_host->GetRoutingID();
-  Emit("did-frame-finish-load", is_main_frame, frame_process_id,
-       frame_routing_id);
+  if (IsEventObserved("did-frame-finish-load")) {
+    Emit("did-frame-finish-load", is_main_frame,
+         render_frame_host->GetProcess()->GetID(),
+         render_frame_host->GetRoutingID());
+  }
 
   if (is_main_frame)
     Emit("did-finish-load");
@@ -879,6 +1009,8 @@ void WebContents::DidStopLoading() {
 
 void WebContents::DidStartNavigation(
     content::NavigationHandle* navigation_handle) {
+  if (!IsEventObserved("did-start-navigation"))
+    return;
   bool is_main_frame = navigation_handle->IsInMainFrame();
   int frame_tree_node_id = navigation_handle->GetFrameTreeNodeId();
   content::FrameTreeNode* frame_tree_node =
@@ -918,8 +1050,10 @@ void WebContents::DidFinishNavigation(
     auto url = navigation_handle->GetURL();
     bool is_same_document = navigation_handle->IsSameDocument();
     if (is_same_document) {
-      Emit("did-navigate-in-page", url, is_main_frame, frame_process_id,
-           frame_routing_id);
+      if (IsEventObserved("did-navigate-in-page")) {
+        Emit("did-navigate-in-page", url, is_main_frame, frame_process_id,
+             frame_routing_id);
+      }
     } else {
       const net::HttpResponseHeaders* http_response =
           navigation_handle->GetResponseHeaders();
@@ -929,8 +1063,10 @@ void WebContents::DidFinishNavigation(
         http_status_text = http_response->GetStatusText();
         http_response_code = http_response->response_code();
       }
-      Emit("did-frame-navigate", url, http_response_code, http_status_text,
-           is_main_frame, frame_process_id, frame_routing_id);
+      if (IsEventObserved("did-frame-navigate")) {
+        Emit("did-frame-navigate", url, http_response_code, http_status_text,
+             is_main_frame, frame_process_id, frame_routing_id);
+      }
       if (is_main_frame) {
         Emit("did-navigate", url, http_response_code, http_status_text);
       }
@@ -1054,6 +1190,15 @@ bool WebContents::OnMessageReceived(const IPC::Message& message,
   FrameDispatchHelper helper = {this, frame_host};
   IPC_BEGIN_MESSAGE_MAP_WITH_PARAM(WebContents, message, frame_host)
     IPC_MESSAGE_HANDLER(AtomFrameHostMsg_Message, OnRendererMessage)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_Message_Serialized,
+                        OnRendererMessageSerialized)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_SharedBufferMessage,
+                        OnRendererSharedBufferMessage)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_StreamBegin, OnRendererStreamBegin)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_StreamChunk, OnRendererStreamChunk)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_StreamEnd, OnRendererStreamEnd)
+    IPC_MESSAGE_HANDLER(AtomFrameHostMsg_CreateTelemetryBuffer,
+                        OnCreateTelemetryBuffer)
     IPC_MESSAGE_FORWARD_DELAY_REPLY(AtomFrameHostMsg_Message_Sync, &helper,
                                     FrameDispatchHelper::OnRendererMessageSync)
     IPC_MESSAGE_FORWARD_DELAY_REPLY(
@@ -1243,6 +1388,19 @@ void WebContents::GoToOffset(int offset) {
   web_contents()->GetController().GoToOffset(offset);
 }
 
+void WebContents::TrimHistory(int max_entries) {
+  if (max_entries < 1)
+    return;
+  content::NavigationController& controller = web_contents()->GetController();
+  // Drop the oldest entries first; RemoveEntryAtIndex refuses to remove the
+  // last committed and pending entries, so the active page always survives.
+  while (controller.GetEntryCount() > max_entries) {
+    int index = controller.GetLastCommittedEntryIndex() == 0 ? 1 : 0;
+    if (!controller.RemoveEntryAtIndex(index))
+      break;
+  }
+}
+
 const std::string WebContents::GetWebRTCIPHandlingPolicy() const {
   return web_contents()->GetMutableRendererPrefs()->webrtc_ip_handling_policy;
 }
@@ -1275,10 +1433,25 @@ std::string WebContents::GetUserAgent() {
 bool WebContents::SavePage(const base::FilePath& full_file_path,
                            const content::SavePageType& save_type,
                            const SavePageHandler::SavePageCallback& callback) {
-  auto* handler = new SavePageHandler(web_contents(), callback);
+  auto* handler = new SavePageHandler(
+      web_contents(), callback,
+      base::Bind(&WebContents::EmitSavePageProgress, isolate(),
+                 weak_map_id()));
   return handler->Handle(full_file_path, save_type);
 }
 
+// static
+void WebContents::EmitSavePageProgress(v8::Isolate* isolate,
+                                       int32_t id,
+                                       int64_t received_bytes,
+                                       int percent) {
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  WebContents* web_contents = FromWeakMapID(isolate, id);
+  if (web_contents)
+    web_contents->Emit("save-page-progress", received_bytes, percent);
+}
+
 void WebContents::OpenDevTools(mate::Arguments* args) {
   if (type_ == REMOTE)
     return;
@@ -1450,11 +1623,17 @@ void WebContents::Print(mate::Arguments* args) {
     }
     print_view_manager_basic_ptr->SetCallback(callback);
   }
+  print_view_manager_basic_ptr->SetPageCallback(
+      base::Bind(&WebContents::OnPrintPageDone, base::Unretained(this)));
   print_view_manager_basic_ptr->PrintNow(
       web_contents()->GetMainFrame(), settings.silent,
       settings.print_background, settings.device_name);
 }
 
+void WebContents::OnPrintPageDone(int page_number, int page_count) {
+  Emit("print-page-done", page_number, page_count);
+}
+
 std::vector<printing::PrinterBasicInfo> WebContents::GetPrinterList() {
   std::vector<printing::PrinterBasicInfo> printers;
   auto print_backend = printing::PrintBackend::CreateInstance(nullptr);
@@ -1599,8 +1778,24 @@ bool WebContents::SendIPCMessage(bool all_frames,
   return false;
 }
 
+bool WebContents::SendToFrame(int32_t frame_id,
+                              const base::string16& channel,
+                              const base::ListValue& args) {
+  for (auto* frame_host : web_contents()->GetAllFrames()) {
+    if (frame_host->GetRoutingID() == frame_id) {
+      return frame_host->Send(
+          new AtomFrameMsg_MessageToFrame(frame_id, channel, args));
+    }
+  }
+  return false;
+}
+
 void WebContents::SendInputEvent(v8::Isolate* isolate,
                                  v8::Local<v8::Value> input_event) {
+  // Conversion cost shows up as this span; the dispatch->ack leg is the
+  // atom::InputEventAck async pair begun by OnInputEvent, and blink's
+  // own InputLatency events carry on to frame presentation.
+  TRACE_EVENT0("input", "WebContents::SendInputEvent");
   content::RenderWidgetHostView* view =
       web_contents()->GetRenderWidgetHostView();
   if (!view)
@@ -1648,6 +1843,174 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
       v8::Exception::Error(mate::StringToV8(isolate, "Invalid event object")));
 }
 
+struct WebContents::ParsedInputEvent {
+  ParsedInputEvent()
+      : keyboard(blink::WebKeyboardEvent::kRawKeyDown,
+                 blink::WebInputEvent::kNoModifiers,
+                 ui::EventTimeForNow()) {}
+
+  blink::WebInputEvent::Type type = blink::WebInputEvent::kUndefined;
+  // Only the member matching |type| is filled in.
+  blink::WebMouseEvent mouse;
+  blink::WebMouseWheelEvent wheel;
+  content::NativeWebKeyboardEvent keyboard;
+  // Replay offset relative to the start of the batch, in milliseconds.
+  double time_ms = 0;
+};
+
+void WebContents::SendInputEvents(v8::Isolate* isolate,
+                                  mate::Arguments* args) {
+  std::vector<v8::Local<v8::Value>> events;
+  if (!args->GetNext(&events)) {
+    args->ThrowError();
+    return;
+  }
+
+  // Convert the whole batch before injecting anything, so a malformed
+  // entry rejects the batch instead of replaying half of it.
+  auto parsed = std::make_shared<std::vector<ParsedInputEvent>>();
+  parsed->reserve(events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    ParsedInputEvent entry;
+    entry.type = mate::GetWebInputEventType(isolate, events[i]);
+    bool converted = false;
+    if (blink::WebInputEvent::IsMouseEventType(entry.type))
+      converted = mate::ConvertFromV8(isolate, events[i], &entry.mouse);
+    else if (blink::WebInputEvent::IsKeyboardEventType(entry.type))
+      converted = mate::ConvertFromV8(isolate, events[i], &entry.keyboard);
+    else if (entry.type == blink::WebInputEvent::kMouseWheel)
+      converted = mate::ConvertFromV8(isolate, events[i], &entry.wheel);
+    if (!converted) {
+      args->ThrowError("Invalid event object at index " +
+                       base::SizeTToString(i));
+      return;
+    }
+    mate::Dictionary dict;
+    if (mate::ConvertFromV8(isolate, events[i], &dict))
+      dict.Get("time", &entry.time_ms);
+    parsed->push_back(entry);
+  }
+
+  DispatchInputEventBatch(isolate, weak_map_id(), parsed, 0,
+                          base::TimeTicks::Now());
+}
+
+// static
+void WebContents::DispatchInputEventBatch(
+    v8::Isolate* isolate,
+    int32_t id,
+    std::shared_ptr<std::vector<ParsedInputEvent>> events,
+    size_t index,
+    base::TimeTicks start) {
+  WebContents* web_contents = FromWeakMapID(isolate, id);
+  if (!web_contents)
+    return;
+
+  while (index < events->size()) {
+    const ParsedInputEvent& entry = (*events)[index];
+    base::TimeDelta due = base::TimeDelta::FromMillisecondsD(entry.time_ms);
+    base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+    if (due > elapsed) {
+      base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
+          FROM_HERE,
+          base::BindOnce(&WebContents::DispatchInputEventBatch, isolate, id,
+                         events, index, start),
+          due - elapsed);
+      return;
+    }
+
+    content::RenderWidgetHostView* view =
+        web_contents->web_contents()->GetRenderWidgetHostView();
+    if (!view)
+      return;
+    content::RenderWidgetHost* rwh = view->GetRenderWidgetHost();
+
+    if (blink::WebInputEvent::IsMouseEventType(entry.type)) {
+      if (web_contents->IsOffScreen()) {
+#if defined(ENABLE_OSR)
+        web_contents->GetOffScreenRenderWidgetHostView()->SendMouseEvent(
+            entry.mouse);
+#endif
+      } else {
+        rwh->ForwardMouseEvent(entry.mouse);
+      }
+    } else if (blink::WebInputEvent::IsKeyboardEventType(entry.type)) {
+      rwh->ForwardKeyboardEvent(entry.keyboard);
+    } else if (entry.type == blink::WebInputEvent::kMouseWheel) {
+      if (web_contents->IsOffScreen()) {
+#if defined(ENABLE_OSR)
+        web_contents->GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(
+            entry.wheel);
+#endif
+      } else {
+        rwh->ForwardWheelEvent(entry.wheel);
+      }
+    }
+    index++;
+  }
+}
+
+v8::Local<v8::Value> WebContents::GetInputLatencyStats(v8::Isolate* isolate) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("eventCount", static_cast<double>(input_event_count_));
+  dict.Set("sampleCount",
+           static_cast<int>(input_latency_samples_ms_.size()));
+  dict.Set("maxMs", input_latency_max_ms_);
+
+  std::vector<double> sorted = input_latency_samples_ms_;
+  if (sorted.empty()) {
+    dict.Set("meanMs", 0.0);
+    dict.Set("p50Ms", 0.0);
+    dict.Set("p90Ms", 0.0);
+    dict.Set("p99Ms", 0.0);
+    return dict.GetHandle();
+  }
+
+  std::sort(sorted.begin(), sorted.end());
+  double sum = 0;
+  for (double sample : sorted)
+    sum += sample;
+  dict.Set("meanMs", sum / sorted.size());
+  dict.Set("p50Ms", sorted[sorted.size() / 2]);
+  dict.Set("p90Ms", sorted[(sorted.size() * 9) / 10]);
+  dict.Set("p99Ms", sorted[(sorted.size() * 99) / 100]);
+  return dict.GetHandle();
+}
+
+void WebContents::SendMemoryPressure(bool critical) {
+  auto* host = web_contents()->GetRenderViewHost();
+  if (!host)
+    return;
+  int32_t level =
+      critical ? base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL
+               : base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE;
+  host->Send(new AtomViewMsg_MemoryPressure(host->GetRoutingID(), level));
+}
+
+void WebContents::NotifyMemoryPressure(const std::string& level,
+                                       mate::Arguments* args) {
+  if (level != "moderate" && level != "critical") {
+    args->ThrowError("Invalid memory pressure level " + level);
+    return;
+  }
+  SendMemoryPressure(level == "critical");
+}
+
+void WebContents::SetBackgroundPriority(bool background) {
+  auto* host = web_contents()->GetMainFrame()->GetProcess();
+  base::ProcessHandle handle = host->GetHandle();
+  if (handle == base::kNullProcessHandle)
+    return;
+#if defined(OS_MACOSX)
+  // Backgrounding on Mac needs the task port of the target process,
+  // which only its launcher holds; leave the priority alone there.
+#else
+  base::Process process =
+      base::Process::DeprecatedGetProcessFromHandle(handle);
+  process.SetProcessBackgrounded(background);
+#endif
+}
+
 void WebContents::BeginFrameSubscription(mate::Arguments* args) {
   bool only_dirty = false;
   FrameSubscriber::FrameCaptureCallback callback;
@@ -1662,6 +2025,17 @@ void WebContents::BeginFrameSubscription(mate::Arguments* args) {
       new FrameSubscriber(isolate(), web_contents(), callback, only_dirty));
 }
 
+void WebContents::BeginSharedFrameSubscription(mate::Arguments* args) {
+  FrameSubscriber::SharedFrameCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  frame_subscriber_.reset(
+      new FrameSubscriber(isolate(), web_contents(), callback));
+}
+
 void WebContents::EndFrameSubscription() {
   frame_subscriber_.reset();
 }
@@ -1705,11 +2079,27 @@ void WebContents::StartDrag(const mate::Dictionary& item,
 
 void WebContents::CapturePage(mate::Arguments* args) {
   gfx::Rect rect;
+  double scale = 1.0;
+  gfx::Size output_size;
   base::Callback<void(const gfx::Image&)> callback;
 
-  if (!(args->Length() == 1 && args->GetNext(&callback)) &&
-      !(args->Length() == 2 && args->GetNext(&rect) &&
-        args->GetNext(&callback))) {
+  // capturePage([rect, ]callback) and capturePage(options, callback).
+  if (args->Length() == 2) {
+    mate::Dictionary options;
+    if (!args->GetNext(&rect)) {
+      if (!args->GetNext(&options)) {
+        args->ThrowError();
+        return;
+      }
+      options.Get("rect", &rect);
+      options.Get("scale", &scale);
+      options.Get("size", &output_size);
+    }
+    if (!args->GetNext(&callback)) {
+      args->ThrowError();
+      return;
+    }
+  } else if (!(args->Length() == 1 && args->GetNext(&callback))) {
     args->ThrowError();
     return;
   }
@@ -1729,10 +2119,18 @@ void WebContents::CapturePage(mate::Arguments* args) {
   // current system, increase the requested bitmap size to capture it all.
   gfx::Size bitmap_size = view_size;
   const gfx::NativeView native_view = view->GetNativeView();
-  const float scale = display::Screen::GetScreen()
-                          ->GetDisplayNearestView(native_view)
-                          .device_scale_factor();
-  if (scale > 1.0f)
+  const float device_scale = display::Screen::GetScreen()
+                                 ->GetDisplayNearestView(native_view)
+                                 .device_scale_factor();
+  if (device_scale > 1.0f)
+    bitmap_size = gfx::ScaleToCeiledSize(view_size, device_scale);
+
+  // An explicit output size or scale overrides the default; the compositor
+  // scales the frame on the GPU before readback, so a downscaled capture
+  // reads back proportionally fewer bytes.
+  if (!output_size.IsEmpty())
+    bitmap_size = output_size;
+  else if (scale > 0 && scale != 1.0)
     bitmap_size = gfx::ScaleToCeiledSize(view_size, scale);
 
   view->CopyFromSurface(gfx::Rect(rect.origin(), view_size), bitmap_size,
@@ -1740,6 +2138,12 @@ void WebContents::CapturePage(mate::Arguments* args) {
 }
 
 void WebContents::OnCursorChange(const content::WebCursor& cursor) {
+  // Cursor changes arrive on every mouse move across element boundaries;
+  // skip the conversion work (including the custom cursor bitmap copy)
+  // when nothing subscribed.
+  if (!IsEventObserved("cursor-changed"))
+    return;
+
   content::CursorInfo info;
   cursor.GetCursorInfo(&info);
 
@@ -1773,6 +2177,28 @@ bool WebContents::IsOffScreen() const {
 
 void WebContents::OnPaint(const gfx::Rect& dirty_rect, const SkBitmap& bitmap) {
   Emit("paint", dirty_rect, gfx::Image::CreateFrom1xBitmap(bitmap));
+
+#if defined(ENABLE_OSR)
+  if (video_encode_requested_) {
+    gfx::Size frame_size(bitmap.width(), bitmap.height());
+    // Restart the encoder when the view is resized; its input size is
+    // fixed at initialization.
+    if (osr_video_encoder_ && osr_video_encoder_->visible_size() != frame_size)
+      osr_video_encoder_.reset();
+    if (!osr_video_encoder_) {
+      osr_video_encoder_.reset(new OffScreenVideoEncoder(
+          base::Bind(&WebContents::OnEncodedPacket, base::Unretained(this)),
+          base::Bind(&WebContents::OnVideoEncodeError,
+                     base::Unretained(this))));
+      if (!osr_video_encoder_->Initialize(frame_size,
+                                          video_encode_bitrate_)) {
+        OnVideoEncodeError();
+        return;
+      }
+    }
+    osr_video_encoder_->EncodeFrame(bitmap, base::TimeTicks::Now());
+  }
+#endif
 }
 
 void WebContents::StartPainting() {
@@ -1832,6 +2258,173 @@ int WebContents::GetFrameRate() const {
 #endif
 }
 
+void WebContents::SetAdaptiveFrameRate(bool adaptive) {
+  if (!IsOffScreen())
+    return;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (osr_wcv)
+    osr_wcv->SetAdaptiveFrameRate(adaptive);
+#endif
+}
+
+bool WebContents::UsesAdaptiveFrameRate() const {
+  if (!IsOffScreen())
+    return false;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  return osr_wcv && osr_wcv->UsesAdaptiveFrameRate();
+#else
+  return false;
+#endif
+}
+
+int WebContents::GetEffectiveFrameRate() const {
+  if (!IsOffScreen())
+    return 0;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  return osr_wcv ? osr_wcv->GetEffectiveFrameRate() : 0;
+#else
+  return 0;
+#endif
+}
+
+void WebContents::SetAsynchronousPaintDispatch(bool enabled) {
+  if (!IsOffScreen())
+    return;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (osr_wcv)
+    osr_wcv->SetAsynchronousPaintDispatch(enabled);
+#endif
+}
+
+bool WebContents::UsesAsynchronousPaintDispatch() const {
+  if (!IsOffScreen())
+    return false;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  return osr_wcv && osr_wcv->UsesAsynchronousPaintDispatch();
+#else
+  return false;
+#endif
+}
+
+void WebContents::SetPaintDamagedRegionOnly(bool enabled) {
+  if (!IsOffScreen())
+    return;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  if (osr_wcv)
+    osr_wcv->SetPaintDamagedRegionOnly(enabled);
+#endif
+}
+
+bool WebContents::PaintsDamagedRegionOnly() const {
+  if (!IsOffScreen())
+    return false;
+
+#if defined(ENABLE_OSR)
+  auto* osr_wcv = GetOffScreenWebContentsView();
+  return osr_wcv && osr_wcv->PaintsDamagedRegionOnly();
+#else
+  return false;
+#endif
+}
+
+v8::Local<v8::Value> WebContents::GetPaintStats(v8::Isolate* isolate) {
+  mate::Dictionary stats = mate::Dictionary::CreateEmpty(isolate);
+  stats.Set("framesDelivered", 0);
+  stats.Set("framesDropped", 0);
+  stats.Set("meanPaintLatency", 0.0);
+  stats.Set("effectiveFrameRate", 0);
+
+#if defined(ENABLE_OSR)
+  auto* osr_rwhv = GetOffScreenRenderWidgetHostView();
+  if (IsOffScreen() && osr_rwhv) {
+    stats.Set("framesDelivered", osr_rwhv->frames_delivered());
+    stats.Set("framesDropped", osr_rwhv->frames_dropped());
+    stats.Set("meanPaintLatency",
+              osr_rwhv->GetMeanPaintLatency().InMillisecondsF());
+    stats.Set("effectiveFrameRate", osr_rwhv->GetEffectiveFrameRate());
+  }
+#endif
+
+  return stats.GetHandle();
+}
+
+void WebContents::StartVideoEncode(mate::Arguments* args) {
+  if (!IsOffScreen())
+    return;
+
+#if defined(ENABLE_OSR)
+  uint32_t bitrate = 4000000;
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("bitrate", &bitrate);
+
+  video_encode_bitrate_ = bitrate;
+  video_encode_requested_ = true;
+#endif
+}
+
+void WebContents::StopVideoEncode() {
+#if defined(ENABLE_OSR)
+  video_encode_requested_ = false;
+  // This may run from inside an 'encoded-frame' handler, i.e. while the
+  // encoder is on the stack, so delete it asynchronously.
+  if (osr_video_encoder_) {
+    content::BrowserThread::DeleteSoon(content::BrowserThread::UI, FROM_HERE,
+                                       osr_video_encoder_.release());
+  }
+#endif
+}
+
+bool WebContents::IsVideoEncoding() const {
+#if defined(ENABLE_OSR)
+  return video_encode_requested_;
+#else
+  return false;
+#endif
+}
+
+#if defined(ENABLE_OSR)
+void WebContents::OnEncodedPacket(const uint8_t* data,
+                                  size_t size,
+                                  base::TimeDelta timestamp,
+                                  bool key_frame) {
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+
+  v8::Local<v8::Value> buffer =
+      node::Buffer::Copy(isolate(), reinterpret_cast<const char*>(data), size)
+          .ToLocalChecked();
+  mate::Dictionary packet = mate::Dictionary::CreateEmpty(isolate());
+  packet.Set("data", buffer);
+  packet.Set("timestamp", timestamp.InMillisecondsF());
+  packet.Set("keyFrame", key_frame);
+  Emit("encoded-frame", packet);
+}
+
+void WebContents::OnVideoEncodeError() {
+  video_encode_requested_ = false;
+  // Errors are reported from inside the encoder, so it cannot be deleted
+  // while its frames are still on the stack.
+  if (osr_video_encoder_) {
+    content::BrowserThread::DeleteSoon(content::BrowserThread::UI, FROM_HERE,
+                                       osr_video_encoder_.release());
+  }
+  Emit("video-encode-error");
+}
+#endif
+
 void WebContents::Invalidate() {
   if (IsOffScreen()) {
 #if defined(ENABLE_OSR)
@@ -1988,95 +2581,120 @@ void WebContents::BuildPrototype(v8::Isolate* isolate,
   prototype->SetClassName(mate::StringToV8(isolate, "WebContents"));
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .MakeDestroyable()
-      .SetMethod("getId", &WebContents::GetID)
-      .SetMethod("getProcessId", &WebContents::GetProcessID)
-      .SetMethod("getOSProcessId", &WebContents::GetOSProcessID)
-      .SetMethod("equal", &WebContents::Equal)
-      .SetMethod("_loadURL", &WebContents::LoadURL)
-      .SetMethod("downloadURL", &WebContents::DownloadURL)
-      .SetMethod("_getURL", &WebContents::GetURL)
-      .SetMethod("getTitle", &WebContents::GetTitle)
-      .SetMethod("isLoading", &WebContents::IsLoading)
-      .SetMethod("isLoadingMainFrame", &WebContents::IsLoadingMainFrame)
-      .SetMethod("isWaitingForResponse", &WebContents::IsWaitingForResponse)
-      .SetMethod("_stop", &WebContents::Stop)
-      .SetMethod("_goBack", &WebContents::GoBack)
-      .SetMethod("_goForward", &WebContents::GoForward)
-      .SetMethod("_goToOffset", &WebContents::GoToOffset)
-      .SetMethod("isCrashed", &WebContents::IsCrashed)
-      .SetMethod("setUserAgent", &WebContents::SetUserAgent)
-      .SetMethod("getUserAgent", &WebContents::GetUserAgent)
-      .SetMethod("savePage", &WebContents::SavePage)
-      .SetMethod("openDevTools", &WebContents::OpenDevTools)
-      .SetMethod("closeDevTools", &WebContents::CloseDevTools)
-      .SetMethod("isDevToolsOpened", &WebContents::IsDevToolsOpened)
-      .SetMethod("isDevToolsFocused", &WebContents::IsDevToolsFocused)
-      .SetMethod("enableDeviceEmulation", &WebContents::EnableDeviceEmulation)
-      .SetMethod("disableDeviceEmulation", &WebContents::DisableDeviceEmulation)
-      .SetMethod("toggleDevTools", &WebContents::ToggleDevTools)
-      .SetMethod("inspectElement", &WebContents::InspectElement)
-      .SetMethod("setIgnoreMenuShortcuts", &WebContents::SetIgnoreMenuShortcuts)
-      .SetMethod("setAudioMuted", &WebContents::SetAudioMuted)
-      .SetMethod("isAudioMuted", &WebContents::IsAudioMuted)
-      .SetMethod("undo", &WebContents::Undo)
-      .SetMethod("redo", &WebContents::Redo)
-      .SetMethod("cut", &WebContents::Cut)
-      .SetMethod("copy", &WebContents::Copy)
-      .SetMethod("paste", &WebContents::Paste)
-      .SetMethod("pasteAndMatchStyle", &WebContents::PasteAndMatchStyle)
-      .SetMethod("delete", &WebContents::Delete)
-      .SetMethod("selectAll", &WebContents::SelectAll)
-      .SetMethod("unselect", &WebContents::Unselect)
-      .SetMethod("replace", &WebContents::Replace)
-      .SetMethod("replaceMisspelling", &WebContents::ReplaceMisspelling)
-      .SetMethod("findInPage", &WebContents::FindInPage)
-      .SetMethod("stopFindInPage", &WebContents::StopFindInPage)
-      .SetMethod("focus", &WebContents::Focus)
-      .SetMethod("isFocused", &WebContents::IsFocused)
-      .SetMethod("tabTraverse", &WebContents::TabTraverse)
-      .SetMethod("_send", &WebContents::SendIPCMessage)
-      .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
-      .SetMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
-      .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
-      .SetMethod("startDrag", &WebContents::StartDrag)
-      .SetMethod("setSize", &WebContents::SetSize)
-      .SetMethod("isGuest", &WebContents::IsGuest)
-      .SetMethod("isOffscreen", &WebContents::IsOffScreen)
-      .SetMethod("startPainting", &WebContents::StartPainting)
-      .SetMethod("stopPainting", &WebContents::StopPainting)
-      .SetMethod("isPainting", &WebContents::IsPainting)
-      .SetMethod("setFrameRate", &WebContents::SetFrameRate)
-      .SetMethod("getFrameRate", &WebContents::GetFrameRate)
-      .SetMethod("invalidate", &WebContents::Invalidate)
-      .SetMethod("setZoomLevel", &WebContents::SetZoomLevel)
-      .SetMethod("_getZoomLevel", &WebContents::GetZoomLevel)
-      .SetMethod("setZoomFactor", &WebContents::SetZoomFactor)
-      .SetMethod("_getZoomFactor", &WebContents::GetZoomFactor)
-      .SetMethod("getType", &WebContents::GetType)
-      .SetMethod("getWebPreferences", &WebContents::GetWebPreferences)
-      .SetMethod("getLastWebPreferences", &WebContents::GetLastWebPreferences)
-      .SetMethod("getOwnerBrowserWindow", &WebContents::GetOwnerBrowserWindow)
-      .SetMethod("hasServiceWorker", &WebContents::HasServiceWorker)
-      .SetMethod("unregisterServiceWorker",
+      .SetLazyMethod("getId", &WebContents::GetID)
+      .SetLazyMethod("getProcessId", &WebContents::GetProcessID)
+      .SetLazyMethod("getOSProcessId", &WebContents::GetOSProcessID)
+      .SetLazyMethod("equal", &WebContents::Equal)
+      .SetLazyMethod("_loadURL", &WebContents::LoadURL)
+      .SetLazyMethod("downloadURL", &WebContents::DownloadURL)
+      .SetLazyMethod("_getURL", &WebContents::GetURL)
+      .SetLazyMethod("getTitle", &WebContents::GetTitle)
+      .SetLazyMethod("isLoading", &WebContents::IsLoading)
+      .SetLazyMethod("isLoadingMainFrame", &WebContents::IsLoadingMainFrame)
+      .SetLazyMethod("isWaitingForResponse", &WebContents::IsWaitingForResponse)
+      .SetLazyMethod("_stop", &WebContents::Stop)
+      .SetLazyMethod("_goBack", &WebContents::GoBack)
+      .SetLazyMethod("_goForward", &WebContents::GoForward)
+      .SetLazyMethod("_goToOffset", &WebContents::GoToOffset)
+      .SetLazyMethod("_trimHistory", &WebContents::TrimHistory)
+      .SetLazyMethod("isCrashed", &WebContents::IsCrashed)
+      .SetLazyMethod("setUserAgent", &WebContents::SetUserAgent)
+      .SetLazyMethod("getUserAgent", &WebContents::GetUserAgent)
+      .SetLazyMethod("savePage", &WebContents::SavePage)
+      .SetLazyMethod("openDevTools", &WebContents::OpenDevTools)
+      .SetLazyMethod("closeDevTools", &WebContents::CloseDevTools)
+      .SetLazyMethod("isDevToolsOpened", &WebContents::IsDevToolsOpened)
+      .SetLazyMethod("isDevToolsFocused", &WebContents::IsDevToolsFocused)
+      .SetLazyMethod("enableDeviceEmulation", &WebContents::EnableDeviceEmulation)
+      .SetLazyMethod("disableDeviceEmulation", &WebContents::DisableDeviceEmulation)
+      .SetLazyMethod("toggleDevTools", &WebContents::ToggleDevTools)
+      .SetLazyMethod("inspectElement", &WebContents::InspectElement)
+      .SetLazyMethod("setIgnoreMenuShortcuts", &WebContents::SetIgnoreMenuShortcuts)
+      .SetLazyMethod("setAudioMuted", &WebContents::SetAudioMuted)
+      .SetLazyMethod("isAudioMuted", &WebContents::IsAudioMuted)
+      .SetLazyMethod("undo", &WebContents::Undo)
+      .SetLazyMethod("redo", &WebContents::Redo)
+      .SetLazyMethod("cut", &WebContents::Cut)
+      .SetLazyMethod("copy", &WebContents::Copy)
+      .SetLazyMethod("paste", &WebContents::Paste)
+      .SetLazyMethod("pasteAndMatchStyle", &WebContents::PasteAndMatchStyle)
+      .SetLazyMethod("delete", &WebContents::Delete)
+      .SetLazyMethod("selectAll", &WebContents::SelectAll)
+      .SetLazyMethod("unselect", &WebContents::Unselect)
+      .SetLazyMethod("replace", &WebContents::Replace)
+      .SetLazyMethod("replaceMisspelling", &WebContents::ReplaceMisspelling)
+      .SetLazyMethod("findInPage", &WebContents::FindInPage)
+      .SetLazyMethod("stopFindInPage", &WebContents::StopFindInPage)
+      .SetLazyMethod("focus", &WebContents::Focus)
+      .SetLazyMethod("isFocused", &WebContents::IsFocused)
+      .SetLazyMethod("tabTraverse", &WebContents::TabTraverse)
+      .SetLazyMethod("_send", &WebContents::SendIPCMessage)
+      .SetLazyMethod("_sendToFrame", &WebContents::SendToFrame)
+      .SetLazyMethod("sendInputEvent", &WebContents::SendInputEvent)
+      .SetLazyMethod("sendInputEvents", &WebContents::SendInputEvents)
+      .SetMethod("getInputLatencyStats", &WebContents::GetInputLatencyStats)
+      .SetMethod("notifyMemoryPressure", &WebContents::NotifyMemoryPressure)
+      .SetMethod("setBackgroundPriority", &WebContents::SetBackgroundPriority)
+      .SetLazyMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
+      .SetLazyMethod("beginSharedFrameSubscription",
+                     &WebContents::BeginSharedFrameSubscription)
+      .SetLazyMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
+      .SetLazyMethod("startDrag", &WebContents::StartDrag)
+      .SetLazyMethod("setSize", &WebContents::SetSize)
+      .SetLazyMethod("isGuest", &WebContents::IsGuest)
+      .SetLazyMethod("isOffscreen", &WebContents::IsOffScreen)
+      .SetLazyMethod("startPainting", &WebContents::StartPainting)
+      .SetLazyMethod("stopPainting", &WebContents::StopPainting)
+      .SetLazyMethod("isPainting", &WebContents::IsPainting)
+      .SetLazyMethod("setFrameRate", &WebContents::SetFrameRate)
+      .SetLazyMethod("getFrameRate", &WebContents::GetFrameRate)
+      .SetLazyMethod("setAdaptiveFrameRate", &WebContents::SetAdaptiveFrameRate)
+      .SetLazyMethod("usesAdaptiveFrameRate",
+                     &WebContents::UsesAdaptiveFrameRate)
+      .SetLazyMethod("getEffectiveFrameRate",
+                     &WebContents::GetEffectiveFrameRate)
+      .SetLazyMethod("setAsynchronousPaintDispatch",
+                     &WebContents::SetAsynchronousPaintDispatch)
+      .SetLazyMethod("usesAsynchronousPaintDispatch",
+                     &WebContents::UsesAsynchronousPaintDispatch)
+      .SetLazyMethod("setPaintDamagedRegionOnly",
+                     &WebContents::SetPaintDamagedRegionOnly)
+      .SetLazyMethod("paintsDamagedRegionOnly",
+                     &WebContents::PaintsDamagedRegionOnly)
+      .SetLazyMethod("getPaintStats", &WebContents::GetPaintStats)
+      .SetLazyMethod("startVideoEncode", &WebContents::StartVideoEncode)
+      .SetLazyMethod("stopVideoEncode", &WebContents::StopVideoEncode)
+      .SetLazyMethod("isVideoEncoding", &WebContents::IsVideoEncoding)
+      .SetLazyMethod("invalidate", &WebContents::Invalidate)
+      .SetLazyMethod("setZoomLevel", &WebContents::SetZoomLevel)
+      .SetLazyMethod("_getZoomLevel", &WebContents::GetZoomLevel)
+      .SetLazyMethod("setZoomFactor", &WebContents::SetZoomFactor)
+      .SetLazyMethod("_getZoomFactor", &WebContents::GetZoomFactor)
+      .SetLazyMethod("getType", &WebContents::GetType)
+      .SetLazyMethod("getWebPreferences", &WebContents::GetWebPreferences)
+      .SetLazyMethod("getLastWebPreferences", &WebContents::GetLastWebPreferences)
+      .SetLazyMethod("getOwnerBrowserWindow", &WebContents::GetOwnerBrowserWindow)
+      .SetLazyMethod("hasServiceWorker", &WebContents::HasServiceWorker)
+      .SetLazyMethod("unregisterServiceWorker",
                  &WebContents::UnregisterServiceWorker)
-      .SetMethod("inspectServiceWorker", &WebContents::InspectServiceWorker)
-      .SetMethod("print", &WebContents::Print)
-      .SetMethod("getPrinters", &WebContents::GetPrinterList)
-      .SetMethod("_printToPDF", &WebContents::PrintToPDF)
-      .SetMethod("addWorkSpace", &WebContents::AddWorkSpace)
-      .SetMethod("removeWorkSpace", &WebContents::RemoveWorkSpace)
-      .SetMethod("showDefinitionForSelection",
+      .SetLazyMethod("inspectServiceWorker", &WebContents::InspectServiceWorker)
+      .SetLazyMethod("print", &WebContents::Print)
+      .SetLazyMethod("getPrinters", &WebContents::GetPrinterList)
+      .SetLazyMethod("_printToPDF", &WebContents::PrintToPDF)
+      .SetLazyMethod("addWorkSpace", &WebContents::AddWorkSpace)
+      .SetLazyMethod("removeWorkSpace", &WebContents::RemoveWorkSpace)
+      .SetLazyMethod("showDefinitionForSelection",
                  &WebContents::ShowDefinitionForSelection)
-      .SetMethod("copyImageAt", &WebContents::CopyImageAt)
-      .SetMethod("capturePage", &WebContents::CapturePage)
-      .SetMethod("setEmbedder", &WebContents::SetEmbedder)
-      .SetMethod("setDevToolsWebContents", &WebContents::SetDevToolsWebContents)
-      .SetMethod("getNativeView", &WebContents::GetNativeView)
-      .SetMethod("setWebRTCIPHandlingPolicy",
+      .SetLazyMethod("copyImageAt", &WebContents::CopyImageAt)
+      .SetLazyMethod("capturePage", &WebContents::CapturePage)
+      .SetLazyMethod("setEmbedder", &WebContents::SetEmbedder)
+      .SetLazyMethod("setDevToolsWebContents", &WebContents::SetDevToolsWebContents)
+      .SetLazyMethod("getNativeView", &WebContents::GetNativeView)
+      .SetLazyMethod("setWebRTCIPHandlingPolicy",
                  &WebContents::SetWebRTCIPHandlingPolicy)
-      .SetMethod("getWebRTCIPHandlingPolicy",
+      .SetLazyMethod("getWebRTCIPHandlingPolicy",
                  &WebContents::GetWebRTCIPHandlingPolicy)
-      .SetMethod("_grantOriginAccess", &WebContents::GrantOriginAccess)
+      .SetLazyMethod("_grantOriginAccess", &WebContents::GrantOriginAccess)
       .SetProperty("id", &WebContents::ID)
       .SetProperty("session", &WebContents::Session)
       .SetProperty("hostWebContents", &WebContents::HostWebContents)
@@ -2091,16 +2709,192 @@ AtomBrowserContext* WebContents::GetBrowserContext() const {
 void WebContents::OnRendererMessage(content::RenderFrameHost* frame_host,
                                     const base::string16& channel,
                                     const base::ListValue& args) {
-  // webContents.emit(channel, new Event(), args...);
-  Emit(base::UTF16ToUTF8(channel), args);
+  // Convert the channel once; both the metrics record and the emit
+  // below read it as a borrowed piece.
+  std::string channel_utf8 = base::UTF16ToUTF8(channel);
+  TRACE_EVENT1("electron.ipc", "WebContents::OnRendererMessage", "channel",
+               channel_utf8);
+  ScopedIPCMetricsRecord record(channel_utf8, args);
+  // webContents.emit(channel, new Event(), args...); passing the frame
+  // puts event.frameId on the event so replies can target it directly.
+  EmitWithSender(channel_utf8, frame_host, nullptr, args);
+}
+
+void WebContents::OnRendererMessageSerialized(
+    content::RenderFrameHost* frame_host,
+    const base::string16& channel,
+    const std::string& args) {
+  TRACE_EVENT1("electron.ipc", "WebContents::OnRendererMessageSerialized",
+               "size", args.size());
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Object> wrapper = GetWrapper();
+  if (wrapper.IsEmpty())
+    return;
+
+  ScopedIPCMetricsRecord record(base::UTF16ToUTF8(channel), args.size());
+  // Decode the structured clone blob in the wrapper's context; this is
+  // the single deserialization the payload sees after leaving V8 in the
+  // renderer.
+  v8::Local<v8::Context> context = wrapper->CreationContext();
+  v8::Context::Scope context_scope(context);
+  EmitWithSender(base::UTF16ToUTF8(channel), frame_host, nullptr,
+                 DeserializeV8Value(isolate(), args));
+}
+
+void WebContents::OnRendererSharedBufferMessage(
+    content::RenderFrameHost* frame_host,
+    const base::string16& channel,
+    const base::SharedMemoryHandle& handle,
+    uint32_t size) {
+  auto shared_memory =
+      std::make_unique<base::SharedMemory>(handle, true /* read_only */);
+  if (!shared_memory->Map(std::max(size, uint32_t{1})))
+    return;
+
+  // |size| comes from the renderer; never trust it past the region that
+  // was actually mapped.
+  size_t safe_size =
+      std::min(static_cast<size_t>(size), shared_memory->mapped_size());
+  // Copy into a JS-owned buffer. The mapping is read-only, so handing
+  // scripts a plain ArrayBuffer over it would crash the browser process
+  // on the first write to the buffer.
+  std::string data(static_cast<const char*>(shared_memory->memory()),
+                   safe_size);
+
+  ScopedIPCMetricsRecord record(base::UTF16ToUTF8(channel), safe_size);
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Value> buffer = WrapStreamBuffer(isolate(), std::move(data));
+  // webContents.emit('ipc-message-buffer', new Event(), channel, buffer);
+  Emit("ipc-message-buffer", channel, buffer);
+}
+
+void WebContents::OnRendererStreamBegin(content::RenderFrameHost* frame_host,
+                                        const base::string16& channel,
+                                        int32_t stream_id,
+                                        uint64_t total_size) {
+  IPCStream& stream = ipc_streams_[std::make_pair(
+      frame_host->GetProcess()->GetID(), stream_id)];
+  stream.channel = channel;
+  stream.total_size = total_size;
+}
+
+void WebContents::OnRendererStreamChunk(content::RenderFrameHost* frame_host,
+                                        int32_t stream_id,
+                                        const std::string& data) {
+  auto iter = ipc_streams_.find(
+      std::make_pair(frame_host->GetProcess()->GetID(), stream_id));
+  if (iter == ipc_streams_.end())
+    return;
+
+  IPCStream& stream = iter->second;
+  if (stream.data.size() + data.size() > stream.total_size) {
+    // The renderer sent more than it announced; drop the stream.
+    ipc_streams_.erase(iter);
+    return;
+  }
+
+  stream.data.append(data);
+  // Acknowledge so the renderer can advance its in-flight window.
+  frame_host->Send(new AtomFrameMsg_StreamAck(
+      frame_host->GetRoutingID(), stream_id, stream.data.size()));
+}
+
+void WebContents::OnRendererStreamEnd(content::RenderFrameHost* frame_host,
+                                      int32_t stream_id) {
+  auto iter = ipc_streams_.find(
+      std::make_pair(frame_host->GetProcess()->GetID(), stream_id));
+  if (iter == ipc_streams_.end())
+    return;
+
+  IPCStream stream = std::move(iter->second);
+  ipc_streams_.erase(iter);
+  if (stream.data.size() != stream.total_size)
+    return;
+
+  ScopedIPCMetricsRecord record(base::UTF16ToUTF8(stream.channel),
+                                stream.data.size());
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Value> buffer =
+      WrapStreamBuffer(isolate(), std::move(stream.data));
+  // webContents.emit('ipc-message-buffer', new Event(), channel, buffer);
+  Emit("ipc-message-buffer", stream.channel, buffer);
+}
+
+void WebContents::OnCreateTelemetryBuffer(
+    content::RenderFrameHost* frame_host,
+    uint32_t requested_size,
+    base::SharedMemoryHandle* handle,
+    uint32_t* actual_size) {
+  *handle = base::SharedMemoryHandle();
+  *actual_size = 0;
+
+  uint32_t size = std::min(std::max(requested_size, uint32_t{4096}),
+                           uint32_t{16 * 1024 * 1024});
+  auto shared_memory = std::make_unique<base::SharedMemory>();
+  if (!shared_memory->CreateAndMapAnonymous(size))
+    return;
+  if (!SharedMemoryRingBuffer::Initialize(shared_memory->memory(), size))
+    return;
+
+  *handle = shared_memory->handle().Duplicate();
+  *actual_size = size;
+  telemetry_buffers_.push_back(std::move(shared_memory));
+  if (!telemetry_timer_.IsRunning()) {
+    telemetry_timer_.Start(FROM_HERE,
+                           base::TimeDelta::FromMilliseconds(250), this,
+                           &WebContents::DrainTelemetryBuffers);
+  }
+}
+
+void WebContents::DrainTelemetryBuffers() {
+  // Bound the work per tick so a chatty renderer cannot monopolize the
+  // UI thread.
+  const size_t kMaxRecordsPerDrain = 512;
+
+  std::vector<std::string> records;
+  for (const auto& shared_memory : telemetry_buffers_) {
+    SharedMemoryRingBuffer::Reader reader(shared_memory->memory(),
+                                          shared_memory->mapped_size());
+    std::string record;
+    while (records.size() < kMaxRecordsPerDrain && reader.Pop(&record))
+      records.push_back(std::move(record));
+  }
+  if (records.empty())
+    return;
+
+  v8::Locker locker(isolate());
+  v8::HandleScope handle_scope(isolate());
+  v8::Local<v8::Object> wrapper = GetWrapper();
+  if (wrapper.IsEmpty())
+    return;
+
+  v8::Local<v8::Context> context = wrapper->CreationContext();
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Array> array =
+      v8::Array::New(isolate(), static_cast<int>(records.size()));
+  for (size_t i = 0; i < records.size(); ++i) {
+    array->Set(context, static_cast<uint32_t>(i),
+               node::Buffer::Copy(isolate(), records[i].data(),
+                                  records[i].size()).ToLocalChecked())
+        .FromJust();
+  }
+  // webContents.emit('telemetry', new Event(), records);
+  Emit("telemetry", array);
 }
 
 void WebContents::OnRendererMessageSync(content::RenderFrameHost* frame_host,
                                         const base::string16& channel,
                                         const base::ListValue& args,
                                         IPC::Message* message) {
+  std::string channel_utf8 = base::UTF16ToUTF8(channel);
+  TRACE_EVENT1("electron.ipc", "WebContents::OnRendererMessageSync", "channel",
+               channel_utf8);
+  ScopedIPCMetricsRecord record(channel_utf8, args);
   // webContents.emit(channel, new Event(sender, message), args...);
-  EmitWithSender(base::UTF16ToUTF8(channel), frame_host, message, args);
+  EmitWithSender(channel_utf8, frame_host, message, args);
 }
 
 // static
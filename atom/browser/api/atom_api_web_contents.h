@@ -5,7 +5,11 @@
 #ifndef ATOM_BROWSER_API_ATOM_API_WEB_CONTENTS_H_
 #define ATOM_BROWSER_API_ATOM_API_WEB_CONTENTS_H_
 
+#include <deque>
+#include <map>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/browser/api/frame_subscriber.h"
@@ -13,9 +17,12 @@
 #include "atom/browser/api/trackable_object.h"
 #include "atom/browser/common_web_contents_delegate.h"
 #include "atom/browser/ui/autofill_popup.h"
+#include "base/memory/shared_memory_handle.h"
 #include "base/observer_list.h"
+#include "base/timer/timer.h"
 #include "content/common/cursors/webcursor.h"
 #include "content/public/browser/keyboard_event_processing_result.h"
+#include "content/public/browser/render_widget_host.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/common/favicon_url.h"
@@ -23,6 +30,10 @@
 #include "printing/backend/print_backend.h"
 #include "ui/gfx/image/image.h"
 
+namespace base {
+class SharedMemory;
+}
+
 namespace blink {
 struct WebDeviceEmulationParams;
 }
@@ -52,6 +63,7 @@ class FrameSubscriber;
 #if defined(ENABLE_OSR)
 class OffScreenWebContentsView;
 class OffScreenRenderWidgetHostView;
+class OffScreenVideoEncoder;
 #endif
 
 namespace api {
@@ -67,7 +79,8 @@ class ExtendedWebContentsObserver {
 // Wrapper around the content::WebContents.
 class WebContents : public mate::TrackableObject<WebContents>,
                     public CommonWebContentsDelegate,
-                    public content::WebContentsObserver {
+                    public content::WebContentsObserver,
+                    public content::RenderWidgetHost::InputEventObserver {
  public:
   enum Type {
     BACKGROUND_PAGE,  // A DevTools extension background page.
@@ -120,6 +133,7 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void GoBack();
   void GoForward();
   void GoToOffset(int offset);
+  void TrimHistory(int max_entries);
   const std::string GetWebRTCIPHandlingPolicy() const;
   void SetWebRTCIPHandlingPolicy(const std::string& webrtc_ip_handling_policy);
   bool IsCrashed() const;
@@ -144,6 +158,8 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void SetAudioMuted(bool muted);
   bool IsAudioMuted();
   void Print(mate::Arguments* args);
+  // Emits "print-page-done" for every page spooled to the printer.
+  void OnPrintPageDone(int page_number, int page_count);
   std::vector<printing::PrinterBasicInfo> GetPrinterList();
   void SetEmbedder(const WebContents* embedder);
   void SetDevToolsWebContents(const WebContents* devtools);
@@ -184,11 +200,36 @@ class WebContents : public mate::TrackableObject<WebContents>,
                       const base::string16& channel,
                       const base::ListValue& args);
 
+  // Send a message straight to the frame with |frame_id|, without the
+  // main-frame relay; |frame_id| is the routing id carried by
+  // event.frameId on incoming messages.
+  bool SendToFrame(int32_t frame_id,
+                   const base::string16& channel,
+                   const base::ListValue& args);
+
   // Send WebInputEvent to the page.
   void SendInputEvent(v8::Isolate* isolate, v8::Local<v8::Value> input_event);
 
+  // Send a batch of WebInputEvents, converted in one pass and injected
+  // back-to-back; per-event "time" offsets pace the replay.
+  void SendInputEvents(v8::Isolate* isolate, mate::Arguments* args);
+
+  // Aggregate dispatch->ack latency of recent input events; see
+  // getInputLatencyStats in the docs.
+  v8::Local<v8::Value> GetInputLatencyStats(v8::Isolate* isolate);
+
+  // Makes this renderer behave as if under memory pressure; a critical
+  // signal additionally forces an immediate V8 low-memory collection.
+  void SendMemoryPressure(bool critical);
+  void NotifyMemoryPressure(const std::string& level, mate::Arguments* args);
+
+  // Moves this renderer to (or out of) the OS background scheduling
+  // class so hidden pages stop competing with the focused one for CPU.
+  void SetBackgroundPriority(bool background);
+
   // Subscribe to the frame updates.
   void BeginFrameSubscription(mate::Arguments* args);
+  void BeginSharedFrameSubscription(mate::Arguments* args);
   void EndFrameSubscription();
 
   // Dragging native items.
@@ -202,6 +243,8 @@ class WebContents : public mate::TrackableObject<WebContents>,
   void SetSize(const SetSizeParams& params);
   bool IsGuest() const;
 
+  bool background_throttling() const { return background_throttling_; }
+
   // Methods for offscreen rendering
   bool IsOffScreen() const;
   void OnPaint(const gfx::Rect& dirty_rect, const SkBitmap& bitmap);
@@ -210,6 +253,17 @@ class WebContents : public mate::TrackableObject<WebContents>,
   bool IsPainting() const;
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  void SetAdaptiveFrameRate(bool adaptive);
+  bool UsesAdaptiveFrameRate() const;
+  int GetEffectiveFrameRate() const;
+  void SetAsynchronousPaintDispatch(bool enabled);
+  bool UsesAsynchronousPaintDispatch() const;
+  void SetPaintDamagedRegionOnly(bool enabled);
+  bool PaintsDamagedRegionOnly() const;
+  void StartVideoEncode(mate::Arguments* args);
+  void StopVideoEncode();
+  bool IsVideoEncoding() const;
+  v8::Local<v8::Value> GetPaintStats(v8::Isolate* isolate);
   void Invalidate();
   gfx::Size GetSizeForNewRenderView(content::WebContents*) const override;
 
@@ -380,6 +434,10 @@ class WebContents : public mate::TrackableObject<WebContents>,
       content::WebContentsObserver::MediaStoppedReason reason) override;
   void DidChangeThemeColor(SkColor theme_color) override;
 
+  // content::RenderWidgetHost::InputEventObserver:
+  void OnInputEvent(const blink::WebInputEvent& event) override;
+  void OnInputEventAck(const blink::WebInputEvent& event) override;
+
   // brightray::InspectableWebContentsDelegate:
   void DevToolsReloadPage() override;
 
@@ -397,6 +455,29 @@ class WebContents : public mate::TrackableObject<WebContents>,
 
  private:
   struct FrameDispatchHelper;
+
+  // One sendInputEvents() entry, converted from V8 up front so injection
+  // and delayed replay do no further V8 work.
+  struct ParsedInputEvent;
+
+  // Injects |events| starting at |index|; when the next event's replay
+  // offset relative to |start| has not been reached yet it re-posts
+  // itself with the remaining delay. |id| re-resolves the WebContents so
+  // a batch outliving it is dropped.
+  static void DispatchInputEventBatch(
+      v8::Isolate* isolate,
+      int32_t id,
+      std::shared_ptr<std::vector<ParsedInputEvent>> events,
+      size_t index,
+      base::TimeTicks start);
+
+  // Forwards save-page progress to the JS object; |id| re-resolves the
+  // WebContents so a save outliving it stops emitting.
+  static void EmitSavePageProgress(v8::Isolate* isolate,
+                                   int32_t id,
+                                   int64_t received_bytes,
+                                   int percent);
+
   AtomBrowserContext* GetBrowserContext() const;
 
   uint32_t GetNextRequestId() { return ++request_id_; }
@@ -404,6 +485,14 @@ class WebContents : public mate::TrackableObject<WebContents>,
 #if defined(ENABLE_OSR)
   OffScreenWebContentsView* GetOffScreenWebContentsView() const;
   OffScreenRenderWidgetHostView* GetOffScreenRenderWidgetHostView() const;
+
+  // Called by the offscreen video encoder on the UI thread; emits an
+  // 'encoded-frame' event with the H.264 packet.
+  void OnEncodedPacket(const uint8_t* data,
+                       size_t size,
+                       base::TimeDelta timestamp,
+                       bool key_frame);
+  void OnVideoEncodeError();
 #endif
 
   // Called when we receive a CursorChange message from chromium.
@@ -414,6 +503,42 @@ class WebContents : public mate::TrackableObject<WebContents>,
                          const base::string16& channel,
                          const base::ListValue& args);
 
+  // Called when received a structured-clone serialized message from
+  // renderer.
+  void OnRendererMessageSerialized(content::RenderFrameHost* frame_host,
+                                   const base::string16& channel,
+                                   const std::string& args);
+
+  // Called when received a shared-memory-backed binary message from
+  // renderer.
+  void OnRendererSharedBufferMessage(content::RenderFrameHost* frame_host,
+                                     const base::string16& channel,
+                                     const base::SharedMemoryHandle& handle,
+                                     uint32_t size);
+
+  // Handlers for the chunked large-payload stream from renderer; the
+  // reassembled buffer is emitted like a shared-buffer message.
+  void OnRendererStreamBegin(content::RenderFrameHost* frame_host,
+                             const base::string16& channel,
+                             int32_t stream_id,
+                             uint64_t total_size);
+  void OnRendererStreamChunk(content::RenderFrameHost* frame_host,
+                             int32_t stream_id,
+                             const std::string& data);
+  void OnRendererStreamEnd(content::RenderFrameHost* frame_host,
+                           int32_t stream_id);
+
+  // Called once when a renderer sets up a telemetry ring buffer; the
+  // reply carries the shared memory handle the renderer maps writable.
+  void OnCreateTelemetryBuffer(content::RenderFrameHost* frame_host,
+                               uint32_t requested_size,
+                               base::SharedMemoryHandle* handle,
+                               uint32_t* actual_size);
+
+  // Drains every telemetry ring buffer and emits the records as a
+  // 'telemetry' event; runs on |telemetry_timer_|.
+  void DrainTelemetryBuffers();
+
   // Called when received a synchronous message from renderer.
   void OnRendererMessageSync(content::RenderFrameHost* frame_host,
                              const base::string16& channel,
@@ -443,6 +568,28 @@ class WebContents : public mate::TrackableObject<WebContents>,
 
   std::unique_ptr<FrameSubscriber> frame_subscriber_;
 
+#if defined(ENABLE_OSR)
+  // The encoder is created lazily on the first painted frame so its input
+  // size matches the delivered bitmaps.
+  std::unique_ptr<OffScreenVideoEncoder> osr_video_encoder_;
+  bool video_encode_requested_ = false;
+  uint32_t video_encode_bitrate_ = 0;
+#endif
+
+  // Dispatch timestamps and trace ids of in-flight input events, keyed
+  // by event type, plus a ring of recent dispatch->ack latencies that
+  // backs getInputLatencyStats().
+  struct PendingInputAck {
+    uint64_t trace_id;
+    base::TimeTicks dispatch_time;
+  };
+  std::map<int, std::deque<PendingInputAck>> pending_input_acks_;
+  std::vector<double> input_latency_samples_ms_;
+  size_t input_latency_cursor_ = 0;
+  uint64_t input_event_count_ = 0;
+  double input_latency_max_ms_ = 0;
+  uint64_t next_input_trace_id_ = 1;
+
   // The host webcontents that may contain this webcontents.
   WebContents* embedder_ = nullptr;
 
@@ -461,6 +608,21 @@ class WebContents : public mate::TrackableObject<WebContents>,
   // Whether to enable devtools.
   bool enable_devtools_ = true;
 
+  struct IPCStream {
+    base::string16 channel;
+    uint64_t total_size = 0;
+    std::string data;
+  };
+
+  // Chunked streams being reassembled, keyed by (renderer process id,
+  // stream id in that process).
+  std::map<std::pair<int, int32_t>, IPCStream> ipc_streams_;
+
+  // Telemetry ring buffer regions created for renderers, drained by
+  // |telemetry_timer_| while any exist.
+  std::vector<std::unique_ptr<base::SharedMemory>> telemetry_buffers_;
+  base::RepeatingTimer telemetry_timer_;
+
   // Observers of this WebContents.
   base::ObserverList<ExtendedWebContentsObserver> observers_;
 
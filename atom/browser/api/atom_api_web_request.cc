@@ -5,6 +5,7 @@
 #include "atom/browser/api/atom_api_web_request.h"
 
 #include <string>
+#include <utility>
 
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/net/atom_network_delegate.h"
@@ -32,6 +33,37 @@ struct Converter<URLPattern> {
   }
 };
 
+template <>
+struct Converter<atom::AtomNetworkDelegate::DeclarativeRule> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     atom::AtomNetworkDelegate::DeclarativeRule* out) {
+    using Action = atom::AtomNetworkDelegate::DeclarativeRule::Action;
+    mate::Dictionary dict;
+    if (!ConvertFromV8(isolate, val, &dict))
+      return false;
+    std::string action;
+    if (!dict.Get("action", &action))
+      return false;
+    if (action == "allow") {
+      out->action = Action::kAllow;
+    } else if (action == "block") {
+      out->action = Action::kBlock;
+    } else if (action == "redirect") {
+      out->action = Action::kRedirect;
+      std::string redirect_url;
+      if (!dict.Get("redirectURL", &redirect_url))
+        return false;
+      out->redirect_url = GURL(redirect_url);
+      if (!out->redirect_url.is_valid())
+        return false;
+    } else {
+      return false;
+    }
+    return dict.Get("urls", &out->url_patterns) && !out->url_patterns.empty();
+  }
+};
+
 }  // namespace mate
 
 namespace atom {
@@ -56,6 +88,32 @@ void CallNetworkDelegateMethod(
   (network_delegate->*method)(type, std::move(patterns), std::move(listener));
 }
 
+void SetResponseListenerOnIO(
+    brightray::URLRequestContextGetter* url_request_context_getter,
+    AtomNetworkDelegate::ResponseEvent type,
+    URLPatterns patterns,
+    AtomNetworkDelegate::ResponseListener listener,
+    bool observe_only) {
+  // Force creating network delegate.
+  net::URLRequestContext* context =
+      url_request_context_getter->GetURLRequestContext();
+  AtomNetworkDelegate* network_delegate =
+      static_cast<AtomNetworkDelegate*>(context->network_delegate());
+  network_delegate->SetResponseListenerInIO(type, std::move(patterns),
+                                            std::move(listener), observe_only);
+}
+
+void SetDeclarativeRulesOnIO(
+    brightray::URLRequestContextGetter* url_request_context_getter,
+    AtomNetworkDelegate::DeclarativeRules rules) {
+  // Force creating network delegate.
+  net::URLRequestContext* context =
+      url_request_context_getter->GetURLRequestContext();
+  AtomNetworkDelegate* network_delegate =
+      static_cast<AtomNetworkDelegate*>(context->network_delegate());
+  network_delegate->SetDeclarativeRulesInIO(std::move(rules));
+}
+
 }  // namespace
 
 WebRequest::WebRequest(v8::Isolate* isolate,
@@ -74,8 +132,33 @@ void WebRequest::SetSimpleListener(mate::Arguments* args) {
 
 template <AtomNetworkDelegate::ResponseEvent type>
 void WebRequest::SetResponseListener(mate::Arguments* args) {
-  SetListener<AtomNetworkDelegate::ResponseListener>(
-      &AtomNetworkDelegate::SetResponseListenerInIO, type, args);
+  // { urls, observeOnly }.
+  URLPatterns patterns;
+  bool observe_only = false;
+  mate::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    dict.Get("urls", &patterns);
+    dict.Get("observeOnly", &observe_only);
+  }
+
+  // Function or null.
+  v8::Local<v8::Value> value;
+  AtomNetworkDelegate::ResponseListener listener;
+  if (!args->GetNext(&listener) &&
+      !(args->GetNext(&value) && value->IsNull())) {
+    args->ThrowError("Must pass null or a Function");
+    return;
+  }
+
+  brightray::URLRequestContextGetter* url_request_context_getter =
+      browser_context_->url_request_context_getter();
+  if (!url_request_context_getter)
+    return;
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&SetResponseListenerOnIO,
+                     base::RetainedRef(url_request_context_getter), type,
+                     std::move(patterns), std::move(listener), observe_only));
 }
 
 template <typename Listener, typename Method, typename Event>
@@ -105,6 +188,24 @@ void WebRequest::SetListener(Method method, Event type, mate::Arguments* args) {
                      type, std::move(patterns), std::move(listener)));
 }
 
+void WebRequest::SetDeclarativeRules(mate::Arguments* args) {
+  AtomNetworkDelegate::DeclarativeRules rules;
+  if (!args->GetNext(&rules)) {
+    args->ThrowError("Must pass an array of rules");
+    return;
+  }
+
+  brightray::URLRequestContextGetter* url_request_context_getter =
+      browser_context_->url_request_context_getter();
+  if (!url_request_context_getter)
+    return;
+  BrowserThread::PostTask(
+      BrowserThread::IO, FROM_HERE,
+      base::BindOnce(&SetDeclarativeRulesOnIO,
+                     base::RetainedRef(url_request_context_getter),
+                     std::move(rules)));
+}
+
 // static
 mate::Handle<WebRequest> WebRequest::Create(
     v8::Isolate* isolate,
@@ -138,7 +239,8 @@ void WebRequest::BuildPrototype(v8::Isolate* isolate,
           "onCompleted",
           &WebRequest::SetSimpleListener<AtomNetworkDelegate::kOnCompleted>)
       .SetMethod("onErrorOccurred", &WebRequest::SetSimpleListener<
-                                        AtomNetworkDelegate::kOnErrorOccurred>);
+                                        AtomNetworkDelegate::kOnErrorOccurred>)
+      .SetMethod("setDeclarativeRules", &WebRequest::SetDeclarativeRules);
 }
 
 }  // namespace api
@@ -36,6 +36,8 @@ class WebRequest : public mate::TrackableObject<WebRequest> {
   template <typename Listener, typename Method, typename Event>
   void SetListener(Method method, Event type, mate::Arguments* args);
 
+  void SetDeclarativeRules(mate::Arguments* args);
+
  private:
   scoped_refptr<AtomBrowserContext> browser_context_;
 
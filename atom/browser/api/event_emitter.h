@@ -71,6 +71,26 @@ class EventEmitter : public Wrappable<T> {
     return EmitWithSender(name, nullptr, nullptr, args...);
   }
 
+  // Returns true if any JS listener is subscribed to |name|. High-frequency
+  // emitters use this to skip argument conversion entirely for events that
+  // nothing observes; only use it for purely informational events, since
+  // suppressed emissions can not be seen by listeners added through an
+  // overridden emit method either.
+  bool IsEventObserved(const base::StringPiece& name) {
+    v8::Locker locker(isolate());
+    v8::HandleScope handle_scope(isolate());
+    v8::Local<v8::Object> wrapper = GetWrapper();
+    if (wrapper.IsEmpty())
+      return false;
+    v8::Local<v8::Value> events =
+        wrapper->Get(StringToV8(isolate(), "_events"));
+    if (events.IsEmpty() || !events->IsObject())
+      return true;  // Not a node EventEmitter; assume observed.
+    v8::Local<v8::Value> handler =
+        v8::Local<v8::Object>::Cast(events)->Get(StringToV8(isolate(), name));
+    return !handler.IsEmpty() && !handler->IsUndefined() && !handler->IsNull();
+  }
+
   // this.emit(name, new Event(sender, message), args...);
   template <typename... Args>
   bool EmitWithSender(const base::StringPiece& name,
@@ -99,11 +119,32 @@ class EventEmitter : public Wrappable<T> {
                      const Args&... args) {
     v8::Locker locker(isolate());
     v8::HandleScope handle_scope(isolate());
-    EmitEvent(isolate(), GetWrapper(), name, event, args...);
+    v8::Local<v8::Object> wrapper = GetWrapper();
+    v8::Local<v8::Function> emit = GetEmitFunction(wrapper);
+    if (emit.IsEmpty())
+      EmitEvent(isolate(), wrapper, name, event, args...);
+    else
+      EmitEvent(isolate(), wrapper, emit, name, event, args...);
     return event->Get(StringToV8(isolate(), "defaultPrevented"))
         ->BooleanValue();
   }
 
+  // Resolves this.emit once and caches it, so steady-state event
+  // delivery skips the prototype chain walk. Returns empty if emit is
+  // not a plain function, in which case the caller falls back to the
+  // by-name lookup.
+  v8::Local<v8::Function> GetEmitFunction(v8::Local<v8::Object> wrapper) {
+    if (!cached_emit_.IsEmpty())
+      return v8::Local<v8::Function>::New(isolate(), cached_emit_);
+    v8::Local<v8::Value> emit = wrapper->Get(StringToV8(isolate(), "emit"));
+    if (emit.IsEmpty() || !emit->IsFunction())
+      return v8::Local<v8::Function>();
+    cached_emit_.Reset(isolate(), emit.As<v8::Function>());
+    return emit.As<v8::Function>();
+  }
+
+  v8::Global<v8::Function> cached_emit_;
+
   DISALLOW_COPY_AND_ASSIGN(EventEmitter);
 };
 
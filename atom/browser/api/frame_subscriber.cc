@@ -4,12 +4,17 @@
 
 #include "atom/browser/api/frame_subscriber.h"
 
+#include <cstring>
+#include <utility>
+
 #include "atom/common/native_mate_converters/gfx_converter.h"
+#include "base/memory/shared_memory.h"
 #include "components/viz/common/frame_sinks/copy_output_request.h"
 #include "components/viz/service/frame_sinks/frame_sink_manager_impl.h"
 #include "components/viz/service/surfaces/surface_manager.h"
 #include "content/browser/compositor/surface_utils.h"
 #include "content/browser/renderer_host/render_widget_host_view_base.h"
+#include "native_mate/dictionary.h"
 #include "ui/gfx/geometry/rect_conversions.h"
 #include "ui/gfx/skbitmap_operations.h"
 
@@ -19,6 +24,43 @@ namespace atom {
 
 namespace api {
 
+// Owns the mapped double buffer. Refcounted because both the subscriber
+// (writer) and the Buffer handed to JS (reader) need the mapping alive,
+// and either side can go away first.
+class SharedFrameMemory : public base::RefCountedThreadSafe<SharedFrameMemory> {
+ public:
+  static scoped_refptr<SharedFrameMemory> Create(size_t size) {
+    scoped_refptr<SharedFrameMemory> memory(new SharedFrameMemory);
+    if (!memory->shared_memory_.CreateAndMapAnonymous(size))
+      return nullptr;
+    memory->size_ = size;
+    return memory;
+  }
+
+  char* data() { return static_cast<char*>(shared_memory_.memory()); }
+  size_t size() const { return size_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<SharedFrameMemory>;
+  SharedFrameMemory() = default;
+  ~SharedFrameMemory() = default;
+
+  base::SharedMemory shared_memory_;
+  size_t size_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedFrameMemory);
+};
+
+namespace {
+
+// Free callback of the JS Buffer; drops the Buffer's reference on the
+// shared mapping when the Buffer is garbage collected.
+void FreeSharedFrameMemory(char* data, void* hint) {
+  delete static_cast<scoped_refptr<SharedFrameMemory>*>(hint);
+}
+
+}  // namespace
+
 FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
                                  content::WebContents* web_contents,
                                  const FrameCaptureCallback& callback,
@@ -28,6 +70,14 @@ FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
       callback_(callback),
       only_dirty_(only_dirty) {}
 
+FrameSubscriber::FrameSubscriber(v8::Isolate* isolate,
+                                 content::WebContents* web_contents,
+                                 const SharedFrameCallback& callback)
+    : content::WebContentsObserver(web_contents),
+      isolate_(isolate),
+      shared_callback_(callback),
+      shared_mode_(true) {}
+
 FrameSubscriber::~FrameSubscriber() = default;
 
 gfx::Rect FrameSubscriber::GetDamageRect() {
@@ -72,6 +122,11 @@ void FrameSubscriber::Done(const gfx::Rect& damage, const SkBitmap& frame) {
   if (frame.drawsNothing())
     return;
 
+  if (shared_mode_) {
+    DeliverShared(damage, frame);
+    return;
+  }
+
   v8::Locker locker(isolate_);
   v8::HandleScope handle_scope(isolate_);
 
@@ -94,6 +149,62 @@ void FrameSubscriber::Done(const gfx::Rect& damage, const SkBitmap& frame) {
   callback_.Run(local_buffer, damage_rect);
 }
 
+void FrameSubscriber::DeliverShared(const gfx::Rect& damage,
+                                    const SkBitmap& frame) {
+  v8::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+
+  const_cast<SkBitmap&>(frame).setAlphaType(kPremul_SkAlphaType);
+
+  const int width = frame.width();
+  const int height = frame.height();
+  const size_t frame_bytes =
+      static_cast<size_t>(width) * frame.bytesPerPixel() * height;
+
+  // (Re)build the double buffer when the frame size changes, and hand
+  // JS its zero-copy view of the new region.
+  if (!shared_memory_ || shared_frame_size_ != gfx::Size(width, height)) {
+    scoped_refptr<SharedFrameMemory> memory =
+        SharedFrameMemory::Create(frame_bytes * 2);
+    if (!memory)
+      return;
+    shared_memory_ = std::move(memory);
+    shared_frame_size_ = gfx::Size(width, height);
+    slot_size_ = frame_bytes;
+    next_slot_ = 0;
+
+    v8::MaybeLocal<v8::Object> buffer = node::Buffer::New(
+        isolate_, shared_memory_->data(), shared_memory_->size(),
+        &FreeSharedFrameMemory,
+        new scoped_refptr<SharedFrameMemory>(shared_memory_));
+    mate::Dictionary buffer_event(isolate_, v8::Object::New(isolate_));
+    buffer_event.Set("type", "buffer");
+    buffer_event.Set("buffer", buffer.ToLocalChecked());
+    buffer_event.Set("width", width);
+    buffer_event.Set("height", height);
+    buffer_event.Set("slotSize", static_cast<uint32_t>(slot_size_));
+    shared_callback_.Run(buffer_event.GetHandle());
+  }
+
+  // Copy into the slot JS is not reading from -- with two slots the
+  // consumer always has the previous frame intact while this one lands.
+  const int slot = next_slot_;
+  memcpy(shared_memory_->data() + slot * slot_size_, frame.getPixels(),
+         frame_bytes);
+  next_slot_ = 1 - next_slot_;
+  sequence_++;
+
+  mate::Dictionary frame_event(isolate_, v8::Object::New(isolate_));
+  frame_event.Set("type", "frame");
+  frame_event.Set("sequence", static_cast<double>(sequence_));
+  frame_event.Set("slot", slot);
+  frame_event.Set("offset", static_cast<uint32_t>(slot * slot_size_));
+  frame_event.Set("width", width);
+  frame_event.Set("height", height);
+  frame_event.Set("damage", damage);
+  shared_callback_.Run(frame_event.GetHandle());
+}
+
 }  // namespace api
 
 }  // namespace atom
@@ -8,8 +8,10 @@
 #include "content/public/browser/web_contents.h"
 
 #include "base/callback.h"
+#include "base/memory/ref_counted.h"
 #include "components/viz/common/frame_sinks/copy_output_result.h"
 #include "content/public/browser/web_contents_observer.h"
+#include "ui/gfx/geometry/size.h"
 #include "ui/gfx/image/image.h"
 #include "v8/include/v8.h"
 
@@ -17,27 +19,49 @@ namespace atom {
 
 namespace api {
 
+class SharedFrameMemory;
 class WebContents;
 
 class FrameSubscriber : public content::WebContentsObserver {
  public:
   using FrameCaptureCallback =
       base::Callback<void(v8::Local<v8::Value>, v8::Local<v8::Value>)>;
+  using SharedFrameCallback = base::Callback<void(v8::Local<v8::Value>)>;
 
   FrameSubscriber(v8::Isolate* isolate,
                   content::WebContents* web_contents,
                   const FrameCaptureCallback& callback,
                   bool only_dirty);
+
+  // Shared-memory mode: frames are copied into alternating slots of a
+  // double buffer that is handed to JS once as a zero-copy Buffer, and
+  // the callback only receives a small sequence-numbered descriptor per
+  // frame, so frame delivery allocates nothing on the V8 heap.
+  FrameSubscriber(v8::Isolate* isolate,
+                  content::WebContents* web_contents,
+                  const SharedFrameCallback& callback);
+
   ~FrameSubscriber() override;
 
  private:
   gfx::Rect GetDamageRect();
   void DidReceiveCompositorFrame() override;
   void Done(const gfx::Rect& damage, const SkBitmap& frame);
+  void DeliverShared(const gfx::Rect& damage, const SkBitmap& frame);
 
   v8::Isolate* isolate_;
   FrameCaptureCallback callback_;
-  bool only_dirty_;
+  SharedFrameCallback shared_callback_;
+  bool only_dirty_ = false;
+  bool shared_mode_ = false;
+
+  // Shared-memory delivery state. The memory is refcounted because the
+  // JS Buffer handed out keeps a reference too; see the .cc file.
+  scoped_refptr<SharedFrameMemory> shared_memory_;
+  gfx::Size shared_frame_size_;
+  size_t slot_size_ = 0;
+  int next_slot_ = 0;
+  uint64_t sequence_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(FrameSubscriber);
 };
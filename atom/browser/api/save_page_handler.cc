@@ -7,17 +7,22 @@
 #include <string>
 
 #include "atom/browser/atom_browser_context.h"
+#include "base/bind.h"
 #include "base/callback.h"
 #include "base/files/file_path.h"
 #include "content/public/browser/web_contents.h"
+#include "content/public/common/mhtml_generation_params.h"
 
 namespace atom {
 
 namespace api {
 
 SavePageHandler::SavePageHandler(content::WebContents* web_contents,
-                                 const SavePageCallback& callback)
-    : web_contents_(web_contents), callback_(callback) {}
+                                 const SavePageCallback& callback,
+                                 const ProgressCallback& progress_callback)
+    : web_contents_(web_contents),
+      callback_(callback),
+      progress_callback_(progress_callback) {}
 
 SavePageHandler::~SavePageHandler() {}
 
@@ -30,6 +35,19 @@ void SavePageHandler::OnDownloadCreated(content::DownloadManager* manager,
 
 bool SavePageHandler::Handle(const base::FilePath& full_path,
                              const content::SavePageType& save_type) {
+  if (save_type == content::SAVE_PAGE_TYPE_AS_MHTML) {
+    // MHTML generation hands the destination file straight to the
+    // serializer, which streams parts into it with bounded buffers, so
+    // peak memory stays flat no matter how large the page is. The
+    // save-package machinery would stage everything through the
+    // download system instead.
+    content::MHTMLGenerationParams params(full_path);
+    web_contents_->GenerateMHTML(params,
+                                 base::Bind(&SavePageHandler::OnMHTMLGenerated,
+                                            base::Unretained(this)));
+    return true;
+  }
+
   auto* download_manager = content::BrowserContext::GetDownloadManager(
       web_contents_->GetBrowserContext());
   download_manager->AddObserver(this);
@@ -48,20 +66,38 @@ bool SavePageHandler::Handle(const base::FilePath& full_path,
   return result;
 }
 
+void SavePageHandler::OnMHTMLGenerated(int64_t size) {
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (size >= 0) {
+    callback_.Run(v8::Null(isolate));
+  } else {
+    v8::Local<v8::String> error_message =
+        v8::String::NewFromUtf8(isolate, "Fail to save page");
+    callback_.Run(v8::Exception::Error(error_message));
+  }
+  delete this;
+}
+
 void SavePageHandler::OnDownloadUpdated(download::DownloadItem* item) {
-  if (item->IsDone()) {
-    v8::Isolate* isolate = v8::Isolate::GetCurrent();
-    v8::Locker locker(isolate);
-    v8::HandleScope handle_scope(isolate);
-    if (item->GetState() == download::DownloadItem::COMPLETE) {
-      callback_.Run(v8::Null(isolate));
-    } else {
-      v8::Local<v8::String> error_message =
-          v8::String::NewFromUtf8(isolate, "Fail to save page");
-      callback_.Run(v8::Exception::Error(error_message));
-    }
-    Destroy(item);
+  if (!item->IsDone()) {
+    if (!progress_callback_.is_null())
+      progress_callback_.Run(item->GetReceivedBytes(), item->PercentComplete());
+    return;
+  }
+
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (item->GetState() == download::DownloadItem::COMPLETE) {
+    callback_.Run(v8::Null(isolate));
+  } else {
+    v8::Local<v8::String> error_message =
+        v8::String::NewFromUtf8(isolate, "Fail to save page");
+    callback_.Run(v8::Exception::Error(error_message));
   }
+  Destroy(item);
 }
 
 void SavePageHandler::Destroy(download::DownloadItem* item) {
@@ -7,6 +7,7 @@
 
 #include <string>
 
+#include "base/callback.h"
 #include "components/download/public/common/download_item.h"
 #include "content/public/browser/download_manager.h"
 #include "content/public/browser/save_page_type.h"
@@ -29,9 +30,14 @@ class SavePageHandler : public content::DownloadManager::Observer,
                         public download::DownloadItem::Observer {
  public:
   using SavePageCallback = base::Callback<void(v8::Local<v8::Value>)>;
+  // Invoked as saved resources stream to disk; |percent| is -1 while
+  // the total is not yet known.
+  using ProgressCallback =
+      base::Callback<void(int64_t received_bytes, int percent)>;
 
   SavePageHandler(content::WebContents* web_contents,
-                  const SavePageCallback& callback);
+                  const SavePageCallback& callback,
+                  const ProgressCallback& progress_callback);
   ~SavePageHandler() override;
 
   bool Handle(const base::FilePath& full_path,
@@ -40,6 +46,10 @@ class SavePageHandler : public content::DownloadManager::Observer,
  private:
   void Destroy(download::DownloadItem* item);
 
+  // Completion of a streamed MHTML generation; |size| is the size of
+  // the generated file, negative on failure.
+  void OnMHTMLGenerated(int64_t size);
+
   // content::DownloadManager::Observer:
   void OnDownloadCreated(content::DownloadManager* manager,
                          download::DownloadItem* item) override;
@@ -49,6 +59,7 @@ class SavePageHandler : public content::DownloadManager::Observer,
 
   content::WebContents* web_contents_;  // weak
   SavePageCallback callback_;
+  ProgressCallback progress_callback_;
 };
 
 }  // namespace api
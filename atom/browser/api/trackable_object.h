@@ -57,6 +57,10 @@ class TrackableObject : public TrackableObjectBase,
  public:
   // Mark the JS object as destroyed.
   void MarkDestroyed() {
+    // The native object may outlive the wrapper's usefulness, so the
+    // cached unwrap result has to go first.
+    if (weak_map_)
+      weak_map_->EraseCached(weak_map_id());
     v8::Local<v8::Object> wrapper = Wrappable<T>::GetWrapper();
     if (!wrapper.IsEmpty()) {
       wrapper->SetAlignedPointerInInternalField(0, nullptr);
@@ -74,12 +78,19 @@ class TrackableObject : public TrackableObjectBase,
     if (!weak_map_)
       return nullptr;
 
+    // Fast path: the pointer cache resolves repeated lookups without
+    // touching V8 at all.
+    if (void* cached = weak_map_->GetCached(id))
+      return static_cast<T*>(cached);
+
     v8::MaybeLocal<v8::Object> object = weak_map_->Get(isolate, id);
     if (object.IsEmpty())
       return nullptr;
 
     T* self = nullptr;
     mate::ConvertFromV8(isolate, object.ToLocalChecked(), &self);
+    if (self)
+      weak_map_->SetCached(id, self);
     return self;
   }
 
@@ -117,6 +128,7 @@ class TrackableObject : public TrackableObjectBase,
       weak_map_ = new atom::KeyWeakMap<int32_t>;
     }
     weak_map_->Set(isolate, weak_map_id_, wrapper);
+    weak_map_->SetCached(weak_map_id_, static_cast<T*>(this));
   }
 
  private:
@@ -4,6 +4,8 @@
 
 #include "atom/browser/atom_blob_reader.h"
 
+#include <algorithm>
+
 #include "content/browser/blob_storage/chrome_blob_storage_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/io_buffer.h"
@@ -43,6 +45,19 @@ void RunCallbackInUI(const AtomBlobReader::CompletionCallback& callback,
   }
 }
 
+// Hands |blob_data| over to a Buffer without copying, then asks the IO
+// thread for the next chunk. Requesting the next chunk only after this one
+// has been delivered keeps a single chunk in flight.
+void RunChunkCallbackInUI(const AtomBlobReader::CompletionCallback& callback,
+                          char* blob_data,
+                          int size,
+                          const base::Closure& continue_reading) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  RunCallbackInUI(callback, blob_data, size);
+  BrowserThread::PostTask(BrowserThread::IO, FROM_HERE, continue_reading);
+}
+
 }  // namespace
 
 AtomBlobReader::AtomBlobReader(content::ChromeBlobStorageContext* blob_context)
@@ -69,6 +84,26 @@ void AtomBlobReader::StartReading(
   blob_read_helper->Read();
 }
 
+void AtomBlobReader::StartStreaming(
+    const std::string& uuid,
+    int chunk_size,
+    const AtomBlobReader::CompletionCallback& chunk_callback) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  auto blob_data_handle = blob_context_->context()->GetBlobDataFromUUID(uuid);
+  if (!blob_data_handle) {
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::BindOnce(&RunCallbackInUI, chunk_callback, nullptr, 0));
+    return;
+  }
+
+  auto blob_reader = blob_data_handle->CreateReader();
+  BlobStreamHelper* blob_stream_helper =
+      new BlobStreamHelper(std::move(blob_reader), chunk_size, chunk_callback);
+  blob_stream_helper->Read();
+}
+
 AtomBlobReader::BlobReadHelper::BlobReadHelper(
     std::unique_ptr<storage::BlobReader> blob_reader,
     const BlobReadHelper::CompletionCallback& callback)
@@ -119,4 +154,93 @@ void AtomBlobReader::BlobReadHelper::DidReadBlobData(
   delete this;
 }
 
+AtomBlobReader::BlobStreamHelper::BlobStreamHelper(
+    std::unique_ptr<storage::BlobReader> blob_reader,
+    int chunk_size,
+    const AtomBlobReader::CompletionCallback& callback)
+    : blob_reader_(std::move(blob_reader)),
+      chunk_size_(chunk_size),
+      chunk_callback_(callback) {}
+
+AtomBlobReader::BlobStreamHelper::~BlobStreamHelper() {
+  delete[] pending_data_;
+}
+
+void AtomBlobReader::BlobStreamHelper::Read() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  storage::BlobReader::Status size_status = blob_reader_->CalculateSize(
+      base::Bind(&AtomBlobReader::BlobStreamHelper::DidCalculateSize,
+                 base::Unretained(this)));
+  if (size_status != storage::BlobReader::Status::IO_PENDING)
+    DidCalculateSize(net::OK);
+}
+
+void AtomBlobReader::BlobStreamHelper::DidCalculateSize(int result) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (result != net::OK) {
+    Fail();
+    return;
+  }
+
+  remaining_ = blob_reader_->total_size();
+  ReadNextChunk();
+}
+
+void AtomBlobReader::BlobStreamHelper::ReadNextChunk() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (remaining_ == 0) {
+    // End of stream; a null chunk tells the caller we are done.
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::BindOnce(&RunCallbackInUI, chunk_callback_, nullptr, 0));
+    delete this;
+    return;
+  }
+
+  int bytes_to_read = static_cast<int>(
+      std::min(static_cast<uint64_t>(chunk_size_), remaining_));
+  pending_data_ = new char[bytes_to_read];
+  scoped_refptr<net::IOBuffer> chunk_buffer =
+      new net::WrappedIOBuffer(pending_data_);
+  int bytes_read = 0;
+  auto callback = base::Bind(&AtomBlobReader::BlobStreamHelper::DidReadChunk,
+                             base::Unretained(this));
+  storage::BlobReader::Status read_status = blob_reader_->Read(
+      chunk_buffer.get(), bytes_to_read, &bytes_read, callback);
+  if (read_status != storage::BlobReader::Status::IO_PENDING)
+    callback.Run(read_status == storage::BlobReader::Status::DONE ? bytes_read
+                                                                  : -1);
+}
+
+void AtomBlobReader::BlobStreamHelper::DidReadChunk(int bytes_read) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  if (bytes_read <= 0) {
+    Fail();
+    return;
+  }
+
+  remaining_ -= bytes_read;
+  char* data = pending_data_;
+  pending_data_ = nullptr;
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::BindOnce(
+          &RunChunkCallbackInUI, chunk_callback_, data, bytes_read,
+          base::Bind(&AtomBlobReader::BlobStreamHelper::ReadNextChunk,
+                     base::Unretained(this))));
+}
+
+void AtomBlobReader::BlobStreamHelper::Fail() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::BindOnce(&RunCallbackInUI, chunk_callback_, nullptr, 0));
+  delete this;
+}
+
 }  // namespace atom
@@ -42,6 +42,15 @@ class AtomBlobReader {
   void StartReading(const std::string& uuid,
                     const AtomBlobReader::CompletionCallback& callback);
 
+  // Streams the blob in chunks of at most |chunk_size| bytes. |callback| is
+  // invoked on the UI thread once per chunk with a Buffer that owns the
+  // chunk's backing store, and finally with null when the stream ends (or on
+  // failure). Only one chunk is in flight at a time, so memory use is
+  // bounded by the chunk size.
+  void StartStreaming(const std::string& uuid,
+                      int chunk_size,
+                      const AtomBlobReader::CompletionCallback& callback);
+
  private:
   // A self-destroyed helper class to read the blob data.
   // Must be accessed on IO thread.
@@ -66,6 +75,33 @@ class AtomBlobReader {
     DISALLOW_COPY_AND_ASSIGN(BlobReadHelper);
   };
 
+  // A self-destroyed helper class that reads the blob one chunk at a time.
+  // Must be accessed on IO thread.
+  class BlobStreamHelper {
+   public:
+    BlobStreamHelper(std::unique_ptr<storage::BlobReader> blob_reader,
+                     int chunk_size,
+                     const AtomBlobReader::CompletionCallback& callback);
+    ~BlobStreamHelper();
+
+    void Read();
+
+   private:
+    void DidCalculateSize(int result);
+    void ReadNextChunk();
+    void DidReadChunk(int bytes_read);
+    void Fail();
+
+    std::unique_ptr<storage::BlobReader> blob_reader_;
+    int chunk_size_;
+    uint64_t remaining_ = 0;
+    // Chunk currently being filled; ownership moves to the delivered Buffer.
+    char* pending_data_ = nullptr;
+    AtomBlobReader::CompletionCallback chunk_callback_;
+
+    DISALLOW_COPY_AND_ASSIGN(BlobStreamHelper);
+  };
+
   scoped_refptr<content::ChromeBlobStorageContext> blob_context_;
 
   DISALLOW_COPY_AND_ASSIGN(AtomBlobReader);
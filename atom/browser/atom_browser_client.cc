@@ -17,12 +17,16 @@
 #include "atom/browser/atom_resource_dispatcher_host_delegate.h"
 #include "atom/browser/atom_speech_recognition_manager_delegate.h"
 #include "atom/browser/child_web_contents_tracker.h"
+#include "atom/browser/javascript_environment.h"
 #include "atom/browser/login_handler.h"
 #include "atom/browser/native_window.h"
 #include "atom/browser/session_preferences.h"
 #include "atom/browser/web_contents_permission_helper.h"
 #include "atom/browser/web_contents_preferences.h"
 #include "atom/browser/window_list.h"
+#include "atom/common/api/api_messages.h"
+#include "atom/common/asar/asar_header_cache.h"
+#include "atom/common/disabled_subsystems.h"
 #include "atom/common/google_api_key.h"
 #include "atom/common/options_switches.h"
 #include "base/command_line.h"
@@ -77,6 +81,9 @@ bool g_suppress_renderer_process_restart = false;
 // Custom schemes to be registered to handle service worker.
 std::string g_custom_service_worker_schemes = "";
 
+// Affinity group for windows that do not set webPreferences.affinity.
+std::string g_default_renderer_affinity = "";
+
 bool IsSameWebSite(content::BrowserContext* browser_context,
                    const GURL& src_url,
                    const GURL& dest_url) {
@@ -101,10 +108,102 @@ void AtomBrowserClient::SetCustomServiceWorkerSchemes(
   g_custom_service_worker_schemes = base::JoinString(schemes, ",");
 }
 
+// static
+void AtomBrowserClient::SetDefaultRendererAffinity(
+    const std::string& affinity) {
+  g_default_renderer_affinity = affinity;
+}
+
 AtomBrowserClient::AtomBrowserClient() {}
 
 AtomBrowserClient::~AtomBrowserClient() {}
 
+void AtomBrowserClient::SetSpareRendererPoolSize(
+    content::BrowserContext* browser_context,
+    size_t size) {
+  if (size == 0)
+    spare_pool_sizes_.erase(browser_context);
+  else
+    spare_pool_sizes_[browser_context] = size;
+
+  // Drop unclaimed spares beyond the new size.
+  size_t count = 0;
+  for (auto iter = spare_renderers_.begin(); iter != spare_renderers_.end();) {
+    const SpareRenderer& spare = iter->second;
+    if (spare.claimed ||
+        spare.site_instance->GetBrowserContext() != browser_context) {
+      ++iter;
+      continue;
+    }
+    if (++count > size)
+      iter = spare_renderers_.erase(iter);
+    else
+      ++iter;
+  }
+
+  ReplenishSpareRenderers(browser_context);
+}
+
+size_t AtomBrowserClient::GetSpareRendererPoolSize(
+    content::BrowserContext* browser_context) const {
+  auto iter = spare_pool_sizes_.find(browser_context);
+  return iter != spare_pool_sizes_.end() ? iter->second : 0;
+}
+
+void AtomBrowserClient::ReplenishSpareRenderers(
+    content::BrowserContext* browser_context) {
+  auto size_iter = spare_pool_sizes_.find(browser_context);
+  if (size_iter == spare_pool_sizes_.end())
+    return;
+
+  size_t current = 0;
+  for (const auto& pair : spare_renderers_) {
+    if (!pair.second.claimed &&
+        pair.second.site_instance->GetBrowserContext() == browser_context)
+      current++;
+  }
+
+  while (current < size_iter->second) {
+    SpareRenderer spare;
+    spare.site_instance = content::SiteInstance::Create(browser_context);
+    auto* process = spare.site_instance->GetProcess();
+    // Register before Init so AppendExtraCommandLineSwitches sees the
+    // launching process as a spare and forces the sandbox switch.
+    spare_renderers_[process->GetID()] = spare;
+    process->Init();
+    current++;
+  }
+}
+
+content::SiteInstance* AtomBrowserClient::TakeSpareSiteInstance(
+    content::BrowserContext* browser_context,
+    content::WebContents* web_contents) {
+  if (spare_renderers_.empty())
+    return nullptr;
+
+  // Spares are launched sandboxed, so only sandboxed WebContents may
+  // claim one.
+  auto* web_preferences = WebContentsPreferences::From(web_contents);
+  if (!web_preferences || !web_preferences->IsEnabled(options::kSandbox))
+    return nullptr;
+
+  for (auto& pair : spare_renderers_) {
+    SpareRenderer& spare = pair.second;
+    if (spare.claimed ||
+        spare.site_instance->GetBrowserContext() != browser_context)
+      continue;
+    spare.claimed = true;
+    ReplenishSpareRenderers(browser_context);
+    return spare.site_instance.get();
+  }
+  return nullptr;
+}
+
+bool AtomBrowserClient::IsSpareRendererProcess(int process_id) const {
+  auto iter = spare_renderers_.find(process_id);
+  return iter != spare_renderers_.end() && !iter->second.claimed;
+}
+
 content::WebContents* AtomBrowserClient::GetWebContentsFromProcessID(
     int process_id) {
   // If the process is a pending process, we should use the web contents
@@ -186,8 +285,14 @@ void AtomBrowserClient::RenderProcessWillLaunch(
   if (IsProcessObserved(process_id))
     return;
 
-  host->AddFilter(new printing::PrintingMessageFilter(process_id));
-  host->AddFilter(new TtsMessageFilter(process_id, host->GetBrowserContext()));
+  // Skip the message filters of subsystems the app declared it never
+  // uses; their threads and allocations then never materialize.
+  if (!subsystems::IsDisabled(subsystems::kPrinting))
+    host->AddFilter(new printing::PrintingMessageFilter(process_id));
+  if (!subsystems::IsDisabled(subsystems::kSpeech)) {
+    host->AddFilter(
+        new TtsMessageFilter(process_id, host->GetBrowserContext()));
+  }
 
   ProcessPreferences prefs;
   auto* web_preferences =
@@ -198,16 +303,36 @@ void AtomBrowserClient::RenderProcessWillLaunch(
         web_preferences->IsEnabled(options::kNativeWindowOpen);
     prefs.disable_popups = web_preferences->IsEnabled("disablePopups");
   }
+  // Spare pool renderers have no WebContents yet but always launch
+  // sandboxed.
+  if (IsSpareRendererProcess(process_id))
+    prefs.sandbox = true;
   AddProcessPreferences(host->GetID(), prefs);
   // ensure the ProcessPreferences is removed later
   host->AddObserver(this);
+
+  // Give the new process the session's injected stylesheets; later changes
+  // are broadcast from the Session API.
+  auto* browser_context =
+      static_cast<AtomBrowserContext*>(host->GetBrowserContext());
+  for (const auto& sheet : browser_context->injected_stylesheets())
+    host->Send(new AtomMsg_AddInjectedStylesheet(sheet.first, sheet.second));
 }
 
 content::SpeechRecognitionManagerDelegate*
 AtomBrowserClient::CreateSpeechRecognitionManagerDelegate() {
+  if (subsystems::IsDisabled(subsystems::kSpeech))
+    return nullptr;
   return new AtomSpeechRecognitionManagerDelegate;
 }
 
+content::PlatformNotificationService*
+AtomBrowserClient::GetPlatformNotificationService() {
+  if (subsystems::IsDisabled(subsystems::kNotifications))
+    return nullptr;
+  return brightray::BrowserClient::GetPlatformNotificationService();
+}
+
 void AtomBrowserClient::OverrideWebkitPrefs(content::RenderViewHost* host,
                                             content::WebPreferences* prefs) {
   prefs->javascript_enabled = true;
@@ -255,9 +380,13 @@ void AtomBrowserClient::OverrideSiteInstanceForNavigation(
   std::string affinity;
   auto* web_contents = content::WebContents::FromRenderFrameHost(rfh);
   auto* web_preferences = WebContentsPreferences::From(web_contents);
-  if (web_preferences &&
-      web_preferences->dict()->GetString("affinity", &affinity) &&
-      !affinity.empty()) {
+  if (web_preferences)
+    web_preferences->dict()->GetString("affinity", &affinity);
+  // Windows that did not pick their own group fall into the app-wide
+  // default group, when one is set.
+  if (affinity.empty())
+    affinity = g_default_renderer_affinity;
+  if (!affinity.empty()) {
     affinity = base::ToLowerASCII(affinity);
     auto iter = site_per_affinities.find(affinity);
     GURL dest_site = content::SiteInstance::GetSiteForURL(browser_context, url);
@@ -286,6 +415,15 @@ void AtomBrowserClient::OverrideSiteInstanceForNavigation(
       return;
     }
 
+    // Prefer a pre-launched spare renderer over a fresh process.
+    content::SiteInstance* spare =
+        TakeSpareSiteInstance(browser_context, web_contents);
+    if (spare) {
+      *new_instance = spare;
+      pending_processes_[spare->GetProcess()->GetID()] = web_contents;
+      return;
+    }
+
     *new_instance = candidate_instance;
     // Remember the original web contents for the pending renderer process.
     auto* pending_process = candidate_instance->GetProcess();
@@ -311,9 +449,9 @@ void AtomBrowserClient::AppendExtraCommandLineSwitches(
     return;
 
   // Copy following switches to child process.
-  static const char* const kCommonSwitchNames[] = {switches::kStandardSchemes,
-                                                   switches::kEnableSandbox,
-                                                   switches::kSecureSchemes};
+  static const char* const kCommonSwitchNames[] = {
+      switches::kStandardSchemes, switches::kEnableSandbox,
+      switches::kSecureSchemes, switches::kDisableSubsystems};
   command_line->CopySwitchesFrom(*base::CommandLine::ForCurrentProcess(),
                                  kCommonSwitchNames,
                                  arraysize(kCommonSwitchNames));
@@ -323,6 +461,33 @@ void AtomBrowserClient::AppendExtraCommandLineSwitches(
     command_line->AppendSwitchASCII(switches::kRegisterServiceWorkerSchemes,
                                     g_custom_service_worker_schemes);
 
+  // Spare pool renderers launch before any WebContents exists; force the
+  // sandbox so the rest of their configuration can be delivered over IPC
+  // when a WebContents claims them.
+  if (IsSpareRendererProcess(process_id))
+    command_line->AppendSwitch(switches::kEnableSandbox);
+
+  // Renderer V8 heap tuning travels as --js-flags; put the tuning flags
+  // first so explicitly passed js-flags win.
+  std::string heap_flags = JavascriptEnvironment::GetV8HeapFlags(
+      *base::CommandLine::ForCurrentProcess(), true /* for_renderer */);
+  if (!heap_flags.empty()) {
+    std::string js_flags =
+        command_line->GetSwitchValueASCII(::switches::kJavaScriptFlags);
+    if (!js_flags.empty())
+      heap_flags += " " + js_flags;
+    command_line->AppendSwitchASCII(::switches::kJavaScriptFlags, heap_flags);
+  }
+
+#if defined(OS_POSIX) && !defined(OS_MACOSX)
+  // Tell the child which asar index each mapped region belongs to; the
+  // regions themselves are passed in GetAdditionalMappedFilesForChildProcess.
+  std::string asar_regions =
+      asar::AsarHeaderCache::GetInstance()->GetSwitchValueForChild();
+  if (!asar_regions.empty())
+    command_line->AppendSwitchASCII(switches::kAsarIndexRegions, asar_regions);
+#endif
+
 #if defined(OS_WIN)
   // Append --app-user-model-id.
   PWSTR current_app_id;
@@ -351,6 +516,21 @@ void AtomBrowserClient::AppendExtraCommandLineSwitches(
   }
 }
 
+#if defined(OS_POSIX) && !defined(OS_MACOSX)
+void AtomBrowserClient::GetAdditionalMappedFilesForChildProcess(
+    const base::CommandLine& command_line,
+    int child_process_id,
+    content::PosixFileDescriptorInfo* mappings) {
+  // Map the shared asar index regions into the child, in the same order
+  // as the kAsarIndexRegions switch entries.
+  int key = kAsarIndexDescriptorStart;
+  for (const auto& handle :
+       asar::AsarHeaderCache::GetInstance()->GetRegionHandles()) {
+    mappings->Share(key++, handle.GetHandle());
+  }
+}
+#endif
+
 void AtomBrowserClient::DidCreatePpapiPlugin(content::BrowserPpapiHost* host) {
 #if defined(ENABLE_PEPPER_FLASH)
   host->GetPpapiHost()->AddHostFactoryFilter(
@@ -543,6 +723,9 @@ void AtomBrowserClient::RenderProcessHostDestroyed(
   int process_id = host->GetID();
   pending_processes_.erase(process_id);
   RemoveProcessPreferences(process_id);
+  // A spare that dies unclaimed is not respawned automatically to avoid
+  // crash loops; the pool refills on the next claim or pool size change.
+  spare_renderers_.erase(process_id);
 }
 
 void AtomBrowserClient::RenderProcessReady(content::RenderProcessHost* host) {
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/ref_counted.h"
 #include "brightray/browser/browser_client.h"
 #include "content/public/browser/render_process_host_observer.h"
 #include "net/ssl/client_cert_identity.h"
@@ -17,6 +18,7 @@
 namespace content {
 class QuotaPermissionContext;
 class ClientCertificateDelegate;
+class SiteInstance;
 }  // namespace content
 
 namespace net {
@@ -46,6 +48,21 @@ class AtomBrowserClient : public brightray::BrowserClient,
   static void SetCustomServiceWorkerSchemes(
       const std::vector<std::string>& schemes);
 
+  // Affinity group applied to windows whose webPreferences do not pick
+  // their own; empty (the default) keeps one renderer per window. Must be
+  // set before the affected windows are created.
+  static void SetDefaultRendererAffinity(const std::string& affinity);
+
+  // Spare renderer pool: pre-launch sandbox-initialized renderer
+  // processes for a session so new WebContents can claim one instead of
+  // paying process startup during navigation. Only sandboxed WebContents
+  // can claim a spare, because their renderer configuration is delivered
+  // over IPC at runtime rather than baked into the launch command line.
+  void SetSpareRendererPoolSize(content::BrowserContext* browser_context,
+                                size_t size);
+  size_t GetSpareRendererPoolSize(
+      content::BrowserContext* browser_context) const;
+
  protected:
   // content::ContentBrowserClient:
   void RenderProcessWillLaunch(
@@ -53,6 +70,8 @@ class AtomBrowserClient : public brightray::BrowserClient,
       service_manager::mojom::ServiceRequest* service_request) override;
   content::SpeechRecognitionManagerDelegate*
   CreateSpeechRecognitionManagerDelegate() override;
+  content::PlatformNotificationService* GetPlatformNotificationService()
+      override;
   void OverrideWebkitPrefs(content::RenderViewHost* render_view_host,
                            content::WebPreferences* prefs) override;
   void OverrideSiteInstanceForNavigation(
@@ -64,6 +83,12 @@ class AtomBrowserClient : public brightray::BrowserClient,
       content::SiteInstance** new_instance) override;
   void AppendExtraCommandLineSwitches(base::CommandLine* command_line,
                                       int child_process_id) override;
+#if defined(OS_POSIX) && !defined(OS_MACOSX)
+  void GetAdditionalMappedFilesForChildProcess(
+      const base::CommandLine& command_line,
+      int child_process_id,
+      content::PosixFileDescriptorInfo* mappings) override;
+#endif
   void DidCreatePpapiPlugin(content::BrowserPpapiHost* browser_host) override;
   void GetGeolocationRequestContext(
       base::OnceCallback<void(scoped_refptr<net::URLRequestContextGetter>)>
@@ -136,10 +161,21 @@ class AtomBrowserClient : public brightray::BrowserClient,
     bool disable_popups = false;
   };
 
+  // A pre-launched renderer waiting to be claimed by a WebContents.
+  struct SpareRenderer {
+    scoped_refptr<content::SiteInstance> site_instance;
+    bool claimed = false;
+  };
+
   bool ShouldCreateNewSiteInstance(content::RenderFrameHost* render_frame_host,
                                    content::BrowserContext* browser_context,
                                    content::SiteInstance* current_instance,
                                    const GURL& dest_url);
+  void ReplenishSpareRenderers(content::BrowserContext* browser_context);
+  content::SiteInstance* TakeSpareSiteInstance(
+      content::BrowserContext* browser_context,
+      content::WebContents* web_contents);
+  bool IsSpareRendererProcess(int process_id) const;
   void AddProcessPreferences(int process_id, ProcessPreferences prefs);
   void RemoveProcessPreferences(int process_id);
   bool IsProcessObserved(int process_id);
@@ -156,6 +192,13 @@ class AtomBrowserClient : public brightray::BrowserClient,
   // list of site per affinity. weak_ptr to prevent instance locking
   std::map<std::string, content::SiteInstance*> site_per_affinities;
 
+  // Desired spare pool size per session.
+  std::map<content::BrowserContext*, size_t> spare_pool_sizes_;
+
+  // process id => spare renderer. Claimed entries stay here to keep the
+  // SiteInstance referenced until the process goes away.
+  std::map<int, SpareRenderer> spare_renderers_;
+
   std::unique_ptr<AtomResourceDispatcherHostDelegate>
       resource_dispatcher_host_delegate_;
 
@@ -87,7 +87,32 @@ AtomBrowserContext::AtomBrowserContext(const std::string& partition,
 
   // Read options.
   use_cache_ = true;
+  use_memory_cache_ = false;
+  cache_max_size_ = 0;
   options.GetBoolean("cache", &use_cache_);
+  std::string cache_type;
+  if (options.GetString("cacheType", &cache_type)) {
+    if (cache_type == "memory")
+      use_memory_cache_ = true;
+    else if (cache_type == "none")
+      use_cache_ = false;
+  }
+  options.GetInteger("cacheMaxSize", &cache_max_size_);
+  cache_backend_type_ = net::CACHE_BACKEND_DEFAULT;
+  std::string cache_backend;
+  if (options.GetString("cacheBackend", &cache_backend)) {
+    if (cache_backend == "simple")
+      cache_backend_type_ = net::CACHE_BACKEND_SIMPLE;
+    else if (cache_backend == "blockfile")
+      cache_backend_type_ = net::CACHE_BACKEND_BLOCKFILE;
+  }
+
+  max_sockets_per_host_ = 0;
+  max_sockets_per_proxy_ = 0;
+  max_sockets_total_ = 0;
+  options.GetInteger("maxSocketsPerHost", &max_sockets_per_host_);
+  options.GetInteger("maxSocketsPerProxy", &max_sockets_per_proxy_);
+  options.GetInteger("maxSocketsTotal", &max_sockets_total_);
 
   // Initialize Pref Registry in brightray.
   InitPrefs();
@@ -114,6 +139,17 @@ std::string AtomBrowserContext::GetUserAgent() {
   return user_agent_;
 }
 
+void AtomBrowserContext::GetSocketPoolLimits(int* max_sockets_per_host,
+                                             int* max_sockets_per_proxy,
+                                             int* max_sockets_total) {
+  if (max_sockets_per_host_ > 0)
+    *max_sockets_per_host = max_sockets_per_host_;
+  if (max_sockets_per_proxy_ > 0)
+    *max_sockets_per_proxy = max_sockets_per_proxy_;
+  if (max_sockets_total_ > 0)
+    *max_sockets_total = max_sockets_total_;
+}
+
 std::unique_ptr<net::URLRequestJobFactory>
 AtomBrowserContext::CreateURLRequestJobFactory(
     content::ProtocolHandlerMap* protocol_handlers) {
@@ -163,8 +199,23 @@ AtomBrowserContext::CreateHttpCacheBackendFactory(
   base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
   if (!use_cache_ || command_line->HasSwitch(switches::kDisableHttpCache))
     return new NoCacheBackend;
-  else
-    return brightray::BrowserContext::CreateHttpCacheBackendFactory(base_path);
+
+  // A memory-only cache keeps cookies and other storage on disk while HTTP
+  // responses never touch it; useful on flash storage.
+  if (use_memory_cache_)
+    return net::HttpCache::DefaultBackend::InMemory(cache_max_size_).release();
+
+  // An explicit backend choice or size bypasses brightray's stock
+  // factory. The simple backend keeps one file per entry and avoids the
+  // blockfile journal rewrites that jank flash storage.
+  if (cache_max_size_ > 0 ||
+      cache_backend_type_ != net::CACHE_BACKEND_DEFAULT) {
+    base::FilePath cache_path = base_path.Append(FILE_PATH_LITERAL("Cache"));
+    return new net::HttpCache::DefaultBackend(
+        net::DISK_CACHE, cache_backend_type_, cache_path, cache_max_size_);
+  }
+
+  return brightray::BrowserContext::CreateHttpCacheBackendFactory(base_path);
 }
 
 content::DownloadManagerDelegate*
@@ -228,6 +279,16 @@ AtomBlobReader* AtomBrowserContext::GetBlobReader() {
   return blob_reader_.get();
 }
 
+int AtomBrowserContext::AddInjectedStylesheet(const std::string& css) {
+  int key = next_injected_stylesheet_key_++;
+  injected_stylesheets_[key] = css;
+  return key;
+}
+
+void AtomBrowserContext::RemoveInjectedStylesheet(int key) {
+  injected_stylesheets_.erase(key);
+}
+
 // static
 scoped_refptr<AtomBrowserContext> AtomBrowserContext::From(
     const std::string& partition,
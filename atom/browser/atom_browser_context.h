@@ -5,11 +5,13 @@
 #ifndef ATOM_BROWSER_ATOM_BROWSER_CONTEXT_H_
 #define ATOM_BROWSER_ATOM_BROWSER_CONTEXT_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
 #include "base/callback_list.h"
 #include "brightray/browser/browser_context.h"
+#include "net/base/cache_type.h"
 
 namespace atom {
 
@@ -49,6 +51,9 @@ class AtomBrowserContext : public brightray::BrowserContext {
   void NotifyCookieChange(const net::CanonicalCookie& cookie,
                           bool removed,
                           net::CookieChangeCause cause) override;
+  void GetSocketPoolLimits(int* max_sockets_per_host,
+                           int* max_sockets_per_proxy,
+                           int* max_sockets_total) override;
 
   // content::BrowserContext:
   content::DownloadManagerDelegate* GetDownloadManagerDelegate() override;
@@ -60,6 +65,15 @@ class AtomBrowserContext : public brightray::BrowserContext {
 
   AtomBlobReader* GetBlobReader();
 
+  // Session-level stylesheets that are inserted into every new document of
+  // this session; newly launched renderer processes receive the current set
+  // once. Returns a handle that can be passed to RemoveInjectedStylesheet.
+  int AddInjectedStylesheet(const std::string& css);
+  void RemoveInjectedStylesheet(int key);
+  const std::map<int, std::string>& injected_stylesheets() const {
+    return injected_stylesheets_;
+  }
+
   void set_cookie_change_subscription(
       std::unique_ptr<
           base::CallbackList<void(const CookieDetails*)>::Subscription>
@@ -79,7 +93,22 @@ class AtomBrowserContext : public brightray::BrowserContext {
   std::unique_ptr<AtomPermissionManager> permission_manager_;
   std::unique_ptr<AtomBlobReader> blob_reader_;
   std::string user_agent_;
+
+  // HTTP cache policy for this partition, read from the fromPartition
+  // options at creation time.
   bool use_cache_;
+  bool use_memory_cache_;
+  int cache_max_size_;
+  net::BackendType cache_backend_type_;
+
+  // Socket pool limits for this partition, read from the fromPartition
+  // options at creation time; 0 keeps the stock limit.
+  int max_sockets_per_host_;
+  int max_sockets_per_proxy_;
+  int max_sockets_total_;
+
+  std::map<int, std::string> injected_stylesheets_;
+  int next_injected_stylesheet_key_ = 1;
 
   base::CallbackList<void(const CookieDetails*)> cookie_change_sub_list_;
   std::unique_ptr<base::CallbackList<void(const CookieDetails*)>::Subscription>
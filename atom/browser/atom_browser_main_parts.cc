@@ -12,11 +12,15 @@
 #include "atom/browser/browser.h"
 #include "atom/browser/javascript_environment.h"
 #include "atom/browser/node_debugger.h"
+#include "atom/browser/startup_timing.h"
+#include "atom/browser/task_latency_metrics.h"
 #include "atom/common/api/atom_bindings.h"
+#include "atom/common/asar/asar_header_cache.h"
 #include "atom/common/asar/asar_util.h"
 #include "atom/common/node_bindings.h"
 #include "base/command_line.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/browser/browser_process.h"
 #include "content/public/browser/child_process_security_policy.h"
 #include "content/public/common/result_codes.h"
@@ -111,6 +115,8 @@ void AtomBrowserMainParts::RegisterDestructionCallback(
 }
 
 int AtomBrowserMainParts::PreEarlyInitialization() {
+  TRACE_EVENT0("electron", "AtomBrowserMainParts::PreEarlyInitialization");
+  startup_timing::Mark("preEarlyInitialization");
   const int result = brightray::BrowserMainParts::PreEarlyInitialization();
   if (result != content::RESULT_CODE_NORMAL_EXIT)
     return result;
@@ -119,10 +125,16 @@ int AtomBrowserMainParts::PreEarlyInitialization() {
   HandleSIGCHLD();
 #endif
 
+  // The browser process is the producer of the shared asar index cache;
+  // enable it before any archive is opened.
+  asar::AsarHeaderCache::GetInstance()->EnableProducer();
+
   return content::RESULT_CODE_NORMAL_EXIT;
 }
 
 void AtomBrowserMainParts::PostEarlyInitialization() {
+  TRACE_EVENT0("electron", "AtomBrowserMainParts::PostEarlyInitialization");
+  startup_timing::Mark("postEarlyInitialization");
   brightray::BrowserMainParts::PostEarlyInitialization();
 
   // Temporary set the bridge_task_runner_ as current thread's task runner,
@@ -138,8 +150,13 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
   node_bindings_->Initialize();
 
   // Create the global environment.
-  node::Environment* env = node_bindings_->CreateEnvironment(
-      js_env_->context(), js_env_->platform());
+  node::Environment* env;
+  {
+    TRACE_EVENT0("electron", "NodeBindings::CreateEnvironment");
+    env = node_bindings_->CreateEnvironment(js_env_->context(),
+                                            js_env_->platform());
+  }
+  startup_timing::Mark("nodeEnvironmentCreated");
   node_env_.reset(new NodeEnvironment(env));
 
   // Enable support for v8 inspector
@@ -150,7 +167,11 @@ void AtomBrowserMainParts::PostEarlyInitialization() {
   atom_bindings_->BindTo(js_env_->isolate(), env->process_object());
 
   // Load everything.
-  node_bindings_->LoadEnvironment(env);
+  {
+    TRACE_EVENT0("electron", "NodeBindings::LoadEnvironment");
+    node_bindings_->LoadEnvironment(env);
+  }
+  startup_timing::Mark("nodeEnvironmentLoaded");
 
   // Wrap the uv loop with global env.
   node_bindings_->set_uv_env(env);
@@ -180,8 +201,14 @@ void AtomBrowserMainParts::ToolkitInitialized() {
 }
 
 void AtomBrowserMainParts::PreMainMessageLoopRun() {
+  TRACE_EVENT0("electron", "AtomBrowserMainParts::PreMainMessageLoopRun");
+  startup_timing::Mark("preMainMessageLoopRun");
   js_env_->OnMessageLoopCreated();
 
+  // Record queueing latency of main-thread tasks for app.getAppMetrics().
+  base::MessageLoop::current()->AddTaskObserver(
+      TaskLatencyMetrics::GetInstance());
+
   // Run user's main script before most things get initialized, so we can have
   // a chance to setup everything.
   node_bindings_->PrepareMessageLoop();
@@ -217,6 +244,7 @@ void AtomBrowserMainParts::PreMainMessageLoopRun() {
 
   // Notify observers that main thread message loop was initialized.
   Browser::Get()->PreMainMessageLoopRun();
+  startup_timing::Mark("mainMessageLoopReady");
 }
 
 bool AtomBrowserMainParts::MainMessageLoopRun(int* result_code) {
@@ -56,6 +56,8 @@ class AtomBrowserMainParts : public brightray::BrowserMainParts {
 
   Browser* browser() { return browser_.get(); }
 
+  JavascriptEnvironment* js_env() { return js_env_.get(); }
+
  protected:
   // content::BrowserMainParts:
   int PreEarlyInitialization() override;
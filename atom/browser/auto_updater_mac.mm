@@ -73,6 +73,15 @@ void AutoUpdater::SetFeedURL(mate::Arguments* args) {
   NSURL* url = [NSURL URLWithString:base::SysUTF8ToNSString(feed)];
   NSMutableURLRequest* urlRequest = [NSMutableURLRequest requestWithURL:url];
 
+  // Advertise the installed version on every feed request, so servers can
+  // target the response at what the client already has — e.g. serve a
+  // small archive containing only changed content for adjacent versions —
+  // and fall back to the full bundle for unknown ones. Explicit headers
+  // below still win.
+  [urlRequest setValue:base::SysUTF8ToNSString(
+                           atom::Browser::Get()->GetVersion())
+      forHTTPHeaderField:@"X-Installed-Version"];
+
   for (const auto& it : requestHeaders) {
     [urlRequest setValue:base::SysUTF8ToNSString(it.second)
         forHTTPHeaderField:base::SysUTF8ToNSString(it.first)];
@@ -4,23 +4,69 @@
 
 #include "atom/browser/bridge_task_runner.h"
 
+#include <utility>
+
 #include "base/message_loop/message_loop.h"
 
 namespace atom {
 
+BridgeTaskRunner::PendingTask::PendingTask(const base::Location& from_here,
+                                           base::OnceClosure task,
+                                           base::TimeDelta delay,
+                                           bool nestable)
+    : from_here(from_here),
+      task(std::move(task)),
+      delay(delay),
+      nestable(nestable) {}
+
+BridgeTaskRunner::PendingTask::~PendingTask() = default;
+
 BridgeTaskRunner::BridgeTaskRunner() = default;
-BridgeTaskRunner::~BridgeTaskRunner() = default;
+
+BridgeTaskRunner::~BridgeTaskRunner() {
+  // Free whatever never got replayed.
+  PendingTask* node = pending_head_.exchange(nullptr, std::memory_order_acquire);
+  while (node) {
+    PendingTask* next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+void BridgeTaskRunner::PushPendingTask(PendingTask* node) {
+  node->next = pending_head_.load(std::memory_order_relaxed);
+  while (!pending_head_.compare_exchange_weak(node->next, node,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed)) {
+  }
+}
 
 void BridgeTaskRunner::MessageLoopIsReady() {
   auto* message_loop = base::MessageLoop::current();
   CHECK(message_loop);
-  for (TaskPair& task : tasks_) {
-    message_loop->task_runner()->PostDelayedTask(
-        std::get<0>(task), std::move(std::get<1>(task)), std::get<2>(task));
+
+  // Splice the whole stack off in one atomic exchange, then reverse it so
+  // tasks replay in posting order.
+  PendingTask* node = pending_head_.exchange(nullptr, std::memory_order_acquire);
+  PendingTask* ordered = nullptr;
+  while (node) {
+    PendingTask* next = node->next;
+    node->next = ordered;
+    ordered = node;
+    node = next;
   }
-  for (TaskPair& task : non_nestable_tasks_) {
-    message_loop->task_runner()->PostNonNestableDelayedTask(
-        std::get<0>(task), std::move(std::get<1>(task)), std::get<2>(task));
+
+  while (ordered) {
+    PendingTask* next = ordered->next;
+    if (ordered->nestable) {
+      message_loop->task_runner()->PostDelayedTask(
+          ordered->from_here, std::move(ordered->task), ordered->delay);
+    } else {
+      message_loop->task_runner()->PostNonNestableDelayedTask(
+          ordered->from_here, std::move(ordered->task), ordered->delay);
+    }
+    delete ordered;
+    ordered = next;
   }
 }
 
@@ -29,7 +75,8 @@ bool BridgeTaskRunner::PostDelayedTask(const base::Location& from_here,
                                        base::TimeDelta delay) {
   auto* message_loop = base::MessageLoop::current();
   if (!message_loop) {
-    tasks_.push_back(std::make_tuple(from_here, std::move(task), delay));
+    PushPendingTask(
+        new PendingTask(from_here, std::move(task), delay, true /* nestable */));
     return true;
   }
 
@@ -51,8 +98,8 @@ bool BridgeTaskRunner::PostNonNestableDelayedTask(
     base::TimeDelta delay) {
   auto* message_loop = base::MessageLoop::current();
   if (!message_loop) {
-    non_nestable_tasks_.push_back(
-        std::make_tuple(from_here, std::move(task), delay));
+    PushPendingTask(new PendingTask(from_here, std::move(task), delay,
+                                    false /* nestable */));
     return true;
   }
 
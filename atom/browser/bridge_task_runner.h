@@ -5,12 +5,10 @@
 #ifndef ATOM_BROWSER_BRIDGE_TASK_RUNNER_H_
 #define ATOM_BROWSER_BRIDGE_TASK_RUNNER_H_
 
-#include <tuple>
-#include <vector>
+#include <atomic>
 
 #include "base/location.h"
 #include "base/single_thread_task_runner.h"
-#include "base/tuple.h"
 
 namespace atom {
 
@@ -33,12 +31,29 @@ class BridgeTaskRunner : public base::SingleThreadTaskRunner {
                                   base::TimeDelta delay) override;
 
  private:
-  using TaskPair =
-      std::tuple<base::Location, base::OnceClosure, base::TimeDelta>;
+  // Node of the pending-task list. Tasks arrive from multiple threads during
+  // early startup, so the list is a lock-free LIFO stack that
+  // MessageLoopIsReady splices off and reverses in one pass.
+  struct PendingTask {
+    PendingTask(const base::Location& from_here,
+                base::OnceClosure task,
+                base::TimeDelta delay,
+                bool nestable);
+    ~PendingTask();
+
+    base::Location from_here;
+    base::OnceClosure task;
+    base::TimeDelta delay;
+    bool nestable;
+    PendingTask* next = nullptr;
+  };
+
   ~BridgeTaskRunner() override;
 
-  std::vector<TaskPair> tasks_;
-  std::vector<TaskPair> non_nestable_tasks_;
+  // Pushes |node| onto |pending_head_|; safe from any thread.
+  void PushPendingTask(PendingTask* node);
+
+  std::atomic<PendingTask*> pending_head_{nullptr};
 
   DISALLOW_COPY_AND_ASSIGN(BridgeTaskRunner);
 };
@@ -246,6 +246,13 @@ class Browser : public WindowListObserver {
   bool is_quiting() const { return is_quiting_; }
   bool is_ready() const { return is_ready_; }
 
+  // Seconds a window must stay hidden before its renderer is told to
+  // shed memory; 0 (the default) disables hidden-window collection.
+  void SetHiddenWindowGCTimeout(int seconds) {
+    hidden_window_gc_timeout_ = seconds > 0 ? seconds : 0;
+  }
+  int hidden_window_gc_timeout() const { return hidden_window_gc_timeout_; }
+
  protected:
   // Returns the version of application bundle or executable file.
   std::string GetExecutableFileVersion() const;
@@ -280,6 +287,8 @@ class Browser : public WindowListObserver {
 
   int badge_count_ = 0;
 
+  int hidden_window_gc_timeout_ = 0;
+
 #if defined(OS_MACOSX)
   base::DictionaryValue about_panel_options_;
 #endif
@@ -14,6 +14,7 @@
 #include "atom/browser/web_contents_preferences.h"
 #include "atom/browser/web_dialog_helper.h"
 #include "atom/common/atom_constants.h"
+#include "atom/common/disabled_subsystems.h"
 #include "atom/common/options_switches.h"
 #include "base/files/file_util.h"
 #include "base/task_scheduler/post_task.h"
@@ -156,8 +157,13 @@ void CommonWebContentsDelegate::InitWithWebContents(
   browser_context_ = browser_context;
   web_contents->SetDelegate(this);
 
-  printing::PrintViewManagerBasic::CreateForWebContents(web_contents);
-  printing::PrintPreviewMessageHandler::CreateForWebContents(web_contents);
+  // "printing" covers the whole pipeline; "pdf" only the preview handler
+  // that backs printToPDF.
+  if (!subsystems::IsDisabled(subsystems::kPrinting)) {
+    printing::PrintViewManagerBasic::CreateForWebContents(web_contents);
+    if (!subsystems::IsDisabled(subsystems::kPdf))
+      printing::PrintPreviewMessageHandler::CreateForWebContents(web_contents);
+  }
 
   // Determien whether the WebContents is offscreen.
   auto* web_preferences = WebContentsPreferences::From(web_contents);
@@ -0,0 +1,103 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/ipc_metrics.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "atom/common/options_switches.h"
+#include "base/command_line.h"
+
+namespace atom {
+
+namespace {
+
+// Index of the power-of-two bucket covering |value|.
+int BucketFor(uint64_t value) {
+  int bucket = 0;
+  while (value > 0 && bucket < IPCMetrics::kNumBuckets - 1) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+std::unique_ptr<base::ListValue> BucketsToList(const uint32_t* buckets) {
+  auto list = std::make_unique<base::ListValue>();
+  for (int i = 0; i < IPCMetrics::kNumBuckets; ++i)
+    list->AppendInteger(buckets[i]);
+  return list;
+}
+
+}  // namespace
+
+// static
+IPCMetrics* IPCMetrics::GetInstance() {
+  return base::Singleton<IPCMetrics>::get();
+}
+
+IPCMetrics::IPCMetrics() {
+  enabled_ = base::CommandLine::ForCurrentProcess()->HasSwitch(
+      switches::kEnableIPCMetrics);
+}
+
+IPCMetrics::~IPCMetrics() = default;
+
+void IPCMetrics::RecordMessage(const std::string& channel,
+                               size_t payload_bytes,
+                               base::TimeDelta elapsed) {
+  ChannelMetrics& metrics = channels_[channel];
+  metrics.count++;
+  metrics.total_bytes += payload_bytes;
+  metrics.max_bytes = std::max(metrics.max_bytes,
+                               static_cast<uint64_t>(payload_bytes));
+  metrics.total_latency += elapsed;
+  metrics.max_latency = std::max(metrics.max_latency, elapsed);
+  metrics.size_buckets[BucketFor(payload_bytes)]++;
+  metrics.latency_buckets[BucketFor(elapsed.InMicroseconds())]++;
+}
+
+// static
+size_t IPCMetrics::EstimateValueSize(const base::Value& value) {
+  switch (value.type()) {
+    case base::Value::Type::STRING:
+      return value.GetString().size();
+    case base::Value::Type::BINARY:
+      return value.GetBlob().size();
+    case base::Value::Type::LIST: {
+      size_t size = 0;
+      for (const auto& child : value.GetList())
+        size += EstimateValueSize(child);
+      return size;
+    }
+    case base::Value::Type::DICTIONARY: {
+      size_t size = 0;
+      for (const auto& pair : value.DictItems())
+        size += pair.first.size() + EstimateValueSize(pair.second);
+      return size;
+    }
+    default:
+      return sizeof(double);
+  }
+}
+
+std::unique_ptr<base::DictionaryValue> IPCMetrics::GetMetrics() const {
+  auto result = std::make_unique<base::DictionaryValue>();
+  for (const auto& pair : channels_) {
+    const ChannelMetrics& metrics = pair.second;
+    auto dict = std::make_unique<base::DictionaryValue>();
+    dict->SetDouble("count", metrics.count);
+    dict->SetDouble("totalBytes", metrics.total_bytes);
+    dict->SetDouble("maxBytes", metrics.max_bytes);
+    dict->SetDouble("totalLatencyMs", metrics.total_latency.InMillisecondsF());
+    dict->SetDouble("maxLatencyMs", metrics.max_latency.InMillisecondsF());
+    dict->Set("sizeHistogram", BucketsToList(metrics.size_buckets));
+    dict->Set("latencyUsHistogram", BucketsToList(metrics.latency_buckets));
+    result->SetWithoutPathExpansion(pair.first, std::move(dict));
+  }
+  return result;
+}
+
+}  // namespace atom
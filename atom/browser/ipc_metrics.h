@@ -0,0 +1,72 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_IPC_METRICS_H_
+#define ATOM_BROWSER_IPC_METRICS_H_
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "base/macros.h"
+#include "base/memory/singleton.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace atom {
+
+// Per-channel accounting of renderer->browser messages, recorded from
+// the dispatch handlers in atom_api_web_contents.cc. Off by default;
+// enabled with the --enable-ipc-metrics switch so it can be shipped to
+// a fraction of users. All access happens on the UI thread, so no
+// locking is needed.
+class IPCMetrics {
+ public:
+  // Number of power-of-two buckets in the size and latency histograms.
+  static const int kNumBuckets = 24;
+
+  static IPCMetrics* GetInstance();
+
+  bool enabled() const { return enabled_; }
+
+  // Records one dispatched message: |payload_bytes| of arguments that
+  // took |elapsed| to deliver to the JS listeners.
+  void RecordMessage(const std::string& channel,
+                     size_t payload_bytes,
+                     base::TimeDelta elapsed);
+
+  // Rough wire size of |value|, used for messages that arrive as
+  // base::Value rather than a byte blob.
+  static size_t EstimateValueSize(const base::Value& value);
+
+  // Snapshot of all recorded channels, used by app.getIPCMetrics().
+  std::unique_ptr<base::DictionaryValue> GetMetrics() const;
+
+ private:
+  friend struct base::DefaultSingletonTraits<IPCMetrics>;
+
+  struct ChannelMetrics {
+    uint64_t count = 0;
+    uint64_t total_bytes = 0;
+    uint64_t max_bytes = 0;
+    base::TimeDelta total_latency;
+    base::TimeDelta max_latency;
+    // Message sizes, bucket n counting payloads < 2^n bytes.
+    uint32_t size_buckets[kNumBuckets] = {};
+    // Dispatch latencies, bucket n counting times < 2^n microseconds.
+    uint32_t latency_buckets[kNumBuckets] = {};
+  };
+
+  IPCMetrics();
+  ~IPCMetrics();
+
+  bool enabled_ = false;
+  std::map<std::string, ChannelMetrics> channels_;
+
+  DISALLOW_COPY_AND_ASSIGN(IPCMetrics);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_IPC_METRICS_H_
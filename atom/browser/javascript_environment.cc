@@ -6,8 +6,12 @@
 
 #include <string>
 
+#include "atom/common/api/locker.h"
+#include "atom/common/options_switches.h"
 #include "base/command_line.h"
 #include "base/message_loop/message_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/task_scheduler/initialization_util.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "content/public/common/content_switches.h"
@@ -27,7 +31,12 @@ JavascriptEnvironment::JavascriptEnvironment()
       locker_(isolate_),
       handle_scope_(isolate_),
       context_(isolate_, v8::Context::New(isolate_)),
-      context_scope_(v8::Local<v8::Context>::New(isolate_, context_)) {}
+      context_scope_(v8::Local<v8::Context>::New(isolate_, context_)) {
+  // The browser process never runs JavaScript off this thread and |locker_|
+  // above is held for the lifetime of the process, so mate::Locker can skip
+  // the redundant nested v8::Locker acquisition from now on.
+  mate::Locker::SetIsSingleThreaded();
+}
 
 JavascriptEnvironment::~JavascriptEnvironment() = default;
 
@@ -39,9 +48,52 @@ void JavascriptEnvironment::OnMessageLoopDestroying() {
   isolate_holder_.RemoveRunMicrotasksObserver();
 }
 
+void JavascriptEnvironment::NotifyLowMemory() {
+  isolate_->LowMemoryNotification();
+}
+
+// static
+std::string JavascriptEnvironment::GetV8HeapFlags(
+    const base::CommandLine& command_line, bool for_renderer) {
+  const struct {
+    const char* switch_name;
+    const char* v8_flag;
+  } kHeapSwitches[] = {
+      {for_renderer ? switches::kRendererV8MaxOldSpaceSize
+                    : switches::kV8MaxOldSpaceSize,
+       "max_old_space_size"},
+      {for_renderer ? switches::kRendererV8MaxSemiSpaceSize
+                    : switches::kV8MaxSemiSpaceSize,
+       "max_semi_space_size"},
+      {for_renderer ? switches::kRendererV8InitialOldSpaceSize
+                    : switches::kV8InitialOldSpaceSize,
+       "initial_old_space_size"},
+  };
+
+  std::string flags;
+  for (const auto& heap_switch : kHeapSwitches) {
+    int size_in_mb = 0;
+    if (!base::StringToInt(
+            command_line.GetSwitchValueASCII(heap_switch.switch_name),
+            &size_in_mb) ||
+        size_in_mb <= 0)
+      continue;
+    if (!flags.empty())
+      flags += " ";
+    flags += base::StringPrintf("--%s=%d", heap_switch.v8_flag, size_in_mb);
+  }
+  return flags;
+}
+
 bool JavascriptEnvironment::Initialize() {
   auto* cmd = base::CommandLine::ForCurrentProcess();
 
+  // Heap tuning switches, applied before --js-flags so explicitly
+  // passed flags win.
+  std::string heap_flags = GetV8HeapFlags(*cmd, false /* for_renderer */);
+  if (!heap_flags.empty())
+    v8::V8::SetFlagsFromString(heap_flags.c_str(), heap_flags.size());
+
   // --js-flags.
   std::string js_flags = cmd->GetSwitchValueASCII(switches::kJavaScriptFlags);
   if (!js_flags.empty())
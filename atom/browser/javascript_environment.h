@@ -5,9 +5,15 @@
 #ifndef ATOM_BROWSER_JAVASCRIPT_ENVIRONMENT_H_
 #define ATOM_BROWSER_JAVASCRIPT_ENVIRONMENT_H_
 
+#include <string>
+
 #include "base/macros.h"
 #include "gin/public/isolate_holder.h"
 
+namespace base {
+class CommandLine;
+}
+
 namespace node {
 class Environment;
 class MultiIsolatePlatform;
@@ -24,6 +30,16 @@ class JavascriptEnvironment {
   void OnMessageLoopCreated();
   void OnMessageLoopDestroying();
 
+  // Collects the main-process heap down to a minimum, as under critical
+  // memory pressure.
+  void NotifyLowMemory();
+
+  // Builds a V8 flag string ("--max_old_space_size=N ...") from the
+  // heap tuning switches for either the main process or renderers.
+  // Returns an empty string when no switch is set.
+  static std::string GetV8HeapFlags(const base::CommandLine& command_line,
+                                    bool for_renderer);
+
   node::MultiIsolatePlatform* platform() const { return platform_; }
   v8::Isolate* isolate() const { return isolate_; }
   v8::Local<v8::Context> context() const {
@@ -0,0 +1,57 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/long_task_watchdog.h"
+
+#include "atom/browser/unresponsive_suppressor.h"
+
+namespace atom {
+
+LongTaskWatchdog::LongTaskWatchdog() {}
+
+LongTaskWatchdog::~LongTaskWatchdog() {
+  Stop();
+}
+
+void LongTaskWatchdog::Start(base::TimeDelta threshold,
+                             const LongTaskCallback& callback) {
+  if (running_)
+    return;
+  threshold_ = threshold;
+  callback_ = callback;
+  running_ = true;
+  base::MessageLoop::current()->AddTaskObserver(this);
+}
+
+void LongTaskWatchdog::Stop() {
+  if (!running_)
+    return;
+  base::MessageLoop::current()->RemoveTaskObserver(this);
+  running_ = false;
+}
+
+void LongTaskWatchdog::WillProcessTask(const base::PendingTask& pending_task) {
+  task_start_time_ = base::TimeTicks::Now();
+}
+
+void LongTaskWatchdog::DidProcessTask(const base::PendingTask& pending_task) {
+  base::TimeDelta duration = base::TimeTicks::Now() - task_start_time_;
+  if (duration < threshold_)
+    return;
+
+  // Deliberately blocking work (modal dialogs etc.) already suppresses the
+  // unresponsive dialog; do not count it as an accidental long task either.
+  if (IsUnresponsiveEventSuppressed())
+    return;
+
+  long_task_count_++;
+  total_long_task_time_ += duration;
+  if (duration > max_task_duration_)
+    max_task_duration_ = duration;
+
+  if (!callback_.is_null())
+    callback_.Run(pending_task.posted_from.ToString(), duration);
+}
+
+}  // namespace atom
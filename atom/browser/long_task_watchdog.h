@@ -0,0 +1,62 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_LONG_TASK_WATCHDOG_H_
+#define ATOM_BROWSER_LONG_TASK_WATCHDOG_H_
+
+#include <string>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/message_loop/message_loop.h"
+#include "base/time/time.h"
+
+namespace atom {
+
+// Records browser main-thread tasks that run longer than a threshold,
+// attributing each one to the location it was posted from. Complements
+// UnresponsiveSuppressor: instead of only hiding the unresponsive dialog,
+// this gives visibility into the near misses that never trigger it.
+class LongTaskWatchdog : public base::MessageLoop::TaskObserver {
+ public:
+  // Runs on the UI thread for every task exceeding the threshold.
+  using LongTaskCallback = base::Callback<void(const std::string& location,
+                                               base::TimeDelta duration)>;
+
+  LongTaskWatchdog();
+  ~LongTaskWatchdog() override;
+
+  // Starts/stops observing the current thread's message loop. Must be
+  // called on the UI thread.
+  void Start(base::TimeDelta threshold, const LongTaskCallback& callback);
+  void Stop();
+
+  bool is_running() const { return running_; }
+  int long_task_count() const { return long_task_count_; }
+  base::TimeDelta total_long_task_time() const {
+    return total_long_task_time_;
+  }
+  base::TimeDelta max_task_duration() const { return max_task_duration_; }
+
+ private:
+  // base::MessageLoop::TaskObserver:
+  void WillProcessTask(const base::PendingTask& pending_task) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+  bool running_ = false;
+  base::TimeDelta threshold_;
+  LongTaskCallback callback_;
+  base::TimeTicks task_start_time_;
+
+  // Counters only ever grow, so callers can diff successive samples.
+  int long_task_count_ = 0;
+  base::TimeDelta total_long_task_time_;
+  base::TimeDelta max_task_duration_;
+
+  DISALLOW_COPY_AND_ASSIGN(LongTaskWatchdog);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_LONG_TASK_WATCHDOG_H_
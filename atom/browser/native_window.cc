@@ -10,10 +10,15 @@
 #include <vector>
 
 #include "atom/browser/browser.h"
+#include "atom/browser/startup_timing.h"
 #include "atom/browser/window_list.h"
 #include "atom/common/color_util.h"
 #include "atom/common/options_switches.h"
+#include "base/time/time.h"
 #include "native_mate/dictionary.h"
+#include "ui/compositor/compositor.h"
+#include "ui/compositor/layer.h"
+#include "ui/gfx/animation/linear_animation.h"
 #include "ui/views/widget/widget.h"
 
 #if defined(OS_WIN)
@@ -48,9 +53,10 @@ gfx::Size GetExpandedWindowSize(const NativeWindow* window, gfx::Size size) {
 NativeWindow::NativeWindow(const mate::Dictionary& options,
                            NativeWindow* parent)
     : widget_(new views::Widget), parent_(parent), weak_factory_(this) {
-  options.Get(options::kFrame, &has_frame_);
-  options.Get(options::kTransparent, &transparent_);
-  options.Get(options::kEnableLargerThanScreen, &enable_larger_than_screen_);
+  options.GetMany(options::kFrame, &has_frame_,
+                  options::kTransparent, &transparent_,
+                  options::kEnableLargerThanScreen,
+                  &enable_larger_than_screen_);
 
   if (parent)
     options.Get("modal", &is_modal_);
@@ -68,7 +74,7 @@ void NativeWindow::InitFromOptions(const mate::Dictionary& options) {
   // Setup window from options.
   int x = -1, y = -1;
   bool center;
-  if (options.Get(options::kX, &x) && options.Get(options::kY, &y)) {
+  if (options.GetMany(options::kX, &x, options::kY, &y) == 2) {
     SetPosition(gfx::Point(x, y));
 
 #if defined(OS_WIN)
@@ -84,13 +90,13 @@ void NativeWindow::InitFromOptions(const mate::Dictionary& options) {
   // On Linux and Window we may already have maximum size defined.
   extensions::SizeConstraints size_constraints(GetContentSizeConstraints());
   int min_height = 0, min_width = 0;
-  if (options.Get(options::kMinHeight, &min_height) |
-      options.Get(options::kMinWidth, &min_width)) {
+  if (options.GetMany(options::kMinHeight, &min_height,
+                      options::kMinWidth, &min_width) > 0) {
     size_constraints.set_minimum_size(gfx::Size(min_width, min_height));
   }
   int max_height = INT_MAX, max_width = INT_MAX;
-  if (options.Get(options::kMaxHeight, &max_height) |
-      options.Get(options::kMaxWidth, &max_width)) {
+  if (options.GetMany(options::kMaxHeight, &max_height,
+                      options::kMaxWidth, &max_width) > 0) {
     size_constraints.set_maximum_size(gfx::Size(max_width, max_height));
   }
   bool use_content_size = false;
@@ -126,6 +132,10 @@ void NativeWindow::InitFromOptions(const mate::Dictionary& options) {
   if (options.Get(options::kAlwaysOnTop, &top) && top) {
     SetAlwaysOnTop(true);
   }
+  int frame_rate;
+  if (options.Get(options::kFrameRate, &frame_rate)) {
+    SetFrameRate(frame_rate);
+  }
   bool fullscreenable = true;
   bool fullscreen = false;
   if (options.Get(options::kFullscreen, &fullscreen) && !fullscreen) {
@@ -425,13 +435,79 @@ void NativeWindow::NotifyWindowFocus() {
 }
 
 void NativeWindow::NotifyWindowShow() {
+  // First mark wins, so this records when the first window of the
+  // session became visible.
+  startup_timing::Mark("firstWindowShown");
+  // The compositor may not have existed when the cap was configured.
+  if (frame_rate_ > 0)
+    SetFrameRate(frame_rate_);
   for (NativeWindowObserver& observer : observers_)
     observer.OnWindowShow();
+  NotifyWindowOcclusionChange(false);
 }
 
 void NativeWindow::NotifyWindowHide() {
   for (NativeWindowObserver& observer : observers_)
     observer.OnWindowHide();
+  NotifyWindowOcclusionChange(true);
+}
+
+void NativeWindow::SetFrameRate(int frame_rate) {
+  if (frame_rate < 0)
+    return;
+  frame_rate_ = frame_rate;
+
+  if (!widget_ || !widget_->GetLayer())
+    return;
+  ui::Compositor* compositor = widget_->GetLayer()->GetCompositor();
+  if (!compositor)
+    return;
+
+  // The compositor keeps producing frames at whatever interval we hand
+  // it, so uncapping means going back to the display's nominal 60Hz.
+  int effective_frame_rate = frame_rate_ > 0 ? frame_rate_ : 60;
+  compositor->SetAuthoritativeVSyncInterval(
+      base::TimeDelta::FromMicroseconds(1000000 / effective_frame_rate));
+}
+
+void NativeWindow::AnimateBounds(const gfx::Rect& target_bounds,
+                                 int duration_ms,
+                                 gfx::Tween::Type easing) {
+  bounds_animation_start_ = GetBounds();
+  bounds_animation_target_ = target_bounds;
+  bounds_animation_easing_ = easing;
+  // Restarting replaces the previous animation without an event; the
+  // finished notification only fires for animations that run to the end.
+  bounds_animation_.reset(
+      new gfx::LinearAnimation(duration_ms, 60 /* frame_rate */, this));
+  bounds_animation_->Start();
+}
+
+void NativeWindow::AnimationProgressed(const gfx::Animation* animation) {
+  SetBounds(gfx::Tween::RectValueBetween(
+                gfx::Tween::CalculateValue(bounds_animation_easing_,
+                                           animation->GetCurrentValue()),
+                bounds_animation_start_, bounds_animation_target_),
+            false);
+}
+
+void NativeWindow::AnimationEnded(const gfx::Animation* animation) {
+  SetBounds(bounds_animation_target_, false);
+  bounds_animation_.reset();
+  NotifyWindowBoundsAnimationFinished();
+}
+
+void NativeWindow::NotifyWindowOcclusionChange(bool occluded) {
+  if (occluded == occluded_)
+    return;
+  occluded_ = occluded;
+  for (NativeWindowObserver& observer : observers_)
+    observer.OnWindowOcclusionChange(occluded);
+}
+
+void NativeWindow::NotifyWindowBoundsAnimationFinished() {
+  for (NativeWindowObserver& observer : observers_)
+    observer.OnWindowBoundsAnimationFinished();
 }
 
 void NativeWindow::NotifyWindowMaximize() {
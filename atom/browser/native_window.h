@@ -16,6 +16,9 @@
 #include "base/supports_user_data.h"
 #include "content/public/browser/web_contents_user_data.h"
 #include "extensions/browser/app_window/size_constraints.h"
+#include "ui/gfx/animation/animation_delegate.h"
+#include "ui/gfx/animation/tween.h"
+#include "ui/gfx/geometry/rect.h"
 #include "ui/views/widget/widget_delegate.h"
 
 class SkRegion;
@@ -26,6 +29,7 @@ struct NativeWebKeyboardEvent;
 
 namespace gfx {
 class Image;
+class LinearAnimation;
 class Point;
 class Rect;
 class RectF;
@@ -45,7 +49,8 @@ class NativeBrowserView;
 struct DraggableRegion;
 
 class NativeWindow : public base::SupportsUserData,
-                     public views::WidgetDelegate {
+                     public views::WidgetDelegate,
+                     public gfx::AnimationDelegate {
  public:
   ~NativeWindow() override;
 
@@ -228,6 +233,8 @@ class NativeWindow : public base::SupportsUserData,
   void NotifyWindowFocus();
   void NotifyWindowShow();
   void NotifyWindowHide();
+  void NotifyWindowOcclusionChange(bool occluded);
+  void NotifyWindowBoundsAnimationFinished();
   void NotifyWindowMaximize();
   void NotifyWindowUnmaximize();
   void NotifyWindowMinimize();
@@ -264,6 +271,22 @@ class NativeWindow : public base::SupportsUserData,
   bool has_frame() const { return has_frame_; }
   void set_has_frame(bool has_frame) { has_frame_ = has_frame; }
 
+  bool IsOccluded() const { return occluded_; }
+
+  // Caps how often this window's compositor produces frames. 0 means
+  // the display-driven default. Takes effect immediately when the
+  // window is showing, otherwise when it is next shown.
+  void SetFrameRate(int frame_rate);
+  int GetFrameRate() const { return frame_rate_; }
+
+  // Animates the window to |target_bounds| natively, driven by an
+  // animation clock in the browser process instead of per-frame calls
+  // from JS. Starting a new animation cancels the running one.
+  void AnimateBounds(const gfx::Rect& target_bounds,
+                     int duration_ms,
+                     gfx::Tween::Type easing);
+  bool IsAnimatingBounds() const { return bounds_animation_ != nullptr; }
+
   bool transparent() const { return transparent_; }
   bool enable_larger_than_screen() const { return enable_larger_than_screen_; }
 
@@ -278,6 +301,10 @@ class NativeWindow : public base::SupportsUserData,
   views::Widget* GetWidget() override;
   const views::Widget* GetWidget() const override;
 
+  // gfx::AnimationDelegate:
+  void AnimationProgressed(const gfx::Animation* animation) override;
+  void AnimationEnded(const gfx::Animation* animation) override;
+
   void set_content_view(views::View* view) { content_view_ = view; }
   void set_browser_view(NativeBrowserView* browser_view) {
     browser_view_ = browser_view;
@@ -304,6 +331,19 @@ class NativeWindow : public base::SupportsUserData,
   // The windows has been closed.
   bool is_closed_ = false;
 
+  // Whether nobody can see the window. Updated from the occlusion
+  // notifications on macOS, and from show/hide elsewhere.
+  bool occluded_ = false;
+
+  // Frames per second the compositor is capped to; 0 means uncapped.
+  int frame_rate_ = 0;
+
+  // Running bounds animation, if any.
+  std::unique_ptr<gfx::LinearAnimation> bounds_animation_;
+  gfx::Rect bounds_animation_start_;
+  gfx::Rect bounds_animation_target_;
+  gfx::Tween::Type bounds_animation_easing_ = gfx::Tween::LINEAR;
+
   // Used to display sheets at the appropriate horizontal and vertical offsets
   // on macOS.
   double sheet_offset_x_ = 0.0;
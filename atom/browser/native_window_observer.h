@@ -58,6 +58,14 @@ class NativeWindowObserver {
   // Called when window is hidden.
   virtual void OnWindowHide() {}
 
+  // Called when the window becomes fully occluded or visible again.
+  // On macOS this follows the real occlusion state; elsewhere hidden is
+  // used as the occlusion signal.
+  virtual void OnWindowOcclusionChange(bool occluded) {}
+
+  // Called when a native bounds animation runs to completion.
+  virtual void OnWindowBoundsAnimationFinished() {}
+
   // Called when window state changed.
   virtual void OnWindowMaximize() {}
   virtual void OnWindowUnmaximize() {}
@@ -169,6 +169,12 @@ bool URLRequestAsarJob::IsRedirectResponse(GURL* location,
 std::unique_ptr<net::SourceStream> URLRequestAsarJob::SetUpSourceStream() {
   std::unique_ptr<net::SourceStream> source =
       net::URLRequestJob::SetUpSourceStream();
+  // Compressed asar entries are stored as deflate streams; decode them
+  // incrementally as the raw bytes come off disk.
+  if (type_ == TYPE_ASAR && file_info_.compressed) {
+    return net::GzipSourceStream::Create(std::move(source),
+                                         net::SourceStream::TYPE_DEFLATE);
+  }
   // Bug 9936 - .svgz files needs to be decompressed.
   return base::LowerCaseEqualsASCII(file_path_.Extension(), ".svgz")
              ? net::GzipSourceStream::Create(std::move(source),
@@ -276,7 +282,17 @@ void URLRequestAsarJob::DidOpen(int result) {
 
   int64_t file_size, read_offset;
   if (type_ == TYPE_ASAR) {
-    file_size = file_info_.size;
+    // For compressed entries we read the stored (deflated) bytes; range
+    // requests would address positions in the decoded stream, which we
+    // cannot seek in, so reject them.
+    if (file_info_.compressed && byte_range_.IsValid()) {
+      NotifyStartError(
+          net::URLRequestStatus(net::URLRequestStatus::FAILED,
+                                net::ERR_REQUEST_RANGE_NOT_SATISFIABLE));
+      return;
+    }
+    file_size = file_info_.compressed ? file_info_.stored_size
+                                      : file_info_.size;
     read_offset = file_info_.offset;
   } else {
     file_size = meta_info_.file_size;
@@ -316,7 +332,13 @@ void URLRequestAsarJob::DidSeek(int64_t result) {
         net::URLRequestStatus::FAILED, net::ERR_REQUEST_RANGE_NOT_SATISFIABLE));
     return;
   }
-  set_expected_content_size(remaining_bytes_);
+  if (type_ == TYPE_ASAR && file_info_.compressed) {
+    // |remaining_bytes_| counts stored bytes; the deflate source stream
+    // expands them, so advertise the decoded size instead.
+    set_expected_content_size(file_info_.size);
+  } else {
+    set_expected_content_size(remaining_bytes_);
+  }
   NotifyHeadersComplete();
 }
 
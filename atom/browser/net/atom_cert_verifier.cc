@@ -25,6 +25,13 @@ VerifyRequestParams::VerifyRequestParams(const VerifyRequestParams&) = default;
 
 namespace {
 
+// Cap and lifetime of cached verification results. Entries expire so that
+// revoked certificates or changed proc behavior are picked up again; the
+// cache is cleared wholesale when full, matching Chromium's built-in
+// verifier cache size.
+const size_t kMaxVerifyCacheSize = 256;
+const int kVerifyCacheTTLMinutes = 10;
+
 class Response : public base::LinkNode<Response> {
  public:
   Response(net::CertVerifyResult* verify_result,
@@ -119,6 +126,8 @@ class CertVerifierRequest : public AtomCertVerifier::Request {
   void NotifyResponseInIO(int result) {
     custom_response_ = result;
     first_response_ = false;
+    cert_verifier_->CacheVerificationResult(params_, error_, custom_response_,
+                                            result_);
     // Responding to first request in the list will initiate destruction of
     // the class, respond to others in the list inside destructor.
     base::LinkNode<Response>* response_node = response_list_.head();
@@ -156,6 +165,9 @@ AtomCertVerifier::~AtomCertVerifier() {}
 
 void AtomCertVerifier::SetVerifyProc(const VerifyProc& proc) {
   verify_proc_ = proc;
+  // Cached decisions were made by the previous proc and may not apply
+  // anymore.
+  verify_cache_.clear();
 }
 
 int AtomCertVerifier::Verify(const RequestParams& params,
@@ -171,6 +183,10 @@ int AtomCertVerifier::Verify(const RequestParams& params,
     return default_cert_verifier_->Verify(params, crl_set, verify_result,
                                           callback, out_req, net_log);
   } else {
+    int error;
+    if (GetCachedVerificationResult(params, verify_result, &error))
+      return error;
+
     CertVerifierRequest* request = FindRequest(params);
     if (!request) {
       out_req->reset();
@@ -206,4 +222,46 @@ CertVerifierRequest* AtomCertVerifier::FindRequest(
   return nullptr;
 }
 
+bool AtomCertVerifier::GetCachedVerificationResult(
+    const RequestParams& params,
+    net::CertVerifyResult* verify_result,
+    int* error) {
+  auto it = verify_cache_.find(params);
+  if (it == verify_cache_.end())
+    return false;
+  if (base::TimeTicks::Now() >= it->second.expiry) {
+    verify_cache_.erase(it);
+    return false;
+  }
+
+  // Complete the request the same way CertVerifierRequest::RunResponse
+  // would have.
+  const CachedResult& cached = it->second;
+  if (cached.custom_response == net::ERR_ABORTED) {
+    *verify_result = cached.result;
+    *error = cached.error;
+  } else {
+    verify_result->Reset();
+    verify_result->verified_cert = params.certificate();
+    ct_delegate_->AddCTExcludedHost(params.hostname());
+    *error = cached.custom_response;
+  }
+  return true;
+}
+
+void AtomCertVerifier::CacheVerificationResult(
+    const RequestParams& params,
+    int error,
+    int custom_response,
+    const net::CertVerifyResult& result) {
+  if (verify_cache_.size() >= kMaxVerifyCacheSize)
+    verify_cache_.clear();
+  CachedResult& cached = verify_cache_[params];
+  cached.error = error;
+  cached.custom_response = custom_response;
+  cached.result = result;
+  cached.expiry = base::TimeTicks::Now() +
+                  base::TimeDelta::FromMinutes(kVerifyCacheTTLMinutes);
+}
+
 }  // namespace atom
@@ -9,7 +9,9 @@
 #include <memory>
 #include <string>
 
+#include "base/time/time.h"
 #include "net/cert/cert_verifier.h"
+#include "net/cert/cert_verify_result.h"
 
 namespace brightray {
 
@@ -61,10 +63,32 @@ class AtomCertVerifier : public net::CertVerifier {
  private:
   friend class CertVerifierRequest;
 
+  // Outcome of a finished verification, kept so a burst of connections to
+  // the same host does not repeat the UI thread round trip to the verify
+  // proc. RequestParams already keys on the certificate chain hash and
+  // hostname.
+  struct CachedResult {
+    int error;
+    int custom_response;
+    net::CertVerifyResult result;
+    base::TimeTicks expiry;
+  };
+
   void RemoveRequest(const RequestParams& params);
   CertVerifierRequest* FindRequest(const RequestParams& params);
 
+  // Returns true and completes |verify_result| and |error| when a still
+  // valid cached verification for |params| exists.
+  bool GetCachedVerificationResult(const RequestParams& params,
+                                   net::CertVerifyResult* verify_result,
+                                   int* error);
+  void CacheVerificationResult(const RequestParams& params,
+                               int error,
+                               int custom_response,
+                               const net::CertVerifyResult& result);
+
   std::map<RequestParams, CertVerifierRequest*> inflight_requests_;
+  std::map<RequestParams, CachedResult> verify_cache_;
   VerifyProc verify_proc_;
   std::unique_ptr<net::CertVerifier> default_cert_verifier_;
   brightray::RequireCTDelegate* ct_delegate_;
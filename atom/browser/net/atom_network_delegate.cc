@@ -12,6 +12,8 @@
 #include "base/strings/string_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
+#include "net/base/load_timing_info.h"
+#include "net/http/http_response_info.h"
 #include "net/url_request/url_request.h"
 #include "services/network/throttling/throttling_network_transaction.h"
 
@@ -20,6 +22,67 @@ using network::ThrottlingNetworkTransaction;
 
 namespace atom {
 
+CompiledURLPatterns::CompiledURLPatterns() = default;
+CompiledURLPatterns::~CompiledURLPatterns() = default;
+CompiledURLPatterns::CompiledURLPatterns(const CompiledURLPatterns& other) =
+    default;
+CompiledURLPatterns& CompiledURLPatterns::operator=(
+    const CompiledURLPatterns& other) = default;
+
+void CompiledURLPatterns::Rebuild(const URLPatterns& patterns) {
+  generic_patterns_.clear();
+  exact_hosts_.clear();
+  subdomain_hosts_.clear();
+  empty_ = patterns.empty();
+
+  for (const auto& pattern : patterns) {
+    if (pattern.match_all_urls() || pattern.host().empty()) {
+      generic_patterns_.push_back(&pattern);
+    } else if (pattern.match_subdomains()) {
+      subdomain_hosts_[pattern.host()].push_back(&pattern);
+    } else {
+      exact_hosts_[pattern.host()].push_back(&pattern);
+    }
+  }
+}
+
+bool CompiledURLPatterns::Matches(const GURL& url) const {
+  for (const auto* pattern : generic_patterns_) {
+    if (pattern->MatchesURL(url))
+      return true;
+  }
+
+  const std::string host = url.host();
+
+  auto it = exact_hosts_.find(host);
+  if (it != exact_hosts_.end()) {
+    for (const auto* pattern : it->second) {
+      if (pattern->MatchesURL(url))
+        return true;
+    }
+  }
+
+  // Walk the host's dot-suffixes, mirroring URLPattern's subdomain
+  // matching but with one map lookup per label instead of one string
+  // comparison per pattern.
+  size_t pos = 0;
+  while (true) {
+    auto sub = subdomain_hosts_.find(pos == 0 ? host : host.substr(pos));
+    if (sub != subdomain_hosts_.end()) {
+      for (const auto* pattern : sub->second) {
+        if (pattern->MatchesURL(url))
+          return true;
+      }
+    }
+    size_t dot = host.find('.', pos);
+    if (dot == std::string::npos)
+      break;
+    pos = dot + 1;
+  }
+
+  return false;
+}
+
 const char* ResourceTypeToString(content::ResourceType type) {
   switch (type) {
     case content::RESOURCE_TYPE_MAIN_FRAME:
@@ -76,17 +139,17 @@ void RunResponseListener(
   return listener.Run(*(details.get()), callback);
 }
 
-// Test whether the URL of |request| matches |patterns|.
+// Response sink for observe-only listeners; whatever they return is
+// discarded since the request has already moved on.
+void IgnoreListenerResponse(const base::DictionaryValue& response) {}
+
+// Test whether the URL of |request| matches |patterns|. Empty patterns mean
+// no filter was installed and every request matches.
 bool MatchesFilterCondition(net::URLRequest* request,
-                            const URLPatterns& patterns) {
+                            const CompiledURLPatterns& patterns) {
   if (patterns.empty())
     return true;
-
-  for (const auto& pattern : patterns) {
-    if (pattern.MatchesURL(request->url()))
-      return true;
-  }
-  return false;
+  return patterns.Matches(request->url());
 }
 
 // Overloaded by multiple types to fill the |details| object.
@@ -151,6 +214,11 @@ void ToDictionary(base::DictionaryValue* details, bool from_cache) {
   details->SetBoolean("fromCache", from_cache);
 }
 
+void ToDictionary(base::DictionaryValue* details,
+                  const net::LoadTimingInfo& timing) {
+  details->SetBoolean("socketReused", timing.socket_reused);
+}
+
 void ToDictionary(base::DictionaryValue* details,
                   const net::URLRequestStatus& status) {
   details->SetString("error", net::ErrorToString(status.error()));
@@ -217,6 +285,13 @@ void ReadFromResponseObject(const base::DictionaryValue& response,
 
 }  // namespace
 
+AtomNetworkDelegate::DeclarativeRule::DeclarativeRule() = default;
+AtomNetworkDelegate::DeclarativeRule::DeclarativeRule(
+    const DeclarativeRule& other) = default;
+AtomNetworkDelegate::DeclarativeRule& AtomNetworkDelegate::DeclarativeRule::
+operator=(const DeclarativeRule& other) = default;
+AtomNetworkDelegate::DeclarativeRule::~DeclarativeRule() = default;
+
 AtomNetworkDelegate::SimpleListenerInfo::SimpleListenerInfo(
     URLPatterns patterns_,
     SimpleListener listener_)
@@ -226,8 +301,11 @@ AtomNetworkDelegate::SimpleListenerInfo::~SimpleListenerInfo() = default;
 
 AtomNetworkDelegate::ResponseListenerInfo::ResponseListenerInfo(
     URLPatterns patterns_,
-    ResponseListener listener_)
-    : url_patterns(patterns_), listener(listener_) {}
+    ResponseListener listener_,
+    bool observe_only_)
+    : url_patterns(patterns_),
+      listener(listener_),
+      observe_only(observe_only_) {}
 AtomNetworkDelegate::ResponseListenerInfo::ResponseListenerInfo() = default;
 AtomNetworkDelegate::ResponseListenerInfo::~ResponseListenerInfo() = default;
 
@@ -238,19 +316,35 @@ AtomNetworkDelegate::~AtomNetworkDelegate() {}
 void AtomNetworkDelegate::SetSimpleListenerInIO(SimpleEvent type,
                                                 URLPatterns patterns,
                                                 SimpleListener callback) {
-  if (callback.is_null())
+  if (callback.is_null()) {
     simple_listeners_.erase(type);
-  else
-    simple_listeners_[type] = {std::move(patterns), std::move(callback)};
+  } else {
+    SimpleListenerInfo& info = simple_listeners_[type];
+    info = {std::move(patterns), std::move(callback)};
+    // Index the patterns now that they reached their final home.
+    info.compiled_patterns.Rebuild(info.url_patterns);
+  }
 }
 
 void AtomNetworkDelegate::SetResponseListenerInIO(ResponseEvent type,
                                                   URLPatterns patterns,
-                                                  ResponseListener callback) {
-  if (callback.is_null())
+                                                  ResponseListener callback,
+                                                  bool observe_only) {
+  if (callback.is_null()) {
     response_listeners_.erase(type);
-  else
-    response_listeners_[type] = {std::move(patterns), std::move(callback)};
+  } else {
+    ResponseListenerInfo& info = response_listeners_[type];
+    info = {std::move(patterns), std::move(callback), observe_only};
+    // Index the patterns now that they reached their final home.
+    info.compiled_patterns.Rebuild(info.url_patterns);
+  }
+}
+
+void AtomNetworkDelegate::SetDeclarativeRulesInIO(DeclarativeRules rules) {
+  declarative_rules_ = std::move(rules);
+  // Index the patterns now that they reached their final home.
+  for (auto& rule : declarative_rules_)
+    rule.compiled_patterns.Rebuild(rule.url_patterns);
 }
 
 void AtomNetworkDelegate::SetDevToolsNetworkEmulationClientId(
@@ -258,10 +352,58 @@ void AtomNetworkDelegate::SetDevToolsNetworkEmulationClientId(
   client_id_ = client_id;
 }
 
+AtomNetworkDelegate::CacheStats AtomNetworkDelegate::GetCacheStatsInIO()
+    const {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  return cache_stats_;
+}
+
+void AtomNetworkDelegate::ResetCacheStatsInIO() {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  cache_stats_ = CacheStats();
+}
+
+void AtomNetworkDelegate::UpdateCacheStats(net::URLRequest* request) {
+  if (!request->url().SchemeIsHTTPOrHTTPS())
+    return;
+
+  const net::HttpResponseInfo& info = request->response_info();
+  if (info.was_cached) {
+    // A cached response that still touched the network was revalidated
+    // with the server before being served from disk.
+    if (info.network_accessed)
+      ++cache_stats_.revalidation_count;
+    else
+      ++cache_stats_.hit_count;
+    cache_stats_.cache_bytes += request->received_response_content_length();
+    cache_stats_.network_bytes += request->GetTotalReceivedBytes();
+  } else {
+    ++cache_stats_.miss_count;
+    cache_stats_.network_bytes += request->GetTotalReceivedBytes();
+  }
+}
+
 int AtomNetworkDelegate::OnBeforeURLRequest(
     net::URLRequest* request,
     const net::CompletionCallback& callback,
     GURL* new_url) {
+  for (const auto& rule : declarative_rules_) {
+    if (!rule.compiled_patterns.Matches(request->url()))
+      continue;
+    switch (rule.action) {
+      case DeclarativeRule::Action::kAllow:
+        // Explicitly allowed; the JS listener is not consulted.
+        return brightray::NetworkDelegate::OnBeforeURLRequest(request,
+                                                              callback,
+                                                              new_url);
+      case DeclarativeRule::Action::kBlock:
+        return net::ERR_BLOCKED_BY_CLIENT;
+      case DeclarativeRule::Action::kRedirect:
+        *new_url = rule.redirect_url;
+        return net::OK;
+    }
+  }
+
   if (!base::ContainsKey(response_listeners_, kOnBeforeRequest))
     return brightray::NetworkDelegate::OnBeforeURLRequest(request, callback,
                                                           new_url);
@@ -346,7 +488,11 @@ void AtomNetworkDelegate::OnCompleted(net::URLRequest* request, bool started) {
     // Error event.
     OnErrorOccurred(request, started);
     return;
-  } else if (request->response_headers() &&
+  }
+
+  UpdateCacheStats(request);
+
+  if (request->response_headers() &&
              net::HttpResponseHeaders::IsRedirectResponseCode(
                  request->response_headers()->response_code())) {
     // Redirect event.
@@ -359,8 +505,13 @@ void AtomNetworkDelegate::OnCompleted(net::URLRequest* request, bool started) {
     return;
   }
 
+  // Report whether the request rode an already-established connection so
+  // preconnect hit rates can be measured from the webRequest events.
+  net::LoadTimingInfo timing;
+  request->GetLoadTimingInfo(&timing);
+
   HandleSimpleEvent(kOnCompleted, request, request->response_headers(),
-                    request->was_cached());
+                    request->was_cached(), timing);
 }
 
 void AtomNetworkDelegate::OnURLRequestDestroyed(net::URLRequest* request) {
@@ -386,7 +537,7 @@ int AtomNetworkDelegate::HandleResponseEvent(
     Out out,
     Args... args) {
   const auto& info = response_listeners_[type];
-  if (!MatchesFilterCondition(request, info.url_patterns))
+  if (!MatchesFilterCondition(request, info.compiled_patterns))
     return net::OK;
 
   auto details = std::make_unique<base::DictionaryValue>();
@@ -396,6 +547,17 @@ int AtomNetworkDelegate::HandleResponseEvent(
   content::ResourceRequestInfo::GetRenderFrameForRequest(
       request, &render_process_id, &render_frame_id);
 
+  if (info.observe_only) {
+    // Fire the event without holding the request; the listener cannot
+    // cancel or modify it and its response is ignored.
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::BindOnce(RunResponseListener, info.listener, std::move(details),
+                       render_process_id, render_frame_id,
+                       base::Bind(&IgnoreListenerResponse)));
+    return net::OK;
+  }
+
   // The |request| could be destroyed before the |callback| is called.
   callbacks_[request->identifier()] = callback;
 
@@ -414,7 +576,7 @@ void AtomNetworkDelegate::HandleSimpleEvent(SimpleEvent type,
                                             net::URLRequest* request,
                                             Args... args) {
   const auto& info = simple_listeners_[type];
-  if (!MatchesFilterCondition(request, info.url_patterns))
+  if (!MatchesFilterCondition(request, info.compiled_patterns))
     return;
 
   auto details = std::make_unique<base::DictionaryValue>();
@@ -8,6 +8,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/synchronization/lock.h"
@@ -18,6 +19,7 @@
 #include "net/base/net_errors.h"
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
+#include "url/gurl.h"
 
 class URLPattern;
 
@@ -25,6 +27,32 @@ namespace atom {
 
 using URLPatterns = std::set<URLPattern>;
 
+// Pre-indexed view over a listener's URLPatterns. Host-anchored patterns are
+// bucketed by host (with a separate bucket walked over the request host's
+// dot-suffixes for match-subdomains patterns), so each request only runs the
+// full URLPattern match against the few candidates sharing its host instead
+// of every registered pattern. Rebuilt only when the listener changes; the
+// indexed pattern set must outlive this object.
+class CompiledURLPatterns {
+ public:
+  CompiledURLPatterns();
+  ~CompiledURLPatterns();
+  CompiledURLPatterns(const CompiledURLPatterns& other);
+  CompiledURLPatterns& operator=(const CompiledURLPatterns& other);
+
+  void Rebuild(const URLPatterns& patterns);
+  bool Matches(const GURL& url) const;
+  bool empty() const { return empty_; }
+
+ private:
+  bool empty_ = true;
+  // Patterns without a concrete host (e.g. <all_urls>, host "*"); always
+  // evaluated.
+  std::vector<const URLPattern*> generic_patterns_;
+  std::map<std::string, std::vector<const URLPattern*>> exact_hosts_;
+  std::map<std::string, std::vector<const URLPattern*>> subdomain_hosts_;
+};
+
 const char* ResourceTypeToString(content::ResourceType type);
 
 class AtomNetworkDelegate : public brightray::NetworkDelegate {
@@ -48,8 +76,29 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
     kOnHeadersReceived,
   };
 
+  // A static allow/block/redirect rule evaluated synchronously on the IO
+  // thread in OnBeforeURLRequest, with no IO->UI->JS round trip. Rules are
+  // checked in registration order and the first match wins; requests that
+  // match no rule fall through to the JS listener.
+  struct DeclarativeRule {
+    enum class Action { kAllow, kBlock, kRedirect };
+
+    DeclarativeRule();
+    DeclarativeRule(const DeclarativeRule& other);
+    DeclarativeRule& operator=(const DeclarativeRule& other);
+    ~DeclarativeRule();
+
+    Action action = Action::kBlock;
+    URLPatterns url_patterns;
+    CompiledURLPatterns compiled_patterns;
+    GURL redirect_url;
+  };
+
+  using DeclarativeRules = std::vector<DeclarativeRule>;
+
   struct SimpleListenerInfo {
     URLPatterns url_patterns;
+    CompiledURLPatterns compiled_patterns;
     SimpleListener listener;
 
     SimpleListenerInfo(URLPatterns, SimpleListener);
@@ -59,13 +108,31 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
 
   struct ResponseListenerInfo {
     URLPatterns url_patterns;
+    CompiledURLPatterns compiled_patterns;
     ResponseListener listener;
+    // When set, the event is dispatched asynchronously and the request
+    // proceeds without waiting for the listener's response. Passive
+    // listeners (metrics, logging) should use this; it removes the
+    // IO->UI->JS->IO round trip from the request's critical path.
+    bool observe_only = false;
 
-    ResponseListenerInfo(URLPatterns, ResponseListener);
+    ResponseListenerInfo(URLPatterns, ResponseListener, bool observe_only);
     ResponseListenerInfo();
     ~ResponseListenerInfo();
   };
 
+  // Cheap HTTP cache effectiveness counters, bumped on the IO thread as
+  // requests complete and read by session.getCacheStats(). |entry_count|
+  // is not tracked here; the caller fills it in from the cache backend.
+  struct CacheStats {
+    uint64_t hit_count = 0;
+    uint64_t miss_count = 0;
+    uint64_t revalidation_count = 0;
+    uint64_t cache_bytes = 0;
+    uint64_t network_bytes = 0;
+    int entry_count = -1;
+  };
+
   AtomNetworkDelegate();
   ~AtomNetworkDelegate() override;
 
@@ -74,10 +141,15 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
                              SimpleListener callback);
   void SetResponseListenerInIO(ResponseEvent type,
                                URLPatterns patterns,
-                               ResponseListener callback);
+                               ResponseListener callback,
+                               bool observe_only);
+  void SetDeclarativeRulesInIO(DeclarativeRules rules);
 
   void SetDevToolsNetworkEmulationClientId(const std::string& client_id);
 
+  CacheStats GetCacheStatsInIO() const;
+  void ResetCacheStatsInIO();
+
  protected:
   // net::NetworkDelegate:
   int OnBeforeURLRequest(net::URLRequest* request,
@@ -102,6 +174,7 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
 
  private:
   void OnErrorOccurred(net::URLRequest* request, bool started);
+  void UpdateCacheStats(net::URLRequest* request);
 
   template <typename... Args>
   void HandleSimpleEvent(SimpleEvent type,
@@ -124,6 +197,7 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
                             T out,
                             const base::DictionaryValue& response);
 
+  DeclarativeRules declarative_rules_;
   std::map<SimpleEvent, SimpleListenerInfo> simple_listeners_;
   std::map<ResponseEvent, ResponseListenerInfo> response_listeners_;
   std::map<uint64_t, net::CompletionCallback> callbacks_;
@@ -131,6 +205,9 @@ class AtomNetworkDelegate : public brightray::NetworkDelegate {
   // Client id for devtools network emulation.
   std::string client_id_;
 
+  // Only touched on the IO thread.
+  CacheStats cache_stats_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomNetworkDelegate);
 };
 
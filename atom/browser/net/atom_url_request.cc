@@ -4,20 +4,44 @@
 // found in the LICENSE file.
 
 #include "atom/browser/net/atom_url_request.h"
+#include <algorithm>
+#include <deque>
 #include <string>
+#include <utility>
 #include "atom/browser/api/atom_api_url_request.h"
 #include "atom/browser/atom_browser_context.h"
 #include "atom/browser/net/atom_url_request_job_factory.h"
 #include "base/callback.h"
+#include "base/time/time.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/elements_upload_data_stream.h"
 #include "net/base/io_buffer.h"
 #include "net/base/load_flags.h"
+#include "net/base/load_timing_info.h"
+#include "net/base/net_errors.h"
 #include "net/base/upload_bytes_element_reader.h"
+#include "net/base/upload_data_stream.h"
+#include "net/http/http_response_info.h"
 #include "net/url_request/redirect_info.h"
 
 namespace {
 const int kBufferSize = 4096;
+
+// Bounds on the upload bytes queued between the JS write() call on the UI
+// thread and their consumption by the network on the IO thread. Once the
+// high water mark is reached Write returns false and the caller is expected
+// to hold off until the 'drain' event; the notification is sent when the
+// backlog falls below the low water mark.
+const int64_t kUploadHighWaterMark = 1024 * 1024;
+const int64_t kUploadLowWaterMark = kUploadHighWaterMark / 2;
+
+// Milliseconds between two load timing ticks, or -1 when the phase did not
+// run for this request, e.g. DNS and connect on a reused socket.
+double TimingDelta(base::TimeTicks start, base::TimeTicks end) {
+  if (start.is_null() || end.is_null())
+    return -1.0;
+  return (end - start).InMillisecondsF();
+}
 }  // namespace
 
 namespace atom {
@@ -44,11 +68,108 @@ class UploadOwnedIOBufferElementReader : public net::UploadBytesElementReader {
   DISALLOW_COPY_AND_ASSIGN(UploadOwnedIOBufferElementReader);
 };
 
+// A pull-based chunked upload stream. Unlike net::ChunkedUploadDataStream,
+// which copies every appended chunk into an internal queue it keeps for the
+// lifetime of the request, this stream queues references to the buffers that
+// already crossed from the UI thread and releases each one as soon as the
+// network has consumed it. Consumption is reported through |on_consumed| so
+// the owner can implement write backpressure; queued upload memory therefore
+// stays bounded no matter how large the body is. The price is that the body
+// cannot be replayed: a restart (e.g. an authentication retry) fails with
+// ERR_UPLOAD_STREAM_REWIND_NOT_SUPPORTED once bytes have been consumed.
+// Only used on the IO thread.
+class StreamingUploadDataStream : public net::UploadDataStream {
+ public:
+  using ConsumedCallback = base::Callback<void(int)>;
+
+  explicit StreamingUploadDataStream(const ConsumedCallback& on_consumed)
+      : net::UploadDataStream(true /* is_chunked */, 0 /* identifier */),
+        on_consumed_(on_consumed) {}
+
+  ~StreamingUploadDataStream() override {}
+
+  void AppendBuffer(scoped_refptr<const net::IOBufferWithSize> buffer,
+                    bool is_last) {
+    DCHECK(!all_data_appended_);
+    all_data_appended_ = is_last;
+    if (buffer)
+      pending_buffers_.push_back(std::move(buffer));
+    if (!read_buffer_)
+      return;
+    // Complete a read that went pending while the queue was empty.
+    int result = ReadChunk(read_buffer_.get(), read_buffer_len_);
+    if (result == net::ERR_IO_PENDING)
+      return;
+    read_buffer_ = nullptr;
+    read_buffer_len_ = 0;
+    OnReadCompleted(result);
+  }
+
+ private:
+  // net::UploadDataStream:
+  int InitInternal(const net::NetLogWithSource& net_log) override {
+    if (bytes_consumed_ > 0) {
+      // Consumed buffers are gone, the body cannot be resent.
+      return net::ERR_UPLOAD_STREAM_REWIND_NOT_SUPPORTED;
+    }
+    return net::OK;
+  }
+
+  int ReadInternal(net::IOBuffer* buf, int buf_len) override {
+    DCHECK(!read_buffer_);
+    int result = ReadChunk(buf, buf_len);
+    if (result == net::ERR_IO_PENDING) {
+      read_buffer_ = buf;
+      read_buffer_len_ = buf_len;
+    }
+    return result;
+  }
+
+  void ResetInternal() override {
+    read_buffer_ = nullptr;
+    read_buffer_len_ = 0;
+  }
+
+  int ReadChunk(net::IOBuffer* buf, int buf_len) {
+    int bytes_read = 0;
+    while (bytes_read < buf_len && !pending_buffers_.empty()) {
+      const auto& front = pending_buffers_.front();
+      int to_copy =
+          std::min(buf_len - bytes_read, front->size() - front_offset_);
+      memcpy(buf->data() + bytes_read, front->data() + front_offset_, to_copy);
+      bytes_read += to_copy;
+      front_offset_ += to_copy;
+      if (front_offset_ == front->size()) {
+        pending_buffers_.pop_front();
+        front_offset_ = 0;
+      }
+    }
+    if (bytes_read == 0 && !all_data_appended_)
+      return net::ERR_IO_PENDING;
+    if (all_data_appended_ && pending_buffers_.empty())
+      SetIsFinalChunk();
+    if (bytes_read > 0) {
+      bytes_consumed_ += bytes_read;
+      on_consumed_.Run(bytes_read);
+    }
+    return bytes_read;
+  }
+
+  ConsumedCallback on_consumed_;
+  std::deque<scoped_refptr<const net::IOBufferWithSize>> pending_buffers_;
+  int front_offset_ = 0;
+  int64_t bytes_consumed_ = 0;
+  bool all_data_appended_ = false;
+  scoped_refptr<net::IOBuffer> read_buffer_;
+  int read_buffer_len_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamingUploadDataStream);
+};
+
 }  // namespace internal
 
 AtomURLRequest::AtomURLRequest(api::URLRequest* delegate)
-    : delegate_(delegate),
-      response_read_buffer_(new net::IOBuffer(kBufferSize)) {}
+    : delegate_(delegate) {}
 
 AtomURLRequest::~AtomURLRequest() {
   DCHECK(!request_context_getter_);
@@ -129,6 +250,7 @@ void AtomURLRequest::DoInitialize(
 
 void AtomURLRequest::DoTerminate() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  streaming_upload_stream_ = nullptr;
   request_.reset();
   if (request_context_getter_) {
     request_context_getter_->RemoveObserver(this);
@@ -139,9 +261,26 @@ void AtomURLRequest::DoTerminate() {
 bool AtomURLRequest::Write(scoped_refptr<const net::IOBufferWithSize> buffer,
                            bool is_last) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-  return content::BrowserThread::PostTask(
-      content::BrowserThread::IO, FROM_HERE,
-      base::BindOnce(&AtomURLRequest::DoWriteBuffer, this, buffer, is_last));
+
+  bool accept_more = true;
+  if (is_chunked_upload_ && buffer) {
+    // Account for the chunk before it crosses to the IO thread so that
+    // backpressure can be reported synchronously to the caller.
+    base::AutoLock auto_lock(upload_lock_);
+    upload_buffered_bytes_ += buffer->size();
+    if (upload_buffered_bytes_ >= kUploadHighWaterMark) {
+      upload_backpressure_ = true;
+      accept_more = false;
+    }
+  }
+
+  if (!content::BrowserThread::PostTask(
+          content::BrowserThread::IO, FROM_HERE,
+          base::BindOnce(&AtomURLRequest::DoWriteBuffer, this, buffer,
+                         is_last))) {
+    return false;
+  }
+  return accept_more;
 }
 
 void AtomURLRequest::SetChunkedUpload(bool is_chunked_upload) {
@@ -216,21 +355,20 @@ void AtomURLRequest::DoWriteBuffer(
     // Chunked encoding case.
 
     bool first_call = false;
-    if (!chunked_stream_writer_) {
-      std::unique_ptr<net::ChunkedUploadDataStream> chunked_stream(
-          new net::ChunkedUploadDataStream(0));
-      chunked_stream_writer_ = chunked_stream->CreateWriter();
-      request_->set_upload(std::move(chunked_stream));
+    if (!streaming_upload_stream_) {
+      // The stream pulls queued chunks as the network consumes them and
+      // reports consumption back so Write() can lift the backpressure.
+      std::unique_ptr<internal::StreamingUploadDataStream> upload_stream(
+          new internal::StreamingUploadDataStream(
+              base::Bind(&AtomURLRequest::OnUploadBufferConsumed, this)));
+      streaming_upload_stream_ = upload_stream.get();
+      request_->set_upload(std::move(upload_stream));
       first_call = true;
     }
 
-    if (buffer)
-      // Non-empty buffer.
-      chunked_stream_writer_->AppendData(buffer->data(), buffer->size(),
-                                         is_last);
-    else if (is_last)
-      // Empty buffer and last chunk, i.e. request.end().
-      chunked_stream_writer_->AppendData(nullptr, 0, true);
+    // A null buffer with is_last set is the empty last chunk, i.e.
+    // request.end().
+    streaming_upload_stream_->AppendBuffer(std::move(buffer), is_last);
 
     if (first_call) {
       request_->Start();
@@ -370,7 +508,7 @@ void AtomURLRequest::OnResponseStarted(net::URLRequest* request,
     content::BrowserThread::PostTask(
         content::BrowserThread::UI, FROM_HERE,
         base::BindOnce(&AtomURLRequest::InformDelegateResponseStarted, this,
-                       response_headers));
+                       response_headers, BuildConnectionInfo()));
     ReadResponse();
   } else if (status.status() == net::URLRequestStatus::Status::FAILED) {
     // Report error on Start.
@@ -379,9 +517,33 @@ void AtomURLRequest::OnResponseStarted(net::URLRequest* request,
   // We don't report an error is the request is canceled.
 }
 
+std::unique_ptr<base::DictionaryValue> AtomURLRequest::BuildConnectionInfo()
+    const {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+
+  const net::HttpResponseInfo& response_info = request_->response_info();
+  net::LoadTimingInfo timing;
+  request_->GetLoadTimingInfo(&timing);
+
+  auto info = std::make_unique<base::DictionaryValue>();
+  info->SetBoolean("reused", timing.socket_reused);
+  info->SetBoolean("fromCache", response_info.was_cached);
+  info->SetString("protocol", net::HttpResponseInfo::ConnectionInfoToString(
+                                  response_info.connection_info));
+  const auto& connect = timing.connect_timing;
+  info->SetDouble("dnsTime", TimingDelta(connect.dns_start, connect.dns_end));
+  info->SetDouble("connectTime",
+                  TimingDelta(connect.connect_start, connect.connect_end));
+  info->SetDouble("sslTime", TimingDelta(connect.ssl_start, connect.ssl_end));
+  info->SetDouble("timeToFirstByte",
+                  TimingDelta(timing.send_start, timing.receive_headers_end));
+  return info;
+}
+
 void AtomURLRequest::ReadResponse() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
 
+  response_read_buffer_ = new net::IOBuffer(kBufferSize);
   int bytes_read = -1;
   if (request_->Read(response_read_buffer_.get(), kBufferSize, &bytes_read)) {
     OnReadCompleted(request_.get(), bytes_read);
@@ -417,7 +579,7 @@ void AtomURLRequest::OnReadCompleted(net::URLRequest* request, int bytes_read) {
       data_ended = true;
       break;
     }
-    if (bytes_read < 0 || !CopyAndPostBuffer(bytes_read)) {
+    if (bytes_read < 0 || !PostReadBuffer(bytes_read)) {
       data_transfer_error = true;
       break;
     }
@@ -441,18 +603,38 @@ void AtomURLRequest::OnContextShuttingDown() {
   DoCancel();
 }
 
-bool AtomURLRequest::CopyAndPostBuffer(int bytes_read) {
+bool AtomURLRequest::PostReadBuffer(int bytes_read) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
 
-  // data is only a wrapper for the asynchronous response_read_buffer_.
-  // Make a deep copy of payload and transfer ownership to the UI thread.
-  auto buffer_copy = WrapRefCounted(new net::IOBufferWithSize(bytes_read));
-  memcpy(buffer_copy->data(), response_read_buffer_->data(), bytes_read);
+  // Hand the filled buffer to the UI thread as-is and start the next read
+  // into a fresh one; the delegate wraps the memory into a JS Buffer
+  // without copying it.
+  scoped_refptr<net::IOBuffer> buffer = std::move(response_read_buffer_);
+  response_read_buffer_ = new net::IOBuffer(kBufferSize);
 
   return content::BrowserThread::PostTask(
       content::BrowserThread::UI, FROM_HERE,
       base::BindOnce(&AtomURLRequest::InformDelegateResponseData, this,
-                     buffer_copy));
+                     std::move(buffer), bytes_read));
+}
+
+void AtomURLRequest::OnUploadBufferConsumed(int bytes) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+
+  bool drained = false;
+  {
+    base::AutoLock auto_lock(upload_lock_);
+    upload_buffered_bytes_ -= bytes;
+    if (upload_backpressure_ && upload_buffered_bytes_ <= kUploadLowWaterMark) {
+      upload_backpressure_ = false;
+      drained = true;
+    }
+  }
+  if (drained) {
+    content::BrowserThread::PostTask(
+        content::BrowserThread::UI, FROM_HERE,
+        base::BindOnce(&AtomURLRequest::InformDelegateUploadDrained, this));
+  }
 }
 
 void AtomURLRequest::InformDelegateReceivedRedirect(
@@ -473,20 +655,22 @@ void AtomURLRequest::InformDelegateAuthenticationRequired(
 }
 
 void AtomURLRequest::InformDelegateResponseStarted(
-    scoped_refptr<net::HttpResponseHeaders> response_headers) const {
+    scoped_refptr<net::HttpResponseHeaders> response_headers,
+    std::unique_ptr<base::DictionaryValue> connection_info) const {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   if (delegate_)
-    delegate_->OnResponseStarted(response_headers);
+    delegate_->OnResponseStarted(response_headers, std::move(connection_info));
 }
 
 void AtomURLRequest::InformDelegateResponseData(
-    scoped_refptr<net::IOBufferWithSize> data) const {
+    scoped_refptr<net::IOBuffer> data,
+    int size) const {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
   // Transfer ownership of the data buffer, data will be released
   // by the delegate's OnResponseData.
   if (delegate_)
-    delegate_->OnResponseData(data);
+    delegate_->OnResponseData(data, size);
 }
 
 void AtomURLRequest::InformDelegateResponseCompleted() const {
@@ -504,4 +688,11 @@ void AtomURLRequest::InformDelegateErrorOccured(const std::string& error,
     delegate_->OnError(error, isRequestError);
 }
 
+void AtomURLRequest::InformDelegateUploadDrained() const {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  if (delegate_)
+    delegate_->OnUploadDrained();
+}
+
 }  // namespace atom
@@ -6,14 +6,16 @@
 #ifndef ATOM_BROWSER_NET_ATOM_URL_REQUEST_H_
 #define ATOM_BROWSER_NET_ATOM_URL_REQUEST_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 #include "atom/browser/api/atom_api_url_request.h"
 #include "atom/browser/atom_browser_context.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
+#include "base/synchronization/lock.h"
+#include "base/values.h"
 #include "net/base/auth.h"
-#include "net/base/chunked_upload_data_stream.h"
 #include "net/base/io_buffer.h"
 #include "net/base/upload_element_reader.h"
 #include "net/http/http_response_headers.h"
@@ -22,6 +24,10 @@
 
 namespace atom {
 
+namespace internal {
+class StreamingUploadDataStream;
+}  // namespace internal
+
 class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
                        public net::URLRequest::Delegate,
                        public net::URLRequestContextGetterObserver {
@@ -82,7 +88,17 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void DoSetLoadFlags(int flags) const;
 
   void ReadResponse();
-  bool CopyAndPostBuffer(int bytes_read);
+  bool PostReadBuffer(int bytes_read);
+
+  // Collects socket reuse, negotiated protocol and handshake timings for
+  // the response that just started. Called on the IO thread.
+  std::unique_ptr<base::DictionaryValue> BuildConnectionInfo() const;
+
+  // Called on the IO thread by the streaming upload stream each time the
+  // network consumes queued upload bytes. Lifts write backpressure and
+  // notifies the delegate once the in-flight window drops below the low
+  // water mark.
+  void OnUploadBufferConsumed(int bytes);
 
   void InformDelegateReceivedRedirect(
       int status_code,
@@ -92,12 +108,14 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
   void InformDelegateAuthenticationRequired(
       scoped_refptr<net::AuthChallengeInfo> auth_info) const;
   void InformDelegateResponseStarted(
-      scoped_refptr<net::HttpResponseHeaders>) const;
-  void InformDelegateResponseData(
-      scoped_refptr<net::IOBufferWithSize> data) const;
+      scoped_refptr<net::HttpResponseHeaders>,
+      std::unique_ptr<base::DictionaryValue> connection_info) const;
+  void InformDelegateResponseData(scoped_refptr<net::IOBuffer> data,
+                                  int size) const;
   void InformDelegateResponseCompleted() const;
   void InformDelegateErrorOccured(const std::string& error,
                                   bool isRequestError) const;
+  void InformDelegateUploadDrained() const;
 
   api::URLRequest* delegate_;
   std::unique_ptr<net::URLRequest> request_;
@@ -105,12 +123,22 @@ class AtomURLRequest : public base::RefCountedThreadSafe<AtomURLRequest>,
 
   bool is_chunked_upload_ = false;
   std::string redirect_policy_;
-  std::unique_ptr<net::ChunkedUploadDataStream> chunked_stream_;
-  std::unique_ptr<net::ChunkedUploadDataStream::Writer> chunked_stream_writer_;
+  // Owned by |request_| once installed via set_upload. Only used on the IO
+  // thread.
+  internal::StreamingUploadDataStream* streaming_upload_stream_ = nullptr;
   std::vector<std::unique_ptr<net::UploadElementReader>>
       upload_element_readers_;
+  // A fresh buffer per read; filled by the network and then handed to the
+  // UI thread as-is, where it backs the JS Buffer without another copy.
   scoped_refptr<net::IOBuffer> response_read_buffer_;
 
+  // Tracks upload bytes handed over on the UI thread but not yet consumed
+  // by the network on the IO thread. Guarded by |upload_lock_| as both
+  // threads update it.
+  base::Lock upload_lock_;
+  int64_t upload_buffered_bytes_ = 0;
+  bool upload_backpressure_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(AtomURLRequest);
 };
 
@@ -6,7 +6,6 @@
 #ifndef ATOM_BROWSER_NET_ATOM_URL_REQUEST_JOB_FACTORY_H_
 #define ATOM_BROWSER_NET_ATOM_URL_REQUEST_JOB_FACTORY_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -59,7 +58,9 @@ class AtomURLRequestJobFactory : public net::URLRequestJobFactory {
   bool IsSafeRedirectTarget(const GURL& location) const override;
 
  private:
-  using ProtocolHandlerMap = std::map<std::string, ProtocolHandler*>;
+  // Dispatch runs on the IO thread for every request created, so the
+  // handler is found with a hash probe instead of a tree walk.
+  using ProtocolHandlerMap = std::unordered_map<std::string, ProtocolHandler*>;
 
   ProtocolHandlerMap protocol_handler_map_;
 
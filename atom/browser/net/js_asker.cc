@@ -4,10 +4,15 @@
 
 #include "atom/browser/net/js_asker.h"
 
+#include <map>
+#include <utility>
 #include <vector>
 
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/v8_value_converter.h"
+#include "base/lazy_instance.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
 
 namespace atom {
 
@@ -19,6 +24,7 @@ namespace {
 void HandlerCallback(const BeforeStartCallback& before_start,
                      const ResponseCallback& callback,
                      mate::Arguments* args) {
+  TRACE_EVENT0("electron.net", "js_asker::HandlerCallback");
   // If there is no argument passed then we failed.
   v8::Local<v8::Value> value;
   if (!args->GetNext(&value)) {
@@ -46,6 +52,7 @@ void AskForOptions(v8::Isolate* isolate,
                    std::unique_ptr<base::DictionaryValue> request_details,
                    const BeforeStartCallback& before_start,
                    const ResponseCallback& callback) {
+  TRACE_EVENT0("electron.net", "js_asker::AskForOptions");
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   v8::Locker locker(isolate);
   v8::HandleScope handle_scope(isolate);
@@ -56,6 +63,66 @@ void AskForOptions(v8::Isolate* isolate,
                                                     before_start, callback)));
 }
 
+namespace {
+
+struct CachedResponse {
+  std::unique_ptr<base::Value> options;
+  base::TimeTicks expiry;
+};
+
+// Capped so a handler tagging many URLs cannot grow the browser process
+// without bound; expired entries are pruned before refusing new ones.
+const size_t kMaxResponseCacheEntries = 256;
+
+base::LazyInstance<std::map<std::string, CachedResponse>>::Leaky
+    g_response_cache = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+std::unique_ptr<base::Value> LookupResponseCache(const std::string& url_spec) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  auto& cache = g_response_cache.Get();
+  auto it = cache.find(url_spec);
+  if (it == cache.end())
+    return nullptr;
+  if (it->second.expiry <= base::TimeTicks::Now()) {
+    cache.erase(it);
+    return nullptr;
+  }
+  return it->second.options->CreateDeepCopy();
+}
+
+void MaybeCacheResponse(const std::string& url_spec,
+                        const base::Value* options) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  if (!options->is_dict())
+    return;
+  const base::DictionaryValue* dict =
+      static_cast<const base::DictionaryValue*>(options);
+  double ttl_ms = 0;
+  if (!dict->GetDouble("ttl", &ttl_ms) || ttl_ms <= 0)
+    return;
+
+  auto& cache = g_response_cache.Get();
+  if (cache.size() >= kMaxResponseCacheEntries &&
+      cache.find(url_spec) == cache.end()) {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    for (auto it = cache.begin(); it != cache.end();) {
+      if (it->second.expiry <= now)
+        it = cache.erase(it);
+      else
+        ++it;
+    }
+    if (cache.size() >= kMaxResponseCacheEntries)
+      return;
+  }
+
+  CachedResponse& entry = cache[url_spec];
+  entry.options = options->CreateDeepCopy();
+  entry.expiry =
+      base::TimeTicks::Now() + base::TimeDelta::FromMillisecondsD(ttl_ms);
+}
+
 bool IsErrorOptions(base::Value* value, int* error) {
   if (value->is_dict()) {
     base::DictionaryValue* dict = static_cast<base::DictionaryValue*>(value);
@@ -70,4 +137,13 @@ bool IsErrorOptions(base::Value* value, int* error) {
 
 }  // namespace internal
 
+void ClearJsAskerResponseCache(const std::string& url_spec) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+  auto& cache = internal::g_response_cache.Get();
+  if (url_spec.empty())
+    cache.clear();
+  else
+    cache.erase(url_spec);
+}
+
 }  // namespace atom
@@ -5,6 +5,9 @@
 #ifndef ATOM_BROWSER_NET_JS_ASKER_H_
 #define ATOM_BROWSER_NET_JS_ASKER_H_
 
+#include <memory>
+#include <string>
+
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "base/callback.h"
 #include "base/memory/ref_counted.h"
@@ -40,8 +43,19 @@ void AskForOptions(v8::Isolate* isolate,
 // Test whether the |options| means an error.
 bool IsErrorOptions(base::Value* value, int* error);
 
+// IO-thread cache of handler response descriptors, opted in per response
+// through a positive |ttl| option (milliseconds). A cached descriptor is
+// replayed on the IO thread without the UI/JS round trip.
+std::unique_ptr<base::Value> LookupResponseCache(const std::string& url_spec);
+void MaybeCacheResponse(const std::string& url_spec,
+                        const base::Value* options);
+
 }  // namespace internal
 
+// Drops cached handler response descriptors, either for a single URL or for
+// all of them when |url_spec| is empty. Must be called on the IO thread.
+void ClearJsAskerResponseCache(const std::string& url_spec);
+
 template <typename RequestJob>
 class JsAsker : public RequestJob {
  public:
@@ -65,11 +79,22 @@ class JsAsker : public RequestJob {
     return request_context_getter_;
   }
 
- private:
-  // RequestJob:
+ protected:
+  // RequestJob. Protected so that subclasses able to satisfy a request on
+  // their own (e.g. from a cache) can fall back to asking the JS handler
+  // explicitly.
   void Start() override {
-    auto request_details = std::make_unique<base::DictionaryValue>();
     request_start_time_ = base::TimeTicks::Now();
+    std::unique_ptr<base::Value> cached_options =
+        internal::LookupResponseCache(RequestJob::request()->url().spec());
+    if (cached_options) {
+      // Replay the cached descriptor without leaving the IO thread.
+      response_start_time_ = base::TimeTicks::Now();
+      StartAsync(std::move(cached_options));
+      return;
+    }
+
+    auto request_details = std::make_unique<base::DictionaryValue>();
     FillRequestDetails(request_details.get(), RequestJob::request());
     content::BrowserThread::PostTask(
         content::BrowserThread::UI, FROM_HERE,
@@ -80,6 +105,7 @@ class JsAsker : public RequestJob {
             base::Bind(&JsAsker::OnResponse, weak_factory_.GetWeakPtr())));
   }
 
+ private:
   int GetResponseCode() const override { return net::HTTP_OK; }
 
   // NOTE: We have to implement this method or risk a crash in blink for
@@ -101,6 +127,8 @@ class JsAsker : public RequestJob {
     response_start_time_ = base::TimeTicks::Now();
     int error = net::ERR_NOT_IMPLEMENTED;
     if (success && value && !internal::IsErrorOptions(value.get(), &error)) {
+      internal::MaybeCacheResponse(RequestJob::request()->url().spec(),
+                                   value.get());
       StartAsync(std::move(value));
     } else {
       RequestJob::NotifyStartError(
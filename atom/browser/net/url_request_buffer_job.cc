@@ -4,18 +4,32 @@
 
 #include "atom/browser/net/url_request_buffer_job.h"
 
+#include <map>
+#include <memory>
 #include <string>
+#include <utility>
 
 #include "atom/common/atom_constants.h"
+#include "base/lazy_instance.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "net/base/mime_util.h"
 #include "net/base/net_errors.h"
+#include "net/filter/brotli_source_stream.h"
+#include "net/filter/gzip_source_stream.h"
 
 namespace atom {
 
 namespace {
 
+bool IsSupportedContentEncoding(const std::string& encoding) {
+  return base::LowerCaseEqualsASCII(encoding, "gzip") ||
+         base::LowerCaseEqualsASCII(encoding, "x-gzip") ||
+         base::LowerCaseEqualsASCII(encoding, "deflate") ||
+         base::LowerCaseEqualsASCII(encoding, "br");
+}
+
 std::string GetExtFromURL(const GURL& url) {
   std::string spec = url.spec();
   size_t index = spec.find_last_of('.');
@@ -24,6 +38,45 @@ std::string GetExtFromURL(const GURL& url) {
   return spec.substr(index + 1, spec.size() - index - 1);
 }
 
+// Process-wide cache of responses from handlers that opted in with
+// |cache: true|. Entries are keyed by URL and versioned by the ETag the
+// handler provided; cached requests are served from the shared refcounted
+// buffer without consulting the JS handler again. Lookup and insertion both
+// happen on the IO thread.
+struct CachedBufferResponse {
+  std::string mime_type;
+  std::string charset;
+  std::string etag;
+  std::string content_encoding;
+  scoped_refptr<base::RefCountedBytes> data;
+  base::TimeTicks last_used;
+};
+
+using BufferResponseCache = std::map<std::string, CachedBufferResponse>;
+
+base::LazyInstance<BufferResponseCache>::Leaky g_buffer_response_cache =
+    LAZY_INSTANCE_INITIALIZER;
+size_t g_buffer_response_cache_bytes = 0;
+
+// Bound on the bytes kept alive by the cache. A handler serving a few
+// hundred static assets never reaches it; beyond it the least recently
+// used entries are evicted instead of growing without limit.
+const size_t kMaxBufferResponseCacheBytes = 64 * 1024 * 1024;
+
+void EvictBufferResponseCache(size_t incoming_bytes) {
+  BufferResponseCache& cache = g_buffer_response_cache.Get();
+  while (!cache.empty() && g_buffer_response_cache_bytes + incoming_bytes >
+                               kMaxBufferResponseCacheBytes) {
+    auto oldest = cache.begin();
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+      if (it->second.last_used < oldest->second.last_used)
+        oldest = it;
+    }
+    g_buffer_response_cache_bytes -= oldest->second.data->size();
+    cache.erase(oldest);
+  }
+}
+
 }  // namespace
 
 URLRequestBufferJob::URLRequestBufferJob(net::URLRequest* request,
@@ -33,13 +86,35 @@ URLRequestBufferJob::URLRequestBufferJob(net::URLRequest* request,
 
 URLRequestBufferJob::~URLRequestBufferJob() = default;
 
+void URLRequestBufferJob::Start() {
+  BufferResponseCache& cache = g_buffer_response_cache.Get();
+  auto it = cache.find(request()->url().spec());
+  if (it != cache.end()) {
+    // Serve the shared immutable buffer without invoking the JS handler.
+    it->second.last_used = base::TimeTicks::Now();
+    mime_type_ = it->second.mime_type;
+    charset_ = it->second.charset;
+    etag_ = it->second.etag;
+    content_encoding_ = it->second.content_encoding;
+    data_ = it->second.data;
+    status_code_ = net::HTTP_OK;
+    net::URLRequestSimpleJob::Start();
+    return;
+  }
+  JsAsker<net::URLRequestSimpleJob>::Start();
+}
+
 void URLRequestBufferJob::StartAsync(std::unique_ptr<base::Value> options) {
   const base::Value* binary = nullptr;
+  bool cacheable = false;
   if (options->is_dict()) {
     base::DictionaryValue* dict =
         static_cast<base::DictionaryValue*>(options.get());
     dict->GetString("mimeType", &mime_type_);
     dict->GetString("charset", &charset_);
+    dict->GetBoolean("cache", &cacheable);
+    dict->GetString("eTag", &etag_);
+    dict->GetString("contentEncoding", &content_encoding_);
     dict->GetBinary("data", &binary);
   } else if (options->is_blob()) {
     binary = options.get();
@@ -60,9 +135,42 @@ void URLRequestBufferJob::StartAsync(std::unique_ptr<base::Value> options) {
     return;
   }
 
+  if (!content_encoding_.empty() &&
+      !IsSupportedContentEncoding(content_encoding_)) {
+    NotifyStartError(net::URLRequestStatus(net::URLRequestStatus::FAILED,
+                                           net::ERR_INVALID_RESPONSE));
+    return;
+  }
+
   data_ = new base::RefCountedBytes(
       reinterpret_cast<const unsigned char*>(binary->GetBlob().data()),
       binary->GetBlob().size());
+
+  if (cacheable && data_->size() <= kMaxBufferResponseCacheBytes) {
+    BufferResponseCache& cache = g_buffer_response_cache.Get();
+    const std::string key = request()->url().spec();
+    auto it = cache.find(key);
+    if (it != cache.end() && !etag_.empty() && it->second.etag == etag_) {
+      // Same asset version; keep sharing the allocation already cached.
+      it->second.last_used = base::TimeTicks::Now();
+      data_ = it->second.data;
+    } else {
+      if (it != cache.end()) {
+        g_buffer_response_cache_bytes -= it->second.data->size();
+        cache.erase(it);
+      }
+      EvictBufferResponseCache(data_->size());
+      CachedBufferResponse& entry = cache[key];
+      entry.mime_type = mime_type_;
+      entry.charset = charset_;
+      entry.etag = etag_;
+      entry.content_encoding = content_encoding_;
+      entry.data = data_;
+      entry.last_used = base::TimeTicks::Now();
+      g_buffer_response_cache_bytes += data_->size();
+    }
+  }
+
   status_code_ = net::HTTP_OK;
   net::URLRequestSimpleJob::Start();
 }
@@ -84,9 +192,41 @@ void URLRequestBufferJob::GetResponseInfo(net::HttpResponseInfo* info) {
     headers->AddHeader(content_type_header);
   }
 
+  if (!etag_.empty()) {
+    std::string etag_header("ETag: ");
+    etag_header.append(etag_);
+    headers->AddHeader(etag_header);
+  }
+
+  if (!content_encoding_.empty()) {
+    std::string encoding_header("Content-Encoding: ");
+    encoding_header.append(content_encoding_);
+    headers->AddHeader(encoding_header);
+  }
+
   info->headers = headers;
 }
 
+std::unique_ptr<net::SourceStream> URLRequestBufferJob::SetUpSourceStream() {
+  // Decode handler-supplied pre-compressed bodies here, the same way
+  // URLRequestStreamJob does: nothing downstream of a custom job
+  // decompresses, so the job itself is the decode point. The in-memory
+  // response cache above still holds the compressed bytes.
+  std::unique_ptr<net::SourceStream> source =
+      net::URLRequestSimpleJob::SetUpSourceStream();
+  if (base::LowerCaseEqualsASCII(content_encoding_, "gzip") ||
+      base::LowerCaseEqualsASCII(content_encoding_, "x-gzip")) {
+    return net::GzipSourceStream::Create(std::move(source),
+                                         net::SourceStream::TYPE_GZIP);
+  } else if (base::LowerCaseEqualsASCII(content_encoding_, "deflate")) {
+    return net::GzipSourceStream::Create(std::move(source),
+                                         net::SourceStream::TYPE_DEFLATE);
+  } else if (base::LowerCaseEqualsASCII(content_encoding_, "br")) {
+    return net::CreateBrotliSourceStream(std::move(source));
+  }
+  return source;
+}
+
 int URLRequestBufferJob::GetRefCountedData(
     std::string* mime_type,
     std::string* charset,
@@ -5,6 +5,7 @@
 #ifndef ATOM_BROWSER_NET_URL_REQUEST_BUFFER_JOB_H_
 #define ATOM_BROWSER_NET_URL_REQUEST_BUFFER_JOB_H_
 
+#include <memory>
 #include <string>
 
 #include "atom/browser/net/js_asker.h"
@@ -23,7 +24,11 @@ class URLRequestBufferJob : public JsAsker<net::URLRequestSimpleJob> {
   void StartAsync(std::unique_ptr<base::Value> options) override;
 
   // URLRequestJob:
+  // Serves memoized handler responses directly when the URL is cached,
+  // otherwise falls through to asking the JS handler.
+  void Start() override;
   void GetResponseInfo(net::HttpResponseInfo* info) override;
+  std::unique_ptr<net::SourceStream> SetUpSourceStream() override;
 
   // URLRequestSimpleJob:
   int GetRefCountedData(std::string* mime_type,
@@ -34,6 +39,10 @@ class URLRequestBufferJob : public JsAsker<net::URLRequestSimpleJob> {
  private:
   std::string mime_type_;
   std::string charset_;
+  std::string etag_;
+  // Encoding of |data_| as declared by the handler ("gzip", "deflate" or
+  // "br"); empty when the body is served as-is.
+  std::string content_encoding_;
   scoped_refptr<base::RefCountedBytes> data_;
   net::HttpStatusCode status_code_;
 
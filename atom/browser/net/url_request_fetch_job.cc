@@ -182,18 +182,27 @@ int URLRequestFetchJob::DataAvailable(net::IOBuffer* buffer,
   // for IO completion, we have to save the parameters until the request is
   // ready to read data.
   if (!pending_buffer_.get()) {
-    write_buffer_ = buffer;
-    write_num_bytes_ = num_bytes;
+    write_buffer_ = new net::DrainableIOBuffer(buffer, num_bytes);
     write_callback_ = callback;
     return net::ERR_IO_PENDING;
   }
 
-  // Write data to the pending buffer and clear them after the writing.
+  // Copy as much as the waiting read can take straight into its buffer.
   int bytes_read = BufferCopy(buffer, num_bytes, pending_buffer_.get(),
                               pending_buffer_size_);
   ClearPendingBuffer();
   ReadRawDataComplete(bytes_read);
-  return bytes_read;
+
+  if (bytes_read == num_bytes)
+    return num_bytes;
+
+  // The chunk did not fit in one read. Keep the remainder and acknowledge
+  // the write once downstream reads have drained it, instead of bouncing a
+  // partial write count back through the URLFetcher write loop.
+  write_buffer_ = new net::DrainableIOBuffer(buffer, num_bytes);
+  write_buffer_->DidConsume(bytes_read);
+  write_callback_ = callback;
+  return net::ERR_IO_PENDING;
 }
 
 void URLRequestFetchJob::Kill() {
@@ -215,12 +224,17 @@ int URLRequestFetchJob::ReadRawData(net::IOBuffer* dest, int dest_size) {
     return net::ERR_IO_PENDING;
   }
 
-  // Read from the write buffer and clear them after reading.
-  int bytes_read =
-      BufferCopy(write_buffer_.get(), write_num_bytes_, dest, dest_size);
-  net::CompletionCallback write_callback = write_callback_;
-  ClearWriteBuffer();
-  write_callback.Run(bytes_read);
+  // Drain the upstream chunk in place. The write is acknowledged with the
+  // full chunk size once the last byte has been handed downstream.
+  int bytes_read = BufferCopy(write_buffer_.get(),
+                              write_buffer_->BytesRemaining(), dest, dest_size);
+  write_buffer_->DidConsume(bytes_read);
+  if (write_buffer_->BytesRemaining() == 0) {
+    int num_bytes = write_buffer_->size();
+    net::CompletionCallback write_callback = write_callback_;
+    ClearWriteBuffer();
+    write_callback.Run(num_bytes);
+  }
   return bytes_read;
 }
 
@@ -279,7 +293,6 @@ void URLRequestFetchJob::ClearPendingBuffer() {
 
 void URLRequestFetchJob::ClearWriteBuffer() {
   write_buffer_ = nullptr;
-  write_num_bytes_ = 0;
   write_callback_.Reset();
 }
 
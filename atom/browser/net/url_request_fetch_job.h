@@ -9,6 +9,7 @@
 
 #include "atom/browser/net/js_asker.h"
 #include "brightray/browser/url_request_context_getter.h"
+#include "net/base/io_buffer.h"
 #include "content/browser/streams/stream.h"
 #include "content/browser/streams/stream_read_observer.h"
 #include "net/url_request/url_fetcher_delegate.h"
@@ -59,9 +60,11 @@ class URLRequestFetchJob : public JsAsker<net::URLRequestJob>,
   scoped_refptr<net::IOBuffer> pending_buffer_;
   int pending_buffer_size_ = 0;
 
-  // Saved arguments passed to DataAvailable.
-  scoped_refptr<net::IOBuffer> write_buffer_;
-  int write_num_bytes_ = 0;
+  // The upstream chunk passed to DataAvailable, drained in place by one or
+  // more ReadRawData calls. The write callback is run only once the whole
+  // chunk has been handed downstream, so partial reads do not bounce back
+  // through the URLFetcher write loop.
+  scoped_refptr<net::DrainableIOBuffer> write_buffer_;
   net::CompletionCallback write_callback_;
 
   DISALLOW_COPY_AND_ASSIGN(URLRequestFetchJob);
@@ -11,19 +11,42 @@
 #include "atom/common/atom_constants.h"
 #include "atom/common/native_mate_converters/net_converter.h"
 #include "atom/common/node_includes.h"
+#include "base/files/file.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/task_scheduler/post_task.h"
 #include "base/time/time.h"
+#include "net/base/file_stream.h"
+#include "net/filter/brotli_source_stream.h"
 #include "net/filter/gzip_source_stream.h"
 
 namespace atom {
 
+namespace {
+
+// Capacity of the ring buffer between the JS stream and ReadRawData. The
+// stream is paused when the buffered bytes reach the high water mark and
+// resumed once reads drain them below the low water mark, so memory use
+// stays constant under any producer/consumer speed mismatch.
+const size_t kStreamRingBufferCapacity = 256 * 1024;
+const size_t kStreamHighWaterMark = kStreamRingBufferCapacity * 3 / 4;
+const size_t kStreamLowWaterMark = kStreamRingBufferCapacity / 4;
+
+}  // namespace
+
 URLRequestStreamJob::URLRequestStreamJob(net::URLRequest* request,
                                          net::NetworkDelegate* network_delegate)
     : JsAsker<net::URLRequestJob>(request, network_delegate),
       weak_factory_(this) {}
 
-URLRequestStreamJob::~URLRequestStreamJob() = default;
+URLRequestStreamJob::~URLRequestStreamJob() {
+  if (stream_) {
+    // The job dies on the IO thread but the handle must be released where
+    // JS runs.
+    content::BrowserThread::DeleteSoon(content::BrowserThread::UI, FROM_HERE,
+                                       stream_.release());
+  }
+}
 
 void URLRequestStreamJob::BeforeStartInUI(v8::Isolate* isolate,
                                           v8::Local<v8::Value> value) {
@@ -53,6 +76,13 @@ void URLRequestStreamJob::BeforeStartInUI(v8::Isolate* isolate,
                                                        response_headers_.get());
   }
 
+  // File-backed response: the handler supplied a path (plus an optional
+  // byte range) instead of a stream, so there is nothing to subscribe to on
+  // the JS side; StartAsync picks the path up from the converted options.
+  std::string file_path;
+  if (opts.Get("path", &file_path))
+    return;
+
   if (!opts.Get("data", &value)) {
     // Assume the opts is already a stream
     value = opts.GetHandle();
@@ -77,25 +107,100 @@ void URLRequestStreamJob::BeforeStartInUI(v8::Isolate* isolate,
   subscriber_->On("data", &URLRequestStreamJob::OnData);
   subscriber_->On("end", &URLRequestStreamJob::OnEnd);
   subscriber_->On("error", &URLRequestStreamJob::OnError);
+
+  isolate_ = isolate;
+  stream_.reset(new v8::Global<v8::Object>(isolate, data.GetHandle()));
 }
 
 void URLRequestStreamJob::StartAsync(std::unique_ptr<base::Value> options) {
+  base::FilePath::StringType file_path;
+  if (options->is_dict()) {
+    auto* dict = static_cast<base::DictionaryValue*>(options.get());
+    dict->GetString("path", &file_path);
+    if (!file_path.empty()) {
+      double offset = 0;
+      double length = -1;
+      dict->GetDouble("offset", &offset);
+      dict->GetDouble("length", &length);
+      file_backed_ = true;
+      file_path_ = base::FilePath(file_path);
+      file_offset_ = static_cast<int64_t>(offset);
+      file_remaining_ = length < 0 ? -1 : static_cast<int64_t>(length);
+      file_stream_.reset(
+          new net::FileStream(base::CreateSequencedTaskRunnerWithTraits(
+              {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+               base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})));
+      int flags = base::File::FLAG_OPEN | base::File::FLAG_READ |
+                  base::File::FLAG_ASYNC;
+      int rv = file_stream_->Open(file_path_, flags,
+                                  base::Bind(&URLRequestStreamJob::DidOpenFile,
+                                             weak_factory_.GetWeakPtr()));
+      if (rv != net::ERR_IO_PENDING)
+        DidOpenFile(rv);
+      return;
+    }
+  }
+  NotifyHeadersComplete();
+}
+
+void URLRequestStreamJob::DidOpenFile(int result) {
+  if (result != net::OK) {
+    NotifyStartError(
+        net::URLRequestStatus(net::URLRequestStatus::FAILED, result));
+    return;
+  }
+
+  if (file_offset_ != 0) {
+    int rv = file_stream_->Seek(file_offset_,
+                                base::Bind(&URLRequestStreamJob::DidSeekFile,
+                                           weak_factory_.GetWeakPtr()));
+    if (rv != net::ERR_IO_PENDING) {
+      // file_stream_->Seek() failed, so pass an intentionally erroneous
+      // value into DidSeekFile().
+      DidSeekFile(-1);
+    }
+  } else {
+    DidSeekFile(file_offset_);
+  }
+}
+
+void URLRequestStreamJob::DidSeekFile(int64_t result) {
+  if (result != file_offset_) {
+    NotifyStartError(net::URLRequestStatus(
+        net::URLRequestStatus::FAILED, net::ERR_REQUEST_RANGE_NOT_SATISFIABLE));
+    return;
+  }
+  if (file_remaining_ >= 0)
+    set_expected_content_size(file_remaining_);
   NotifyHeadersComplete();
 }
 
+void URLRequestStreamJob::DidReadFile(scoped_refptr<net::IOBuffer> buf,
+                                      int result) {
+  if (result >= 0 && file_remaining_ >= 0) {
+    file_remaining_ -= result;
+    DCHECK_GE(file_remaining_, 0);
+  }
+
+  buf = nullptr;
+
+  ReadRawDataComplete(result);
+}
+
 void URLRequestStreamJob::OnData(mate::Arguments* args) {
   v8::Local<v8::Value> node_data;
   args->GetNext(&node_data);
   if (node_data->IsUint8Array()) {
-    const char* data = node::Buffer::Data(node_data);
-    size_t data_size = node::Buffer::Length(node_data);
-    std::copy(data, data + data_size, std::back_inserter(buffer_));
+    WriteRing(node::Buffer::Data(node_data), node::Buffer::Length(node_data));
   } else {
     NOTREACHED();
   }
   if (pending_io_buf_) {
     CopyMoreData(pending_io_buf_, pending_io_buf_size_);
   }
+  if (!stream_paused_ && ring_bytes_ >= kStreamHighWaterMark) {
+    PauseStream();
+  }
 }
 
 void URLRequestStreamJob::OnEnd(mate::Arguments* args) {
@@ -113,6 +218,26 @@ void URLRequestStreamJob::OnError(mate::Arguments* args) {
 }
 
 int URLRequestStreamJob::ReadRawData(net::IOBuffer* dest, int dest_size) {
+  if (file_backed_) {
+    // The body comes straight from the file; no UI thread hop is needed.
+    if (file_remaining_ >= 0 && file_remaining_ < dest_size)
+      dest_size = static_cast<int>(file_remaining_);
+
+    if (!dest_size)
+      return 0;
+
+    int rv = file_stream_->Read(dest, dest_size,
+                                base::Bind(&URLRequestStreamJob::DidReadFile,
+                                           weak_factory_.GetWeakPtr(),
+                                           WrapRefCounted(dest)));
+    if (rv >= 0 && file_remaining_ >= 0) {
+      file_remaining_ -= rv;
+      DCHECK_GE(file_remaining_, 0);
+    }
+
+    return rv;
+  }
+
   content::BrowserThread::PostTask(
       content::BrowserThread::UI, FROM_HERE,
       base::BindOnce(&URLRequestStreamJob::CopyMoreData,
@@ -123,7 +248,9 @@ int URLRequestStreamJob::ReadRawData(net::IOBuffer* dest, int dest_size) {
 
 void URLRequestStreamJob::DoneReading() {
   subscriber_.reset();
-  buffer_.clear();
+  ring_buffer_.clear();
+  ring_start_ = 0;
+  ring_bytes_ = 0;
   ended_ = true;
 }
 
@@ -147,11 +274,9 @@ void URLRequestStreamJob::CopyMoreData(scoped_refptr<net::IOBuffer> io_buf,
   pending_io_buf_size_ = 0;
 
   int read_count = 0;
-  if (buffer_.size()) {
-    size_t count = std::min((size_t)io_buf_size, buffer_.size());
-    std::copy(buffer_.begin(), buffer_.begin() + count, io_buf->data());
-    buffer_.erase(buffer_.begin(), buffer_.begin() + count);
-    read_count = count;
+  if (ring_bytes_ > 0) {
+    read_count = static_cast<int>(
+        ReadRing(io_buf->data(), static_cast<size_t>(io_buf_size)));
   } else if (!ended_ && !errored_) {
     // No data available yet, save references to the IOBuffer, which will be
     // passed back to this function when OnData/OnEnd/OnError are called
@@ -159,6 +284,11 @@ void URLRequestStreamJob::CopyMoreData(scoped_refptr<net::IOBuffer> io_buf,
     pending_io_buf_size_ = io_buf_size;
   }
 
+  if (stream_paused_ && !ended_ && !errored_ &&
+      ring_bytes_ <= kStreamLowWaterMark) {
+    ResumeStream();
+  }
+
   if (!pending_io_buf_) {
     // Only call CopyMoreDataDone if we have read something.
     int status = (errored_ && !read_count) ? net::ERR_FAILED : read_count;
@@ -169,6 +299,72 @@ void URLRequestStreamJob::CopyMoreData(scoped_refptr<net::IOBuffer> io_buf,
   }
 }
 
+void URLRequestStreamJob::WriteRing(const char* data, size_t size) {
+  if (ring_buffer_.empty()) {
+    ring_buffer_.resize(kStreamRingBufferCapacity);
+  }
+  if (ring_bytes_ + size > ring_buffer_.size()) {
+    // A single chunk exceeded the remaining capacity; linearize into a
+    // larger buffer. Pause/resume keeps this to pathological chunk sizes.
+    std::vector<char> grown(
+        std::max(ring_buffer_.size() * 2, ring_bytes_ + size));
+    size_t preserved = ring_bytes_;
+    ReadRing(grown.data(), preserved);
+    ring_buffer_.swap(grown);
+    ring_start_ = 0;
+    ring_bytes_ = preserved;
+  }
+
+  size_t end = (ring_start_ + ring_bytes_) % ring_buffer_.size();
+  size_t chunk = std::min(size, ring_buffer_.size() - end);
+  memcpy(&ring_buffer_[end], data, chunk);
+  if (chunk < size) {
+    memcpy(&ring_buffer_[0], data + chunk, size - chunk);
+  }
+  ring_bytes_ += size;
+}
+
+size_t URLRequestStreamJob::ReadRing(char* dest, size_t size) {
+  size_t count = std::min(size, ring_bytes_);
+  if (count == 0) {
+    return 0;
+  }
+  size_t chunk = std::min(count, ring_buffer_.size() - ring_start_);
+  memcpy(dest, &ring_buffer_[ring_start_], chunk);
+  if (chunk < count) {
+    memcpy(dest + chunk, &ring_buffer_[0], count - chunk);
+  }
+  ring_start_ = (ring_start_ + count) % ring_buffer_.size();
+  ring_bytes_ -= count;
+  return count;
+}
+
+void URLRequestStreamJob::PauseStream() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!stream_ || stream_->IsEmpty()) {
+    return;
+  }
+  stream_paused_ = true;
+  v8::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  mate::internal::CallMethodWithArgs(
+      isolate_, v8::Local<v8::Object>::New(isolate_, *stream_), "pause", 0,
+      nullptr);
+}
+
+void URLRequestStreamJob::ResumeStream() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!stream_ || stream_->IsEmpty()) {
+    return;
+  }
+  stream_paused_ = false;
+  v8::Locker locker(isolate_);
+  v8::HandleScope handle_scope(isolate_);
+  mate::internal::CallMethodWithArgs(
+      isolate_, v8::Local<v8::Object>::New(isolate_, *stream_), "resume", 0,
+      nullptr);
+}
+
 std::unique_ptr<net::SourceStream> URLRequestStreamJob::SetUpSourceStream() {
   std::unique_ptr<net::SourceStream> source =
       net::URLRequestJob::SetUpSourceStream();
@@ -182,6 +378,8 @@ std::unique_ptr<net::SourceStream> URLRequestStreamJob::SetUpSourceStream() {
     } else if (base::LowerCaseEqualsASCII(type, "deflate")) {
       return net::GzipSourceStream::Create(std::move(source),
                                            net::SourceStream::TYPE_DEFLATE);
+    } else if (base::LowerCaseEqualsASCII(type, "br")) {
+      return net::CreateBrotliSourceStream(std::move(source));
     }
   }
   return source;
@@ -5,11 +5,13 @@
 #ifndef ATOM_BROWSER_NET_URL_REQUEST_STREAM_JOB_H_
 #define ATOM_BROWSER_NET_URL_REQUEST_STREAM_JOB_H_
 
-#include <deque>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "atom/browser/api/event_subscriber.h"
 #include "atom/browser/net/js_asker.h"
+#include "base/files/file_path.h"
 #include "base/memory/ref_counted_memory.h"
 #include "native_mate/persistent_dictionary.h"
 #include "net/base/io_buffer.h"
@@ -17,6 +19,10 @@
 #include "net/url_request/url_request_context_getter.h"
 #include "v8/include/v8.h"
 
+namespace net {
+class FileStream;
+}
+
 namespace atom {
 
 class URLRequestStreamJob : public JsAsker<net::URLRequestJob> {
@@ -51,7 +57,44 @@ class URLRequestStreamJob : public JsAsker<net::URLRequestJob> {
   void CopyMoreData(scoped_refptr<net::IOBuffer> io_buf, int io_buf_size);
   void CopyMoreDataDone(scoped_refptr<net::IOBuffer> io_buf, int read_count);
 
-  std::deque<char> buffer_;
+  // Ring buffer operations, only used on the UI thread. WriteRing grows the
+  // buffer only in the pathological case of a single chunk larger than the
+  // whole capacity.
+  void WriteRing(const char* data, size_t size);
+  size_t ReadRing(char* dest, size_t size);
+
+  // Pause/resume the JS stream to keep the buffered amount between the low
+  // and high water marks.
+  void PauseStream();
+  void ResumeStream();
+
+  // File-backed response path: the handler returned a file path (plus an
+  // optional byte range) instead of a stream, so the body is read straight
+  // from disk on the IO thread without round-tripping through JS.
+  void DidOpenFile(int result);
+  void DidSeekFile(int64_t result);
+  void DidReadFile(scoped_refptr<net::IOBuffer> buf, int result);
+
+  // Fixed-capacity ring buffer holding bytes emitted by the JS stream but
+  // not yet consumed by ReadRawData.
+  std::vector<char> ring_buffer_;
+  size_t ring_start_ = 0;
+  size_t ring_bytes_ = 0;
+  bool stream_paused_ = false;
+
+  v8::Isolate* isolate_ = nullptr;
+  // Handle to the JS stream, used to call pause/resume. Only accessed on the
+  // UI thread; released via DeleteSoon as the job dies on the IO thread.
+  std::unique_ptr<v8::Global<v8::Object>> stream_;
+
+  // State of the file-backed response path.
+  bool file_backed_ = false;
+  base::FilePath file_path_;
+  int64_t file_offset_ = 0;
+  // Bytes left to serve; -1 means read until EOF.
+  int64_t file_remaining_ = -1;
+  std::unique_ptr<net::FileStream> file_stream_;
+
   bool ended_ = false;
   bool errored_ = false;
   scoped_refptr<net::IOBuffer> pending_io_buf_;
@@ -11,6 +11,15 @@
 
 namespace atom {
 
+namespace {
+
+// Number of delivery buffers kept when only damaged subregions are sent.
+// Painting rotates through the pool, so a consumer may hold a delivered
+// bitmap for up to this many frames without it being overwritten.
+const size_t kBufferPoolSize = 3;
+
+}  // namespace
+
 OffScreenOutputDevice::OffScreenOutputDevice(bool transparent,
                                              const OnPaintCallback& callback)
     : transparent_(transparent), callback_(callback) {
@@ -25,6 +34,9 @@ void OffScreenOutputDevice::Resize(const gfx::Size& pixel_size,
     return;
   viewport_pixel_size_ = pixel_size;
 
+  buffer_pool_.clear();
+  next_pool_index_ = 0;
+
   canvas_.reset();
   bitmap_.reset(new SkBitmap);
   bitmap_->allocN32Pixels(viewport_pixel_size_.width(),
@@ -95,7 +107,50 @@ void OffScreenOutputDevice::OnPaint(const gfx::Rect& damage_rect) {
   if (rect.IsEmpty())
     return;
 
+  if (deliver_damaged_region_only_ && rect != gfx::Rect(viewport_pixel_size_)) {
+    SkIRect damage = gfx::RectToSkIRect(rect);
+    SkBitmap* buffer = GetNextPoolBuffer();
+    SkPixmap pixels;
+    SkPixmap damaged;
+    if (buffer && bitmap_->peekPixels(&pixels) &&
+        pixels.extractSubset(&damaged, damage)) {
+      // Copy only the damaged pixels into the pool buffer; the delivered
+      // bitmap shares the buffer's pixels, so its rowBytes() carries the
+      // stride consumers must use per row.
+      buffer->writePixels(damaged, rect.x(), rect.y());
+      SkBitmap subregion;
+      if (buffer->extractSubset(&subregion, damage)) {
+        callback_.Run(rect, subregion);
+        return;
+      }
+    }
+    // Fall back to full-frame delivery if the subregion copy failed.
+  }
+
   callback_.Run(rect, *bitmap_);
 }
 
+void OffScreenOutputDevice::SetDeliverDamagedRegionOnly(bool enabled) {
+  deliver_damaged_region_only_ = enabled;
+}
+
+SkBitmap* OffScreenOutputDevice::GetNextPoolBuffer() {
+  if (buffer_pool_.empty())
+    buffer_pool_.resize(kBufferPoolSize);
+
+  std::unique_ptr<SkBitmap>& buffer = buffer_pool_[next_pool_index_];
+  next_pool_index_ = (next_pool_index_ + 1) % buffer_pool_.size();
+
+  if (!buffer) {
+    buffer.reset(new SkBitmap);
+    buffer->allocN32Pixels(viewport_pixel_size_.width(),
+                           viewport_pixel_size_.height(), !transparent_);
+    if (buffer->drawsNothing()) {
+      buffer.reset();
+      return nullptr;
+    }
+  }
+  return buffer.get();
+}
+
 }  // namespace atom
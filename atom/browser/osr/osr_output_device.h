@@ -5,8 +5,14 @@
 #ifndef ATOM_BROWSER_OSR_OSR_OUTPUT_DEVICE_H_
 #define ATOM_BROWSER_OSR_OSR_OUTPUT_DEVICE_H_
 
+#include <memory>
+#include <vector>
+
 #include "base/callback.h"
+#include "components/viz/common/resources/single_release_callback.h"
 #include "components/viz/service/display/software_output_device.h"
+#include "gpu/command_buffer/common/mailbox.h"
+#include "gpu/command_buffer/common/sync_token.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkCanvas.h"
 
@@ -14,6 +20,19 @@ namespace atom {
 
 typedef base::Callback<void(const gfx::Rect&, const SkBitmap&)> OnPaintCallback;
 
+// Variant of OnPaintCallback that delivers the composited frame as a
+// shared GPU texture instead of a CPU bitmap, so the consumer never pays
+// for a readback into system memory. The mailbox can be consumed from any
+// context that shares with Chromium's GPU service after waiting on
+// |sync_token|. |release| must be run (with a sync token covering the
+// consumer's reads) once the texture is no longer needed, or it leaks.
+typedef base::Callback<void(
+    const gfx::Rect& damage_rect,
+    const gpu::Mailbox& mailbox,
+    const gpu::SyncToken& sync_token,
+    std::unique_ptr<viz::SingleReleaseCallback> release)>
+    OnTexturePaintCallback;
+
 class OffScreenOutputDevice : public viz::SoftwareOutputDevice {
  public:
   OffScreenOutputDevice(bool transparent, const OnPaintCallback& callback);
@@ -27,16 +46,33 @@ class OffScreenOutputDevice : public viz::SoftwareOutputDevice {
   void SetActive(bool active, bool paint);
   void OnPaint(const gfx::Rect& damage_rect);
 
+  // When enabled, OnPaint() delivers a bitmap covering only the damaged
+  // subregion instead of the whole frame, so small updates (cursor blink,
+  // caret, spinners) stop costing full-frame memory bandwidth. The damaged
+  // pixels are copied into a rotating pool of pre-allocated buffers, so the
+  // delivered bitmap stays valid while the compositor paints the next few
+  // frames. Consumers must honor the delivered bitmap's rowBytes(), which is
+  // the stride of the underlying pool buffer.
+  void SetDeliverDamagedRegionOnly(bool enabled);
+
  private:
+  // Returns the next buffer from the rotating pool, allocating it at
+  // viewport size the first time it is used after a Resize().
+  SkBitmap* GetNextPoolBuffer();
+
   const bool transparent_;
   OnPaintCallback callback_;
 
   bool active_ = false;
+  bool deliver_damaged_region_only_ = false;
 
   std::unique_ptr<SkCanvas> canvas_;
   std::unique_ptr<SkBitmap> bitmap_;
   gfx::Rect pending_damage_rect_;
 
+  std::vector<std::unique_ptr<SkBitmap>> buffer_pool_;
+  size_t next_pool_index_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(OffScreenOutputDevice);
 };
 
@@ -0,0 +1,97 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/osr/osr_paint_dispatcher.h"
+
+#include <algorithm>
+
+#include "base/bind.h"
+#include "base/location.h"
+
+namespace atom {
+
+OffScreenPaintDispatcher::OffScreenPaintDispatcher(
+    const OnPaintCallback& callback,
+    scoped_refptr<base::SingleThreadTaskRunner> task_runner)
+    : callback_(callback), task_runner_(task_runner) {
+  DCHECK(!callback_.is_null());
+  DCHECK(task_runner_.get());
+}
+
+OffScreenPaintDispatcher::~OffScreenPaintDispatcher() {}
+
+void OffScreenPaintDispatcher::Publish(const gfx::Rect& damage_rect,
+                                       const SkBitmap& bitmap) {
+  Slot& slot = slots_[write_index_];
+  slot.damage_rect = damage_rect;
+  if (slot.bitmap.info() != bitmap.info()) {
+    slot.bitmap.reset();
+    slot.bitmap.allocPixels(bitmap.info());
+  }
+  bitmap.readPixels(slot.bitmap.pixmap(), 0, 0);
+  slot.bitmap.notifyPixelsChanged();
+
+  bool post_drain = false;
+  {
+    base::AutoLock auto_lock(lock_);
+    if (stopped_)
+      return;
+    if (ready_valid_)
+      dropped_frame_count_++;
+    std::swap(write_index_, ready_index_);
+    ready_valid_ = true;
+    if (!drain_pending_) {
+      drain_pending_ = true;
+      post_drain = true;
+    }
+  }
+
+  if (post_drain) {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&OffScreenPaintDispatcher::Drain, this));
+  }
+}
+
+void OffScreenPaintDispatcher::Stop() {
+  base::AutoLock auto_lock(lock_);
+  stopped_ = true;
+  ready_valid_ = false;
+}
+
+uint64_t OffScreenPaintDispatcher::dropped_frame_count() const {
+  base::AutoLock auto_lock(lock_);
+  return dropped_frame_count_;
+}
+
+void OffScreenPaintDispatcher::Drain() {
+  {
+    base::AutoLock auto_lock(lock_);
+    if (stopped_ || !ready_valid_) {
+      drain_pending_ = false;
+      return;
+    }
+    std::swap(read_index_, ready_index_);
+    ready_valid_ = false;
+  }
+
+  const Slot& slot = slots_[read_index_];
+  callback_.Run(slot.damage_rect, slot.bitmap);
+
+  bool post_drain = false;
+  {
+    base::AutoLock auto_lock(lock_);
+    if (ready_valid_ && !stopped_)
+      post_drain = true;
+    else
+      drain_pending_ = false;
+  }
+
+  // Another frame was published while the callback ran; keep draining.
+  if (post_drain) {
+    task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(&OffScreenPaintDispatcher::Drain, this));
+  }
+}
+
+}  // namespace atom
@@ -0,0 +1,78 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_OSR_OSR_PAINT_DISPATCHER_H_
+#define ATOM_BROWSER_OSR_OSR_PAINT_DISPATCHER_H_
+
+#include <cstdint>
+
+#include "atom/browser/osr/osr_output_device.h"
+#include "base/memory/ref_counted.h"
+#include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace atom {
+
+// Decouples frame capture from frame consumption with a triple buffer.
+// Publish() copies the frame into a private write slot on the compositor
+// (UI) thread and swaps it into the ready slot, then the consumer task
+// runner drains the newest ready frame and runs the paint callback with
+// it. Publishing never waits for the consumer: if a new frame arrives
+// before the previous ready frame was drained, the old one is dropped.
+//
+// Thread-safe and reference counted so pending drain tasks keep the
+// dispatcher alive; call Stop() before dropping the last owning reference
+// if the paint callback must not run afterwards.
+class OffScreenPaintDispatcher
+    : public base::RefCountedThreadSafe<OffScreenPaintDispatcher> {
+ public:
+  OffScreenPaintDispatcher(
+      const OnPaintCallback& callback,
+      scoped_refptr<base::SingleThreadTaskRunner> task_runner);
+
+  // Called on the UI thread with a bitmap that is only valid for the
+  // duration of the call; the damaged frame is copied into the buffer.
+  void Publish(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
+
+  // Prevents any further paint callbacks from running. Pending drain tasks
+  // become no-ops.
+  void Stop();
+
+  // Number of published frames that were overwritten before the consumer
+  // could drain them.
+  uint64_t dropped_frame_count() const;
+
+ private:
+  friend class base::RefCountedThreadSafe<OffScreenPaintDispatcher>;
+  ~OffScreenPaintDispatcher();
+
+  struct Slot {
+    gfx::Rect damage_rect;
+    SkBitmap bitmap;
+  };
+
+  // Runs on |task_runner_|.
+  void Drain();
+
+  const OnPaintCallback callback_;
+  const scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
+
+  mutable base::Lock lock_;
+  Slot slots_[3];
+  int write_index_ = 0;  // Only touched by the publishing thread.
+  int ready_index_ = 1;  // Guarded by |lock_|.
+  int read_index_ = 2;   // Only touched by the consumer between swaps.
+  bool ready_valid_ = false;    // Guarded by |lock_|.
+  bool drain_pending_ = false;  // Guarded by |lock_|.
+  bool stopped_ = false;        // Guarded by |lock_|.
+  uint64_t dropped_frame_count_ = 0;  // Guarded by |lock_|.
+
+  DISALLOW_COPY_AND_ASSIGN(OffScreenPaintDispatcher);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_OSR_OSR_PAINT_DISPATCHER_H_
@@ -128,11 +128,23 @@ class AtomCopyFrameGenerator {
     if (!view_->render_widget_host() || !view_->IsPainting())
       return;
 
-    auto request = std::make_unique<viz::CopyOutputRequest>(
-        viz::CopyOutputRequest::ResultFormat::RGBA_BITMAP,
-        base::BindOnce(
-            &AtomCopyFrameGenerator::CopyFromCompositingSurfaceHasResult,
-            weak_ptr_factory_.GetWeakPtr(), damage_rect));
+    std::unique_ptr<viz::CopyOutputRequest> request;
+    if (view_->IsTexturePainting()) {
+      // Keep the composited frame on the GPU: the result carries a
+      // mailbox the embedder consumes directly, so the pixels never
+      // cross into system memory.
+      request = std::make_unique<viz::CopyOutputRequest>(
+          viz::CopyOutputRequest::ResultFormat::RGBA_TEXTURE,
+          base::BindOnce(
+              &AtomCopyFrameGenerator::CopyFromCompositingSurfaceHasTexture,
+              weak_ptr_factory_.GetWeakPtr(), damage_rect));
+    } else {
+      request = std::make_unique<viz::CopyOutputRequest>(
+          viz::CopyOutputRequest::ResultFormat::RGBA_BITMAP,
+          base::BindOnce(
+              &AtomCopyFrameGenerator::CopyFromCompositingSurfaceHasResult,
+              weak_ptr_factory_.GetWeakPtr(), damage_rect));
+    }
 
     request->set_area(gfx::Rect(view_->GetCompositorViewportPixelSize()));
     view_->GetRootLayer()->RequestCopyOfOutput(std::move(request));
@@ -180,6 +192,26 @@ class AtomCopyFrameGenerator {
     }
   }
 
+  void CopyFromCompositingSurfaceHasTexture(
+      const gfx::Rect& damage_rect,
+      std::unique_ptr<viz::CopyOutputResult> result) {
+    if (result->IsEmpty() || result->size().IsEmpty() ||
+        !result->GetTextureResult() || !view_->render_widget_host()) {
+      OnCopyFrameCaptureFailure(damage_rect);
+      return;
+    }
+
+    gpu::Mailbox mailbox = result->GetTextureResult()->mailbox;
+    gpu::SyncToken sync_token = result->GetTextureResult()->sync_token;
+
+    frame_retry_count_ = 0;
+    // Unlike the bitmap path there is no readback cost to amortize, so
+    // frames are delivered without pacing; holding a texture back would
+    // only add latency for the consumer.
+    view_->OnTexturePaint(damage_rect, mailbox, sync_token,
+                          result->TakeTextureOwnership());
+  }
+
   void OnCopyFrameCaptureFailure(const gfx::Rect& damage_rect) {
     const bool force_frame = (++frame_retry_count_ <= kFrameRetryLimit);
     if (force_frame) {
@@ -212,11 +244,18 @@ class AtomCopyFrameGenerator {
   DISALLOW_COPY_AND_ASSIGN(AtomCopyFrameGenerator);
 };
 
+// Number of consecutive begin-frames without damage before the adaptive
+// timer halves its rate, and the slowest interval it backs off to (1 fps).
+const int kIdleFramesBeforeBackoff = 30;
+const int kMaxAdaptiveIntervalUs = base::Time::kMicrosecondsPerSecond;
+
 class AtomBeginFrameTimer : public viz::DelayBasedTimeSourceClient {
  public:
   AtomBeginFrameTimer(int frame_rate_threshold_us,
                       const base::Closure& callback)
-      : callback_(callback) {
+      : callback_(callback),
+        frame_rate_threshold_us_(frame_rate_threshold_us),
+        effective_interval_us_(frame_rate_threshold_us) {
     time_source_.reset(new viz::DelayBasedTimeSource(
         content::BrowserThread::GetTaskRunnerForThread(
             content::BrowserThread::UI)
@@ -232,17 +271,56 @@ class AtomBeginFrameTimer : public viz::DelayBasedTimeSourceClient {
   bool IsActive() const { return time_source_->Active(); }
 
   void SetFrameRateThresholdUs(int frame_rate_threshold_us) {
-    time_source_->SetTimebaseAndInterval(
-        base::TimeTicks::Now(),
-        base::TimeDelta::FromMicroseconds(frame_rate_threshold_us));
+    frame_rate_threshold_us_ = frame_rate_threshold_us;
+    idle_frame_count_ = 0;
+    SetEffectiveIntervalUs(frame_rate_threshold_us);
+  }
+
+  // When adaptive, the timer backs off towards kMaxAdaptiveIntervalUs after
+  // consecutive ticks that produced no damage, and OnFrameDamaged() restores
+  // the configured rate immediately.
+  void SetAdaptive(bool adaptive) {
+    if (adaptive_ == adaptive)
+      return;
+    adaptive_ = adaptive;
+    idle_frame_count_ = 0;
+    SetEffectiveIntervalUs(frame_rate_threshold_us_);
+  }
+
+  void OnFrameDamaged() {
+    idle_frame_count_ = 0;
+    if (effective_interval_us_ != frame_rate_threshold_us_)
+      SetEffectiveIntervalUs(frame_rate_threshold_us_);
   }
 
+  int GetEffectiveIntervalUs() const { return effective_interval_us_; }
+
  private:
-  void OnTimerTick() override { callback_.Run(); }
+  void OnTimerTick() override {
+    if (adaptive_ && ++idle_frame_count_ >= kIdleFramesBeforeBackoff) {
+      idle_frame_count_ = 0;
+      if (effective_interval_us_ < kMaxAdaptiveIntervalUs) {
+        SetEffectiveIntervalUs(
+            std::min(effective_interval_us_ * 2, kMaxAdaptiveIntervalUs));
+      }
+    }
+    callback_.Run();
+  }
+
+  void SetEffectiveIntervalUs(int interval_us) {
+    effective_interval_us_ = interval_us;
+    time_source_->SetTimebaseAndInterval(
+        base::TimeTicks::Now(), base::TimeDelta::FromMicroseconds(interval_us));
+  }
 
   const base::Closure callback_;
   std::unique_ptr<viz::DelayBasedTimeSource> time_source_;
 
+  int frame_rate_threshold_us_;
+  int effective_interval_us_;
+  bool adaptive_ = false;
+  int idle_frame_count_ = 0;
+
   DISALLOW_COPY_AND_ASSIGN(AtomBeginFrameTimer);
 };
 
@@ -326,6 +404,11 @@ OffScreenRenderWidgetHostView::~OffScreenRenderWidgetHostView() {
   if (copy_frame_generator_.get())
     copy_frame_generator_.reset(NULL);
 
+  if (paint_dispatcher_.get()) {
+    paint_dispatcher_->Stop();
+    paint_dispatcher_ = nullptr;
+  }
+
 #if defined(OS_MACOSX)
   DestroyPlatformWidget();
 #else
@@ -348,6 +431,7 @@ void OffScreenRenderWidgetHostView::OnWindowClosed() {
 
 void OffScreenRenderWidgetHostView::OnBeginFrameTimerTick() {
   const base::TimeTicks frame_time = base::TimeTicks::Now();
+  last_begin_frame_time_ = frame_time;
   const base::TimeDelta vsync_period =
       base::TimeDelta::FromMicroseconds(frame_rate_threshold_us_);
   SendBeginFrame(frame_time, vsync_period);
@@ -511,7 +595,7 @@ void OffScreenRenderWidgetHostView::SubmitCompositorFrame(
     const viz::LocalSurfaceId& local_surface_id,
     viz::CompositorFrame frame,
     viz::mojom::HitTestRegionListPtr hit_test_region_list) {
-  TRACE_EVENT0("electron",
+  TRACE_EVENT0("electron.osr",
                "OffScreenRenderWidgetHostView::SubmitCompositorFrame");
 
   if (frame.metadata.root_scroll_offset != last_scroll_offset_) {
@@ -519,6 +603,11 @@ void OffScreenRenderWidgetHostView::SubmitCompositorFrame(
   }
 
   if (!frame.render_pass_list.empty()) {
+    if (begin_frame_timer_.get() &&
+        !frame.render_pass_list.back()->damage_rect.IsEmpty()) {
+      begin_frame_timer_->OnFrameDamaged();
+    }
+
     if (software_output_device_) {
       if (!begin_frame_timer_.get() || IsPopupWidget()) {
         software_output_device_->SetActive(painting_, false);
@@ -887,6 +976,8 @@ OffScreenRenderWidgetHostView::CreateSoftwareOutputDevice(
   software_output_device_ = new OffScreenOutputDevice(
       transparent_, base::Bind(&OffScreenRenderWidgetHostView::OnPaint,
                                weak_ptr_factory_.GetWeakPtr()));
+  if (paint_damaged_region_only_)
+    software_output_device_->SetDeliverDamagedRegionOnly(true);
   return base::WrapUnique(software_output_device_);
 }
 
@@ -948,7 +1039,11 @@ void CopyBitmapTo(const SkBitmap& destination,
 
 void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
                                             const SkBitmap& bitmap) {
-  TRACE_EVENT0("electron", "OffScreenRenderWidgetHostView::OnPaint");
+  TRACE_EVENT0("electron.osr", "OffScreenRenderWidgetHostView::OnPaint");
+
+  frames_delivered_++;
+  if (!last_begin_frame_time_.is_null())
+    total_paint_latency_ += base::TimeTicks::Now() - last_begin_frame_time_;
 
   HoldResize();
 
@@ -970,11 +1065,18 @@ void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
           bitmap, pos.x(), pos.y(), pos.width(), pos.height()));
     }
 
+    // Holding the frame references keeps the shared pixels alive even if
+    // a proxy publishes a new frame while the paint callback runs.
+    std::vector<scoped_refptr<OffscreenSharedFrame>> proxy_frames;
     for (auto* proxy_view : proxy_views_) {
+      scoped_refptr<OffscreenSharedFrame> frame = proxy_view->GetFrame();
+      if (!frame.get())
+        continue;
       gfx::Rect pos = proxy_view->GetBounds();
       damage.Union(pos);
       damages.push_back(pos);
-      bitmaps.push_back(proxy_view->GetBitmap());
+      proxy_frames.push_back(frame);
+      bitmaps.push_back(&frame->bitmap());
       originals.push_back(SkBitmapOperations::CreateTiledBitmap(
           bitmap, pos.x(), pos.y(), pos.width(), pos.height()));
     }
@@ -985,7 +1087,11 @@ void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
 
     damage.Intersect(GetViewBounds());
     paint_callback_running_ = true;
-    callback_.Run(damage, bitmap);
+    if (paint_dispatcher_.get()) {
+      paint_dispatcher_->Publish(damage, bitmap);
+    } else {
+      callback_.Run(damage, bitmap);
+    }
     paint_callback_running_ = false;
 
     for (size_t i = 0; i < damages.size(); i++) {
@@ -996,6 +1102,25 @@ void OffScreenRenderWidgetHostView::OnPaint(const gfx::Rect& damage_rect,
   ReleaseResize();
 }
 
+void OffScreenRenderWidgetHostView::OnTexturePaint(
+    const gfx::Rect& damage_rect,
+    const gpu::Mailbox& mailbox,
+    const gpu::SyncToken& sync_token,
+    std::unique_ptr<viz::SingleReleaseCallback> release) {
+  TRACE_EVENT0("electron.osr", "OffScreenRenderWidgetHostView::OnTexturePaint");
+
+  // The texture must always be released, even when nobody consumes it,
+  // or the mailbox leaks in the GPU service.
+  if (!painting_ || texture_callback_.is_null()) {
+    release->Run(sync_token, false /* is_lost */);
+    return;
+  }
+
+  HoldResize();
+  texture_callback_.Run(damage_rect, mailbox, sync_token, std::move(release));
+  ReleaseResize();
+}
+
 void OffScreenRenderWidgetHostView::OnPopupPaint(const gfx::Rect& damage_rect,
                                                  const SkBitmap& bitmap) {
   if (popup_host_view_ && popup_bitmap_.get())
@@ -1133,6 +1258,48 @@ void OffScreenRenderWidgetHostView::SetPainting(bool painting) {
   }
 }
 
+void OffScreenRenderWidgetHostView::SetTexturePaintCallback(
+    const OnTexturePaintCallback& callback) {
+  texture_callback_ = callback;
+}
+
+bool OffScreenRenderWidgetHostView::IsTexturePainting() const {
+  return !texture_callback_.is_null();
+}
+
+void OffScreenRenderWidgetHostView::SetAsynchronousPaintDispatch(
+    bool enabled,
+    scoped_refptr<base::SingleThreadTaskRunner> task_runner) {
+  if (enabled == UsesAsynchronousPaintDispatch())
+    return;
+
+  if (!enabled) {
+    paint_dispatcher_->Stop();
+    paint_dispatcher_ = nullptr;
+    return;
+  }
+
+  if (!task_runner.get()) {
+    task_runner = content::BrowserThread::GetTaskRunnerForThread(
+        content::BrowserThread::UI);
+  }
+  paint_dispatcher_ = new OffScreenPaintDispatcher(callback_, task_runner);
+}
+
+bool OffScreenRenderWidgetHostView::UsesAsynchronousPaintDispatch() const {
+  return paint_dispatcher_.get() != nullptr;
+}
+
+void OffScreenRenderWidgetHostView::SetPaintDamagedRegionOnly(bool enabled) {
+  paint_damaged_region_only_ = enabled;
+  if (software_output_device_)
+    software_output_device_->SetDeliverDamagedRegionOnly(enabled);
+}
+
+bool OffScreenRenderWidgetHostView::PaintsDamagedRegionOnly() const {
+  return paint_damaged_region_only_;
+}
+
 bool OffScreenRenderWidgetHostView::IsPainting() const {
   return painting_;
 }
@@ -1162,6 +1329,38 @@ int OffScreenRenderWidgetHostView::GetFrameRate() const {
   return frame_rate_;
 }
 
+void OffScreenRenderWidgetHostView::SetAdaptiveFrameRate(bool adaptive) {
+  adaptive_frame_rate_ = adaptive;
+
+  if (begin_frame_timer_.get())
+    begin_frame_timer_->SetAdaptive(adaptive);
+
+  for (auto* guest_host_view : guest_host_views_)
+    guest_host_view->SetAdaptiveFrameRate(adaptive);
+}
+
+bool OffScreenRenderWidgetHostView::UsesAdaptiveFrameRate() const {
+  return adaptive_frame_rate_;
+}
+
+int OffScreenRenderWidgetHostView::GetEffectiveFrameRate() const {
+  if (adaptive_frame_rate_ && begin_frame_timer_.get()) {
+    return base::Time::kMicrosecondsPerSecond /
+           begin_frame_timer_->GetEffectiveIntervalUs();
+  }
+  return frame_rate_;
+}
+
+uint64_t OffScreenRenderWidgetHostView::frames_dropped() const {
+  return paint_dispatcher_.get() ? paint_dispatcher_->dropped_frame_count() : 0;
+}
+
+base::TimeDelta OffScreenRenderWidgetHostView::GetMeanPaintLatency() const {
+  if (frames_delivered_ == 0)
+    return base::TimeDelta();
+  return total_paint_latency_ / frames_delivered_;
+}
+
 #if !defined(OS_MACOSX)
 ui::Compositor* OffScreenRenderWidgetHostView::GetCompositor() const {
   return compositor_.get();
@@ -1199,6 +1398,7 @@ void OffScreenRenderWidgetHostView::SetupFrameRate(bool force) {
         base::Bind(&OffScreenRenderWidgetHostView::OnBeginFrameTimerTick,
                    weak_ptr_factory_.GetWeakPtr())));
   }
+  begin_frame_timer_->SetAdaptive(adaptive_frame_rate_);
 }
 
 void OffScreenRenderWidgetHostView::Invalidate() {
@@ -1206,6 +1406,11 @@ void OffScreenRenderWidgetHostView::Invalidate() {
 }
 
 void OffScreenRenderWidgetHostView::InvalidateBounds(const gfx::Rect& bounds) {
+  // An explicit invalidation means new content is expected, so an adaptive
+  // timer ramps back to the configured rate right away.
+  if (begin_frame_timer_.get())
+    begin_frame_timer_->OnFrameDamaged();
+
   if (software_output_device_) {
     software_output_device_->OnPaint(bounds);
   } else if (copy_frame_generator_) {
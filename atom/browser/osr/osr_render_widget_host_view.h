@@ -16,6 +16,7 @@
 #include "atom/browser/native_window.h"
 #include "atom/browser/native_window_observer.h"
 #include "atom/browser/osr/osr_output_device.h"
+#include "atom/browser/osr/osr_paint_dispatcher.h"
 #include "atom/browser/osr/osr_view_proxy.h"
 #include "base/process/kill.h"
 #include "base/threading/thread.h"
@@ -220,6 +221,10 @@ class OffScreenRenderWidgetHostView
       content::RenderWidgetHostViewGuest* guest_host_view);
 
   void OnPaint(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
+  void OnTexturePaint(const gfx::Rect& damage_rect,
+                      const gpu::Mailbox& mailbox,
+                      const gpu::SyncToken& sync_token,
+                      std::unique_ptr<viz::SingleReleaseCallback> release);
   void OnPopupPaint(const gfx::Rect& damage_rect, const SkBitmap& bitmap);
   void OnProxyViewPaint(const gfx::Rect& damage_rect) override;
 
@@ -235,9 +240,50 @@ class OffScreenRenderWidgetHostView
   void SetPainting(bool painting);
   bool IsPainting() const;
 
+  // When |callback| is non-null, composited frames on the GPU compositing
+  // path are exported through it as shared textures instead of being read
+  // back into SkBitmaps (see OnTexturePaintCallback). Popup and proxy view
+  // overlays are not blended into exported textures. Takes effect for
+  // frames submitted after the call; the software output device path is
+  // unaffected.
+  void SetTexturePaintCallback(const OnTexturePaintCallback& callback);
+  bool IsTexturePainting() const;
+
+  // When enabled, paint callbacks are published into a triple buffer that
+  // |task_runner| (the UI thread when null) drains asynchronously, so a
+  // slow consumer drops frames instead of back-pressuring the compositor.
+  // Popup and proxy view overlays are blended before publishing, exactly
+  // as on the synchronous path.
+  void SetAsynchronousPaintDispatch(
+      bool enabled,
+      scoped_refptr<base::SingleThreadTaskRunner> task_runner = nullptr);
+  bool UsesAsynchronousPaintDispatch() const;
+
+  // When enabled, paints on the software output device path deliver a
+  // bitmap covering only the damaged subregion, copied from a rotating
+  // buffer pool; see OffScreenOutputDevice::SetDeliverDamagedRegionOnly.
+  void SetPaintDamagedRegionOnly(bool enabled);
+  bool PaintsDamagedRegionOnly() const;
+
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
 
+  // In adaptive mode the begin-frame timer backs off towards 1 fps while
+  // consecutive frames produce no damage and returns to the configured rate
+  // as soon as a frame is damaged or the view is invalidated. The frame rate
+  // set with SetFrameRate() stays the upper bound.
+  void SetAdaptiveFrameRate(bool adaptive);
+  bool UsesAdaptiveFrameRate() const;
+  // Returns the rate the begin-frame timer is currently ticking at, which
+  // can be below GetFrameRate() when adaptive mode has backed off.
+  int GetEffectiveFrameRate() const;
+
+  // Paint counters, accumulated since this view was created.
+  uint64_t frames_delivered() const { return frames_delivered_; }
+  uint64_t frames_dropped() const;
+  // Mean begin-frame to paint-callback latency of delivered frames.
+  base::TimeDelta GetMeanPaintLatency() const;
+
   ui::Compositor* GetCompositor() const;
   ui::Layer* GetRootLayer() const;
   content::DelegatedFrameHost* GetDelegatedFrameHost() const;
@@ -288,9 +334,13 @@ class OffScreenRenderWidgetHostView
   const bool transparent_;
   OnPaintCallback callback_;
   OnPaintCallback parent_callback_;
+  OnTexturePaintCallback texture_callback_;
+  scoped_refptr<OffScreenPaintDispatcher> paint_dispatcher_;
+  bool paint_damaged_region_only_ = false;
 
   int frame_rate_ = 0;
   int frame_rate_threshold_us_ = 0;
+  bool adaptive_frame_rate_ = false;
 
   base::Time last_time_ = base::Time::Now();
 
@@ -308,6 +358,10 @@ class OffScreenRenderWidgetHostView
 
   bool paint_callback_running_ = false;
 
+  uint64_t frames_delivered_ = 0;
+  base::TimeDelta total_paint_latency_;
+  base::TimeTicks last_begin_frame_time_;
+
   viz::LocalSurfaceId local_surface_id_;
   viz::ParentLocalSurfaceIdAllocator local_surface_id_allocator_;
 
@@ -0,0 +1,121 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/osr/osr_video_encoder.h"
+
+#include <utility>
+
+#include "gpu/command_buffer/service/gpu_preferences.h"
+#include "media/base/bitstream_buffer.h"
+#include "media/base/video_frame.h"
+#include "media/gpu/gpu_video_encode_accelerator_factory.h"
+#include "third_party/libyuv/include/libyuv.h"
+
+namespace atom {
+
+OffScreenVideoEncoder::OffScreenVideoEncoder(
+    const OnEncodedPacketCallback& packet_callback,
+    const OnEncodeErrorCallback& error_callback)
+    : packet_callback_(packet_callback), error_callback_(error_callback) {
+  DCHECK(!packet_callback_.is_null());
+  DCHECK(!error_callback_.is_null());
+}
+
+OffScreenVideoEncoder::~OffScreenVideoEncoder() {
+  // A VideoEncodeAccelerator deletes itself in Destroy().
+  if (encoder_)
+    encoder_.release()->Destroy();
+}
+
+bool OffScreenVideoEncoder::Initialize(const gfx::Size& size,
+                                       uint32_t bitrate) {
+  DCHECK(!encoder_);
+
+  visible_size_ = size;
+  start_time_ = base::TimeTicks::Now();
+  encoder_ = media::GpuVideoEncodeAcceleratorFactory::CreateVEA(
+      media::PIXEL_FORMAT_I420, size, media::H264PROFILE_BASELINE, bitrate,
+      this, gpu::GpuPreferences());
+  return encoder_.get() != nullptr;
+}
+
+void OffScreenVideoEncoder::EncodeFrame(const SkBitmap& bitmap,
+                                        base::TimeTicks capture_time) {
+  if (!ready_ || !encoder_)
+    return;
+  if (bitmap.width() != visible_size_.width() ||
+      bitmap.height() != visible_size_.height())
+    return;
+
+  scoped_refptr<media::VideoFrame> frame = media::VideoFrame::CreateFrame(
+      media::PIXEL_FORMAT_I420, input_coded_size_, gfx::Rect(visible_size_),
+      visible_size_, capture_time - start_time_);
+  if (!frame.get())
+    return;
+
+  // The only raw-frame copy in the pipeline: skia N32 pixels to the I420
+  // planes the encoder consumes.
+  libyuv::ARGBToI420(static_cast<const uint8_t*>(bitmap.getPixels()),
+                     bitmap.rowBytes(),
+                     frame->data(media::VideoFrame::kYPlane),
+                     frame->stride(media::VideoFrame::kYPlane),
+                     frame->data(media::VideoFrame::kUPlane),
+                     frame->stride(media::VideoFrame::kUPlane),
+                     frame->data(media::VideoFrame::kVPlane),
+                     frame->stride(media::VideoFrame::kVPlane),
+                     visible_size_.width(), visible_size_.height());
+
+  encoder_->Encode(frame, false /* force_keyframe */);
+}
+
+void OffScreenVideoEncoder::RequireBitstreamBuffers(
+    unsigned int input_count,
+    const gfx::Size& input_coded_size,
+    size_t output_buffer_size) {
+  input_coded_size_ = input_coded_size;
+
+  output_buffers_.resize(input_count);
+  for (size_t i = 0; i < output_buffers_.size(); i++) {
+    OutputBuffer& buffer = output_buffers_[i];
+    buffer.memory.reset(new base::SharedMemory);
+    buffer.size = output_buffer_size;
+    if (!buffer.memory->CreateAndMapAnonymous(output_buffer_size)) {
+      NotifyError(media::VideoEncodeAccelerator::kPlatformFailureError);
+      return;
+    }
+    encoder_->UseOutputBitstreamBuffer(media::BitstreamBuffer(
+        static_cast<int32_t>(i), buffer.memory->handle(), buffer.size));
+  }
+
+  ready_ = true;
+}
+
+void OffScreenVideoEncoder::BitstreamBufferReady(int32_t bitstream_buffer_id,
+                                                 size_t payload_size,
+                                                 bool key_frame,
+                                                 base::TimeDelta timestamp) {
+  if (bitstream_buffer_id < 0 ||
+      static_cast<size_t>(bitstream_buffer_id) >= output_buffers_.size()) {
+    NotifyError(media::VideoEncodeAccelerator::kPlatformFailureError);
+    return;
+  }
+
+  OutputBuffer& buffer = output_buffers_[bitstream_buffer_id];
+  packet_callback_.Run(static_cast<const uint8_t*>(buffer.memory->memory()),
+                       payload_size, timestamp, key_frame);
+
+  // Hand the buffer back to the encoder for the next packet.
+  encoder_->UseOutputBitstreamBuffer(
+      media::BitstreamBuffer(bitstream_buffer_id, buffer.memory->handle(),
+                             buffer.size));
+}
+
+void OffScreenVideoEncoder::NotifyError(
+    media::VideoEncodeAccelerator::Error error) {
+  LOG(ERROR) << "OSR video encode error " << error;
+  ready_ = false;
+  error_callback_.Run();
+}
+
+}  // namespace atom
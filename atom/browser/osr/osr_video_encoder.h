@@ -0,0 +1,81 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_OSR_OSR_VIDEO_ENCODER_H_
+#define ATOM_BROWSER_OSR_OSR_VIDEO_ENCODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/shared_memory.h"
+#include "base/time/time.h"
+#include "media/video/video_encode_accelerator.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/geometry/size.h"
+
+namespace atom {
+
+// Connects offscreen rendering output to the platform hardware video
+// encoder (Media Foundation on Windows, VideoToolbox on macOS, VAAPI on
+// Linux) through media::VideoEncodeAccelerator. Painted frames are
+// converted once to I420 and queued on the encoder; H.264 packets come
+// back through the packet callback. All methods and callbacks run on the
+// UI thread.
+class OffScreenVideoEncoder : public media::VideoEncodeAccelerator::Client {
+ public:
+  // |data| is only valid for the duration of the call.
+  using OnEncodedPacketCallback = base::Callback<void(const uint8_t* data,
+                                                      size_t size,
+                                                      base::TimeDelta timestamp,
+                                                      bool key_frame)>;
+  using OnEncodeErrorCallback = base::Callback<void()>;
+
+  OffScreenVideoEncoder(const OnEncodedPacketCallback& packet_callback,
+                        const OnEncodeErrorCallback& error_callback);
+  ~OffScreenVideoEncoder() override;
+
+  // Returns false when no hardware encoder is available for |size|.
+  bool Initialize(const gfx::Size& size, uint32_t bitrate);
+
+  // Converts |bitmap| to I420 and queues it for encoding. Frames that
+  // arrive before the encoder handed out its output buffers, or whose
+  // size does not match the initialized size, are dropped.
+  void EncodeFrame(const SkBitmap& bitmap, base::TimeTicks capture_time);
+
+  const gfx::Size& visible_size() const { return visible_size_; }
+
+  // media::VideoEncodeAccelerator::Client:
+  void RequireBitstreamBuffers(unsigned int input_count,
+                               const gfx::Size& input_coded_size,
+                               size_t output_buffer_size) override;
+  void BitstreamBufferReady(int32_t bitstream_buffer_id,
+                            size_t payload_size,
+                            bool key_frame,
+                            base::TimeDelta timestamp) override;
+  void NotifyError(media::VideoEncodeAccelerator::Error error) override;
+
+ private:
+  struct OutputBuffer {
+    std::unique_ptr<base::SharedMemory> memory;
+    size_t size;
+  };
+
+  const OnEncodedPacketCallback packet_callback_;
+  const OnEncodeErrorCallback error_callback_;
+
+  std::unique_ptr<media::VideoEncodeAccelerator> encoder_;
+  gfx::Size visible_size_;
+  gfx::Size input_coded_size_;
+  std::vector<OutputBuffer> output_buffers_;
+  base::TimeTicks start_time_;
+  bool ready_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(OffScreenVideoEncoder);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_OSR_OSR_VIDEO_ENCODER_H_
@@ -6,10 +6,17 @@
 
 namespace atom {
 
-OffscreenViewProxy::OffscreenViewProxy(views::View* view) : view_(view) {
-  view_bitmap_.reset(new SkBitmap);
+OffscreenSharedFrame::OffscreenSharedFrame(const SkBitmap& bitmap)
+    : bitmap_(bitmap) {
+  // Sharing the pixel ref is only safe if nobody draws into the pixels
+  // after the handoff.
+  bitmap_.setImmutable();
 }
 
+OffscreenSharedFrame::~OffscreenSharedFrame() {}
+
+OffscreenViewProxy::OffscreenViewProxy(views::View* view) : view_(view) {}
+
 OffscreenViewProxy::~OffscreenViewProxy() {
   if (observer_) {
     observer_->ProxyViewDestroyed(this);
@@ -27,14 +34,15 @@ void OffscreenViewProxy::RemoveObserver() {
   observer_ = nullptr;
 }
 
-const SkBitmap* OffscreenViewProxy::GetBitmap() const {
-  return view_bitmap_.get();
+scoped_refptr<OffscreenSharedFrame> OffscreenViewProxy::GetFrame() const {
+  return frame_;
 }
 
 void OffscreenViewProxy::SetBitmap(const SkBitmap& bitmap) {
   if (view_bounds_.width() == bitmap.width() &&
       view_bounds_.height() == bitmap.height() && observer_) {
-    view_bitmap_.reset(new SkBitmap(bitmap));
+    // The frame shares |bitmap|'s pixel ref; no pixels are copied.
+    frame_ = new OffscreenSharedFrame(bitmap);
     observer_->OnProxyViewPaint(view_bounds_);
   }
 }
@@ -7,6 +7,7 @@
 
 #include <set>
 
+#include "base/memory/ref_counted.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/events/event.h"
 #include "ui/gfx/geometry/rect.h"
@@ -16,6 +17,25 @@ namespace atom {
 
 class OffscreenViewProxy;
 
+// A refcounted, immutable frame shared between the view that painted it
+// and the embedding view that composites it. The handoff shares the
+// bitmap's pixel ref instead of copying pixels; consumers keep the frame
+// alive across a composite by holding a reference, even if the producer
+// publishes a new frame meanwhile.
+class OffscreenSharedFrame
+    : public base::RefCountedThreadSafe<OffscreenSharedFrame> {
+ public:
+  explicit OffscreenSharedFrame(const SkBitmap& bitmap);
+
+  const SkBitmap& bitmap() const { return bitmap_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<OffscreenSharedFrame>;
+  ~OffscreenSharedFrame();
+
+  SkBitmap bitmap_;
+};
+
 class OffscreenViewProxyObserver {
  public:
   virtual void OnProxyViewPaint(const gfx::Rect& damage_rect) = 0;
@@ -30,7 +50,7 @@ class OffscreenViewProxy {
   void SetObserver(OffscreenViewProxyObserver* observer);
   void RemoveObserver();
 
-  const SkBitmap* GetBitmap() const;
+  scoped_refptr<OffscreenSharedFrame> GetFrame() const;
   void SetBitmap(const SkBitmap& bitmap);
 
   const gfx::Rect& GetBounds();
@@ -44,7 +64,7 @@ class OffscreenViewProxy {
   views::View* view_;
 
   gfx::Rect view_bounds_;
-  std::unique_ptr<SkBitmap> view_bitmap_;
+  scoped_refptr<OffscreenSharedFrame> frame_;
 
   OffscreenViewProxyObserver* observer_ = nullptr;
 };
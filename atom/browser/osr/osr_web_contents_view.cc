@@ -103,9 +103,18 @@ OffScreenWebContentsView::CreateViewForWidget(
   }
 
   auto* relay = NativeWindowRelay::FromWebContents(web_contents_);
-  return new OffScreenRenderWidgetHostView(
+  auto* view = new OffScreenRenderWidgetHostView(
       transparent_, painting_, GetFrameRate(), callback_, render_widget_host,
       nullptr, relay->window.get());
+  if (!texture_callback_.is_null())
+    view->SetTexturePaintCallback(texture_callback_);
+  if (adaptive_frame_rate_)
+    view->SetAdaptiveFrameRate(true);
+  if (asynchronous_paint_dispatch_)
+    view->SetAsynchronousPaintDispatch(true);
+  if (paint_damaged_region_only_)
+    view->SetPaintDamagedRegionOnly(true);
+  return view;
 }
 
 content::RenderWidgetHostViewBase*
@@ -191,6 +200,14 @@ bool OffScreenWebContentsView::IsPainting() const {
   }
 }
 
+void OffScreenWebContentsView::SetTexturePaintCallback(
+    const OnTexturePaintCallback& callback) {
+  texture_callback_ = callback;
+  auto* view = GetView();
+  if (view != nullptr)
+    view->SetTexturePaintCallback(callback);
+}
+
 void OffScreenWebContentsView::SetFrameRate(int frame_rate) {
   auto* view = GetView();
   if (view != nullptr) {
@@ -209,6 +226,63 @@ int OffScreenWebContentsView::GetFrameRate() const {
   }
 }
 
+void OffScreenWebContentsView::SetAdaptiveFrameRate(bool adaptive) {
+  adaptive_frame_rate_ = adaptive;
+  auto* view = GetView();
+  if (view != nullptr)
+    view->SetAdaptiveFrameRate(adaptive);
+}
+
+bool OffScreenWebContentsView::UsesAdaptiveFrameRate() const {
+  auto* view = GetView();
+  if (view != nullptr) {
+    return view->UsesAdaptiveFrameRate();
+  } else {
+    return adaptive_frame_rate_;
+  }
+}
+
+void OffScreenWebContentsView::SetAsynchronousPaintDispatch(bool enabled) {
+  asynchronous_paint_dispatch_ = enabled;
+  auto* view = GetView();
+  if (view != nullptr)
+    view->SetAsynchronousPaintDispatch(enabled);
+}
+
+bool OffScreenWebContentsView::UsesAsynchronousPaintDispatch() const {
+  auto* view = GetView();
+  if (view != nullptr) {
+    return view->UsesAsynchronousPaintDispatch();
+  } else {
+    return asynchronous_paint_dispatch_;
+  }
+}
+
+void OffScreenWebContentsView::SetPaintDamagedRegionOnly(bool enabled) {
+  paint_damaged_region_only_ = enabled;
+  auto* view = GetView();
+  if (view != nullptr)
+    view->SetPaintDamagedRegionOnly(enabled);
+}
+
+bool OffScreenWebContentsView::PaintsDamagedRegionOnly() const {
+  auto* view = GetView();
+  if (view != nullptr) {
+    return view->PaintsDamagedRegionOnly();
+  } else {
+    return paint_damaged_region_only_;
+  }
+}
+
+int OffScreenWebContentsView::GetEffectiveFrameRate() const {
+  auto* view = GetView();
+  if (view != nullptr) {
+    return view->GetEffectiveFrameRate();
+  } else {
+    return frame_rate_;
+  }
+}
+
 OffScreenRenderWidgetHostView* OffScreenWebContentsView::GetView() const {
   if (web_contents_) {
     return static_cast<OffScreenRenderWidgetHostView*>(
@@ -71,8 +71,25 @@ class OffScreenWebContentsView : public content::WebContentsView,
 
   void SetPainting(bool painting);
   bool IsPainting() const;
+  // Exports composited frames as shared GPU textures instead of bitmap
+  // paints; see OnTexturePaintCallback in osr_output_device.h. Applies
+  // to the current view and any view created afterwards.
+  void SetTexturePaintCallback(const OnTexturePaintCallback& callback);
   void SetFrameRate(int frame_rate);
   int GetFrameRate() const;
+  void SetAdaptiveFrameRate(bool adaptive);
+  bool UsesAdaptiveFrameRate() const;
+  int GetEffectiveFrameRate() const;
+  // Routes paint callbacks through the triple-buffered dispatcher; see
+  // OffScreenRenderWidgetHostView::SetAsynchronousPaintDispatch().
+  // Applies to the current view and any view created afterwards.
+  void SetAsynchronousPaintDispatch(bool enabled);
+  bool UsesAsynchronousPaintDispatch() const;
+  // Delivers paints covering only the damaged subregion; see
+  // OffScreenRenderWidgetHostView::SetPaintDamagedRegionOnly().
+  // Applies to the current view and any view created afterwards.
+  void SetPaintDamagedRegionOnly(bool enabled);
+  bool PaintsDamagedRegionOnly() const;
 
  private:
 #if defined(OS_MACOSX)
@@ -85,7 +102,11 @@ class OffScreenWebContentsView : public content::WebContentsView,
   const bool transparent_;
   bool painting_ = true;
   int frame_rate_ = 60;
+  bool adaptive_frame_rate_ = false;
+  bool asynchronous_paint_dispatch_ = false;
+  bool paint_damaged_region_only_ = false;
   OnPaintCallback callback_;
+  OnTexturePaintCallback texture_callback_;
 
   // Weak refs.
   content::WebContents* web_contents_ = nullptr;
@@ -4,7 +4,10 @@
 
 #include "atom/browser/render_process_preferences.h"
 
+#include <vector>
+
 #include "atom/common/api/api_messages.h"
+#include "base/strings/string_number_conversions.h"
 #include "content/public/browser/notification_service.h"
 #include "content/public/browser/notification_types.h"
 #include "content/public/browser/render_process_host.h"
@@ -23,12 +26,19 @@ int RenderProcessPreferences::AddEntry(const base::DictionaryValue& entry) {
   int id = ++next_id_;
   entries_[id] = entry.CreateDeepCopy();
   cache_needs_update_ = true;
+  ++version_;
+  base::DictionaryValue added;
+  added.SetWithoutPathExpansion(base::IntToString(id), entry.CreateDeepCopy());
+  SendDelta(added, std::vector<int>());
   return id;
 }
 
 void RenderProcessPreferences::RemoveEntry(int id) {
+  if (entries_.erase(id) == 0)
+    return;
   cache_needs_update_ = true;
-  entries_.erase(id);
+  ++version_;
+  SendDelta(base::DictionaryValue(), std::vector<int>(1, id));
 }
 
 void RenderProcessPreferences::Observe(
@@ -43,7 +53,7 @@ void RenderProcessPreferences::Observe(
     return;
 
   UpdateCache();
-  process->Send(new AtomMsg_UpdatePreferences(cached_entries_));
+  process->Send(new AtomMsg_UpdatePreferences(version_, cached_entries_));
 }
 
 void RenderProcessPreferences::UpdateCache() {
@@ -52,8 +62,20 @@ void RenderProcessPreferences::UpdateCache() {
 
   cached_entries_.Clear();
   for (const auto& iter : entries_)
-    cached_entries_.Append(iter.second->CreateDeepCopy());
+    cached_entries_.SetWithoutPathExpansion(base::IntToString(iter.first),
+                                            iter.second->CreateDeepCopy());
   cache_needs_update_ = false;
 }
 
+void RenderProcessPreferences::SendDelta(const base::DictionaryValue& added,
+                                         const std::vector<int>& removed) {
+  for (auto iter = content::RenderProcessHost::AllHostsIterator();
+       !iter.IsAtEnd(); iter.Advance()) {
+    content::RenderProcessHost* process = iter.GetCurrentValue();
+    if (predicate_.Run(process))
+      process->Send(
+          new AtomMsg_UpdatePreferenceEntries(version_, added, removed));
+  }
+}
+
 }  // namespace atom
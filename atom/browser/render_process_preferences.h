@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/values.h"
@@ -40,6 +41,11 @@ class RenderProcessPreferences : public content::NotificationObserver {
 
   void UpdateCache();
 
+  // Sends an incremental change to every live render process accepted by
+  // the predicate, so mutations do not require re-sending all entries.
+  void SendDelta(const base::DictionaryValue& added,
+                 const std::vector<int>& removed);
+
   // Manages our notification registrations.
   content::NotificationRegistrar registrar_;
 
@@ -48,10 +54,14 @@ class RenderProcessPreferences : public content::NotificationObserver {
   int next_id_ = 0;
   std::unordered_map<int, std::unique_ptr<base::DictionaryValue>> entries_;
 
-  // We need to convert the |entries_| to ListValue for multiple times, this
-  // caches is only updated when we are sending messages.
+  // Incremented on every mutation; sent with every message so renderers can
+  // discard stale updates.
+  int version_ = 0;
+
+  // We need to convert the |entries_| to DictionaryValue for multiple times,
+  // this caches is only updated when we are sending messages.
   bool cache_needs_update_ = true;
-  base::ListValue cached_entries_;
+  base::DictionaryValue cached_entries_;
 
   DISALLOW_COPY_AND_ASSIGN(RenderProcessPreferences);
 };
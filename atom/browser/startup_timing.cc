@@ -0,0 +1,45 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/startup_timing.h"
+
+#include "base/lazy_instance.h"
+#include "base/process/process_info.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+
+namespace atom {
+
+namespace startup_timing {
+
+namespace {
+
+struct Timings {
+  base::Lock lock;
+  std::map<std::string, base::Time> marks;
+};
+
+base::LazyInstance<Timings>::Leaky g_timings = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void Mark(const std::string& name) {
+  Timings* timings = g_timings.Pointer();
+  base::AutoLock auto_lock(timings->lock);
+  timings->marks.emplace(name, base::Time::Now());
+}
+
+std::map<std::string, double> GetTimings() {
+  base::Time start = base::CurrentProcessInfo::CreationTime();
+  Timings* timings = g_timings.Pointer();
+  base::AutoLock auto_lock(timings->lock);
+  std::map<std::string, double> result;
+  for (const auto& pair : timings->marks)
+    result[pair.first] = (pair.second - start).InMillisecondsF();
+  return result;
+}
+
+}  // namespace startup_timing
+
+}  // namespace atom
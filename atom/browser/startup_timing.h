@@ -0,0 +1,28 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_STARTUP_TIMING_H_
+#define ATOM_BROWSER_STARTUP_TIMING_H_
+
+#include <map>
+#include <string>
+
+namespace atom {
+
+namespace startup_timing {
+
+// Records the current time under |name|. The first mark for a name
+// wins, so "one-time" events like the first window paint can be marked
+// from code that runs repeatedly.
+void Mark(const std::string& name);
+
+// All recorded marks, as milliseconds relative to process start. Used
+// by app.getStartupTimings().
+std::map<std::string, double> GetTimings();
+
+}  // namespace startup_timing
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_STARTUP_TIMING_H_
@@ -0,0 +1,89 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/browser/task_latency_metrics.h"
+
+#include <algorithm>
+
+#include "base/pending_task.h"
+
+namespace atom {
+
+namespace {
+
+// Index of the power-of-two bucket covering |value|.
+int BucketFor(uint64_t value) {
+  int bucket = 0;
+  while (value > 0 && bucket < TaskLatencyMetrics::kNumBuckets - 1) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+// Upper bound in microseconds of the bucket holding the |fraction|-th
+// quantile, or 0 when nothing has been recorded.
+double EstimatePercentileUs(const uint32_t* buckets,
+                            uint64_t count,
+                            double fraction) {
+  if (count == 0)
+    return 0;
+  uint64_t threshold = static_cast<uint64_t>(count * fraction);
+  uint64_t seen = 0;
+  for (int i = 0; i < TaskLatencyMetrics::kNumBuckets; ++i) {
+    seen += buckets[i];
+    if (seen > threshold)
+      return static_cast<double>(1ULL << i);
+  }
+  return static_cast<double>(1ULL << (TaskLatencyMetrics::kNumBuckets - 1));
+}
+
+}  // namespace
+
+// static
+TaskLatencyMetrics* TaskLatencyMetrics::GetInstance() {
+  return base::Singleton<TaskLatencyMetrics>::get();
+}
+
+TaskLatencyMetrics::TaskLatencyMetrics() = default;
+
+TaskLatencyMetrics::~TaskLatencyMetrics() = default;
+
+void TaskLatencyMetrics::WillProcessTask(
+    const base::PendingTask& pending_task) {
+  // For immediate tasks the latency is the time spent in the queue; for
+  // delayed tasks it is how far past the requested run time we are.
+  base::TimeTicks reference = pending_task.delayed_run_time.is_null()
+                                  ? pending_task.time_posted
+                                  : pending_task.delayed_run_time;
+  if (reference.is_null())
+    return;
+
+  base::TimeDelta latency = base::TimeTicks::Now() - reference;
+  if (latency < base::TimeDelta())
+    latency = base::TimeDelta();
+
+  count_++;
+  total_latency_ += latency;
+  max_latency_ = std::max(max_latency_, latency);
+  latency_buckets_[BucketFor(latency.InMicroseconds())]++;
+}
+
+void TaskLatencyMetrics::DidProcessTask(const base::PendingTask&) {}
+
+std::unique_ptr<base::DictionaryValue> TaskLatencyMetrics::GetMetrics() const {
+  auto result = std::make_unique<base::DictionaryValue>();
+  result->SetDouble("count", count_);
+  result->SetDouble("totalLatencyMs", total_latency_.InMillisecondsF());
+  result->SetDouble("maxLatencyMs", max_latency_.InMillisecondsF());
+  result->SetDouble("p50Us", EstimatePercentileUs(latency_buckets_, count_,
+                                                  0.50));
+  result->SetDouble("p95Us", EstimatePercentileUs(latency_buckets_, count_,
+                                                  0.95));
+  result->SetDouble("p99Us", EstimatePercentileUs(latency_buckets_, count_,
+                                                  0.99));
+  return result;
+}
+
+}  // namespace atom
@@ -0,0 +1,55 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_BROWSER_TASK_LATENCY_METRICS_H_
+#define ATOM_BROWSER_TASK_LATENCY_METRICS_H_
+
+#include <memory>
+
+#include "base/macros.h"
+#include "base/memory/singleton.h"
+#include "base/message_loop/message_loop.h"
+#include "base/time/time.h"
+#include "base/values.h"
+
+namespace atom {
+
+// Tracks how long browser main-thread tasks sit in the queue before
+// running, surfaced through app.getAppMetrics(). Installed as a
+// TaskObserver on the main message loop; the per-task cost is one clock
+// read and a bucket increment, cheap enough to leave on in production.
+// All access happens on the UI thread, so no locking is needed.
+class TaskLatencyMetrics : public base::MessageLoop::TaskObserver {
+ public:
+  // Number of power-of-two buckets in the latency histogram, bucket n
+  // counting latencies < 2^n microseconds.
+  static const int kNumBuckets = 24;
+
+  static TaskLatencyMetrics* GetInstance();
+
+  // base::MessageLoop::TaskObserver:
+  void WillProcessTask(const base::PendingTask& pending_task) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+  // Snapshot of the recorded latencies; percentiles are estimated from
+  // the bucket upper bounds.
+  std::unique_ptr<base::DictionaryValue> GetMetrics() const;
+
+ private:
+  friend struct base::DefaultSingletonTraits<TaskLatencyMetrics>;
+
+  TaskLatencyMetrics();
+  ~TaskLatencyMetrics() override;
+
+  uint64_t count_ = 0;
+  base::TimeDelta total_latency_;
+  base::TimeDelta max_latency_;
+  uint32_t latency_buckets_[kNumBuckets] = {};
+
+  DISALLOW_COPY_AND_ASSIGN(TaskLatencyMetrics);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_BROWSER_TASK_LATENCY_METRICS_H_
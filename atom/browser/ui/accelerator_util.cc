@@ -7,6 +7,7 @@
 #include <stdio.h>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "atom/common/keyboard_util.h"
@@ -17,8 +18,24 @@
 
 namespace accelerator_util {
 
-bool StringToAccelerator(const std::string& shortcut,
-                         ui::Accelerator* accelerator) {
+namespace {
+
+// Apps tend to rebuild menus wholesale, re-parsing the same handful of
+// accelerator strings on every rebuild, so keep the parsed results around.
+// Only used on the UI thread, where all accelerators are converted.
+using AcceleratorCache = std::unordered_map<std::string, ui::Accelerator>;
+
+// Bounds memory in the face of generated accelerator strings; real apps
+// stay far below this.
+const size_t kMaxAcceleratorCacheSize = 256;
+
+AcceleratorCache& GetAcceleratorCache() {
+  static AcceleratorCache* cache = new AcceleratorCache;
+  return *cache;
+}
+
+bool ParseAccelerator(const std::string& shortcut,
+                      ui::Accelerator* accelerator) {
   if (!base::IsStringASCII(shortcut)) {
     LOG(ERROR) << "The accelerator string can only contain ASCII characters";
     return false;
@@ -68,6 +85,26 @@ bool StringToAccelerator(const std::string& shortcut,
   return true;
 }
 
+}  // namespace
+
+bool StringToAccelerator(const std::string& shortcut,
+                         ui::Accelerator* accelerator) {
+  AcceleratorCache& cache = GetAcceleratorCache();
+  auto iter = cache.find(shortcut);
+  if (iter != cache.end()) {
+    *accelerator = iter->second;
+    return true;
+  }
+
+  if (!ParseAccelerator(shortcut, accelerator))
+    return false;
+
+  if (cache.size() >= kMaxAcceleratorCacheSize)
+    cache.clear();
+  cache[shortcut] = *accelerator;
+  return true;
+}
+
 void GenerateAcceleratorTable(AcceleratorTable* table,
                               atom::AtomMenuModel* model) {
   int count = model->GetItemCount();
@@ -119,6 +119,14 @@ void AutofillPopup::CreateView(content::RenderFrameHost* frame_host,
                                bool offscreen,
                                views::View* parent,
                                const gfx::RectF& r) {
+  // Reuse the existing view when the popup is already showing for this
+  // frame; the following SetItems() diffs the content and moves the widget
+  // instead of tearing the whole popup down and rebuilding it.
+  if (view_ && frame_host_ == frame_host && parent_ == parent) {
+    element_bounds_ = gfx::ToEnclosedRect(r);
+    return;
+  }
+
   Hide();
 
   frame_host_ = frame_host;
@@ -163,12 +171,20 @@ void AutofillPopup::Hide() {
 void AutofillPopup::SetItems(const std::vector<base::string16>& values,
                              const std::vector<base::string16>& labels) {
   DCHECK(view_);
+  const bool items_changed = values != values_ || labels != labels_;
   values_ = values;
   labels_ = labels;
+  const gfx::Rect old_bounds = popup_bounds_;
   UpdatePopupBounds();
-  view_->OnSuggestionsChanged();
-  if (view_)  // could be hidden after the change
+  if (items_changed) {
+    view_->OnSuggestionsChanged();
+    if (view_)  // could be hidden after the change
+      view_->DoUpdateBoundsAndRedrawPopup();
+  } else if (popup_bounds_ != old_bounds) {
+    // Same suggestions at a new position: move the widget without rebuilding
+    // the child views.
     view_->DoUpdateBoundsAndRedrawPopup();
+  }
 }
 
 void AutofillPopup::AcceptSuggestion(int index) {
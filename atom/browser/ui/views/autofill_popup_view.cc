@@ -222,7 +222,8 @@ void AutofillPopupView::DoUpdateBoundsAndRedrawPopup() {
   if (!popup_)
     return;
 
-  GetWidget()->SetBounds(popup_->popup_bounds_);
+  if (GetWidget()->GetWindowBoundsInScreen() != popup_->popup_bounds_)
+    GetWidget()->SetBounds(popup_->popup_bounds_);
 #if defined(ENABLE_OSR)
   if (view_proxy_.get()) {
     view_proxy_->SetBounds(popup_->popup_bounds_in_view());
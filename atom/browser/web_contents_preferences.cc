@@ -56,6 +56,7 @@ WebContentsPreferences::WebContentsPreferences(
   SetDefaultBoolIfUndefined(options::kExperimentalCanvasFeatures, false);
   bool node = SetDefaultBoolIfUndefined(options::kNodeIntegration, true);
   SetDefaultBoolIfUndefined(options::kNodeIntegrationInWorker, false);
+  SetDefaultBoolIfUndefined(options::kRecycleWorkerEnvironments, false);
   SetDefaultBoolIfUndefined(options::kWebviewTag, node);
   SetDefaultBoolIfUndefined(options::kSandbox, false);
   SetDefaultBoolIfUndefined(options::kNativeWindowOpen, false);
@@ -152,6 +153,10 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (dict_.GetBoolean(options::kNodeIntegrationInWorker, &b) && b)
     command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
 
+  // Whether to keep worker node environment scaffolding warm between workers.
+  if (dict_.GetBoolean(options::kRecycleWorkerEnvironments, &b) && b)
+    command_line->AppendSwitch(switches::kRecycleWorkerEnvironments);
+
   // Check if webview tag creation is enabled, default to nodeIntegration value.
   // TODO(kevinsawicki): Default to false in 2.0
   bool webview_tag = node_integration;
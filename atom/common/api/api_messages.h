@@ -5,6 +5,7 @@
 // Multiply-included file, no traditional include guard.
 
 #include "atom/common/draggable_region.h"
+#include "base/memory/shared_memory_handle.h"
 #include "base/strings/string16.h"
 #include "base/values.h"
 #include "content/public/common/common_param_traits.h"
@@ -28,18 +29,73 @@ IPC_MESSAGE_ROUTED2(AtomFrameHostMsg_Message,
                     base::string16 /* channel */,
                     base::ListValue /* arguments */)
 
+// Structured-clone variant of AtomFrameHostMsg_Message: the arguments
+// are encoded once with v8::ValueSerializer in the renderer and decoded
+// once at the destination, skipping base::Value entirely.
+IPC_MESSAGE_ROUTED2(AtomFrameHostMsg_Message_Serialized,
+                    base::string16 /* channel */,
+                    std::string /* arguments (structured clone) */)
+
 IPC_SYNC_MESSAGE_ROUTED2_1(AtomFrameHostMsg_Message_Sync,
                            base::string16 /* channel */,
                            base::ListValue /* arguments */,
                            base::ListValue /* result */)
 
+// Carries a binary payload in shared memory instead of going through
+// base::Value serialization, so large buffers are not copied per hop.
+IPC_MESSAGE_ROUTED3(AtomFrameHostMsg_SharedBufferMessage,
+                    base::string16 /* channel */,
+                    base::SharedMemoryHandle /* buffer */,
+                    uint32_t /* size */)
+
+// Chunked transfer of a binary payload too large for one message (or
+// one shared memory region). StreamBegin opens the stream, each
+// StreamChunk appends a bounded slice, StreamEnd closes it once the
+// browser has acknowledged every byte. The browser acks received bytes
+// with AtomFrameMsg_StreamAck so the renderer keeps only a fixed window
+// of chunks in flight; see atom::IPCStreamSender.
+IPC_MESSAGE_ROUTED3(AtomFrameHostMsg_StreamBegin,
+                    base::string16 /* channel */,
+                    int32_t /* stream_id */,
+                    uint64_t /* total_size */)
+
+IPC_MESSAGE_ROUTED2(AtomFrameHostMsg_StreamChunk,
+                    int32_t /* stream_id */,
+                    std::string /* data */)
+
+IPC_MESSAGE_ROUTED1(AtomFrameHostMsg_StreamEnd, int32_t /* stream_id */)
+
+IPC_MESSAGE_ROUTED2(AtomFrameMsg_StreamAck,
+                    int32_t /* stream_id */,
+                    uint64_t /* bytes_received */)
+
+// Sent once by a renderer to set up a telemetry ring buffer (see
+// atom::SharedMemoryRingBuffer). The browser creates the region, drains
+// it on a timer and replies with a handle the renderer maps writable;
+// after this no per-sample IPC is needed.
+IPC_SYNC_MESSAGE_ROUTED1_2(AtomFrameHostMsg_CreateTelemetryBuffer,
+                           uint32_t /* requested_size */,
+                           base::SharedMemoryHandle /* buffer */,
+                           uint32_t /* actual_size */)
+
 IPC_MESSAGE_ROUTED3(AtomFrameMsg_Message,
                     bool /* send_to_all */,
                     base::string16 /* channel */,
                     base::ListValue /* arguments */)
 
+// Sent by webContents.sendToFrame() straight to the target RenderFrame;
+// unlike AtomFrameMsg_Message it is delivered to subframes without a
+// relay through the main frame.
+IPC_MESSAGE_ROUTED2(AtomFrameMsg_MessageToFrame,
+                    base::string16 /* channel */,
+                    base::ListValue /* arguments */)
+
 IPC_MESSAGE_ROUTED0(AtomViewMsg_Offscreen)
 
+// Makes the renderer behave as if under memory pressure; |level| is a
+// base::MemoryPressureListener::MemoryPressureLevel.
+IPC_MESSAGE_ROUTED1(AtomViewMsg_MemoryPressure, int32_t /* level */)
+
 IPC_MESSAGE_ROUTED3(AtomAutofillFrameHostMsg_ShowPopup,
                     gfx::RectF /* bounds */,
                     std::vector<base::string16> /* values */,
@@ -54,8 +110,24 @@ IPC_MESSAGE_ROUTED1(AtomAutofillFrameMsg_AcceptSuggestion,
 IPC_MESSAGE_ROUTED1(AtomFrameHostMsg_UpdateDraggableRegions,
                     std::vector<atom::DraggableRegion> /* regions */)
 
-// Update renderer process preferences.
-IPC_MESSAGE_CONTROL1(AtomMsg_UpdatePreferences, base::ListValue)
+// Replace the full set of renderer process preferences, keyed by entry id.
+IPC_MESSAGE_CONTROL2(AtomMsg_UpdatePreferences,
+                     int /* version */,
+                     base::DictionaryValue /* entries by id */)
+
+// Apply an incremental change to the renderer process preferences.
+IPC_MESSAGE_CONTROL3(AtomMsg_UpdatePreferenceEntries,
+                     int /* version */,
+                     base::DictionaryValue /* added or changed, by id */,
+                     std::vector<int> /* removed ids */)
+
+// Add/remove a session-level stylesheet that is inserted into every new
+// document created in the process.
+IPC_MESSAGE_CONTROL2(AtomMsg_AddInjectedStylesheet,
+                     int /* key */,
+                     std::string /* css */)
+
+IPC_MESSAGE_CONTROL1(AtomMsg_RemoveInjectedStylesheet, int /* key */)
 
 // Sent by renderer to set the temporary zoom level.
 IPC_SYNC_MESSAGE_ROUTED1_1(AtomFrameHostMsg_SetTemporaryZoomLevel,
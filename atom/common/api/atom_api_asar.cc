@@ -4,8 +4,13 @@
 
 #include <stddef.h>
 
+#include <memory>
+#include <utility>
 #include <vector>
 
+#include "base/task_scheduler/post_task.h"
+
+#include "atom/common/api/v8_code_cache.h"
 #include "atom/common/asar/archive.h"
 #include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
@@ -23,7 +28,7 @@ class Archive : public mate::Wrappable<Archive> {
  public:
   static v8::Local<v8::Value> Create(v8::Isolate* isolate,
                                      const base::FilePath& path) {
-    auto archive = std::make_unique<asar::Archive>(path);
+    auto archive = std::make_shared<asar::Archive>(path);
     if (!archive->Init())
       return v8::False(isolate);
     return (new Archive(isolate, std::move(archive)))->GetWrapper();
@@ -36,19 +41,47 @@ class Archive : public mate::Wrappable<Archive> {
         .SetProperty("path", &Archive::GetPath)
         .SetMethod("getFileInfo", &Archive::GetFileInfo)
         .SetMethod("stat", &Archive::Stat)
+        .SetMethod("statMany", &Archive::StatMany)
+        .SetMethod("statManyAsync", &Archive::StatManyAsync)
+        .SetMethod("existsMany", &Archive::ExistsMany)
         .SetMethod("readdir", &Archive::Readdir)
+        .SetMethod("readdirMany", &Archive::ReaddirMany)
+        .SetMethod("readdirManyAsync", &Archive::ReaddirManyAsync)
         .SetMethod("realpath", &Archive::Realpath)
+        .SetMethod("readFile", &Archive::ReadFile)
         .SetMethod("copyFileOut", &Archive::CopyFileOut)
         .SetMethod("getFd", &Archive::GetFD)
         .SetMethod("destroy", &Archive::Destroy);
   }
 
  protected:
-  Archive(v8::Isolate* isolate, std::unique_ptr<asar::Archive> archive)
+  Archive(v8::Isolate* isolate, std::shared_ptr<asar::Archive> archive)
       : archive_(std::move(archive)) {
     Init(isolate);
   }
 
+  // Results of a batched lookup, computed on a worker thread. The Stats
+  // and file lists are plain data so they can cross threads freely.
+  struct BatchStats {
+    bool found = false;
+    asar::Archive::Stats stats;
+  };
+  struct BatchReaddir {
+    bool found = false;
+    std::vector<base::FilePath> files;
+  };
+
+  static v8::Local<v8::Value> BuildStatsDict(
+      v8::Isolate* isolate, const asar::Archive::Stats& stats) {
+    mate::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("size", stats.size);
+    dict.Set("offset", stats.offset);
+    dict.Set("isFile", stats.is_file);
+    dict.Set("isDirectory", stats.is_directory);
+    dict.Set("isLink", stats.is_link);
+    return dict.GetHandle();
+  }
+
   // Returns the path of the file.
   base::FilePath GetPath() { return archive_->path(); }
 
@@ -61,6 +94,7 @@ class Archive : public mate::Wrappable<Archive> {
     mate::Dictionary dict(isolate, v8::Object::New(isolate));
     dict.Set("size", info.size);
     dict.Set("unpacked", info.unpacked);
+    dict.Set("compressed", info.compressed);
     dict.Set("offset", info.offset);
     return dict.GetHandle();
   }
@@ -70,13 +104,85 @@ class Archive : public mate::Wrappable<Archive> {
     asar::Archive::Stats stats;
     if (!archive_ || !archive_->Stat(path, &stats))
       return v8::False(isolate);
-    mate::Dictionary dict(isolate, v8::Object::New(isolate));
-    dict.Set("size", stats.size);
-    dict.Set("offset", stats.offset);
-    dict.Set("isFile", stats.is_file);
-    dict.Set("isDirectory", stats.is_directory);
-    dict.Set("isLink", stats.is_link);
-    return dict.GetHandle();
+    return BuildStatsDict(isolate, stats);
+  }
+
+  // Stats every path in one call, so warming up the module loader does
+  // not pay a JS->C++ round trip per path. Missing entries come back as
+  // false, matching the single-path method.
+  v8::Local<v8::Value> StatMany(v8::Isolate* isolate,
+                                const std::vector<base::FilePath>& paths) {
+    if (!archive_)
+      return v8::False(isolate);
+    v8::Local<v8::Array> result = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      asar::Archive::Stats stats;
+      result->Set(i, archive_->Stat(paths[i], &stats)
+                         ? BuildStatsDict(isolate, stats)
+                         : v8::Local<v8::Value>(v8::False(isolate)));
+    }
+    return result;
+  }
+
+  // Like statMany, but the lookups run on a worker thread and the
+  // result array is delivered to |callback|. The index is immutable
+  // after Init so lookups are safe off the main thread; the archive is
+  // kept alive by the bound shared_ptr even if destroy() races.
+  void StatManyAsync(
+      v8::Isolate* isolate,
+      const std::vector<base::FilePath>& paths,
+      const base::Callback<void(v8::Local<v8::Value>)>& callback) {
+    if (!archive_) {
+      callback.Run(v8::False(isolate));
+      return;
+    }
+    base::PostTaskWithTraitsAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::Bind(&Archive::DoStatMany, archive_, paths),
+        base::Bind(&Archive::OnStatMany, isolate, callback));
+  }
+
+  static std::vector<BatchStats> DoStatMany(
+      std::shared_ptr<asar::Archive> archive,
+      const std::vector<base::FilePath>& paths) {
+    std::vector<BatchStats> results(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+      results[i].found = archive->Stat(paths[i], &results[i].stats);
+    return results;
+  }
+
+  static void OnStatMany(
+      v8::Isolate* isolate,
+      const base::Callback<void(v8::Local<v8::Value>)>& callback,
+      std::vector<BatchStats> results) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Array> array = v8::Array::New(isolate, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      array->Set(i, results[i].found
+                        ? BuildStatsDict(isolate, results[i].stats)
+                        : v8::Local<v8::Value>(v8::False(isolate)));
+    }
+    callback.Run(array);
+  }
+
+  // Answers "which of these paths exist" in one call, returning an
+  // array of codes matching internalModuleStat's contract: 0 for a
+  // file, 1 for a directory, -34 (-ENOENT) for a missing path. Cheaper
+  // than statMany when the caller only needs existence, since no Stats
+  // dictionaries are built for the (mostly missing) probes.
+  v8::Local<v8::Value> ExistsMany(v8::Isolate* isolate,
+                                  const std::vector<base::FilePath>& paths) {
+    if (!archive_)
+      return v8::False(isolate);
+    v8::Local<v8::Array> result = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      asar::Archive::Stats stats;
+      int code = -34;  // -ENOENT
+      if (archive_->Stat(paths[i], &stats))
+        code = stats.is_directory ? 1 : 0;
+      result->Set(i, v8::Integer::New(isolate, code));
+    }
+    return result;
   }
 
   // Returns all files under a directory.
@@ -88,6 +194,59 @@ class Archive : public mate::Wrappable<Archive> {
     return mate::ConvertToV8(isolate, files);
   }
 
+  // Batched variant of readdir; missing directories come back as false.
+  v8::Local<v8::Value> ReaddirMany(v8::Isolate* isolate,
+                                   const std::vector<base::FilePath>& paths) {
+    if (!archive_)
+      return v8::False(isolate);
+    v8::Local<v8::Array> result = v8::Array::New(isolate, paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+      std::vector<base::FilePath> files;
+      result->Set(i, archive_->Readdir(paths[i], &files)
+                         ? mate::ConvertToV8(isolate, files)
+                         : v8::Local<v8::Value>(v8::False(isolate)));
+    }
+    return result;
+  }
+
+  // Async variant of readdirMany; see statManyAsync for threading notes.
+  void ReaddirManyAsync(
+      v8::Isolate* isolate,
+      const std::vector<base::FilePath>& paths,
+      const base::Callback<void(v8::Local<v8::Value>)>& callback) {
+    if (!archive_) {
+      callback.Run(v8::False(isolate));
+      return;
+    }
+    base::PostTaskWithTraitsAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::Bind(&Archive::DoReaddirMany, archive_, paths),
+        base::Bind(&Archive::OnReaddirMany, isolate, callback));
+  }
+
+  static std::vector<BatchReaddir> DoReaddirMany(
+      std::shared_ptr<asar::Archive> archive,
+      const std::vector<base::FilePath>& paths) {
+    std::vector<BatchReaddir> results(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i)
+      results[i].found = archive->Readdir(paths[i], &results[i].files);
+    return results;
+  }
+
+  static void OnReaddirMany(
+      v8::Isolate* isolate,
+      const base::Callback<void(v8::Local<v8::Value>)>& callback,
+      std::vector<BatchReaddir> results) {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Array> array = v8::Array::New(isolate, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      array->Set(i, results[i].found
+                        ? mate::ConvertToV8(isolate, results[i].files)
+                        : v8::Local<v8::Value>(v8::False(isolate)));
+    }
+    callback.Run(array);
+  }
+
   // Returns the path of file with symbol link resolved.
   v8::Local<v8::Value> Realpath(v8::Isolate* isolate,
                                 const base::FilePath& path) {
@@ -97,6 +256,19 @@ class Archive : public mate::Wrappable<Archive> {
     return mate::ConvertToV8(isolate, realpath);
   }
 
+  // Reads the decompressed contents of a packed file into a Buffer.
+  v8::Local<v8::Value> ReadFile(v8::Isolate* isolate,
+                                const base::FilePath& path) {
+    asar::Archive::FileInfo info;
+    if (!archive_ || !archive_->GetFileInfo(path, &info) || info.unpacked)
+      return v8::False(isolate);
+    std::string contents;
+    if (!archive_->ReadFile(info, &contents))
+      return v8::False(isolate);
+    return node::Buffer::Copy(isolate, contents.data(), contents.size())
+        .ToLocalChecked();
+  }
+
   // Copy the file out into a temporary file and returns the new path.
   v8::Local<v8::Value> CopyFileOut(v8::Isolate* isolate,
                                    const base::FilePath& path) {
@@ -117,7 +289,7 @@ class Archive : public mate::Wrappable<Archive> {
   void Destroy() { archive_.reset(); }
 
  private:
-  std::unique_ptr<asar::Archive> archive_;
+  std::shared_ptr<asar::Archive> archive_;
 
   DISALLOW_COPY_AND_ASSIGN(Archive);
 };
@@ -125,9 +297,13 @@ class Archive : public mate::Wrappable<Archive> {
 void InitAsarSupport(v8::Isolate* isolate,
                      v8::Local<v8::Value> process,
                      v8::Local<v8::Value> require) {
-  // Evaluate asar_init.js.
+  // Evaluate asar_init.js, consuming the persistent code cache when one
+  // is available.
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
   v8::Local<v8::Script> asar_init =
-      v8::Script::Compile(node::asar_init_value.ToStringChecked(isolate));
+      atom::code_cache::Compile(context, "asar_init",
+                                node::asar_init_value.ToStringChecked(isolate))
+          .ToLocalChecked();
   v8::Local<v8::Value> result = asar_init->Run();
 
   // Initialize asar support.
@@ -4,13 +4,22 @@
 
 #include "atom/common/api/atom_api_clipboard.h"
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "atom/common/api/locker.h"
+#include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/image_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_scheduler/post_task.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixmap.h"
 #include "ui/base/clipboard/scoped_clipboard_writer.h"
+#include "ui/gfx/codec/png_codec.h"
 
 #include "atom/common/node_includes.h"
 
@@ -18,6 +27,71 @@ namespace atom {
 
 namespace api {
 
+namespace {
+
+using ReadCallback = base::Callback<void(v8::Local<v8::Value>)>;
+using DeferredProvider =
+    base::Callback<v8::Local<v8::Value>(const std::string&)>;
+
+// The pending writeDeferred() providers. Only one deferred write can own
+// the clipboard at a time, matching the platform clipboards themselves;
+// a later write (deferred or not) replaces it.
+struct DeferredWrite {
+  v8::Isolate* isolate = nullptr;
+  DeferredProvider provider;
+};
+
+DeferredWrite* g_deferred_write = nullptr;
+
+void FreeStdString(char* data, void* hint) {
+  delete static_cast<std::string*>(hint);
+}
+
+// Runs on a worker thread; the encoded payload is the only input so no
+// clipboard state is touched off the clipboard's own thread.
+SkBitmap DecodeClipboardImageOnWorker(const std::string& data) {
+  SkBitmap bitmap;
+  gfx::PNGCodec::Decode(reinterpret_cast<const unsigned char*>(data.data()),
+                        data.size(), &bitmap);
+  return bitmap;
+}
+
+void RunBitmapReadCallback(v8::Isolate* isolate,
+                           const ReadCallback& callback,
+                           const SkBitmap& bitmap) {
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  callback.Run(
+      mate::ConvertToV8(isolate, gfx::Image::CreateFrom1xBitmap(bitmap)));
+}
+
+void RunImageReadCallback(v8::Isolate* isolate,
+                          const ReadCallback& callback,
+                          const gfx::Image& image) {
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  callback.Run(mate::ConvertToV8(isolate, image));
+}
+
+void RunBufferReadCallback(v8::Isolate* isolate,
+                           const ReadCallback& callback,
+                           std::unique_ptr<std::string> data) {
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (data->empty()) {
+    callback.Run(node::Buffer::New(isolate, 0).ToLocalChecked());
+    return;
+  }
+  // Hand the payload to JS without another copy; the string is freed when
+  // the Buffer is collected.
+  std::string* raw = data.release();
+  callback.Run(node::Buffer::New(isolate, &(*raw)[0], raw->size(),
+                                 &FreeStdString, raw)
+                   .ToLocalChecked());
+}
+
+}  // namespace
+
 ui::ClipboardType Clipboard::GetClipboardType(mate::Arguments* args) {
   std::string type;
   if (args->GetNext(&type) && type == "selection")
@@ -56,6 +130,25 @@ v8::Local<v8::Value> Clipboard::ReadBuffer(const std::string& format_string,
       .ToLocalChecked();
 }
 
+void Clipboard::ReadBufferAsync(const std::string& format_string,
+                                mate::Arguments* args) {
+  ReadCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  // Platform clipboards are thread-affine, so the transfer itself has to
+  // happen here; unlike readBuffer the payload is handed to JS without an
+  // extra copy and the callback runs in a later task.
+  auto data = std::make_unique<std::string>();
+  ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
+  clipboard->ReadData(ui::Clipboard::GetFormatType(format_string), data.get());
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::Bind(&RunBufferReadCallback, args->isolate(), callback,
+                            base::Passed(&data)));
+}
+
 void Clipboard::WriteBuffer(const std::string& format,
                             const v8::Local<v8::Value> buffer,
                             mate::Arguments* args) {
@@ -93,6 +186,67 @@ void Clipboard::Write(const mate::Dictionary& data, mate::Arguments* args) {
     writer.WriteImage(image.AsBitmap());
 }
 
+void Clipboard::WriteDeferred(mate::Arguments* args) {
+  std::vector<std::string> formats;
+  DeferredProvider provider;
+  if (!args->GetNext(&formats) || !args->GetNext(&provider)) {
+    args->ThrowError();
+    return;
+  }
+  if (formats.empty()) {
+    args->ThrowError("formats must not be empty");
+    return;
+  }
+
+  delete g_deferred_write;
+  g_deferred_write = new DeferredWrite;
+  g_deferred_write->isolate = args->isolate();
+  g_deferred_write->provider = provider;
+
+  if (PlatformWriteDeferred(formats))
+    return;
+
+  // No deferral mechanism on this platform; render every format now so
+  // the clipboard still ends up with the same contents.
+  ui::ScopedClipboardWriter writer(ui::CLIPBOARD_TYPE_COPY_PASTE);
+  for (const auto& format : formats) {
+    std::string data = RenderDeferredFormat(format);
+    writer.WriteData(data.data(), data.size(),
+                     ui::Clipboard::GetFormatType(format));
+  }
+  delete g_deferred_write;
+  g_deferred_write = nullptr;
+}
+
+// static
+std::string Clipboard::RenderDeferredFormat(const std::string& format) {
+  if (!g_deferred_write)
+    return std::string();
+
+  v8::Isolate* isolate = g_deferred_write->isolate;
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Value> result = g_deferred_write->provider.Run(format);
+  if (result.IsEmpty())
+    return std::string();
+  if (node::Buffer::HasInstance(result))
+    return std::string(node::Buffer::Data(result),
+                       node::Buffer::Length(result));
+  std::string data;
+  mate::ConvertFromV8(isolate, result, &data);
+  return data;
+}
+
+#if !defined(OS_WIN) && !defined(OS_MACOSX)
+// static
+bool Clipboard::PlatformWriteDeferred(
+    const std::vector<std::string>& formats) {
+  // The X11 clipboard is owned by Chromium's own selection owner, which
+  // offers no hook to render formats on request.
+  return false;
+}
+#endif
+
 base::string16 Clipboard::ReadText(mate::Arguments* args) {
   base::string16 data;
   ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
@@ -167,6 +321,41 @@ gfx::Image Clipboard::ReadImage(mate::Arguments* args) {
   return gfx::Image::CreateFrom1xBitmap(bitmap);
 }
 
+void Clipboard::ReadImageAsync(mate::Arguments* args) {
+  ui::ClipboardType type = GetClipboardType(args);
+  ReadCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  ui::Clipboard* clipboard = ui::Clipboard::GetForCurrentThread();
+
+  // Pull only the encoded PNG payload here; the expensive decode runs on
+  // the worker pool.
+  ui::Clipboard::FormatType png_format =
+      ui::Clipboard::GetFormatType(ui::Clipboard::kMimeTypePNG);
+  std::string png_data;
+  if (clipboard->IsFormatAvailable(png_format, type))
+    clipboard->ReadData(png_format, &png_data);
+
+  if (png_data.empty()) {
+    // No encoded payload on the clipboard; fall back to the synchronous
+    // platform read and reply in a later task.
+    gfx::Image image =
+        gfx::Image::CreateFrom1xBitmap(clipboard->ReadImage(type));
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::Bind(&RunImageReadCallback, args->isolate(), callback, image));
+    return;
+  }
+
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::Bind(&DecodeClipboardImageOnWorker, base::Passed(&png_data)),
+      base::Bind(&RunBitmapReadCallback, args->isolate(), callback));
+}
+
 void Clipboard::WriteImage(const gfx::Image& image, mate::Arguments* args) {
   ui::ScopedClipboardWriter writer(GetClipboardType(args));
   SkBitmap orig = image.AsBitmap();
@@ -204,6 +393,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("has", &atom::api::Clipboard::Has);
   dict.SetMethod("read", &atom::api::Clipboard::Read);
   dict.SetMethod("write", &atom::api::Clipboard::Write);
+  dict.SetMethod("writeDeferred", &atom::api::Clipboard::WriteDeferred);
   dict.SetMethod("readText", &atom::api::Clipboard::ReadText);
   dict.SetMethod("writeText", &atom::api::Clipboard::WriteText);
   dict.SetMethod("readRTF", &atom::api::Clipboard::ReadRTF);
@@ -213,10 +403,12 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("readBookmark", &atom::api::Clipboard::ReadBookmark);
   dict.SetMethod("writeBookmark", &atom::api::Clipboard::WriteBookmark);
   dict.SetMethod("readImage", &atom::api::Clipboard::ReadImage);
+  dict.SetMethod("_readImageAsync", &atom::api::Clipboard::ReadImageAsync);
   dict.SetMethod("writeImage", &atom::api::Clipboard::WriteImage);
   dict.SetMethod("readFindText", &atom::api::Clipboard::ReadFindText);
   dict.SetMethod("writeFindText", &atom::api::Clipboard::WriteFindText);
   dict.SetMethod("readBuffer", &atom::api::Clipboard::ReadBuffer);
+  dict.SetMethod("_readBufferAsync", &atom::api::Clipboard::ReadBufferAsync);
   dict.SetMethod("writeBuffer", &atom::api::Clipboard::WriteBuffer);
   dict.SetMethod("clear", &atom::api::Clipboard::Clear);
 }
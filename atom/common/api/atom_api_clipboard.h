@@ -26,6 +26,13 @@ class Clipboard {
 
   static std::string Read(const std::string& format_string);
   static void Write(const mate::Dictionary& data, mate::Arguments* args);
+  static void WriteDeferred(mate::Arguments* args);
+
+  // Produces the payload for |format| of the pending deferred write by
+  // running its JS provider, or an empty string when no deferred write is
+  // active. Called from the platform clipboard when a paste requests the
+  // format.
+  static std::string RenderDeferredFormat(const std::string& format);
 
   static base::string16 ReadText(mate::Arguments* args);
   static void WriteText(const base::string16& text, mate::Arguments* args);
@@ -42,6 +49,7 @@ class Clipboard {
                             mate::Arguments* args);
 
   static gfx::Image ReadImage(mate::Arguments* args);
+  static void ReadImageAsync(mate::Arguments* args);
   static void WriteImage(const gfx::Image& image, mate::Arguments* args);
 
   static base::string16 ReadFindText();
@@ -49,11 +57,19 @@ class Clipboard {
 
   static v8::Local<v8::Value> ReadBuffer(const std::string& format_string,
                                          mate::Arguments* args);
+  static void ReadBufferAsync(const std::string& format_string,
+                              mate::Arguments* args);
   static void WriteBuffer(const std::string& format_string,
                           const v8::Local<v8::Value> buffer,
                           mate::Arguments* args);
 
  private:
+  // Registers |formats| on the platform clipboard without payloads,
+  // arranging for RenderDeferredFormat to be asked when a paste requests
+  // one. Returns false when the platform has no deferral mechanism, in
+  // which case the caller renders everything eagerly.
+  static bool PlatformWriteDeferred(const std::vector<std::string>& formats);
+
   DISALLOW_COPY_AND_ASSIGN(Clipboard);
 };
 
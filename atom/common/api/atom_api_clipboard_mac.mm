@@ -6,10 +6,38 @@
 #include "base/strings/sys_string_conversions.h"
 #include "ui/base/cocoa/find_pasteboard.h"
 
+// Owner of the general pasteboard during a deferred write; AppKit calls
+// back when a paste requests one of the declared types.
+@interface AtomDeferredClipboardOwner : NSObject
+@end
+
+@implementation AtomDeferredClipboardOwner
+
+- (void)pasteboard:(NSPasteboard*)sender provideDataForType:(NSString*)type {
+  std::string data = atom::api::Clipboard::RenderDeferredFormat(
+      base::SysNSStringToUTF8(type));
+  [sender setData:[NSData dataWithBytes:data.data() length:data.size()]
+          forType:type];
+}
+
+@end
+
 namespace atom {
 
 namespace api {
 
+// static
+bool Clipboard::PlatformWriteDeferred(
+    const std::vector<std::string>& formats) {
+  static AtomDeferredClipboardOwner* owner =
+      [[AtomDeferredClipboardOwner alloc] init];
+  NSMutableArray* types = [NSMutableArray arrayWithCapacity:formats.size()];
+  for (const auto& format : formats)
+    [types addObject:base::SysUTF8ToNSString(format)];
+  [[NSPasteboard generalPasteboard] declareTypes:types owner:owner];
+  return true;
+}
+
 void Clipboard::WriteFindText(const base::string16& text) {
   NSString* text_ns = base::SysUTF16ToNSString(text);
   [[FindPasteboard sharedInstance] setFindText:text_ns];
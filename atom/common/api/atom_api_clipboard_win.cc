@@ -0,0 +1,110 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/api/atom_api_clipboard.h"
+
+#include <windows.h>
+
+#include <map>
+
+#include "base/strings/utf_string_conversions.h"
+
+namespace atom {
+
+namespace api {
+
+namespace {
+
+// Formats of the pending deferred write, keyed by registered clipboard
+// format id so WM_RENDERFORMAT can recover the name.
+std::map<UINT, std::string> g_deferred_formats;
+
+// Message-only window owning the clipboard; created on first use and
+// kept for the lifetime of the process.
+HWND g_clipboard_owner = nullptr;
+
+void RenderFormat(UINT format_id) {
+  auto it = g_deferred_formats.find(format_id);
+  if (it == g_deferred_formats.end())
+    return;
+
+  std::string data = Clipboard::RenderDeferredFormat(it->second);
+  HGLOBAL handle = GlobalAlloc(GMEM_MOVEABLE, data.size());
+  if (!handle)
+    return;
+  memcpy(GlobalLock(handle), data.data(), data.size());
+  GlobalUnlock(handle);
+  // The system owns |handle| from here on.
+  SetClipboardData(format_id, handle);
+}
+
+LRESULT CALLBACK ClipboardOwnerWndProc(HWND hwnd,
+                                       UINT message,
+                                       WPARAM w_param,
+                                       LPARAM l_param) {
+  switch (message) {
+    case WM_RENDERFORMAT:
+      // A paste asked for one of the deferred formats; the clipboard is
+      // already open for us.
+      RenderFormat(static_cast<UINT>(w_param));
+      return 0;
+    case WM_RENDERALLFORMATS:
+      // The process is shutting down; materialize everything still
+      // pending so the clipboard survives us.
+      if (OpenClipboard(hwnd)) {
+        for (const auto& pair : g_deferred_formats)
+          RenderFormat(pair.first);
+        CloseClipboard();
+      }
+      return 0;
+    case WM_DESTROYCLIPBOARD:
+      // Somebody else took the clipboard over; the pending providers
+      // will never be asked again.
+      g_deferred_formats.clear();
+      return 0;
+  }
+  return DefWindowProc(hwnd, message, w_param, l_param);
+}
+
+HWND GetClipboardOwnerWindow() {
+  if (g_clipboard_owner)
+    return g_clipboard_owner;
+
+  WNDCLASSEX window_class = {0};
+  window_class.cbSize = sizeof(window_class);
+  window_class.lpfnWndProc = ClipboardOwnerWndProc;
+  window_class.hInstance = GetModuleHandle(nullptr);
+  window_class.lpszClassName = L"Electron_DeferredClipboardWindow";
+  RegisterClassEx(&window_class);
+  g_clipboard_owner =
+      CreateWindow(window_class.lpszClassName, nullptr, 0, 0, 0, 0, 0,
+                   HWND_MESSAGE, nullptr, window_class.hInstance, nullptr);
+  return g_clipboard_owner;
+}
+
+}  // namespace
+
+// static
+bool Clipboard::PlatformWriteDeferred(
+    const std::vector<std::string>& formats) {
+  HWND owner = GetClipboardOwnerWindow();
+  if (!owner || !OpenClipboard(owner))
+    return false;
+
+  EmptyClipboard();
+  g_deferred_formats.clear();
+  for (const auto& format : formats) {
+    UINT format_id = RegisterClipboardFormat(base::UTF8ToWide(format).c_str());
+    g_deferred_formats[format_id] = format;
+    // A null payload is the delayed-rendering contract: the system sends
+    // WM_RENDERFORMAT to the owner window when the data is needed.
+    SetClipboardData(format_id, nullptr);
+  }
+  CloseClipboard();
+  return true;
+}
+
+}  // namespace api
+
+}  // namespace atom
@@ -7,17 +7,23 @@
 #include <string>
 #include <vector>
 
+#include "atom/common/api/locker.h"
 #include "atom/common/asar/asar_util.h"
+#include "atom/common/native_mate_converters/callback.h"
 #include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/gfx_converter.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
+#include "base/containers/mru_cache.h"
 #include "base/files/file_util.h"
+#include "base/lazy_instance.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
+#include "base/task_scheduler/post_task.h"
 #include "base/threading/thread_restrictions.h"
 #include "native_mate/object_template_builder.h"
 #include "net/base/data_url.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
@@ -151,6 +157,90 @@ bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
   return succeed;
 }
 
+// Process-wide cache of images decoded by createFromPath, keyed by path and
+// modification time. gfx::Image copies share the underlying decoded bitmaps,
+// so a cache hit costs no pixel memory; tray and menu code that recreates
+// the same icons over and over shares one decode instead of piling up
+// duplicates.
+class DecodedImageCache {
+ public:
+  // Total decoded bytes kept alive by the cache; least recently used
+  // entries are evicted beyond this.
+  static const size_t kMaxCacheBytes = 64 * 1024 * 1024;
+
+  DecodedImageCache() : images_(ImageMap::NO_AUTO_EVICT) {}
+
+  bool Get(const base::FilePath& path,
+           const base::Time& mtime,
+           gfx::Image* image) {
+    auto it = images_.Get(path.value());
+    if (it == images_.end())
+      return false;
+    if (it->second.mtime != mtime) {
+      total_bytes_ -= it->second.bytes;
+      images_.Erase(it);
+      return false;
+    }
+    *image = it->second.image;
+    return true;
+  }
+
+  void Put(const base::FilePath& path,
+           const base::Time& mtime,
+           const gfx::Image& image) {
+    size_t bytes = 0;
+    for (const gfx::ImageSkiaRep& rep : image.ToImageSkia()->image_reps())
+      bytes += rep.sk_bitmap().computeByteSize();
+    if (bytes == 0 || bytes > kMaxCacheBytes)
+      return;
+
+    auto it = images_.Get(path.value());
+    if (it != images_.end()) {
+      total_bytes_ -= it->second.bytes;
+      images_.Erase(it);
+    }
+
+    images_.Put(path.value(), {mtime, bytes, image});
+    total_bytes_ += bytes;
+    while (total_bytes_ > kMaxCacheBytes) {
+      auto lru = std::prev(images_.end());
+      total_bytes_ -= lru->second.bytes;
+      images_.Erase(lru);
+    }
+  }
+
+ private:
+  struct Entry {
+    base::Time mtime;
+    size_t bytes;
+    gfx::Image image;
+  };
+  using ImageMap = base::MRUCache<base::FilePath::StringType, Entry>;
+
+  ImageMap images_;
+  size_t total_bytes_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(DecodedImageCache);
+};
+
+base::LazyInstance<DecodedImageCache>::Leaky g_decoded_image_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Modification time used to key the decoded-image cache; files inside an
+// asar archive use the archive's time. Null when the file cannot be
+// statted, in which case the cache is bypassed.
+base::Time GetImageMTime(const base::FilePath& path) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::File::Info info;
+  if (base::GetFileInfo(path, &info))
+    return info.last_modified;
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path) &&
+      base::GetFileInfo(asar_path, &info))
+    return info.last_modified;
+  return base::Time();
+}
+
 base::FilePath NormalizePath(const base::FilePath& path) {
   if (!path.ReferencesParent()) {
     return path;
@@ -204,6 +294,96 @@ bool ReadImageSkiaFromICO(gfx::ImageSkia* image, HICON icon) {
 
 void Noop(char*, void*) {}
 
+// Frees pixel memory adopted from an externalized ArrayBuffer once the last
+// SkBitmap referencing it goes away. Node's ArrayBuffer allocator uses
+// malloc, so free() is the matching deallocator.
+void ReleaseExternalPixels(void* pixels, void* context) {
+  free(pixels);
+}
+
+// Shared by resize() and resizeAsync(): computes the target size and the
+// scaling method from the options dictionary. |size| comes in holding the
+// current image size.
+void ParseResizeOptions(const base::DictionaryValue& options,
+                        float aspect_ratio,
+                        gfx::Size* size,
+                        skia::ImageOperations::ResizeMethod* method) {
+  int width = size->width();
+  int height = size->height();
+  bool width_set = options.GetInteger("width", &width);
+  bool height_set = options.GetInteger("height", &height);
+  size->SetSize(width, height);
+
+  if (width_set && !height_set) {
+    // Scale height to preserve original aspect ratio
+    size->set_height(width);
+    *size = gfx::ScaleToRoundedSize(*size, 1.f, 1.f / aspect_ratio);
+  } else if (height_set && !width_set) {
+    // Scale width to preserve original aspect ratio
+    size->set_width(height);
+    *size = gfx::ScaleToRoundedSize(*size, aspect_ratio, 1.f);
+  }
+
+  *method = skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+  std::string quality;
+  options.GetString("quality", &quality);
+  if (quality == "good")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality == "better")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+}
+
+// The workers below only receive SkBitmaps, whose pixel refs are safe to
+// share across threads; gfx::Image and gfx::ImageSkia refcounting is not
+// thread-safe, so any image objects are created and destroyed on one thread.
+
+std::vector<unsigned char> EncodePNGOnWorker(const SkBitmap& bitmap) {
+  std::vector<unsigned char> encoded;
+  gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
+  return encoded;
+}
+
+std::vector<unsigned char> EncodeJPEGOnWorker(const SkBitmap& bitmap,
+                                              int quality) {
+  gfx::Image image(gfx::ImageSkia::CreateFrom1xBitmap(bitmap));
+  std::vector<unsigned char> encoded;
+  gfx::JPEG1xEncodedDataFromImage(image, quality, &encoded);
+  return encoded;
+}
+
+SkBitmap ResizeOnWorker(const SkBitmap& bitmap,
+                        skia::ImageOperations::ResizeMethod method,
+                        const gfx::Size& size) {
+  return skia::ImageOperations::Resize(bitmap, method, size.width(),
+                                       size.height());
+}
+
+void RunBufferCallback(
+    v8::Isolate* isolate,
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    const std::vector<unsigned char>& encoded) {
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (encoded.empty()) {
+    callback.Run(node::Buffer::New(isolate, 0).ToLocalChecked());
+    return;
+  }
+  callback.Run(node::Buffer::Copy(isolate,
+                                  reinterpret_cast<const char*>(encoded.data()),
+                                  encoded.size())
+                   .ToLocalChecked());
+}
+
+void RunImageCallback(
+    v8::Isolate* isolate,
+    const base::Callback<void(v8::Local<v8::Value>)>& callback,
+    const SkBitmap& bitmap) {
+  mate::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  gfx::Image image(gfx::ImageSkia::CreateFrom1xBitmap(bitmap));
+  callback.Run(mate::ConvertToV8(isolate, NativeImage::Create(isolate, image)));
+}
+
 }  // namespace
 
 NativeImage::NativeImage(v8::Isolate* isolate, const gfx::Image& image)
@@ -304,6 +484,54 @@ v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
       .ToLocalChecked();
 }
 
+void NativeImage::ToPNGAsync(mate::Arguments* args) {
+  float scale_factor = 1.0f;
+  if (!args->PeekNext().IsEmpty() && !args->PeekNext()->IsFunction()) {
+    mate::Dictionary options;
+    if (args->GetNext(&options))
+      options.Get("scaleFactor", &scale_factor);
+  }
+  ResultCallback callback;
+  if (!args->GetNext(&callback)) {
+    args->ThrowError();
+    return;
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).sk_bitmap();
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::Bind(&EncodePNGOnWorker, bitmap),
+      base::Bind(&RunBufferCallback, args->isolate(), callback));
+}
+
+void NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                              int quality,
+                              const ResultCallback& callback) {
+  const SkBitmap bitmap = image_.AsBitmap();
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::Bind(&EncodeJPEGOnWorker, bitmap, quality),
+      base::Bind(&RunBufferCallback, isolate, callback));
+}
+
+void NativeImage::ResizeAsync(v8::Isolate* isolate,
+                              const base::DictionaryValue& options,
+                              const ResultCallback& callback) {
+  gfx::Size size = GetSize();
+  skia::ImageOperations::ResizeMethod method;
+  ParseResizeOptions(options, GetAspectRatio(), &size, &method);
+
+  // Unlike resize(), which scales lazily on first use, the 1x
+  // representation is scaled eagerly on the worker.
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(1.0f).sk_bitmap();
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::Bind(&ResizeOnWorker, bitmap, method, size),
+      base::Bind(&RunImageCallback, isolate, callback));
+}
+
 std::string NativeImage::ToDataURL(mate::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
@@ -368,30 +596,8 @@ mate::Handle<NativeImage> NativeImage::Resize(
     v8::Isolate* isolate,
     const base::DictionaryValue& options) {
   gfx::Size size = GetSize();
-  int width = size.width();
-  int height = size.height();
-  bool width_set = options.GetInteger("width", &width);
-  bool height_set = options.GetInteger("height", &height);
-  size.SetSize(width, height);
-
-  if (width_set && !height_set) {
-    // Scale height to preserve original aspect ratio
-    size.set_height(width);
-    size = gfx::ScaleToRoundedSize(size, 1.f, 1.f / GetAspectRatio());
-  } else if (height_set && !width_set) {
-    // Scale width to preserve original aspect ratio
-    size.set_width(height);
-    size = gfx::ScaleToRoundedSize(size, GetAspectRatio(), 1.f);
-  }
-
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string quality;
-  options.GetString("quality", &quality);
-  if (quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  skia::ImageOperations::ResizeMethod method;
+  ParseResizeOptions(options, GetAspectRatio(), &size, &method);
 
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
       image_.AsImageSkia(), method, size);
@@ -492,9 +698,16 @@ mate::Handle<NativeImage> NativeImage::CreateFromPath(
     return mate::CreateHandle(isolate, new NativeImage(isolate, image_path));
   }
 #endif
-  gfx::ImageSkia image_skia;
-  PopulateImageSkiaRepsFromPath(&image_skia, image_path);
-  gfx::Image image(image_skia);
+  base::Time mtime = GetImageMTime(image_path);
+  gfx::Image image;
+  if (mtime.is_null() ||
+      !g_decoded_image_cache.Get().Get(image_path, mtime, &image)) {
+    gfx::ImageSkia image_skia;
+    PopulateImageSkiaRepsFromPath(&image_skia, image_path);
+    image = gfx::Image(image_skia);
+    if (!mtime.is_null() && !image.IsEmpty())
+      g_decoded_image_cache.Get().Put(image_path, mtime, image);
+  }
   mate::Handle<NativeImage> handle = Create(isolate, image);
 #if defined(OS_MACOSX)
   if (IsTemplateFilename(image_path))
@@ -525,6 +738,67 @@ mate::Handle<NativeImage> NativeImage::CreateFromBuffer(
   return Create(args->isolate(), gfx::Image(image_skia));
 }
 
+// static
+mate::Handle<NativeImage> NativeImage::CreateFromExternalBuffer(
+    mate::Arguments* args,
+    v8::Local<v8::Value> buffer) {
+  int width = 0;
+  int height = 0;
+  double scale_factor = 1.;
+
+  mate::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("width", &width);
+    options.Get("height", &height);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  if (width <= 0 || height <= 0) {
+    args->ThrowError("width and height are required");
+    return CreateEmpty(args->isolate());
+  }
+  if (!buffer->IsArrayBufferView()) {
+    args->ThrowError("buffer must be a Buffer or TypedArray");
+    return CreateEmpty(args->isolate());
+  }
+
+  v8::Local<v8::ArrayBufferView> view = buffer.As<v8::ArrayBufferView>();
+  v8::Local<v8::ArrayBuffer> array_buffer = view->Buffer();
+  size_t row_bytes = static_cast<size_t>(width) * 4;
+  // The view must own its entire ArrayBuffer, otherwise we would steal
+  // memory shared with other views (e.g. Node's Buffer pool).
+  if (view->ByteOffset() != 0 ||
+      view->ByteLength() != array_buffer->ByteLength() ||
+      view->ByteLength() < row_bytes * height) {
+    args->ThrowError(
+        "buffer must cover its entire ArrayBuffer and hold "
+        "width * height * 4 bytes");
+    return CreateEmpty(args->isolate());
+  }
+  if (array_buffer->IsExternal() || !array_buffer->IsNeuterable()) {
+    args->ThrowError("buffer's memory cannot be adopted");
+    return CreateEmpty(args->isolate());
+  }
+
+  // Take ownership of the backing store; the ArrayBuffer is neutered so
+  // JS can no longer touch memory now owned by the bitmap.
+  v8::ArrayBuffer::Contents contents = array_buffer->Externalize();
+  array_buffer->Neuter();
+
+  SkBitmap bitmap;
+  if (!bitmap.installPixels(SkImageInfo::MakeN32Premul(width, height),
+                            contents.Data(), row_bytes,
+                            &ReleaseExternalPixels, nullptr)) {
+    free(contents.Data());
+    args->ThrowError("Failed to adopt pixel buffer");
+    return CreateEmpty(args->isolate());
+  }
+
+  gfx::ImageSkia image_skia;
+  image_skia.AddRepresentation(gfx::ImageSkiaRep(bitmap, scale_factor));
+  return Create(args->isolate(), gfx::Image(image_skia));
+}
+
 // static
 mate::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
                                                          const GURL& url) {
@@ -554,6 +828,9 @@ void NativeImage::BuildPrototype(v8::Isolate* isolate,
   mate::ObjectTemplateBuilder(isolate, prototype->PrototypeTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("_toPNGAsync", &NativeImage::ToPNGAsync)
+      .SetMethod("_toJPEGAsync", &NativeImage::ToJPEGAsync)
+      .SetMethod("_resizeAsync", &NativeImage::ResizeAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
@@ -613,6 +890,8 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("createEmpty", &atom::api::NativeImage::CreateEmpty);
   dict.SetMethod("createFromPath", &atom::api::NativeImage::CreateFromPath);
   dict.SetMethod("createFromBuffer", &atom::api::NativeImage::CreateFromBuffer);
+  dict.SetMethod("createFromExternalBuffer",
+                 &atom::api::NativeImage::CreateFromExternalBuffer);
   dict.SetMethod("createFromDataURL",
                  &atom::api::NativeImage::CreateFromDataURL);
   dict.SetMethod("createFromNamedImage",
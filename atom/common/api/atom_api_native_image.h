@@ -8,6 +8,7 @@
 #include <map>
 #include <string>
 
+#include "base/callback.h"
 #include "base/values.h"
 #include "native_mate/dictionary.h"
 #include "native_mate/handle.h"
@@ -54,6 +55,9 @@ class NativeImage : public mate::Wrappable<NativeImage> {
   static mate::Handle<NativeImage> CreateFromBuffer(
       mate::Arguments* args,
       v8::Local<v8::Value> buffer);
+  static mate::Handle<NativeImage> CreateFromExternalBuffer(
+      mate::Arguments* args,
+      v8::Local<v8::Value> buffer);
   static mate::Handle<NativeImage> CreateFromDataURL(v8::Isolate* isolate,
                                                      const GURL& url);
   static mate::Handle<NativeImage> CreateFromNamedImage(
@@ -77,8 +81,18 @@ class NativeImage : public mate::Wrappable<NativeImage> {
   ~NativeImage() override;
 
  private:
+  // Receives the result of the async variants on the JS thread.
+  using ResultCallback = base::Callback<void(v8::Local<v8::Value>)>;
+
   v8::Local<v8::Value> ToPNG(mate::Arguments* args);
   v8::Local<v8::Value> ToJPEG(v8::Isolate* isolate, int quality);
+  void ToPNGAsync(mate::Arguments* args);
+  void ToJPEGAsync(v8::Isolate* isolate,
+                   int quality,
+                   const ResultCallback& callback);
+  void ResizeAsync(v8::Isolate* isolate,
+                   const base::DictionaryValue& options,
+                   const ResultCallback& callback);
   v8::Local<v8::Value> ToBitmap(mate::Arguments* args);
   v8::Local<v8::Value> GetBitmap(mate::Arguments* args);
   v8::Local<v8::Value> GetNativeHandle(v8::Isolate* isolate,
@@ -10,6 +10,7 @@
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/node_includes.h"
 #include "atom/common/platform_util.h"
+#include "base/bind.h"
 #include "native_mate/dictionary.h"
 
 #if defined(OS_WIN)
@@ -43,6 +44,37 @@ struct Converter<base::win::ShortcutOperation> {
 
 namespace {
 
+void IgnoreShellResult(bool success) {}
+
+// Runs one of the asynchronous platform_util operations, resolving the
+// optional JS callback with a boolean result. The boolean return value
+// is kept for compatibility but now only reports that the operation was
+// queued, since the work itself happens off the calling thread.
+bool RunShellOperation(
+    void (*operation)(const base::FilePath&,
+                      const platform_util::ShellOperationCallback&),
+    const base::FilePath& full_path,
+    mate::Arguments* args) {
+  platform_util::ShellOperationCallback callback =
+      base::Bind(&IgnoreShellResult);
+  if (args->Length() >= 2)
+    args->GetNext(&callback);
+  operation(full_path, callback);
+  return true;
+}
+
+bool ShowItemInFolder(const base::FilePath& full_path, mate::Arguments* args) {
+  return RunShellOperation(&platform_util::ShowItemInFolder, full_path, args);
+}
+
+bool OpenItem(const base::FilePath& full_path, mate::Arguments* args) {
+  return RunShellOperation(&platform_util::OpenItem, full_path, args);
+}
+
+bool MoveItemToTrash(const base::FilePath& full_path, mate::Arguments* args) {
+  return RunShellOperation(&platform_util::MoveItemToTrash, full_path, args);
+}
+
 void OnOpenExternalFinished(
     v8::Isolate* isolate,
     const base::Callback<void(v8::Local<v8::Value>)>& callback,
@@ -141,10 +173,10 @@ void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Context> context,
                 void* priv) {
   mate::Dictionary dict(context->GetIsolate(), exports);
-  dict.SetMethod("showItemInFolder", &platform_util::ShowItemInFolder);
-  dict.SetMethod("openItem", &platform_util::OpenItem);
+  dict.SetMethod("showItemInFolder", &ShowItemInFolder);
+  dict.SetMethod("openItem", &OpenItem);
   dict.SetMethod("openExternal", &OpenExternal);
-  dict.SetMethod("moveItemToTrash", &platform_util::MoveItemToTrash);
+  dict.SetMethod("moveItemToTrash", &MoveItemToTrash);
   dict.SetMethod("beep", &platform_util::Beep);
 #if defined(OS_WIN)
   dict.SetMethod("writeShortcutLink", &WriteShortcutLink);
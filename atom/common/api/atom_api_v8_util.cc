@@ -4,13 +4,16 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "atom/common/api/atom_api_key_weak_map.h"
 #include "atom/common/api/remote_callback_freer.h"
 #include "atom/common/api/remote_object_freer.h"
 #include "atom/common/native_mate_converters/content_converter.h"
+#include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/node_includes.h"
+#include "base/files/file.h"
 #include "base/hash.h"
 #include "native_mate/dictionary.h"
 #include "url/origin.h"
@@ -94,6 +97,76 @@ void TakeHeapSnapshot(v8::Isolate* isolate) {
   isolate->GetHeapProfiler()->TakeHeapSnapshot();
 }
 
+// Streams heap snapshot JSON chunks straight to |file| so the serialized
+// snapshot never has to fit in memory.
+class FileOutputStream : public v8::OutputStream {
+ public:
+  explicit FileOutputStream(base::File* file) : file_(file) {}
+
+  bool failed() const { return failed_; }
+
+  // v8::OutputStream:
+  int GetChunkSize() override { return 65536; }
+  void EndOfStream() override {}
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    if (file_->WriteAtCurrentPos(data, size) != size) {
+      failed_ = true;
+      return kAbort;
+    }
+    return kContinue;
+  }
+
+ private:
+  base::File* file_;
+  bool failed_ = false;
+};
+
+bool WriteHeapSnapshot(v8::Isolate* isolate, const base::FilePath& path) {
+  base::File file(path,
+                  base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+  if (!file.IsValid())
+    return false;
+
+  const v8::HeapSnapshot* snapshot =
+      isolate->GetHeapProfiler()->TakeHeapSnapshot();
+  if (!snapshot)
+    return false;
+
+  FileOutputStream stream(&file);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+  // Unlike takeHeapSnapshot the serialized snapshot is not kept for
+  // inspection from DevTools, so release it right away.
+  const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+  return !stream.failed();
+}
+
+v8::Local<v8::Value> GetHeapSpaceStatistics(v8::Isolate* isolate) {
+  std::vector<mate::Dictionary> spaces;
+  size_t space_count = isolate->NumberOfHeapSpaces();
+  for (size_t i = 0; i < space_count; ++i) {
+    v8::HeapSpaceStatistics stats;
+    if (!isolate->GetHeapSpaceStatistics(&stats, i))
+      continue;
+    mate::Dictionary space = mate::Dictionary::CreateEmpty(isolate);
+    space.Set("spaceName", stats.space_name());
+    space.Set("spaceSize", static_cast<double>(stats.space_size() >> 10));
+    space.Set("spaceUsedSize",
+              static_cast<double>(stats.space_used_size() >> 10));
+    space.Set("spaceAvailableSize",
+              static_cast<double>(stats.space_available_size() >> 10));
+    space.Set("physicalSpaceSize",
+              static_cast<double>(stats.physical_space_size() >> 10));
+    spaces.push_back(space);
+  }
+  return mate::ConvertToV8(isolate, spaces);
+}
+
+double GetExternallyAllocatedMemory(v8::Isolate* isolate) {
+  // Adjusting by zero returns the current amount without changing it.
+  return static_cast<double>(
+      isolate->AdjustAmountOfExternalAllocatedMemory(0));
+}
+
 void RequestGarbageCollectionForTesting(v8::Isolate* isolate) {
   isolate->RequestGarbageCollectionForTesting(
       v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
@@ -113,6 +186,9 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("deleteHiddenValue", &DeleteHiddenValue);
   dict.SetMethod("getObjectHash", &GetObjectHash);
   dict.SetMethod("takeHeapSnapshot", &TakeHeapSnapshot);
+  dict.SetMethod("writeHeapSnapshot", &WriteHeapSnapshot);
+  dict.SetMethod("getHeapSpaceStatistics", &GetHeapSpaceStatistics);
+  dict.SetMethod("getExternallyAllocatedMemory", &GetExternallyAllocatedMemory);
   dict.SetMethod("setRemoteCallbackFreer", &atom::RemoteCallbackFreer::BindTo);
   dict.SetMethod("setRemoteObjectFreer", &atom::RemoteObjectFreer::BindTo);
   dict.SetMethod("createIDWeakMap", &atom::api::KeyWeakMap<int32_t>::Create);
@@ -7,16 +7,23 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "atom/common/api/locker.h"
 #include "atom/common/atom_version.h"
 #include "atom/common/chrome_version.h"
+#include "atom/common/native_mate_converters/file_path_converter.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
+#include "atom/common/node_bindings.h"
 #include "atom/common/node_includes.h"
+#include "base/files/file.h"
+#include "base/json/string_escape.h"
 #include "base/logging.h"
 #include "base/process/process_metrics_iocounters.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/sys_info.h"
 #include "native_mate/dictionary.h"
+#include "v8/include/v8-profiler.h"
 
 namespace atom {
 
@@ -27,6 +34,43 @@ struct DummyClass {
   bool crash;
 };
 
+// Handle counters filled in by CountHandle while walking a uv loop.
+struct UvHandleCounts {
+  int total = 0;
+  int active = 0;
+  int referenced = 0;
+};
+
+void CountHandle(uv_handle_t* handle, void* arg) {
+  UvHandleCounts* counts = static_cast<UvHandleCounts*>(arg);
+  counts->total++;
+  if (uv_is_active(handle))
+    counts->active++;
+  if (uv_has_ref(handle))
+    counts->referenced++;
+}
+
+// Returns the |percentile| (0-100) of |samples|, sorting them in place.
+double Percentile(std::vector<double>* samples, double percentile) {
+  if (samples->empty())
+    return 0;
+  std::sort(samples->begin(), samples->end());
+  size_t index = static_cast<size_t>(percentile / 100.0 *
+                                     (samples->size() - 1));
+  return (*samples)[index];
+}
+
+// Builds the {p50, p90, p99, max} dictionary for one sample series.
+v8::Local<v8::Object> PercentilesToV8(v8::Isolate* isolate,
+                                      std::vector<double>* samples) {
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("p50", Percentile(samples, 50));
+  dict.Set("p90", Percentile(samples, 90));
+  dict.Set("p99", Percentile(samples, 99));
+  dict.Set("max", samples->empty() ? 0 : samples->back());
+  return dict.GetHandle();
+}
+
 // Called when there is a fatal error in V8, we just crash the process here so
 // we can get the stack trace.
 void FatalErrorCallback(const char* location, const char* message) {
@@ -34,9 +78,106 @@ void FatalErrorCallback(const char* location, const char* message) {
   AtomBindings::Crash();
 }
 
+// Title used for profiles started via process.startCPUProfiling.
+const char kCPUProfileTitle[] = "electron";
+
+// Active sampling profiler; created lazily and disposed when profiling
+// stops, so there is zero cost while idle.
+v8::CpuProfiler* g_cpu_profiler = nullptr;
+
+// Serializes a v8::CpuProfile into the .cpuprofile JSON format understood
+// by DevTools, flushing to |file| in chunks so the serialized profile
+// never has to fit in memory.
+class CPUProfileSerializer {
+ public:
+  explicit CPUProfileSerializer(base::File* file) : file_(file) {}
+
+  bool Serialize(const v8::CpuProfile* profile) {
+    Append("{\"nodes\":[");
+    bool first = true;
+    SerializeNode(profile->GetTopDownRoot(), &first);
+    Append("],\"startTime\":");
+    Append(base::Int64ToString(profile->GetStartTime()));
+    Append(",\"endTime\":");
+    Append(base::Int64ToString(profile->GetEndTime()));
+    Append(",\"samples\":[");
+    int count = profile->GetSamplesCount();
+    for (int i = 0; i < count; ++i) {
+      if (i > 0)
+        Append(",");
+      Append(base::UintToString(profile->GetSample(i)->GetNodeId()));
+    }
+    Append("],\"timeDeltas\":[");
+    int64_t last_timestamp = profile->GetStartTime();
+    for (int i = 0; i < count; ++i) {
+      if (i > 0)
+        Append(",");
+      int64_t timestamp = profile->GetSampleTimestamp(i);
+      Append(base::Int64ToString(timestamp - last_timestamp));
+      last_timestamp = timestamp;
+    }
+    Append("]}");
+    Flush();
+    return !failed_;
+  }
+
+ private:
+  void SerializeNode(const v8::CpuProfileNode* node, bool* first) {
+    if (!*first)
+      Append(",");
+    *first = false;
+    Append("{\"id\":");
+    Append(base::UintToString(node->GetNodeId()));
+    Append(",\"callFrame\":{\"functionName\":");
+    Append(base::GetQuotedJSONString(node->GetFunctionNameStr()));
+    Append(",\"scriptId\":");
+    Append(base::GetQuotedJSONString(base::IntToString(node->GetScriptId())));
+    Append(",\"url\":");
+    Append(base::GetQuotedJSONString(node->GetScriptResourceNameStr()));
+    // DevTools expects zero-based positions in call frames.
+    Append(",\"lineNumber\":");
+    Append(base::IntToString(node->GetLineNumber() - 1));
+    Append(",\"columnNumber\":");
+    Append(base::IntToString(node->GetColumnNumber() - 1));
+    Append("},\"hitCount\":");
+    Append(base::UintToString(node->GetHitCount()));
+    int child_count = node->GetChildrenCount();
+    Append(",\"children\":[");
+    for (int i = 0; i < child_count; ++i) {
+      if (i > 0)
+        Append(",");
+      Append(base::UintToString(node->GetChild(i)->GetNodeId()));
+    }
+    Append("]}");
+    for (int i = 0; i < child_count; ++i)
+      SerializeNode(node->GetChild(i), first);
+  }
+
+  void Append(const std::string& data) {
+    buffer_ += data;
+    if (buffer_.size() >= 64 * 1024)
+      Flush();
+  }
+
+  void Flush() {
+    if (buffer_.empty() || failed_)
+      return;
+    int size = static_cast<int>(buffer_.size());
+    if (file_->WriteAtCurrentPos(buffer_.data(), size) != size)
+      failed_ = true;
+    buffer_.clear();
+  }
+
+  base::File* file_;
+  std::string buffer_;
+  bool failed_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(CPUProfileSerializer);
+};
+
 }  // namespace
 
-AtomBindings::AtomBindings(uv_loop_t* loop) {
+AtomBindings::AtomBindings(uv_loop_t* loop) : uv_loop_(loop) {
   uv_async_init(loop, &call_next_tick_async_, OnCallNextTick);
   call_next_tick_async_.data = this;
   metrics_ = base::ProcessMetrics::CreateCurrentProcessMetrics();
@@ -58,7 +199,11 @@ void AtomBindings::BindTo(v8::Isolate* isolate, v8::Local<v8::Object> process) {
   dict.SetMethod("getSystemMemoryInfo", &GetSystemMemoryInfo);
   dict.SetMethod("getCPUUsage", base::Bind(&AtomBindings::GetCPUUsage,
                                            base::Unretained(this)));
+  dict.SetMethod("getUvLoopStats", base::Bind(&AtomBindings::GetUvLoopStats,
+                                              base::Unretained(this)));
   dict.SetMethod("getIOCounters", &GetIOCounters);
+  dict.SetMethod("startCPUProfiling", &StartCPUProfiling);
+  dict.SetMethod("stopCPUProfiling", &StopCPUProfiling);
 #if defined(OS_POSIX)
   dict.SetMethod("setFdLimit", &base::SetFdLimit);
 #endif
@@ -222,6 +367,76 @@ v8::Local<v8::Value> AtomBindings::GetCPUUsage(v8::Isolate* isolate) {
   return dict.GetHandle();
 }
 
+v8::Local<v8::Value> AtomBindings::GetUvLoopStats(v8::Isolate* isolate) {
+  UvLoopMetrics::Snapshot snapshot;
+  UvLoopMetrics::Get()->GetSnapshot(&snapshot);
+
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("iterations", static_cast<double>(snapshot.iterations));
+  dict.Set("iterationLatency",
+           PercentilesToV8(isolate, &snapshot.iteration_ms));
+  dict.Set("wakeupLag", PercentilesToV8(isolate, &snapshot.wakeup_lag_ms));
+
+  mate::Dictionary poll = mate::Dictionary::CreateEmpty(isolate);
+  poll.Set("count", static_cast<double>(snapshot.polls));
+  poll.Set("totalMs", snapshot.total_poll_time.InMillisecondsF());
+  dict.Set("poll", poll);
+
+  // Walk the loop from the thread it runs on; this is always the calling
+  // thread since the binding is invoked from JS.
+  UvHandleCounts counts;
+  uv_walk(uv_loop_, CountHandle, &counts);
+  mate::Dictionary handles = mate::Dictionary::CreateEmpty(isolate);
+  handles.Set("total", counts.total);
+  handles.Set("active", counts.active);
+  handles.Set("referenced", counts.referenced);
+  dict.Set("handles", handles);
+
+  return dict.GetHandle();
+}
+
+// static
+void AtomBindings::StartCPUProfiling(v8::Isolate* isolate,
+                                     mate::Arguments* args) {
+  if (g_cpu_profiler) {
+    args->ThrowError("CPU profiling is already in progress");
+    return;
+  }
+
+  int sampling_interval = 1000;  // microseconds
+  mate::Dictionary options;
+  if (args->GetNext(&options))
+    options.Get("samplingInterval", &sampling_interval);
+
+  g_cpu_profiler = v8::CpuProfiler::New(isolate);
+  g_cpu_profiler->SetSamplingInterval(std::max(sampling_interval, 100));
+  g_cpu_profiler->StartProfiling(mate::StringToV8(isolate, kCPUProfileTitle),
+                                 true /* record_samples */);
+}
+
+// static
+bool AtomBindings::StopCPUProfiling(v8::Isolate* isolate,
+                                    const base::FilePath& path) {
+  if (!g_cpu_profiler)
+    return false;
+
+  v8::CpuProfile* profile = g_cpu_profiler->StopProfiling(
+      mate::StringToV8(isolate, kCPUProfileTitle));
+  bool success = false;
+  if (profile) {
+    base::File file(path,
+                    base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+    if (file.IsValid()) {
+      CPUProfileSerializer serializer(&file);
+      success = serializer.Serialize(profile);
+    }
+    profile->Delete();
+  }
+  g_cpu_profiler->Dispose();
+  g_cpu_profiler = nullptr;
+  return success;
+}
+
 // static
 v8::Local<v8::Value> AtomBindings::GetIOCounters(v8::Isolate* isolate) {
   auto metrics = base::ProcessMetrics::CreateCurrentProcessMetrics();
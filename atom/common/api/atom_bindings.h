@@ -7,6 +7,7 @@
 
 #include <list>
 
+#include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/process/process_metrics.h"
 #include "base/strings/string16.h"
@@ -40,13 +41,21 @@ class AtomBindings {
   static v8::Local<v8::Value> GetSystemMemoryInfo(v8::Isolate* isolate,
                                                   mate::Arguments* args);
   v8::Local<v8::Value> GetCPUUsage(v8::Isolate* isolate);
+  v8::Local<v8::Value> GetUvLoopStats(v8::Isolate* isolate);
   static v8::Local<v8::Value> GetIOCounters(v8::Isolate* isolate);
+  static void StartCPUProfiling(v8::Isolate* isolate, mate::Arguments* args);
+  static bool StopCPUProfiling(v8::Isolate* isolate,
+                               const base::FilePath& path);
 
  private:
   void ActivateUVLoop(v8::Isolate* isolate);
 
   static void OnCallNextTick(uv_async_t* handle);
 
+  // The loop this process' node environment runs on; used to walk its
+  // handles from GetUvLoopStats.
+  uv_loop_t* uv_loop_;
+
   uv_async_t call_next_tick_async_;
   std::list<node::Environment*> pending_next_ticks_;
   std::unique_ptr<base::ProcessMetrics> metrics_;
@@ -11,26 +11,54 @@ namespace mate {
 
 namespace internal {
 
+namespace {
+
+// If the JS function throws an exception (doesn't return a value) the result
+// of MakeCallback will be empty and therefore ToLocal will be false, in this
+// case we need to return "false" as that indicates that the event emitter did
+// not handle the event.
+v8::Local<v8::Value> ToLocalOrFalse(v8::Isolate* isolate,
+                                    v8::MaybeLocal<v8::Value> ret) {
+  v8::Local<v8::Value> localRet;
+  if (ret.ToLocal(&localRet)) {
+    return localRet;
+  }
+  return v8::Boolean::New(isolate, false);
+}
+
+}  // namespace
+
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         v8::Local<v8::Object> obj,
                                         const char* method,
-                                        ValueVector* args) {
+                                        size_t argc,
+                                        v8::Local<v8::Value>* argv) {
   // Perform microtask checkpoint after running JavaScript.
   v8::MicrotasksScope script_scope(isolate,
                                    v8::MicrotasksScope::kRunMicrotasks);
   // Use node::MakeCallback to call the callback, and it will also run pending
   // tasks in Node.js.
-  v8::MaybeLocal<v8::Value> ret = node::MakeCallback(
-      isolate, obj, method, args->size(), &args->front(), {0, 0});
-  // If the JS function throws an exception (doesn't return a value) the result
-  // of MakeCallback will be empty and therefore ToLocal will be false, in this
-  // case we need to return "false" as that indicates that the event emitter did
-  // not handle the event
-  v8::Local<v8::Value> localRet;
-  if (ret.ToLocal(&localRet)) {
-    return localRet;
-  }
-  return v8::Boolean::New(isolate, false);
+  return ToLocalOrFalse(
+      isolate, node::MakeCallback(isolate, obj, method, argc, argv, {0, 0}));
+}
+
+v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
+                                        v8::Local<v8::Object> obj,
+                                        const char* method,
+                                        ValueVector* args) {
+  return CallMethodWithArgs(isolate, obj, method, args->size(),
+                            args->empty() ? nullptr : &args->front());
+}
+
+v8::Local<v8::Value> CallEmitWithArgs(v8::Isolate* isolate,
+                                      v8::Local<v8::Object> obj,
+                                      v8::Local<v8::Function> emit,
+                                      size_t argc,
+                                      v8::Local<v8::Value>* argv) {
+  v8::MicrotasksScope script_scope(isolate,
+                                   v8::MicrotasksScope::kRunMicrotasks);
+  return ToLocalOrFalse(
+      isolate, node::MakeCallback(isolate, obj, emit, argc, argv, {0, 0}));
 }
 
 }  // namespace internal
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "atom/common/native_mate_converters/string16_converter.h"
+#include "base/macros.h"
 #include "native_mate/converter.h"
 
 namespace mate {
@@ -16,11 +17,25 @@ namespace internal {
 
 using ValueVector = std::vector<v8::Local<v8::Value>>;
 
+v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
+                                        v8::Local<v8::Object> obj,
+                                        const char* method,
+                                        size_t argc,
+                                        v8::Local<v8::Value>* argv);
+
 v8::Local<v8::Value> CallMethodWithArgs(v8::Isolate* isolate,
                                         v8::Local<v8::Object> obj,
                                         const char* method,
                                         ValueVector* args);
 
+// Like CallMethodWithArgs, but with the callee already resolved so the
+// per-call property lookup is skipped.
+v8::Local<v8::Value> CallEmitWithArgs(v8::Isolate* isolate,
+                                      v8::Local<v8::Object> obj,
+                                      v8::Local<v8::Function> emit,
+                                      size_t argc,
+                                      v8::Local<v8::Value>* argv);
+
 }  // namespace internal
 
 // obj.emit.apply(obj, name, args...);
@@ -43,11 +58,32 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                const Args&... args) {
-  internal::ValueVector converted_args = {
+  // The argument count is known at compile time, so the conversion
+  // happens into a stack array with no heap allocation.
+  v8::Local<v8::Value> converted_args[] = {
+      StringToV8(isolate, name),
+      ConvertToV8(isolate, args)...,
+  };
+  return internal::CallMethodWithArgs(isolate, obj, "emit",
+                                      arraysize(converted_args),
+                                      converted_args);
+}
+
+// obj.emit(name, args...) with |emit| already resolved (and typically
+// cached by the caller, see mate::EventEmitter).
+template <typename StringType, typename... Args>
+v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
+                               v8::Local<v8::Object> obj,
+                               v8::Local<v8::Function> emit,
+                               const StringType& name,
+                               const Args&... args) {
+  v8::Local<v8::Value> converted_args[] = {
       StringToV8(isolate, name),
       ConvertToV8(isolate, args)...,
   };
-  return internal::CallMethodWithArgs(isolate, obj, "emit", &converted_args);
+  return internal::CallEmitWithArgs(isolate, obj, emit,
+                                    arraysize(converted_args),
+                                    converted_args);
 }
 
 // obj.custom_emit(args...)
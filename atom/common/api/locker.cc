@@ -4,9 +4,42 @@
 
 #include "atom/common/api/locker.h"
 
+#include "base/logging.h"
+#include "base/threading/platform_thread.h"
+
 namespace mate {
 
+namespace {
+
+// Set once at browser startup, after the main thread has taken its
+// process-wide v8::Locker; no other thread runs JavaScript after that.
+bool g_single_threaded = false;
+
+#if DCHECK_IS_ON()
+base::PlatformThreadRef g_js_thread_ref;
+#endif
+
+}  // namespace
+
+// static
+void Locker::SetIsSingleThreaded() {
+#if DCHECK_IS_ON()
+  g_js_thread_ref = base::PlatformThread::CurrentRef();
+#endif
+  g_single_threaded = true;
+}
+
 Locker::Locker(v8::Isolate* isolate) {
+  if (g_single_threaded) {
+    // The lone JS thread holds the isolate lock for the whole process
+    // lifetime, so a nested v8::Locker here is pure overhead at every task
+    // boundary.
+    DCHECK(v8::Locker::IsLocked(isolate));
+#if DCHECK_IS_ON()
+    DCHECK(base::PlatformThread::CurrentRef() == g_js_thread_ref);
+#endif
+    return;
+  }
   if (IsBrowserProcess())
     locker_.reset(new v8::Locker(isolate));
 }
@@ -22,6 +22,13 @@ class Locker {
   // by checking whether current has used V8 Lock, but it might be a bad idea.
   static inline bool IsBrowserProcess() { return v8::Locker::IsActive(); }
 
+  // Marks the calling thread as the only thread that ever runs JavaScript in
+  // this process. The thread must already hold the isolate lock for the
+  // lifetime of the process; once set, Locker instances become no-ops instead
+  // of taking a redundant nested v8::Locker. Debug builds keep asserting that
+  // every Locker is constructed on this thread with the lock held.
+  static void SetIsSingleThreaded();
+
  private:
   void* operator new(size_t size);
   void operator delete(void*, size_t);
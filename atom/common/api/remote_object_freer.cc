@@ -4,8 +4,16 @@
 
 #include "atom/common/api/remote_object_freer.h"
 
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "atom/common/api/api_messages.h"
+#include "base/bind.h"
+#include "base/lazy_instance.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/values.h"
 #include "content/public/renderer/render_frame.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
@@ -24,6 +32,35 @@ content::RenderFrame* GetCurrentRenderFrame() {
   return content::RenderFrame::FromWebFrame(frame);
 }
 
+// Object ids freed but not yet reported to the browser, per frame. A GC
+// pass over a heavy window releases thousands of proxies; sending one
+// message per id stalls the browser process, so frees are coalesced and
+// flushed in a single message per batch.
+base::LazyInstance<std::map<int, std::vector<int>>>::Leaky g_pending_ids =
+    LAZY_INSTANCE_INITIALIZER;
+
+void FlushPendingDereferences(int routing_id) {
+  std::vector<int> ids;
+  ids.swap(g_pending_ids.Get()[routing_id]);
+  if (ids.empty())
+    return;
+
+  content::RenderFrame* render_frame =
+      content::RenderFrame::FromRoutingID(routing_id);
+  if (!render_frame)
+    return;
+
+  base::string16 channel = base::ASCIIToUTF16("ipc-message");
+  base::ListValue args;
+  args.AppendString("ELECTRON_BROWSER_DEREFERENCE");
+  auto id_list = std::make_unique<base::ListValue>();
+  for (int id : ids)
+    id_list->AppendInteger(id);
+  args.Append(std::move(id_list));
+  render_frame->Send(
+      new AtomFrameHostMsg_Message(routing_id, channel, args));
+}
+
 }  // namespace
 
 // static
@@ -48,17 +85,17 @@ RemoteObjectFreer::RemoteObjectFreer(v8::Isolate* isolate,
 RemoteObjectFreer::~RemoteObjectFreer() {}
 
 void RemoteObjectFreer::RunDestructor() {
-  content::RenderFrame* render_frame =
-      content::RenderFrame::FromRoutingID(routing_id_);
-  if (!render_frame)
+  if (routing_id_ == MSG_ROUTING_NONE)
     return;
 
-  base::string16 channel = base::ASCIIToUTF16("ipc-message");
-  base::ListValue args;
-  args.AppendString("ELECTRON_BROWSER_DEREFERENCE");
-  args.AppendInteger(object_id_);
-  render_frame->Send(new AtomFrameHostMsg_Message(render_frame->GetRoutingID(),
-                                                  channel, args));
+  // The first free of a batch schedules the flush; ids collected until
+  // the task runs go out in the same message.
+  std::vector<int>& pending = g_pending_ids.Get()[routing_id_];
+  if (pending.empty()) {
+    base::ThreadTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::Bind(&FlushPendingDereferences, routing_id_));
+  }
+  pending.push_back(object_id_);
 }
 
 }  // namespace atom
@@ -0,0 +1,146 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/api/v8_code_cache.h"
+
+#include "atom/common/atom_version.h"
+#include "base/base_paths.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/md5.h"
+#include "base/path_service.h"
+#include "base/strings/stringprintf.h"
+#include "base/threading/thread_restrictions.h"
+#include "build/build_config.h"
+
+#if defined(OS_POSIX)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace atom {
+
+namespace code_cache {
+
+namespace {
+
+// Returns the root of the code cache, or an empty path. The cache must
+// live in a per-user directory: V8's cache deserializer trusts its
+// input, so a blob planted in a world-writable location such as the
+// temp dir would let any local user run code inside the app.
+base::FilePath GetCacheRootDir() {
+  base::FilePath cache_dir;
+#if defined(OS_POSIX)
+  if (!PathService::Get(base::DIR_CACHE, &cache_dir))
+    return base::FilePath();
+#else
+  if (!PathService::Get(base::DIR_APP_DATA, &cache_dir))
+    return base::FilePath();
+#endif
+  return cache_dir.Append(FILE_PATH_LITERAL("electron-code-cache"));
+}
+
+// Returns the cache file for |id|, or an empty path if the cache
+// directory is unavailable.
+base::FilePath GetCacheFilePath(const std::string& id) {
+  base::FilePath cache_dir = GetCacheRootDir();
+  if (cache_dir.empty())
+    return base::FilePath();
+  return cache_dir.AppendASCII(ATOM_VERSION_STRING).AppendASCII(id + ".bin");
+}
+
+// Returns true when the blob at |path| may be consumed: it must be a
+// regular file owned by the current user that nobody else can write.
+bool IsTrustedCacheFile(const base::FilePath& path) {
+#if defined(OS_POSIX)
+  struct stat info;
+  if (lstat(path.value().c_str(), &info) != 0)
+    return false;
+  return S_ISREG(info.st_mode) && info.st_uid == getuid() &&
+         (info.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#else
+  return true;
+#endif
+}
+
+// Compiles |source|, consuming and maintaining the cache entry at
+// |cache_path| (which may be empty to disable caching).
+v8::MaybeLocal<v8::Script> CompileWithCacheFile(
+    v8::Local<v8::Context> context,
+    const base::FilePath& cache_path,
+    v8::Local<v8::String> source) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  std::string cached;
+  if (!cache_path.empty() && IsTrustedCacheFile(cache_path) &&
+      base::ReadFileToString(cache_path, &cached)) {
+    // V8 owns and frees the CachedData buffer.
+    auto* cached_data = new v8::ScriptCompiler::CachedData(
+        reinterpret_cast<const uint8_t*>(cached.data()), cached.size(),
+        v8::ScriptCompiler::CachedData::BufferPolicy::BufferNotOwned);
+    v8::ScriptCompiler::Source script_source(source, cached_data);
+    v8::MaybeLocal<v8::Script> script = v8::ScriptCompiler::Compile(
+        context, &script_source, v8::ScriptCompiler::kConsumeCodeCache);
+    // V8 rejects the cache if it was produced by a different build or
+    // with different flags; recompile and rewrite it below.
+    if (!script.IsEmpty() && !cached_data->rejected)
+      return script;
+    base::DeleteFile(cache_path, false);
+  }
+
+  v8::ScriptCompiler::Source script_source(source);
+  v8::MaybeLocal<v8::Script> script =
+      v8::ScriptCompiler::Compile(context, &script_source,
+                                  v8::ScriptCompiler::kProduceCodeCache);
+  if (script.IsEmpty())
+    return script;
+
+  const v8::ScriptCompiler::CachedData* cached_data =
+      script_source.GetCachedData();
+  if (!cache_path.empty() && cached_data && cached_data->length > 0 &&
+      base::CreateDirectory(cache_path.DirName())) {
+#if defined(OS_POSIX)
+    // Keep the cache private to the current user.
+    base::SetPosixFilePermissions(cache_path.DirName(), 0700);
+    base::SetPosixFilePermissions(cache_path.DirName().DirName(), 0700);
+#endif
+    if (base::WriteFile(cache_path,
+                        reinterpret_cast<const char*>(cached_data->data),
+                        cached_data->length) > 0) {
+#if defined(OS_POSIX)
+      base::SetPosixFilePermissions(cache_path, 0600);
+#endif
+    }
+  }
+
+  return script;
+}
+
+}  // namespace
+
+v8::MaybeLocal<v8::Script> Compile(v8::Local<v8::Context> context,
+                                   const std::string& id,
+                                   v8::Local<v8::String> source) {
+  return CompileWithCacheFile(context, GetCacheFilePath(id), source);
+}
+
+v8::MaybeLocal<v8::Script> CompileUserScript(v8::Local<v8::Context> context,
+                                             const base::FilePath& path,
+                                             v8::Local<v8::String> source) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  base::File::Info info;
+  base::FilePath cache_path;
+  if (base::GetFileInfo(path, &info)) {
+    std::string key = base::StringPrintf(
+        "%s-%" PRId64, path.AsUTF8Unsafe().c_str(),
+        info.last_modified.ToInternalValue());
+    cache_path = GetCacheFilePath("user-" + base::MD5String(key));
+  }
+  return CompileWithCacheFile(context, cache_path, source);
+}
+
+}  // namespace code_cache
+
+}  // namespace atom
@@ -0,0 +1,39 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_API_V8_CODE_CACHE_H_
+#define ATOM_COMMON_API_V8_CODE_CACHE_H_
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "v8/include/v8.h"
+
+namespace atom {
+
+namespace code_cache {
+
+// Compiles |source| using a persistent V8 code cache. |id| names the
+// bundle ("asar_init", "isolated_bundle", ...); the cache file lives in
+// a version-scoped directory under the user's cache directory, so a new
+// Electron build never consumes stale bytecode and no other local user
+// can plant a blob. On a cache hit V8 skips parsing
+// the bundle; on a miss the cache is (re)written for the next launch.
+// Falls back to a plain compile on any I/O or cache failure.
+v8::MaybeLocal<v8::Script> Compile(v8::Local<v8::Context> context,
+                                   const std::string& id,
+                                   v8::Local<v8::String> source);
+
+// Like Compile, but for scripts shipped by the app rather than by
+// Electron: the cache entry is keyed by |path| and the file's mtime, so
+// an edited script never consumes stale bytecode.
+v8::MaybeLocal<v8::Script> CompileUserScript(v8::Local<v8::Context> context,
+                                             const base::FilePath& path,
+                                             v8::Local<v8::String> source);
+
+}  // namespace code_cache
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_API_V8_CODE_CACHE_H_
@@ -0,0 +1,44 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/api/v8_value_serializer.h"
+
+#include <stdlib.h>
+
+#include <utility>
+
+namespace atom {
+
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      std::string* out) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::TryCatch try_catch(isolate);
+  v8::ValueSerializer serializer(isolate);
+  serializer.WriteHeader();
+  if (!serializer.WriteValue(context, value).FromMaybe(false))
+    return false;
+
+  std::pair<uint8_t*, size_t> buffer = serializer.Release();
+  out->assign(reinterpret_cast<const char*>(buffer.first), buffer.second);
+  free(buffer.first);
+  return true;
+}
+
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const std::string& data) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::TryCatch try_catch(isolate);
+  v8::ValueDeserializer deserializer(
+      isolate, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+  if (!deserializer.ReadHeader(context).FromMaybe(false))
+    return v8::Null(isolate);
+
+  v8::Local<v8::Value> value;
+  if (!deserializer.ReadValue(context).ToLocal(&value))
+    return v8::Null(isolate);
+  return value;
+}
+
+}  // namespace atom
@@ -0,0 +1,30 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_API_V8_VALUE_SERIALIZER_H_
+#define ATOM_COMMON_API_V8_VALUE_SERIALIZER_H_
+
+#include <string>
+
+#include "v8/include/v8.h"
+
+namespace atom {
+
+// Encodes |value| with V8's structured clone serializer, producing a
+// byte blob that can cross the IPC boundary without the per-element
+// base::Value traversals. Returns false for values the clone algorithm
+// rejects (functions, host objects); any scheduled exception is
+// swallowed so callers can fall back to another path.
+bool SerializeV8Value(v8::Isolate* isolate,
+                      v8::Local<v8::Value> value,
+                      std::string* out);
+
+// Decodes a blob produced by SerializeV8Value in the current context.
+// Returns null on malformed input.
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const std::string& data);
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_API_V8_VALUE_SERIALIZER_H_
@@ -4,19 +4,26 @@
 
 #include "atom/common/asar/archive.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
-#include "atom/common/asar/scoped_temporary_file.h"
+#include "atom/common/asar/archive_index.h"
+#include "atom/common/asar/asar_header_cache.h"
+#include "atom/common/asar/extraction_cache.h"
+#include "atom/common/asar/integrity_checker.h"
+#include "base/bind.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/pickle.h"
-#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/task_scheduler/post_task.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
+#include "third_party/zlib/zlib.h"
 
 #if defined(OS_WIN)
 #include <io.h>
@@ -26,92 +33,67 @@ namespace asar {
 
 namespace {
 
+// Upper bound on remembered missing keys, so pathological probing
+// cannot grow the negative cache without bound.
+const size_t kMaxNegativeLookups = 8192;
+
+// Index keys are always slash-separated.
+std::string NormalizePath(const base::FilePath& path) {
+  std::string result = path.AsUTF8Unsafe();
 #if defined(OS_WIN)
-const char kSeparators[] = "\\/";
-#else
-const char kSeparators[] = "/";
+  base::ReplaceChars(result, "\\", "/", &result);
 #endif
-
-bool GetNodeFromPath(std::string path,
-                     const base::DictionaryValue* root,
-                     const base::DictionaryValue** out);
-
-// Gets the "files" from "dir".
-bool GetFilesNode(const base::DictionaryValue* root,
-                  const base::DictionaryValue* dir,
-                  const base::DictionaryValue** out) {
-  // Test for symbol linked directory.
-  std::string link;
-  if (dir->GetStringWithoutPathExpansion("link", &link)) {
-    const base::DictionaryValue* linked_node = nullptr;
-    if (!GetNodeFromPath(link, root, &linked_node))
-      return false;
-    dir = linked_node;
-  }
-
-  return dir->GetDictionaryWithoutPathExpansion("files", out);
+  return result;
 }
 
-// Gets sub-file "name" from "dir".
-bool GetChildNode(const base::DictionaryValue* root,
-                  const std::string& name,
-                  const base::DictionaryValue* dir,
-                  const base::DictionaryValue** out) {
-  if (name == "") {
-    *out = root;
-    return true;
-  }
-
-  const base::DictionaryValue* files = nullptr;
-  return GetFilesNode(root, dir, &files) &&
-         files->GetDictionaryWithoutPathExpansion(name, out);
-}
-
-// Gets the node of "path" from "root".
-bool GetNodeFromPath(std::string path,
-                     const base::DictionaryValue* root,
-                     const base::DictionaryValue** out) {
-  if (path == "") {
-    *out = root;
-    return true;
-  }
-
-  const base::DictionaryValue* dir = root;
-  for (size_t delimiter_position = path.find_first_of(kSeparators);
-       delimiter_position != std::string::npos;
-       delimiter_position = path.find_first_of(kSeparators)) {
-    const base::DictionaryValue* child = nullptr;
-    if (!GetChildNode(root, path.substr(0, delimiter_position), dir, &child))
-      return false;
-
-    dir = child;
-    path.erase(0, delimiter_position + 1);
-  }
-
-  return GetChildNode(root, path, dir, out);
+void FillFileInfoWithEntry(Archive::FileInfo* info,
+                           uint32_t header_size,
+                           const ArchiveIndex::Entry* entry) {
+  info->size = entry->size;
+  info->stored_size = entry->stored_size;
+  info->unpacked = entry->unpacked;
+  info->executable = entry->executable;
+  info->compressed = entry->compressed;
+  info->integrity = entry->integrity;
+  if (!entry->unpacked)
+    info->offset = entry->offset + header_size;
 }
 
-bool FillFileInfoWithNode(Archive::FileInfo* info,
-                          uint32_t header_size,
-                          const base::DictionaryValue* node) {
-  int size;
-  if (!node->GetInteger("size", &size))
-    return false;
-  info->size = static_cast<uint32_t>(size);
-
-  if (node->GetBoolean("unpacked", &info->unpacked) && info->unpacked)
-    return true;
-
-  std::string offset;
-  if (!node->GetString("offset", &offset))
-    return false;
-  if (!base::StringToUint64(offset, &info->offset))
+// Streaming inflate of a deflate-compressed entry. |read| is called
+// repeatedly to produce the next chunk of stored bytes, so the whole
+// compressed body never has to sit in memory at once.
+bool InflateToString(
+    uint32_t expected_size,
+    const base::Callback<int(char* buf, int size)>& read,
+    std::string* out) {
+  z_stream stream;
+  memset(&stream, 0, sizeof(stream));
+  if (inflateInit(&stream) != Z_OK)
     return false;
-  info->offset += header_size;
 
-  node->GetBoolean("executable", &info->executable);
-
-  return true;
+  out->clear();
+  out->reserve(expected_size);
+
+  char in_buf[16384];
+  char out_buf[16384];
+  int ret = Z_OK;
+  while (ret != Z_STREAM_END) {
+    if (stream.avail_in == 0) {
+      int len = read.Run(in_buf, sizeof(in_buf));
+      if (len <= 0)
+        break;
+      stream.next_in = reinterpret_cast<Bytef*>(in_buf);
+      stream.avail_in = len;
+    }
+    stream.next_out = reinterpret_cast<Bytef*>(out_buf);
+    stream.avail_out = sizeof(out_buf);
+    ret = inflate(&stream, Z_NO_FLUSH);
+    if (ret != Z_OK && ret != Z_STREAM_END)
+      break;
+    out->append(out_buf, sizeof(out_buf) - stream.avail_out);
+  }
+  inflateEnd(&stream);
+  return ret == Z_STREAM_END && out->size() == expected_size;
 }
 
 }  // namespace
@@ -140,6 +122,8 @@ Archive::~Archive() {
 }
 
 bool Archive::Init() {
+  TRACE_EVENT1("electron.asar", "asar::Archive::Init", "path",
+               path_.AsUTF8Unsafe());
   if (!file_.IsValid()) {
     if (file_.error_details() != base::File::FILE_ERROR_NOT_FOUND) {
       LOG(WARNING) << "Opening " << path_.value() << ": "
@@ -168,6 +152,16 @@ bool Archive::Init() {
     return false;
   }
 
+  // If another process already parsed this archive and shared the index
+  // with us, skip reading and parsing the header body entirely.
+  std::unique_ptr<ArchiveIndex> shared_index =
+      AsarHeaderCache::GetInstance()->GetSharedIndex(path_);
+  if (shared_index) {
+    header_size_ = 8 + size;
+    index_ = std::move(shared_index);
+    return true;
+  }
+
   buf.resize(size);
   {
     base::ThreadRestrictions::ScopedAllowIO allow_io;
@@ -185,89 +179,124 @@ bool Archive::Init() {
     return false;
   }
 
-  std::string error;
-  base::JSONReader reader;
-  std::unique_ptr<base::Value> value(reader.ReadToValue(header));
-  if (!value || !value->is_dict()) {
-    LOG(ERROR) << "Failed to parse header: " << error;
-    return false;
+  auto index = std::make_unique<ArchiveIndex>();
+  if (ArchiveIndex::IsBinaryHeader(header)) {
+    // v3 archives ship the flat binary index directly.
+    if (!index->ParseBinary(header)) {
+      LOG(ERROR) << "Failed to parse binary index from " << path_.value();
+      return false;
+    }
+  } else {
+    // Old archives carry a JSON header; convert it into the flat index
+    // once at init so lookups never walk the tree again.
+    base::JSONReader reader;
+    std::unique_ptr<base::Value> value(reader.ReadToValue(header));
+    if (!value || !value->is_dict()) {
+      LOG(ERROR) << "Failed to parse header from " << path_.value();
+      return false;
+    }
+    if (!index->BuildFromJson(
+            static_cast<const base::DictionaryValue&>(*value))) {
+      LOG(ERROR) << "Failed to index header from " << path_.value();
+      return false;
+    }
   }
 
+  // In the browser process, share the parsed index with future child
+  // processes. No-op elsewhere.
+  AsarHeaderCache::GetInstance()->PublishIndex(path_, *index);
+
   header_size_ = 8 + size;
-  header_.reset(static_cast<base::DictionaryValue*>(value.release()));
+  index_ = std::move(index);
   return true;
 }
 
-bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) {
-  if (!header_)
-    return false;
+const ArchiveIndex::Entry* Archive::FindEntry(const base::FilePath& path,
+                                              int depth) {
+  if (!index_)
+    return nullptr;
 
-  const base::DictionaryValue* node;
-  if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
-    return false;
+  // Guard against link cycles.
+  if (depth > 32)
+    return nullptr;
+
+  const ArchiveIndex::Entry* entry = FindKey(NormalizePath(path));
+  if (entry && !entry->link.empty())
+    return FindEntry(base::FilePath::FromUTF8Unsafe(entry->link), depth + 1);
+  return entry;
+}
+
+const ArchiveIndex::Entry* Archive::FindKey(const std::string& key) {
+  {
+    base::AutoLock lock(negative_lookups_lock_);
+    if (negative_lookups_.count(key))
+      return nullptr;
+  }
+
+  const ArchiveIndex::Entry* entry = index_->Find(key);
+  if (!entry) {
+    base::AutoLock lock(negative_lookups_lock_);
+    if (negative_lookups_.size() >= kMaxNegativeLookups)
+      negative_lookups_.clear();
+    negative_lookups_.insert(key);
+  }
+  return entry;
+}
 
-  std::string link;
-  if (node->GetString("link", &link))
-    return GetFileInfo(base::FilePath::FromUTF8Unsafe(link), info);
+bool Archive::GetFileInfo(const base::FilePath& path, FileInfo* info) {
+  const ArchiveIndex::Entry* entry = FindEntry(path, 0);
+  if (!entry || entry->is_directory)
+    return false;
 
-  return FillFileInfoWithNode(info, header_size_, node);
+  FillFileInfoWithEntry(info, header_size_, entry);
+  return true;
 }
 
 bool Archive::Stat(const base::FilePath& path, Stats* stats) {
-  if (!header_)
+  if (!index_)
     return false;
 
-  const base::DictionaryValue* node;
-  if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
+  const ArchiveIndex::Entry* entry = FindKey(NormalizePath(path));
+  if (!entry)
     return false;
 
-  if (node->FindKey("link")) {
+  if (!entry->link.empty()) {
     stats->is_file = false;
     stats->is_link = true;
     return true;
   }
 
-  if (node->FindKey("files")) {
+  if (entry->is_directory) {
     stats->is_file = false;
     stats->is_directory = true;
     return true;
   }
 
-  return FillFileInfoWithNode(stats, header_size_, node);
+  FillFileInfoWithEntry(stats, header_size_, entry);
+  return true;
 }
 
 bool Archive::Readdir(const base::FilePath& path,
                       std::vector<base::FilePath>* list) {
-  if (!header_)
-    return false;
-
-  const base::DictionaryValue* node;
-  if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
-    return false;
-
-  const base::DictionaryValue* files;
-  if (!GetFilesNode(header_.get(), node, &files))
+  const ArchiveIndex::Entry* entry = FindEntry(path, 0);
+  if (!entry || !entry->is_directory)
     return false;
 
-  base::DictionaryValue::Iterator iter(*files);
-  while (!iter.IsAtEnd()) {
-    list->push_back(base::FilePath::FromUTF8Unsafe(iter.key()));
-    iter.Advance();
-  }
+  for (const std::string& child : entry->children)
+    list->push_back(base::FilePath::FromUTF8Unsafe(child));
   return true;
 }
 
 bool Archive::Realpath(const base::FilePath& path, base::FilePath* realpath) {
-  if (!header_)
+  if (!index_)
     return false;
 
-  const base::DictionaryValue* node;
-  if (!GetNodeFromPath(path.AsUTF8Unsafe(), header_.get(), &node))
+  const ArchiveIndex::Entry* entry = FindKey(NormalizePath(path));
+  if (!entry)
     return false;
 
-  std::string link;
-  if (node->GetString("link", &link)) {
-    *realpath = base::FilePath::FromUTF8Unsafe(link);
+  if (!entry->link.empty()) {
+    *realpath = base::FilePath::FromUTF8Unsafe(entry->link);
     return true;
   }
 
@@ -276,6 +305,8 @@ bool Archive::Realpath(const base::FilePath& path, base::FilePath* realpath) {
 }
 
 bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
+  TRACE_EVENT1("electron.asar", "asar::Archive::CopyFileOut", "path",
+               path.AsUTF8Unsafe());
   auto it = external_files_.find(path.value());
   if (it != external_files_.end()) {
     *out = it->second->path();
@@ -291,20 +322,116 @@ bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
     return true;
   }
 
-  auto temp_file = std::make_unique<ScopedTemporaryFile>();
-  base::FilePath::StringType ext = path.Extension();
-  if (!temp_file->InitFromFile(&file_, ext, info.offset, info.size))
+  scoped_refptr<ExtractedFile> extracted =
+      ExtractionCache::GetInstance()->GetOrExtract(
+          path_, path.Extension(), info.offset, info.size, info.executable,
+          base::Bind(&Archive::ReadFile, base::Unretained(this), info));
+  if (!extracted)
     return false;
 
-#if defined(OS_POSIX)
-  if (info.executable) {
-    // chmod a+x temp_file;
-    base::SetPosixFilePermissions(temp_file->path(), 0755);
+  *out = extracted->path();
+  external_files_[path.value()] = std::move(extracted);
+  return true;
+}
+
+bool Archive::ReadFile(const FileInfo& info, std::string* contents) {
+  TRACE_EVENT2("electron.asar", "asar::Archive::ReadFile", "size", info.size,
+               "compressed", info.compressed);
+  if (info.unpacked)
+    return false;
+
+  // Digests are checked off the hot path; this only fails once a
+  // background verification has recorded a mismatch.
+  if (!IntegrityChecker::GetInstance()->CheckRead(path_, info.offset,
+                                                  info.stored_size,
+                                                  info.integrity))
+    return false;
+
+  base::StringPiece data;
+  if (GetFileData(info, &data)) {
+    if (!info.compressed) {
+      data.CopyToString(contents);
+      return true;
+    }
+    size_t consumed = 0;
+    return InflateToString(
+        info.size,
+        base::Bind(
+            [](base::StringPiece data, size_t* consumed, char* buf, int size) {
+              int len = std::min(static_cast<size_t>(size),
+                                 data.size() - *consumed);
+              memcpy(buf, data.data() + *consumed, len);
+              *consumed += len;
+              return len;
+            },
+            data, base::Unretained(&consumed)),
+        contents);
   }
-#endif
 
-  *out = temp_file->path();
-  external_files_[path.value()] = std::move(temp_file);
+  // No mapping available; fall back to chunked reads from the file.
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  if (!info.compressed) {
+    contents->resize(info.size);
+    return file_.Read(info.offset, const_cast<char*>(contents->data()),
+                      info.size) == static_cast<int>(info.size);
+  }
+
+  int64_t read_offset = info.offset;
+  int64_t end_offset = info.offset + info.stored_size;
+  return InflateToString(
+      info.size,
+      base::Bind(
+          [](base::File* file, int64_t* offset, int64_t end, char* buf,
+             int size) {
+            int len = std::min(static_cast<int64_t>(size), end - *offset);
+            if (len <= 0)
+              return 0;
+            len = file->Read(*offset, buf, len);
+            if (len > 0)
+              *offset += len;
+            return len;
+          },
+          base::Unretained(&file_), base::Unretained(&read_offset),
+          end_offset),
+      contents);
+}
+
+bool Archive::GetFileData(const base::FilePath& path,
+                          base::StringPiece* data) {
+  FileInfo info;
+  if (!GetFileInfo(path, &info))
+    return false;
+  return GetFileData(info, data);
+}
+
+bool Archive::GetFileData(const FileInfo& info, base::StringPiece* data) {
+  if (info.unpacked)
+    return false;
+
+  if (!IntegrityChecker::GetInstance()->CheckRead(path_, info.offset,
+                                                  info.stored_size,
+                                                  info.integrity))
+    return false;
+
+  if (!mapped_file_) {
+    if (mapped_file_failed_)
+      return false;
+    base::ThreadRestrictions::ScopedAllowIO allow_io;
+    auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+    if (!mapped_file->Initialize(file_.Duplicate())) {
+      LOG(WARNING) << "Failed to map " << path_.value();
+      mapped_file_failed_ = true;
+      return false;
+    }
+    mapped_file_ = std::move(mapped_file);
+  }
+
+  if (info.offset + info.stored_size > mapped_file_->length())
+    return false;
+
+  *data = base::StringPiece(
+      reinterpret_cast<const char*>(mapped_file_->data()) + info.offset,
+      info.stored_size);
   return true;
 }
 
@@ -6,30 +6,45 @@
 #define ATOM_COMMON_ASAR_ARCHIVE_H_
 
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "atom/common/asar/archive_index.h"
+#include "atom/common/asar/extraction_cache.h"
 #include "base/files/file.h"
 #include "base/files/file_path.h"
-
-namespace base {
-class DictionaryValue;
-}
+#include "base/files/memory_mapped_file.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/lock.h"
 
 namespace asar {
 
-class ScopedTemporaryFile;
-
 // This class represents an asar package, and provides methods to read
 // information from it.
 class Archive {
  public:
   struct FileInfo {
-    FileInfo() : unpacked(false), executable(false), size(0), offset(0) {}
+    FileInfo()
+        : unpacked(false),
+          executable(false),
+          compressed(false),
+          size(0),
+          stored_size(0),
+          offset(0) {}
     bool unpacked;
     bool executable;
+    // Whether the stored bytes are deflate-compressed.
+    bool compressed;
+    // Uncompressed size.
     uint32_t size;
+    // Bytes occupied in the archive; equals |size| unless compressed.
+    uint32_t stored_size;
     uint64_t offset;
+    // SHA-256 digest of the stored bytes, empty when the header does
+    // not carry one. Verified lazily; see IntegrityChecker.
+    std::string integrity;
   };
 
   struct Stats : public FileInfo {
@@ -61,22 +76,55 @@ class Archive {
   // For unpacked file, this method will return its real path.
   bool CopyFileOut(const base::FilePath& path, base::FilePath* out);
 
+  // Get a zero-copy view of a packed file's contents, backed by a
+  // memory mapping of the archive that is shared by all readers of this
+  // Archive. The view stays valid for the lifetime of the Archive.
+  // Returns false for unpacked files, which live outside the archive.
+  // The view contains the stored (possibly compressed) bytes.
+  bool GetFileData(const base::FilePath& path, base::StringPiece* data);
+  bool GetFileData(const FileInfo& info, base::StringPiece* data);
+
+  // Reads the full decompressed contents of a packed file. Compressed
+  // entries are inflated incrementally, never materializing the stored
+  // bytes and the contents in one extra buffer.
+  bool ReadFile(const FileInfo& info, std::string* contents);
+
   // Returns the file's fd.
   int GetFD() const;
 
   base::FilePath path() const { return path_; }
-  base::DictionaryValue* header() const { return header_.get(); }
 
  private:
+  // Looks up |path| in the index, resolving links on the way.
+  const ArchiveIndex::Entry* FindEntry(const base::FilePath& path, int depth);
+
+  // Looks up a normalized index key, remembering misses. Requires
+  // |index_| to be set.
+  const ArchiveIndex::Entry* FindKey(const std::string& key);
+
   base::FilePath path_;
   base::File file_;
   int fd_ = -1;
   uint32_t header_size_ = 0;
-  std::unique_ptr<base::DictionaryValue> header_;
-
-  // Cached external temporary files.
-  std::unordered_map<base::FilePath::StringType,
-                     std::unique_ptr<ScopedTemporaryFile>>
+  std::unique_ptr<ArchiveIndex> index_;
+
+  // Lazily created memory mapping of the whole archive, used to serve
+  // zero-copy reads. |mapped_file_failed_| avoids retrying after a
+  // failed mmap.
+  std::unique_ptr<base::MemoryMappedFile> mapped_file_;
+  bool mapped_file_failed_ = false;
+
+  // Index keys known not to be in the archive. The index is immutable
+  // after Init(), so a miss never turns into a hit; remembering misses
+  // lets the module loader's repeated probes of non-existent paths skip
+  // the binary search. Guarded by |negative_lookups_lock_| because
+  // batched lookups run on worker threads.
+  base::Lock negative_lookups_lock_;
+  std::unordered_set<std::string> negative_lookups_;
+
+  // References into the process-wide extraction cache, so files this
+  // archive handed out stay alive while the archive does.
+  std::unordered_map<base::FilePath::StringType, scoped_refptr<ExtractedFile>>
       external_files_;
 
   DISALLOW_COPY_AND_ASSIGN(Archive);
@@ -0,0 +1,218 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/asar/archive_index.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/pickle.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/values.h"
+
+namespace asar {
+
+namespace {
+
+// Length of the raw SHA-256 digests carried by integrity fields.
+const size_t kSHA256DigestLength = 32;
+
+bool EntryLess(const std::pair<std::string, ArchiveIndex::Entry>& entry,
+               const std::string& path) {
+  return entry.first < path;
+}
+
+}  // namespace
+
+const char ArchiveIndex::kBinaryIndexMagic[4] = {'A', '3', 'I', 'X'};
+
+ArchiveIndex::Entry::Entry() = default;
+ArchiveIndex::Entry::Entry(const Entry& other) = default;
+ArchiveIndex::Entry::~Entry() = default;
+
+ArchiveIndex::ArchiveIndex() = default;
+ArchiveIndex::~ArchiveIndex() = default;
+
+// static
+bool ArchiveIndex::IsBinaryHeader(base::StringPiece payload) {
+  return payload.size() >= sizeof(kBinaryIndexMagic) &&
+         memcmp(payload.data(), kBinaryIndexMagic,
+                sizeof(kBinaryIndexMagic)) == 0;
+}
+
+bool ArchiveIndex::ParseBinary(base::StringPiece payload) {
+  if (!IsBinaryHeader(payload))
+    return false;
+
+  base::Pickle pickle(payload.data() + sizeof(kBinaryIndexMagic),
+                      payload.size() - sizeof(kBinaryIndexMagic));
+  base::PickleIterator iter(pickle);
+
+  uint32_t count;
+  if (!iter.ReadUInt32(&count))
+    return false;
+
+  entries_.reserve(count + 1);
+  for (uint32_t i = 0; i < count; ++i) {
+    std::string path;
+    Entry entry;
+    uint32_t flags;
+    if (!iter.ReadString(&path) || !iter.ReadUInt32(&flags) ||
+        !iter.ReadUInt64(&entry.offset) || !iter.ReadUInt32(&entry.size) ||
+        !iter.ReadUInt32(&entry.stored_size) || !iter.ReadString(&entry.link) ||
+        ((flags & 16) != 0 && !iter.ReadString(&entry.integrity))) {
+      entries_.clear();
+      return false;
+    }
+    entry.is_directory = (flags & 1) != 0;
+    entry.unpacked = (flags & 2) != 0;
+    entry.executable = (flags & 4) != 0;
+    entry.compressed = (flags & 8) != 0;
+    entries_.emplace_back(std::move(path), std::move(entry));
+  }
+
+  // Rebuild directory listings from the flat table so the writer does
+  // not have to serialize them twice.
+  Entry root;
+  root.is_directory = true;
+  entries_.emplace_back(std::string(), std::move(root));
+  SortEntries();
+  for (auto& pair : entries_) {
+    if (pair.first.empty())
+      continue;
+    size_t slash = pair.first.find_last_of('/');
+    std::string parent =
+        slash == std::string::npos ? std::string() : pair.first.substr(0, slash);
+    std::string name = slash == std::string::npos
+                           ? pair.first
+                           : pair.first.substr(slash + 1);
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), parent,
+                               EntryLess);
+    if (it != entries_.end() && it->first == parent)
+      it->second.children.push_back(std::move(name));
+  }
+  return true;
+}
+
+bool ArchiveIndex::BuildFromJson(const base::DictionaryValue& root) {
+  entries_.clear();
+
+  Entry root_entry;
+  root_entry.is_directory = true;
+
+  const base::DictionaryValue* files = nullptr;
+  if (root.GetDictionaryWithoutPathExpansion("files", &files) &&
+      !AddDirectory(std::string(), files, &root_entry)) {
+    entries_.clear();
+    return false;
+  }
+
+  entries_.emplace_back(std::string(), std::move(root_entry));
+  SortEntries();
+  return true;
+}
+
+bool ArchiveIndex::AddDirectory(const std::string& path,
+                                const base::DictionaryValue* files,
+                                Entry* dir) {
+  for (base::DictionaryValue::Iterator iter(*files); !iter.IsAtEnd();
+       iter.Advance()) {
+    const base::DictionaryValue* node = nullptr;
+    if (!iter.value().GetAsDictionary(&node))
+      return false;
+
+    std::string child_path =
+        path.empty() ? iter.key() : path + "/" + iter.key();
+    dir->children.push_back(iter.key());
+
+    Entry entry;
+    const base::DictionaryValue* child_files = nullptr;
+    if (node->GetStringWithoutPathExpansion("link", &entry.link)) {
+      // Nothing else to fill in for links.
+    } else if (node->GetDictionaryWithoutPathExpansion("files",
+                                                       &child_files)) {
+      entry.is_directory = true;
+      if (!AddDirectory(child_path, child_files, &entry))
+        return false;
+    } else {
+      int size;
+      if (!node->GetInteger("size", &size))
+        return false;
+      entry.size = static_cast<uint32_t>(size);
+      entry.stored_size = entry.size;
+      node->GetBoolean("unpacked", &entry.unpacked);
+      node->GetBoolean("executable", &entry.executable);
+      node->GetBoolean("compressed", &entry.compressed);
+      int stored_size;
+      if (entry.compressed && node->GetInteger("csize", &stored_size))
+        entry.stored_size = static_cast<uint32_t>(stored_size);
+      if (!entry.unpacked) {
+        std::string offset;
+        if (!node->GetString("offset", &offset) ||
+            !base::StringToUint64(offset, &entry.offset))
+          return false;
+      }
+      std::string integrity_hex;
+      if (node->GetString("integrity", &integrity_hex)) {
+        std::vector<uint8_t> digest;
+        if (!base::HexStringToBytes(integrity_hex, &digest) ||
+            digest.size() != kSHA256DigestLength)
+          return false;
+        entry.integrity.assign(digest.begin(), digest.end());
+      }
+    }
+
+    entries_.emplace_back(std::move(child_path), std::move(entry));
+  }
+  return true;
+}
+
+void ArchiveIndex::SortEntries() {
+  std::sort(entries_.begin(), entries_.end(),
+            [](const std::pair<std::string, Entry>& a,
+               const std::pair<std::string, Entry>& b) {
+              return a.first < b.first;
+            });
+}
+
+void ArchiveIndex::SerializeBinary(std::string* payload) const {
+  base::Pickle pickle;
+  uint32_t count = 0;
+  for (const auto& pair : entries_) {
+    if (!pair.first.empty())
+      ++count;
+  }
+  pickle.WriteUInt32(count);
+  for (const auto& pair : entries_) {
+    if (pair.first.empty())
+      continue;
+    const Entry& entry = pair.second;
+    uint32_t flags = (entry.is_directory ? 1 : 0) | (entry.unpacked ? 2 : 0) |
+                     (entry.executable ? 4 : 0) | (entry.compressed ? 8 : 0) |
+                     (entry.integrity.empty() ? 0 : 16);
+    pickle.WriteString(pair.first);
+    pickle.WriteUInt32(flags);
+    pickle.WriteUInt64(entry.offset);
+    pickle.WriteUInt32(entry.size);
+    pickle.WriteUInt32(entry.stored_size);
+    pickle.WriteString(entry.link);
+    // Flag-gated so digest-less archives keep the old record layout.
+    if (!entry.integrity.empty())
+      pickle.WriteString(entry.integrity);
+  }
+
+  payload->assign(kBinaryIndexMagic, sizeof(kBinaryIndexMagic));
+  payload->append(static_cast<const char*>(pickle.data()), pickle.size());
+}
+
+const ArchiveIndex::Entry* ArchiveIndex::Find(const std::string& path) const {
+  auto it = std::lower_bound(entries_.begin(), entries_.end(), path,
+                             EntryLess);
+  if (it == entries_.end() || it->first != path)
+    return nullptr;
+  return &it->second;
+}
+
+}  // namespace asar
@@ -0,0 +1,95 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_ASAR_ARCHIVE_INDEX_H_
+#define ATOM_COMMON_ASAR_ARCHIVE_INDEX_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "base/strings/string_piece.h"
+
+namespace base {
+class DictionaryValue;
+}
+
+namespace asar {
+
+// A flat, sorted index of every entry in an asar archive, keyed by the
+// entry's full slash-separated path. Lookups are a binary search over
+// the sorted path table instead of a per-component walk of the JSON
+// header tree.
+//
+// The index can be built two ways:
+//  - directly from a v3 binary header (ParseBinary), or
+//  - converted from the JSON header of a v1/v2 archive (BuildFromJson).
+class ArchiveIndex {
+ public:
+  struct Entry {
+    Entry();
+    Entry(const Entry& other);
+    ~Entry();
+
+    bool is_directory = false;
+    bool unpacked = false;
+    bool executable = false;
+    // Whether the stored bytes are deflate-compressed.
+    bool compressed = false;
+    // Uncompressed size of the entry.
+    uint32_t size = 0;
+    // Bytes occupied in the archive; equals |size| unless compressed.
+    uint32_t stored_size = 0;
+    uint64_t offset = 0;
+    // Link target for symlinked entries, empty otherwise.
+    std::string link;
+    // SHA-256 digest of the stored bytes, empty when the header does
+    // not carry one. Verified lazily; see IntegrityChecker.
+    std::string integrity;
+    // Child names for directories, in header order.
+    std::vector<std::string> children;
+  };
+
+  ArchiveIndex();
+  ~ArchiveIndex();
+
+  // Parses a v3 binary header payload. The payload starts with the
+  // kBinaryIndexMagic tag, followed by a uint32 entry count and then
+  // |count| length-prefixed records sorted by path.
+  bool ParseBinary(base::StringPiece payload);
+
+  // Converts the parsed JSON header of a v1/v2 archive into the flat
+  // index. This is the compatibility path for old archives.
+  bool BuildFromJson(const base::DictionaryValue& root);
+
+  // Returns the entry for |path| ("" is the root directory), or nullptr
+  // if the path is not in the archive. Does not resolve links.
+  const Entry* Find(const std::string& path) const;
+
+  // Serializes the index into the v3 binary payload format, the inverse
+  // of ParseBinary. Directory listings are not serialized; ParseBinary
+  // rebuilds them from the flat table.
+  void SerializeBinary(std::string* payload) const;
+
+  // Returns true if |payload| looks like a v3 binary header.
+  static bool IsBinaryHeader(base::StringPiece payload);
+
+  static const char kBinaryIndexMagic[4];
+
+ private:
+  bool AddDirectory(const std::string& path,
+                    const base::DictionaryValue* files,
+                    Entry* dir);
+  void SortEntries();
+
+  // Sorted by path for binary search.
+  std::vector<std::pair<std::string, Entry>> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArchiveIndex);
+};
+
+}  // namespace asar
+
+#endif  // ATOM_COMMON_ASAR_ARCHIVE_INDEX_H_
@@ -0,0 +1,130 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/asar/asar_header_cache.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "atom/common/asar/archive_index.h"
+#include "atom/common/options_switches.h"
+#include "base/command_line.h"
+#include "base/pickle.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+
+#if defined(OS_POSIX)
+#include "base/posix/global_descriptors.h"
+#endif
+
+namespace asar {
+
+// static
+AsarHeaderCache* AsarHeaderCache::GetInstance() {
+  return base::Singleton<AsarHeaderCache>::get();
+}
+
+AsarHeaderCache::AsarHeaderCache() = default;
+AsarHeaderCache::~AsarHeaderCache() = default;
+
+void AsarHeaderCache::EnableProducer() {
+  producer_ = true;
+}
+
+void AsarHeaderCache::PublishIndex(const base::FilePath& path,
+                                   const ArchiveIndex& index) {
+  if (!producer_)
+    return;
+
+  std::string payload;
+  index.SerializeBinary(&payload);
+
+  auto shm = std::make_unique<base::SharedMemory>();
+  if (!shm->CreateAndMapAnonymous(payload.size()))
+    return;
+  memcpy(shm->memory(), payload.data(), payload.size());
+
+  base::AutoLock auto_lock(lock_);
+  regions_[path] = std::move(shm);
+}
+
+std::string AsarHeaderCache::GetSwitchValueForChild() {
+  std::string value;
+  base::AutoLock auto_lock(lock_);
+  for (const auto& pair : regions_) {
+    if (!value.empty())
+      value.append(";");
+    value.append(pair.first.AsUTF8Unsafe());
+    value.append(":");
+    value.append(base::NumberToString(pair.second->mapped_size()));
+  }
+  return value;
+}
+
+std::vector<base::SharedMemoryHandle> AsarHeaderCache::GetRegionHandles() {
+  std::vector<base::SharedMemoryHandle> handles;
+  base::AutoLock auto_lock(lock_);
+  for (const auto& pair : regions_)
+    handles.push_back(pair.second->handle());
+  return handles;
+}
+
+void AsarHeaderCache::InitFromCommandLine(
+    const base::CommandLine& command_line,
+    int first_key) {
+#if defined(OS_POSIX) && !defined(OS_MACOSX)
+  std::string value =
+      command_line.GetSwitchValueASCII(atom::switches::kAsarIndexRegions);
+  if (value.empty())
+    return;
+
+  int key = first_key;
+  for (const std::string& entry : base::SplitString(
+           value, ";", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    size_t colon = entry.find_last_of(':');
+    if (colon == std::string::npos)
+      continue;
+    size_t size;
+    if (!base::StringToSizeT(entry.substr(colon + 1), &size))
+      continue;
+
+    int fd = base::GlobalDescriptors::GetInstance()->MaybeGet(key++);
+    if (fd == -1)
+      continue;
+
+    base::SharedMemoryHandle handle(
+        base::FileDescriptor(fd, false /* auto_close */),
+        size, base::UnguessableToken::Create());
+    auto shm = std::make_unique<base::SharedMemory>(handle,
+                                                    true /* read_only */);
+    if (!shm->Map(size))
+      continue;
+
+    base::AutoLock auto_lock(lock_);
+    regions_[base::FilePath::FromUTF8Unsafe(entry.substr(0, colon))] =
+        std::move(shm);
+  }
+#endif
+}
+
+std::unique_ptr<ArchiveIndex> AsarHeaderCache::GetSharedIndex(
+    const base::FilePath& path) {
+  base::SharedMemory* shm = nullptr;
+  {
+    base::AutoLock auto_lock(lock_);
+    auto it = regions_.find(path);
+    if (it == regions_.end())
+      return nullptr;
+    shm = it->second.get();
+  }
+
+  auto index = std::make_unique<ArchiveIndex>();
+  if (!index->ParseBinary(base::StringPiece(
+          static_cast<const char*>(shm->memory()), shm->mapped_size())))
+    return nullptr;
+  return index;
+}
+
+}  // namespace asar
@@ -0,0 +1,84 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_ASAR_ASAR_HEADER_CACHE_H_
+#define ATOM_COMMON_ASAR_ASAR_HEADER_CACHE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/macros.h"
+#include "base/memory/shared_memory.h"
+#include "base/memory/singleton.h"
+#include "base/synchronization/lock.h"
+
+namespace base {
+class CommandLine;
+}
+
+namespace asar {
+
+class ArchiveIndex;
+
+// Descriptor key of the first shared index region mapped into a child
+// process, chosen well above the range content uses for its own
+// descriptors.
+const int kAsarIndexDescriptorStart = 100;
+
+// Cross-process cache of parsed asar indexes.
+//
+// The browser process parses each archive header once, serializes the
+// flat index into a read-only shared memory region and hands the region
+// to child processes at launch (as a mapped descriptor on POSIX).
+// Children deserialize the compact binary payload from the mapping
+// instead of re-reading and re-parsing the JSON header, and the region
+// itself is shared so the raw header bytes are resident only once.
+class AsarHeaderCache {
+ public:
+  static AsarHeaderCache* GetInstance();
+
+  // Called in the browser process before any archive is opened.
+  void EnableProducer();
+  bool is_producer() const { return producer_; }
+
+  // Browser: store the serialized |index| of |path| in shared memory.
+  void PublishIndex(const base::FilePath& path, const ArchiveIndex& index);
+
+  // Browser: the "path:size" list advertised to children, telling them
+  // which archive each mapped region belongs to.
+  std::string GetSwitchValueForChild();
+
+  // Browser: handles of the shared regions, in the same order as the
+  // entries of GetSwitchValueForChild().
+  std::vector<base::SharedMemoryHandle> GetRegionHandles();
+
+  // Child: map the regions advertised on the command line.
+  void InitFromCommandLine(const base::CommandLine& command_line,
+                           int first_key);
+
+  // Any process: deserialize the shared index for |path|, if present.
+  // Returns nullptr on a cache miss.
+  std::unique_ptr<ArchiveIndex> GetSharedIndex(const base::FilePath& path);
+
+ private:
+  friend struct base::DefaultSingletonTraits<AsarHeaderCache>;
+
+  AsarHeaderCache();
+  ~AsarHeaderCache();
+
+  bool producer_ = false;
+
+  // Guards |regions_|; archives can be opened from several threads.
+  base::Lock lock_;
+  std::map<base::FilePath, std::unique_ptr<base::SharedMemory>> regions_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsarHeaderCache);
+};
+
+}  // namespace asar
+
+#endif  // ATOM_COMMON_ASAR_ASAR_HEADER_CACHE_H_
@@ -87,14 +87,9 @@ bool ReadFileToString(const base::FilePath& path, std::string* contents) {
     return base::ReadFileToString(real_path, contents);
   }
 
-  base::File src(asar_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
-  if (!src.IsValid())
-    return false;
-
-  contents->resize(info.size);
-  return static_cast<int>(info.size) ==
-         src.Read(info.offset, const_cast<char*>(contents->data()),
-                  contents->size());
+  // Serve the read from the shared memory mapping of the archive when
+  // possible, inflating compressed entries incrementally.
+  return archive->ReadFile(info, contents);
 }
 
 }  // namespace asar
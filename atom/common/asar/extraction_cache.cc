@@ -0,0 +1,157 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/asar/extraction_cache.h"
+
+#include <string>
+
+#include "base/base_paths.h"
+#include "base/files/file_util.h"
+#include "base/md5.h"
+#include "base/path_service.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
+#include "base/threading/thread_restrictions.h"
+#include "build/build_config.h"
+
+#if defined(OS_POSIX)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace asar {
+
+namespace {
+
+const base::FilePath::CharType kCacheDirName[] =
+    FILE_PATH_LITERAL("electron-asar-cache");
+
+// A stable per-extraction file name: one directory per (archive path,
+// archive mtime), one file per offset inside it. The cache must live in
+// a per-user directory — extractions include files that are later made
+// executable and run, so a world-writable location such as the temp dir
+// would let any local user control what the app executes.
+base::FilePath GetCachePath(const base::FilePath& archive_path,
+                            const base::Time& mtime,
+                            const base::FilePath::StringType& ext,
+                            uint64_t offset) {
+  base::FilePath cache_dir;
+#if defined(OS_POSIX)
+  if (!PathService::Get(base::DIR_CACHE, &cache_dir))
+    return base::FilePath();
+#else
+  if (!PathService::Get(base::DIR_APP_DATA, &cache_dir))
+    return base::FilePath();
+#endif
+
+  std::string key = base::StringPrintf(
+      "%s-%" PRId64, archive_path.AsUTF8Unsafe().c_str(),
+      mtime.ToInternalValue());
+  base::FilePath path = cache_dir.Append(kCacheDirName)
+                            .AppendASCII(base::MD5String(key))
+                            .AppendASCII(base::NumberToString(offset));
+  if (!ext.empty())
+    path = path.AddExtension(ext);
+  return path;
+}
+
+// Returns true when the file at |path| may be reused: it must be a
+// regular file owned by the current user that nobody else can write.
+bool IsTrustedCacheFile(const base::FilePath& path) {
+#if defined(OS_POSIX)
+  struct stat info;
+  if (lstat(path.value().c_str(), &info) != 0)
+    return false;
+  return S_ISREG(info.st_mode) && info.st_uid == getuid() &&
+         (info.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+#else
+  return true;
+#endif
+}
+
+}  // namespace
+
+ExtractedFile::ExtractedFile(const base::FilePath& path) : path_(path) {}
+
+ExtractedFile::~ExtractedFile() = default;
+
+// static
+ExtractionCache* ExtractionCache::GetInstance() {
+  return base::Singleton<ExtractionCache>::get();
+}
+
+ExtractionCache::ExtractionCache() = default;
+ExtractionCache::~ExtractionCache() = default;
+
+scoped_refptr<ExtractedFile> ExtractionCache::GetOrExtract(
+    const base::FilePath& archive_path,
+    const base::FilePath::StringType& ext,
+    uint64_t offset,
+    uint64_t size,
+    bool executable,
+    const base::Callback<bool(std::string*)>& read_contents) {
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+
+  base::File::Info archive_info;
+  if (!base::GetFileInfo(archive_path, &archive_info))
+    return nullptr;
+
+  base::FilePath path =
+      GetCachePath(archive_path, archive_info.last_modified, ext, offset);
+  if (path.empty())
+    return nullptr;
+
+  {
+    base::AutoLock auto_lock(lock_);
+    auto it = files_.find(path);
+    if (it != files_.end())
+      return it->second;
+  }
+
+  std::string contents;
+  if (!read_contents.Run(&contents) || contents.size() != size)
+    return nullptr;
+
+  // A previous run may have left a valid extraction on disk. Reuse it
+  // only when it is owned by the current user and its bytes match what
+  // the archive holds — a size check alone would let another process
+  // plant a payload of the right length.
+  std::string cached;
+  bool valid = IsTrustedCacheFile(path) &&
+               base::ReadFileToString(path, &cached) && cached == contents;
+
+  if (!valid) {
+    if (!base::CreateDirectory(path.DirName()))
+      return nullptr;
+#if defined(OS_POSIX)
+    // Keep the cache private to the current user.
+    base::SetPosixFilePermissions(path.DirName(), 0700);
+    base::SetPosixFilePermissions(path.DirName().DirName(), 0700);
+#endif
+
+    // Write to a temporary name first so concurrent processes never see
+    // a half-written extraction.
+    base::FilePath temp_path;
+    if (!base::CreateTemporaryFileInDir(path.DirName(), &temp_path))
+      return nullptr;
+    if (base::WriteFile(temp_path, contents.data(), contents.size()) !=
+            static_cast<int>(size) ||
+        !base::ReplaceFile(temp_path, path, nullptr)) {
+      base::DeleteFile(temp_path, false);
+      return nullptr;
+    }
+  }
+
+#if defined(OS_POSIX)
+  if (executable)
+    base::SetPosixFilePermissions(path, 0755);
+#endif
+
+  auto file = base::MakeRefCounted<ExtractedFile>(path);
+  base::AutoLock auto_lock(lock_);
+  files_[path] = file;
+  return file;
+}
+
+}  // namespace asar
@@ -0,0 +1,79 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_ASAR_EXTRACTION_CACHE_H_
+#define ATOM_COMMON_ASAR_EXTRACTION_CACHE_H_
+
+#include <map>
+#include <string>
+
+#include "base/callback.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/macros.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/singleton.h"
+#include "base/synchronization/lock.h"
+
+namespace asar {
+
+// A file extracted from an asar archive into the on-disk cache. The file
+// itself outlives this object — extractions are persistent so repeated
+// launches (and repeated child_process spawns) reuse them — but holding
+// a reference keeps the cache from pruning it while in use.
+class ExtractedFile : public base::RefCountedThreadSafe<ExtractedFile> {
+ public:
+  explicit ExtractedFile(const base::FilePath& path);
+
+  const base::FilePath& path() const { return path_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<ExtractedFile>;
+  ~ExtractedFile();
+
+  base::FilePath path_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExtractedFile);
+};
+
+// Process-wide cache of files extracted from asar archives, replacing
+// the per-Archive ScopedTemporaryFile churn. Extractions live under a
+// stable directory keyed by archive path, archive mtime and file
+// offset, so a file is written once and then reused by every Archive
+// in this process and by later runs of the app.
+class ExtractionCache {
+ public:
+  static ExtractionCache* GetInstance();
+
+  // Returns the cached extraction of the entry at |offset|.
+  // |read_contents| produces the final, decompressed bytes (|size| is
+  // their expected length); it is always run, because an extraction
+  // found on disk is only reused after its bytes are validated against
+  // the archive's. |archive_path| and the archive's mtime form the
+  // cache key, so a rebuilt archive never serves stale contents.
+  // Returns nullptr on I/O failure.
+  scoped_refptr<ExtractedFile> GetOrExtract(
+      const base::FilePath& archive_path,
+      const base::FilePath::StringType& ext,
+      uint64_t offset,
+      uint64_t size,
+      bool executable,
+      const base::Callback<bool(std::string*)>& read_contents);
+
+ private:
+  friend struct base::DefaultSingletonTraits<ExtractionCache>;
+
+  ExtractionCache();
+  ~ExtractionCache();
+
+  // Guards |files_|; extraction can happen on several threads.
+  base::Lock lock_;
+  std::map<base::FilePath, scoped_refptr<ExtractedFile>> files_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExtractionCache);
+};
+
+}  // namespace asar
+
+#endif  // ATOM_COMMON_ASAR_EXTRACTION_CACHE_H_
@@ -0,0 +1,103 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/asar/integrity_checker.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "base/bind.h"
+#include "base/files/file.h"
+#include "base/logging.h"
+#include "base/task_scheduler/post_task.h"
+#include "crypto/secure_hash.h"
+#include "crypto/sha2.h"
+
+namespace asar {
+
+IntegrityChecker::IntegrityChecker() {}
+
+IntegrityChecker::~IntegrityChecker() {}
+
+// static
+IntegrityChecker* IntegrityChecker::GetInstance() {
+  return base::Singleton<IntegrityChecker>::get();
+}
+
+bool IntegrityChecker::CheckRead(const base::FilePath& archive_path,
+                                 uint64_t offset,
+                                 uint32_t stored_size,
+                                 const std::string& expected_digest) {
+  if (expected_digest.empty())
+    return true;
+
+  EntryKey key(archive_path, offset);
+  {
+    base::AutoLock lock(lock_);
+    auto it = states_.find(key);
+    if (it != states_.end())
+      return it->second != State::kMismatch;
+    states_[key] = State::kPending;
+  }
+
+  // First read of this entry: serve it, hash in the background.
+  base::PostTaskWithTraits(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BACKGROUND,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::Bind(&IntegrityChecker::VerifyOnWorker, archive_path, offset,
+                 stored_size, expected_digest));
+  return true;
+}
+
+// static
+void IntegrityChecker::VerifyOnWorker(const base::FilePath& archive_path,
+                                      uint64_t offset,
+                                      uint32_t stored_size,
+                                      const std::string& expected_digest) {
+  // The archive file is opened independently of the Archive that
+  // triggered the check, so this task never races its destruction.
+  base::File file(archive_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  State state = State::kMismatch;
+  if (file.IsValid()) {
+    std::unique_ptr<crypto::SecureHash> hash(
+        crypto::SecureHash::Create(crypto::SecureHash::SHA256));
+    char buf[65536];
+    int64_t read_offset = offset;
+    uint32_t remaining = stored_size;
+    while (remaining > 0) {
+      int len = file.Read(
+          read_offset, buf,
+          std::min(static_cast<uint32_t>(sizeof(buf)), remaining));
+      if (len <= 0)
+        break;
+      hash->Update(buf, len);
+      read_offset += len;
+      remaining -= len;
+    }
+    if (remaining == 0) {
+      char digest[crypto::kSHA256Length];
+      hash->Finish(digest, sizeof(digest));
+      if (expected_digest.size() == sizeof(digest) &&
+          memcmp(digest, expected_digest.data(), sizeof(digest)) == 0)
+        state = State::kOk;
+    }
+  }
+
+  if (state == State::kMismatch) {
+    LOG(ERROR) << "Integrity check failed for entry at offset " << offset
+               << " of " << archive_path.value()
+               << "; further reads of it will fail";
+  }
+  GetInstance()->RecordResult(EntryKey(archive_path, offset), state);
+}
+
+void IntegrityChecker::RecordResult(const EntryKey& key, State state) {
+  base::AutoLock lock(lock_);
+  states_[key] = state;
+}
+
+}  // namespace asar
@@ -0,0 +1,69 @@
+// Copyright (c) 2017 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_ASAR_INTEGRITY_CHECKER_H_
+#define ATOM_COMMON_ASAR_INTEGRITY_CHECKER_H_
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/macros.h"
+#include "base/memory/singleton.h"
+#include "base/synchronization/lock.h"
+
+namespace asar {
+
+// Process-wide lazy verification of packed asar entries against the
+// SHA-256 digests optionally carried by the archive header.
+//
+// Hashing on the read path would tax every require(), so an entry is
+// instead verified once, on a background worker, the first time it is
+// read: that first read is served unconditionally while the worker
+// hashes the stored bytes, and only reads after a recorded mismatch
+// fail. BoringSSL's vectorized SHA-256 keeps the background pass cheap.
+class IntegrityChecker {
+ public:
+  static IntegrityChecker* GetInstance();
+
+  // Called on every packed read. Returns false when a previous
+  // verification of the bytes at |offset| found a mismatch; otherwise
+  // returns true, scheduling the background hash on the first call for
+  // this entry. |expected_digest| may be empty (no digest, no check).
+  bool CheckRead(const base::FilePath& archive_path,
+                 uint64_t offset,
+                 uint32_t stored_size,
+                 const std::string& expected_digest);
+
+ private:
+  friend struct base::DefaultSingletonTraits<IntegrityChecker>;
+
+  enum class State { kPending, kOk, kMismatch };
+
+  // Archive path plus the entry's absolute offset in it.
+  using EntryKey = std::pair<base::FilePath, uint64_t>;
+
+  IntegrityChecker();
+  ~IntegrityChecker();
+
+  // Runs on a background worker: hashes |stored_size| bytes at |offset|
+  // of |archive_path| and records the verdict.
+  static void VerifyOnWorker(const base::FilePath& archive_path,
+                             uint64_t offset,
+                             uint32_t stored_size,
+                             const std::string& expected_digest);
+
+  void RecordResult(const EntryKey& key, State state);
+
+  // Guards |states_|; reads come from several threads.
+  base::Lock lock_;
+  std::map<EntryKey, State> states_;
+
+  DISALLOW_COPY_AND_ASSIGN(IntegrityChecker);
+};
+
+}  // namespace asar
+
+#endif  // ATOM_COMMON_ASAR_INTEGRITY_CHECKER_H_
@@ -4,46 +4,56 @@
 
 #include "atom/common/color_util.h"
 
-#include <vector>
-
-#include "base/strings/string_number_conversions.h"
-#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 
 namespace atom {
 
+namespace {
+
+// Returns the value of a hex digit, or -1 for other characters.
+int HexDigitValue(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+}  // namespace
+
 SkColor ParseHexColor(const std::string& color_string) {
   // Check the string for incorrect formatting.
   if (color_string.empty() || color_string[0] != '#')
     return SK_ColorWHITE;
 
-  // Prepend FF if alpha channel is not specified.
-  std::string source = color_string.substr(1);
-  if (source.size() == 3)
-    source.insert(0, "F");
-  else if (source.size() == 6)
-    source.insert(0, "FF");
-
-  // Convert the string from #FFF format to #FFFFFF format.
-  std::string formatted_color;
-  if (source.size() == 4) {
-    for (size_t i = 0; i < 4; ++i) {
-      formatted_color += source[i];
-      formatted_color += source[i];
+  // #RGB and #ARGB use one hex digit per channel, #RRGGBB and #AARRGGBB
+  // two; the alpha channel defaults to FF when not specified. The digits
+  // are parsed in place, so callers invoking this per frame (e.g. animated
+  // setBackgroundColor) do not allocate.
+  const char* hex = color_string.c_str() + 1;
+  size_t size = color_string.size() - 1;
+  uint32_t channels[4] = {0xFF, 0, 0, 0};  // ARGB.
+  if (size == 3 || size == 4) {
+    for (size_t i = 4 - size, j = 0; j < size; ++i, ++j) {
+      int digit = HexDigitValue(hex[j]);
+      if (digit < 0)
+        return SK_ColorWHITE;
+      channels[i] = digit * 0x11;
+    }
+  } else if (size == 6 || size == 8) {
+    for (size_t i = (8 - size) / 2, j = 0; j < size; ++i, j += 2) {
+      int high = HexDigitValue(hex[j]);
+      int low = HexDigitValue(hex[j + 1]);
+      if (high < 0 || low < 0)
+        return SK_ColorWHITE;
+      channels[i] = high * 16 + low;
     }
-  } else if (source.size() == 8) {
-    formatted_color = source;
   } else {
     return SK_ColorWHITE;
   }
-
-  // Convert the string to an integer and make sure it is in the correct value
-  // range.
-  std::vector<uint8_t> bytes;
-  if (!base::HexStringToBytes(formatted_color, &bytes))
-    return SK_ColorWHITE;
-
-  return SkColorSetARGB(bytes[0], bytes[1], bytes[2], bytes[3]);
+  return SkColorSetARGB(channels[0], channels[1], channels[2], channels[3]);
 }
 
 std::string ToRGBHex(SkColor color) {
@@ -29,7 +29,9 @@ void CrashReporter::Start(const std::string& product_name,
                           const base::FilePath& crashes_dir,
                           bool upload_to_server,
                           bool skip_system_crash_handler,
+                          bool micro_dump,
                           const StringMap& extra_parameters) {
+  micro_dump_ = micro_dump;
   SetUploadParameters(extra_parameters);
 
   InitBreakpad(product_name, ATOM_VERSION_STRING, company_name, submit_url,
@@ -120,8 +122,11 @@ void CrashReporter::StartInstance(const mate::Dictionary& options) {
   extra_parameters["_productName"] = product_name;
   extra_parameters["_companyName"] = company_name;
 
+  bool micro_dump = false;
+  options.Get("microDump", &micro_dump);
+
   reporter->Start(product_name, company_name, submit_url, crashes_dir, true,
-                  false, extra_parameters);
+                  false, micro_dump, extra_parameters);
 }
 
 }  // namespace crash_reporter
@@ -30,6 +30,7 @@ class CrashReporter {
              const base::FilePath& crashes_dir,
              bool upload_to_server,
              bool skip_system_crash_handler,
+             bool micro_dump,
              const StringMap& extra_parameters);
 
   virtual std::vector<CrashReporter::UploadReportResult> GetUploadedReports(
@@ -58,6 +59,11 @@ class CrashReporter {
   StringMap upload_parameters_;
   bool is_browser_;
 
+  // When true, crashes produce a few-KB microdump (stack, registers and
+  // module list) through the logger instead of a full minidump file.
+  // Currently only honored on Linux.
+  bool micro_dump_ = false;
+
  private:
   void SetUploadParameters(const StringMap& parameters);
 
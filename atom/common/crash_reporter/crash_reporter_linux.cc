@@ -58,7 +58,10 @@ void CrashReporterLinux::InitBreakpad(const std::string& product_name,
                                       const base::FilePath& crashes_dir,
                                       bool upload_to_server,
                                       bool skip_system_crash_handler) {
-  EnableCrashDumping(crashes_dir);
+  if (micro_dump_)
+    EnableMicrodumpCrashDumping(product_name, version);
+  else
+    EnableCrashDumping(crashes_dir);
 
   crash_keys_.reset(new CrashKeyStorage());
 
@@ -101,6 +104,35 @@ void CrashReporterLinux::EnableCrashDumping(const base::FilePath& crashes_dir) {
                                        -1));
 }
 
+void CrashReporterLinux::EnableMicrodumpCrashDumping(
+    const std::string& product_name,
+    const std::string& version) {
+  // Microdumps hold just the crashing stack, registers and module list --
+  // a few KB emitted through the logger instead of a dump file on disk, so
+  // crash signatures cost near-zero disk and upload.
+  MinidumpDescriptor descriptor(MinidumpDescriptor::kMicrodumpOnConsole);
+  microdump_product_info_ = product_name + ":" + version;
+  descriptor.microdump_extra_info()->product_info =
+      microdump_product_info_.c_str();
+
+  breakpad_.reset(new ExceptionHandler(descriptor, NULL, MicrodumpDone, this,
+                                       true,  // Install handlers.
+                                       -1));
+}
+
+bool CrashReporterLinux::MicrodumpDone(const MinidumpDescriptor& minidump,
+                                       void* context,
+                                       const bool succeeded) {
+  // WARNING: this code runs in a compromised context. It may not call into
+  // libc nor allocate memory normally.
+  if (!succeeded) {
+    const char msg[] = "Failed to generate microdump.";
+    WriteLog(msg, sizeof(msg) - 1);
+  }
+  // There is no dump file to upload; the microdump already went to the log.
+  return succeeded;
+}
+
 bool CrashReporterLinux::CrashDone(const MinidumpDescriptor& minidump,
                                    void* context,
                                    const bool succeeded) {
@@ -46,10 +46,15 @@ class CrashReporterLinux : public CrashReporter {
   ~CrashReporterLinux() override;
 
   void EnableCrashDumping(const base::FilePath& crashes_dir);
+  void EnableMicrodumpCrashDumping(const std::string& product_name,
+                                   const std::string& version);
 
   static bool CrashDone(const google_breakpad::MinidumpDescriptor& minidump,
                         void* context,
                         const bool succeeded);
+  static bool MicrodumpDone(const google_breakpad::MinidumpDescriptor& minidump,
+                            void* context,
+                            const bool succeeded);
 
   std::unique_ptr<google_breakpad::ExceptionHandler> breakpad_;
   std::unique_ptr<CrashKeyStorage> crash_keys_;
@@ -57,6 +62,8 @@ class CrashReporterLinux : public CrashReporter {
   uint64_t process_start_time_ = 0;
   pid_t pid_ = 0;
   std::string upload_url_;
+  // Referenced by breakpad's microdump extra info; must outlive breakpad_.
+  std::string microdump_product_info_;
   bool upload_to_server_ = true;
 
   DISALLOW_COPY_AND_ASSIGN(CrashReporterLinux);
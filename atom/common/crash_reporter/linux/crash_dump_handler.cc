@@ -9,6 +9,7 @@
 #include "atom/common/crash_reporter/linux/crash_dump_handler.h"
 
 #include <poll.h>
+#include <sys/wait.h>
 
 #include <algorithm>
 
@@ -96,6 +97,7 @@ const char g_form_data_msg[] = "Content-Disposition: form-data; name=\"";
 const char g_quote_msg[] = "\"";
 const char g_dashdash_msg[] = "--";
 const char g_dump_msg[] = "upload_file_minidump\"; filename=\"dump\"";
+const char g_dump_gz_msg[] = "upload_file_minidump\"; filename=\"dump.gz\"";
 const char g_content_type_msg[] = "Content-Type: application/octet-stream";
 
 // MimeWriter manages an iovec for writing MIMEs to a file.
@@ -316,6 +318,33 @@ void LoadDataFromFile(google_breakpad::PageAllocator* allocator,
   LoadDataFromFD(allocator, *fd, true, file_data, size);
 }
 
+// Streams |src_fd| through gzip into |dest_fd| in a child process, so the
+// compromised process itself never buffers or compresses the data. We cannot
+// link zlib here (it allocates through libc), but exec'ing a helper is fine:
+// the upload path already execs wget the same way. Returns false when gzip
+// is unavailable or fails, in which case the caller falls back to the
+// uncompressed dump.
+bool GzipFdToFd(int src_fd, int dest_fd) {
+  const pid_t child = sys_fork();
+  if (!child) {
+    IGNORE_RET(sys_dup2(src_fd, 0));
+    IGNORE_RET(sys_dup2(dest_fd, 1));
+    static const char kGzipBinary[] = "/bin/gzip";
+    const char* args[] = {
+        kGzipBinary, "-c", NULL,
+    };
+    execve(args[0], const_cast<char**>(args), environ);
+    sys__exit(1);
+  }
+  if (child < 0)
+    return false;
+
+  int status = 0;
+  if (HANDLE_EINTR(sys_waitpid(child, &status, 0)) != child)
+    return false;
+  return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
 // Spawn the appropriate upload process for the current OS:
 // - generic Linux invokes wget.
 // - ChromeOS invokes crash_reporter.
@@ -549,6 +578,55 @@ void HandleCrashDump(const BreakpadInfo& info) {
     }
   }
 
+  // Compress the dump before it goes into the MIME block. Big-heap processes
+  // produce dumps of hundreds of megabytes that gzip down by an order of
+  // magnitude, which shrinks both the temp-file write below and the wget
+  // upload. The dump kept on disk stays uncompressed for local debugging.
+  static const char gz_file_template[] =
+      "/tmp/chromium-dump-gz-XXXXXXXXXXXXXXXX";
+  char gz_file[sizeof(gz_file_template)];
+  bool dump_compressed = false;
+  if (info.upload && !keep_fd) {
+    memcpy(gz_file, gz_file_template, sizeof(gz_file_template));
+
+    int gz_fd = -1;
+    for (unsigned i = 0; i < 10; ++i) {
+      uint64_t t;
+      sys_read(ufd, &t, sizeof(t));
+      write_uint64_hex(gz_file + sizeof(gz_file) - (16 + 1), t);
+
+      gz_fd = sys_open(gz_file, O_RDWR | O_CREAT | O_EXCL, 0600);
+      if (gz_fd >= 0)
+        break;
+    }
+
+    if (gz_fd >= 0) {
+      const int raw_fd = sys_open(info.filename, O_RDONLY, 0);
+      if (raw_fd >= 0) {
+        dump_compressed = GzipFdToFd(raw_fd, gz_fd);
+        IGNORE_RET(sys_close(raw_fd));
+      }
+
+      if (dump_compressed && sys_lseek(gz_fd, 0, SEEK_SET) != -1) {
+        uint8_t* gz_data = NULL;
+        size_t gz_size = 0;
+        LoadDataFromFD(&allocator, gz_fd, false, &gz_data, &gz_size);
+        if (gz_data && gz_size) {
+          dump_data = gz_data;
+          dump_size = gz_size;
+        } else {
+          dump_compressed = false;
+        }
+      } else {
+        dump_compressed = false;
+      }
+
+      IGNORE_RET(sys_close(gz_fd));
+      if (!dump_compressed)
+        IGNORE_RET(sys_unlink(gz_file));
+    }
+  }
+
   // The MIME boundary is 28 hyphens, followed by a 64-bit nonce and a NUL.
   char mime_boundary[28 + 16 + 1];
   my_memset(mime_boundary, '-', 28);
@@ -659,7 +737,8 @@ void HandleCrashDump(const BreakpadInfo& info) {
     }
   }
 
-  writer.AddFileContents(g_dump_msg, dump_data, dump_size);
+  writer.AddFileContents(dump_compressed ? g_dump_gz_msg : g_dump_msg,
+                         dump_data, dump_size);
   writer.AddEnd();
   writer.Flush();
 
@@ -733,6 +812,8 @@ void HandleCrashDump(const BreakpadInfo& info) {
     // Helper process.
     IGNORE_RET(sys_unlink(info.filename));
     IGNORE_RET(sys_unlink(temp_file));
+    if (dump_compressed)
+      IGNORE_RET(sys_unlink(gz_file));
     sys__exit(0);
   }
 
@@ -6,13 +6,17 @@
 
 #include <windows.h>
 
+#include <dbghelp.h>
 #include <sddl.h>
 #include <fstream>  // NOLINT
 #include <map>
 
 #include "base/command_line.h"
+#include "base/files/file.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/md5.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
@@ -20,6 +24,7 @@
 #include "breakpad/src/client/windows/crash_generation/client_info.h"
 #include "breakpad/src/client/windows/crash_generation/crash_generation_server.h"
 #include "breakpad/src/client/windows/sender/crash_report_sender.h"
+#include "third_party/zlib/zlib.h"
 
 namespace breakpad {
 
@@ -33,6 +38,9 @@ const wchar_t kTestPipeName[] = L"\\\\.\\pipe\\ChromeCrashServices";
 const wchar_t kGoogleReportURL[] = L"https://clients2.google.com/cr/report";
 const wchar_t kCheckPointFile[] = L"crash_checkpoint.txt";
 
+// Window after which an identical crash may be uploaded again.
+const int kSignatureUploadIntervalMinutes = 60;
+
 typedef std::map<std::wstring, std::wstring> CrashMap;
 
 bool CustomInfoToMap(const google_breakpad::ClientInfo* client_info,
@@ -74,6 +82,101 @@ bool WriteCustomInfoToFile(const std::wstring& dump_path, const CrashMap& map) {
   return true;
 }
 
+// Builds a signature for a dump by hashing its exception record (code,
+// flags, faulting address and parameters). A crash loop hits the same fault
+// over and over, so this collapses the loop into one signature without
+// having to walk the full stack. Returns an empty string when the dump has
+// no exception stream; such dumps are never deduplicated.
+std::string GetDumpSignature(const base::FilePath& dump_path) {
+  base::File file(dump_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return std::string();
+
+  MINIDUMP_HEADER header = {0};
+  if (file.Read(0, reinterpret_cast<char*>(&header), sizeof(header)) !=
+          static_cast<int>(sizeof(header)) ||
+      header.Signature != MINIDUMP_SIGNATURE) {
+    return std::string();
+  }
+
+  for (ULONG32 i = 0; i < header.NumberOfStreams; ++i) {
+    MINIDUMP_DIRECTORY directory = {0};
+    const int64_t offset =
+        header.StreamDirectoryRva + static_cast<int64_t>(i) * sizeof(directory);
+    if (file.Read(offset, reinterpret_cast<char*>(&directory),
+                  sizeof(directory)) != static_cast<int>(sizeof(directory))) {
+      return std::string();
+    }
+    if (directory.StreamType != ExceptionStream)
+      continue;
+
+    MINIDUMP_EXCEPTION_STREAM exception = {0};
+    if (file.Read(directory.Location.Rva, reinterpret_cast<char*>(&exception),
+                  sizeof(exception)) != static_cast<int>(sizeof(exception))) {
+      return std::string();
+    }
+    return base::MD5String(
+        std::string(reinterpret_cast<const char*>(&exception.ExceptionRecord),
+                    sizeof(exception.ExceptionRecord)));
+  }
+  return std::string();
+}
+
+// Reads the custom info written by WriteCustomInfoToFile() back into |map|.
+// Used to resume uploads of dumps left behind by a previous session.
+bool ReadCustomInfoFromFile(const std::wstring& dump_path, CrashMap* map) {
+  std::wstring file_path(dump_path);
+  size_t last_dot = file_path.rfind(L'.');
+  if (last_dot == std::wstring::npos)
+    return false;
+  file_path.resize(last_dot);
+  file_path += L".txt";
+
+  std::wifstream file(file_path.c_str(),
+                      std::ios_base::in | std::ios::binary);
+  if (!file.is_open())
+    return false;
+
+  std::wstring line;
+  while (std::getline(file, line)) {
+    size_t colon = line.find(L':');
+    if (colon == std::wstring::npos || colon == 0)
+      continue;
+    (*map)[line.substr(0, colon)] = line.substr(colon + 1);
+  }
+  return !map->empty();
+}
+
+// Streams |source| through zlib into |destination| in 64KB chunks, so large
+// dumps are compressed without ever being resident in memory. Removes the
+// partial output and returns false on failure.
+bool GzipDumpFile(const base::FilePath& source,
+                  const base::FilePath& destination) {
+  std::ifstream in(source.value().c_str(), std::ios::in | std::ios::binary);
+  if (!in.is_open())
+    return false;
+
+  gzFile out = gzopen_w(destination.value().c_str(), "wb");
+  if (!out)
+    return false;
+
+  char buffer[64 * 1024];
+  bool ok = true;
+  while (ok && in) {
+    in.read(buffer, sizeof(buffer));
+    std::streamsize bytes = in.gcount();
+    if (bytes > 0 &&
+        gzwrite(out, buffer, static_cast<unsigned int>(bytes)) != bytes) {
+      ok = false;
+    }
+  }
+  if (gzclose(out) != Z_OK)
+    ok = false;
+  if (!ok)
+    base::DeleteFile(destination, false);
+  return ok;
+}
+
 bool WriteReportIDToFile(const std::wstring& dump_path,
                          const std::wstring& report_id) {
   std::wstring file_path(dump_path);
@@ -281,6 +384,30 @@ bool CrashService::Initialize(const base::string16& application_name,
             << " reports/day"
             << "\nreporter is " << reporter_tag_;
   }
+  // Re-queue dumps a previous session never managed to upload, so uploads
+  // survive service restarts instead of starting from scratch. The custom
+  // info saved next to each dump carries everything the sender needs.
+  if (sender_) {
+    base::FileEnumerator dumps(dumps_path_to_use, false,
+                               base::FileEnumerator::FILES,
+                               FILE_PATH_LITERAL("*.dmp"));
+    for (base::FilePath dump = dumps.Next(); !dump.empty();
+         dump = dumps.Next()) {
+      CrashMap map;
+      if (!ReadCustomInfoFromFile(dump.value(), &map))
+        continue;
+      if (map.find(L"skip_upload") != map.end())
+        continue;
+      VLOG(1) << "resuming upload of " << dump.value();
+      DumpJobInfo* dump_job = new DumpJobInfo(0, this, map, dump.value());
+      if (!::QueueUserWorkItem(&CrashService::AsyncSendDump, dump_job,
+                               WT_EXECUTELONGFUNCTION)) {
+        LOG(ERROR) << "could not queue resumed job";
+        delete dump_job;
+      }
+    }
+  }
+
   // Start servicing clients.
   if (!dumper_->Start()) {
     LOG(ERROR) << "could not start dumper";
@@ -388,6 +515,23 @@ void CrashService::OnClientDumpRequest(
   if (!self->sender_ || map.find(L"skip_upload") != map.end())
     return;
 
+  // Client-side dedup: a crash loop can produce hundreds of identical dumps
+  // in minutes. Upload at most one dump per signature per rate-limit window,
+  // count the rest, and report the suppressed total with the next upload of
+  // that signature.
+  int suppressed_count = 0;
+  if (!self->ShouldUploadSignature(GetDumpSignature(dump_location),
+                                   &suppressed_count)) {
+    VLOG(1) << "suppressing duplicate dump " << dump_location.value();
+    if (!::DeleteFileW(dump_location.value().c_str()))
+      LOG(WARNING) << "could not delete " << dump_location.value();
+    base::DeleteFile(dump_location.ReplaceExtension(L".txt"), false);
+    return;
+  }
+  if (suppressed_count > 0) {
+    map[L"suppressed-duplicates"] = base::IntToString16(suppressed_count);
+  }
+
   // Send the crash dump using a worker thread. This operation has retry
   // logic in case there is no internet connection at the time.
   DumpJobInfo* dump_job =
@@ -398,6 +542,27 @@ void CrashService::OnClientDumpRequest(
   }
 }
 
+bool CrashService::ShouldUploadSignature(const std::string& signature,
+                                         int* suppressed_count) {
+  *suppressed_count = 0;
+  if (signature.empty())
+    return true;
+
+  base::AutoLock lock(signatures_lock_);
+  SignatureState& state = signature_state_[signature];
+  const base::Time now = base::Time::Now();
+  if (!state.last_upload.is_null() &&
+      now - state.last_upload <
+          base::TimeDelta::FromMinutes(kSignatureUploadIntervalMinutes)) {
+    ++state.suppressed;
+    return false;
+  }
+  *suppressed_count = state.suppressed;
+  state.suppressed = 0;
+  state.last_upload = now;
+  return true;
+}
+
 // We are going to try sending the report several times. If we can't send,
 // we sleep from one minute to several hours depending on the retry round.
 DWORD CrashService::AsyncSendDump(void* context) {
@@ -408,6 +573,16 @@ DWORD CrashService::AsyncSendDump(void* context) {
 
   std::wstring report_id = L"<unsent>";
 
+  // Upload a gzip-compressed copy when possible; the crash server accepts
+  // gzipped minidumps and big-heap dumps shrink by an order of magnitude,
+  // turning minutes of upload into seconds. The raw dump is kept until the
+  // upload is resolved, so an interrupted session can resume from it.
+  base::FilePath dump_file(info->dump_path);
+  base::FilePath compressed_file = dump_file.AddExtension(L".gz");
+  bool compressed = GzipDumpFile(dump_file, compressed_file);
+  const std::wstring upload_path =
+      compressed ? compressed_file.value() : info->dump_path;
+
   const DWORD kOneMinute = 60 * 1000;
   const DWORD kOneHour = 60 * kOneMinute;
 
@@ -424,7 +599,7 @@ DWORD CrashService::AsyncSendDump(void* context) {
       base::AutoLock lock(info->self->sending_);
       VLOG(1) << "trying to send report for pid = " << info->pid;
       std::map<std::wstring, std::wstring> file_map;
-      file_map[L"upload_file_minidump"] = info->dump_path;
+      file_map[L"upload_file_minidump"] = upload_path;
       google_breakpad::ReportResult send_result =
           info->self->sender_->SendCrashReport(info->self->reporter_url_,
                                                info->map, file_map, &report_id);
@@ -458,6 +633,8 @@ DWORD CrashService::AsyncSendDump(void* context) {
 
   if (!::DeleteFileW(info->dump_path.c_str()))
     LOG(WARNING) << "could not delete " << info->dump_path;
+  if (compressed && !::DeleteFileW(compressed_file.value().c_str()))
+    LOG(WARNING) << "could not delete " << compressed_file.value();
 
   delete info;
   return 0;
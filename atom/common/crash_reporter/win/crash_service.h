@@ -5,11 +5,13 @@
 #ifndef ATOM_COMMON_CRASH_REPORTER_WIN_CRASH_SERVICE_H_
 #define ATOM_COMMON_CRASH_REPORTER_WIN_CRASH_SERVICE_H_
 
+#include <map>
 #include <string>
 
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
+#include "base/time/time.h"
 
 #if defined(OS_WIN)
 #include <windows.h>
@@ -101,6 +103,21 @@ class CrashService {
   // lock when it is performing the send.
   static DWORD __stdcall AsyncSendDump(void* context);
 
+  // Per-signature upload bookkeeping for client-side dedup. Guarded by
+  // signatures_lock_.
+  struct SignatureState {
+    int suppressed = 0;
+    base::Time last_upload;
+  };
+
+  // Decides whether a dump with |signature| should be uploaded now. At most
+  // one dump per signature is uploaded per rate-limit window; the rest are
+  // counted. When uploading, |suppressed_count| receives the number of
+  // identical dumps suppressed since the previous upload. Returns false if
+  // the dump should be dropped.
+  bool ShouldUploadSignature(const std::string& signature,
+                             int* suppressed_count);
+
   // Returns the security descriptor which access to low integrity processes
   // The caller is supposed to free the security descriptor by calling
   // LocalFree.
@@ -122,6 +139,10 @@ class CrashService {
   volatile LONG clients_terminated_ = 0;
   base::Lock sending_;
 
+  // See ShouldUploadSignature().
+  std::map<std::string, SignatureState> signature_state_;
+  base::Lock signatures_lock_;
+
   DISALLOW_COPY_AND_ASSIGN(CrashService);
 };
 
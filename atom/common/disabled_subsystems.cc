@@ -0,0 +1,53 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/disabled_subsystems.h"
+
+#include <set>
+#include <string>
+
+#include "atom/common/options_switches.h"
+#include "base/command_line.h"
+#include "base/lazy_instance.h"
+#include "base/strings/string_split.h"
+
+namespace atom {
+
+namespace subsystems {
+
+const char kPrinting[] = "printing";
+const char kPdf[] = "pdf";
+const char kNotifications[] = "notifications";
+const char kSpeech[] = "speech";
+
+namespace {
+
+base::LazyInstance<std::set<std::string>>::Leaky g_disabled_subsystems =
+    LAZY_INSTANCE_INITIALIZER;
+bool g_parsed = false;
+
+const std::set<std::string>& GetDisabledSubsystems() {
+  if (!g_parsed) {
+    g_parsed = true;
+    std::string value =
+        base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(
+            switches::kDisableSubsystems);
+    for (const auto& name :
+         base::SplitString(value, ",", base::TRIM_WHITESPACE,
+                           base::SPLIT_WANT_NONEMPTY)) {
+      g_disabled_subsystems.Get().insert(name);
+    }
+  }
+  return g_disabled_subsystems.Get();
+}
+
+}  // namespace
+
+bool IsDisabled(const char* name) {
+  return GetDisabledSubsystems().count(name) > 0;
+}
+
+}  // namespace subsystems
+
+}  // namespace atom
@@ -0,0 +1,29 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_DISABLED_SUBSYSTEMS_H_
+#define ATOM_COMMON_DISABLED_SUBSYSTEMS_H_
+
+namespace atom {
+
+namespace subsystems {
+
+// Subsystem names accepted by the --disable-subsystems switch. Apps that
+// never use a feature can list it to skip its filters, helpers and
+// registrations in every process, saving their startup time and baseline
+// memory.
+extern const char kPrinting[];
+extern const char kPdf[];
+extern const char kNotifications[];
+extern const char kSpeech[];
+
+// True when |name| was listed in --disable-subsystems for this process.
+// The switch is parsed once on first use.
+bool IsDisabled(const char* name);
+
+}  // namespace subsystems
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_DISABLED_SUBSYSTEMS_H_
@@ -8,4 +8,12 @@ namespace atom {
 
 DraggableRegion::DraggableRegion() : draggable(false) {}
 
+bool DraggableRegion::operator==(const DraggableRegion& other) const {
+  return draggable == other.draggable && bounds == other.bounds;
+}
+
+bool DraggableRegion::operator!=(const DraggableRegion& other) const {
+  return !(*this == other);
+}
+
 }  // namespace atom
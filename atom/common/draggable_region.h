@@ -14,6 +14,9 @@ struct DraggableRegion {
   gfx::Rect bounds;
 
   DraggableRegion();
+
+  bool operator==(const DraggableRegion& other) const;
+  bool operator!=(const DraggableRegion& other) const;
 };
 
 }  // namespace atom
@@ -5,6 +5,7 @@
 #ifndef ATOM_COMMON_KEY_WEAK_MAP_H_
 #define ATOM_COMMON_KEY_WEAK_MAP_H_
 
+#include <functional>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -61,6 +62,7 @@ class KeyWeakMap {
 
   // Remove object with |key| in the WeakMap.
   void Remove(const K& key) {
+    EraseCached(key);
     auto iter = map_.find(key);
     if (iter == map_.end())
       return;
@@ -69,6 +71,55 @@ class KeyWeakMap {
     map_.erase(iter);
   }
 
+  // Caches |ptr| as the already-unwrapped native pointer for |key|, so
+  // hot repeated lookups (e.g. TrackableObject::FromWeakMapID from the
+  // remote module) resolve without a hash map lookup or any V8 calls.
+  // The cache is a small open-addressed table with bounded probing; a
+  // colliding insert evicts the home slot, which only costs the evicted
+  // key a slow lookup later.
+  void SetCached(const K& key, void* ptr) {
+    size_t index = CacheIndex(key);
+    for (size_t probe = 0; probe < kCacheProbes; ++probe) {
+      CacheSlot& slot = cache_[(index + probe) & (kCacheSize - 1)];
+      if (!slot.valid || slot.key == key) {
+        slot.key = key;
+        slot.ptr = ptr;
+        slot.valid = true;
+        return;
+      }
+    }
+    CacheSlot& slot = cache_[index];
+    slot.key = key;
+    slot.ptr = ptr;
+    slot.valid = true;
+  }
+
+  // Returns the cached native pointer for |key|, or nullptr when it is
+  // not cached (which only means the caller has to unwrap the slow
+  // way, not that the object is gone).
+  void* GetCached(const K& key) const {
+    size_t index = CacheIndex(key);
+    for (size_t probe = 0; probe < kCacheProbes; ++probe) {
+      const CacheSlot& slot = cache_[(index + probe) & (kCacheSize - 1)];
+      if (slot.valid && slot.key == key)
+        return slot.ptr;
+    }
+    return nullptr;
+  }
+
+  // Drops |key| from the pointer cache; called on Remove and when the
+  // wrapper is marked destroyed while the native object lives on.
+  void EraseCached(const K& key) {
+    size_t index = CacheIndex(key);
+    for (size_t probe = 0; probe < kCacheProbes; ++probe) {
+      CacheSlot& slot = cache_[(index + probe) & (kCacheSize - 1)];
+      if (slot.valid && slot.key == key) {
+        slot.valid = false;
+        return;
+      }
+    }
+  }
+
  private:
   static void OnObjectGC(
       const v8::WeakCallbackInfo<typename KeyWeakMap<K>::KeyObject>& data) {
@@ -76,9 +127,25 @@ class KeyWeakMap {
     key_object->self->Remove(key_object->key);
   }
 
+  static const size_t kCacheSize = 64;
+  static const size_t kCacheProbes = 4;
+
+  struct CacheSlot {
+    K key;
+    void* ptr = nullptr;
+    bool valid = false;
+  };
+
+  size_t CacheIndex(const K& key) const {
+    return std::hash<K>()(key) & (kCacheSize - 1);
+  }
+
   // Map of stored objects.
   std::unordered_map<K, std::pair<KeyObject, v8::Global<v8::Object>>> map_;
 
+  // Inline key -> native pointer cache; see SetCached.
+  CacheSlot cache_[kCacheSize] = {};
+
   DISALLOW_COPY_AND_ASSIGN(KeyWeakMap);
 };
 
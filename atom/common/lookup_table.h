@@ -0,0 +1,122 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_LOOKUP_TABLE_H_
+#define ATOM_COMMON_LOOKUP_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <string>
+
+namespace atom {
+
+// Helpers for compile-time validated string -> value lookup tables.
+// Entries are kept sorted by name in the source, a static_assert on
+// IsSortedByName() enforces it when the table changes, and LookupByName()
+// binary-searches, so string -> enum conversions stop re-running long
+// if/else chains on every call:
+//
+//   constexpr Entry kTable[] = {...};  // any struct with a |name| member
+//   static_assert(IsSortedByName(kTable), "kTable must be sorted by name");
+//   const Entry* entry = LookupByName(kTable, token);
+//
+// For hot paths a perfect-hash index can be generated at compile time on
+// top of the same table, making lookups a single hash plus one string
+// compare with no allocations:
+//
+//   constexpr auto kIndex = MakePerfectHashIndex<256>(kTable);
+//   const Entry* entry = LookupByNameHashed(kTable, kIndex, token);
+
+constexpr int CompareLookupNames(const char* a, const char* b) {
+  while (*a && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return (*a < *b) ? -1 : ((*a > *b) ? 1 : 0);
+}
+
+template <typename Entry, size_t N>
+constexpr bool IsSortedByName(const Entry (&table)[N]) {
+  for (size_t i = 1; i < N; ++i) {
+    if (CompareLookupNames(table[i - 1].name, table[i].name) >= 0)
+      return false;
+  }
+  return true;
+}
+
+constexpr uint32_t HashLookupName(const char* s, uint32_t seed) {
+  // FNV-1a, xored with a seed so MakePerfectHashIndex() can re-roll the
+  // hash function until every table entry lands in its own slot.
+  uint32_t hash = seed ^ 2166136261u;
+  while (*s) {
+    hash = (hash ^ static_cast<uint32_t>(*s++)) * 16777619u;
+  }
+  return hash;
+}
+
+// Maps hash slots to 1-based indices into the source table; slot value 0
+// means empty. |seed| is the value found at compile time that makes the
+// hash collision-free for the table.
+template <size_t kSlots>
+struct PerfectHashIndex {
+  uint32_t seed;
+  uint8_t slots[kSlots];
+};
+
+template <size_t kSlots, typename Entry, size_t N>
+constexpr PerfectHashIndex<kSlots> MakePerfectHashIndex(
+    const Entry (&table)[N]) {
+  static_assert(N < 256, "table too large for uint8_t slot indices");
+  static_assert(kSlots >= 2 * N,
+                "need spare slots to find a collision-free seed quickly");
+  PerfectHashIndex<kSlots> index{};
+  for (uint32_t seed = 1;; ++seed) {
+    for (size_t i = 0; i < kSlots; ++i)
+      index.slots[i] = 0;
+    bool collision_free = true;
+    for (size_t i = 0; i < N && collision_free; ++i) {
+      size_t slot = HashLookupName(table[i].name, seed) % kSlots;
+      if (index.slots[slot])
+        collision_free = false;
+      else
+        index.slots[slot] = static_cast<uint8_t>(i + 1);
+    }
+    if (collision_free) {
+      index.seed = seed;
+      return index;
+    }
+  }
+}
+
+template <size_t kSlots, typename Entry, size_t N>
+const Entry* LookupByNameHashed(const Entry (&table)[N],
+                                const PerfectHashIndex<kSlots>& index,
+                                const std::string& name) {
+  uint8_t slot =
+      index.slots[HashLookupName(name.c_str(), index.seed) % kSlots];
+  if (slot == 0)
+    return nullptr;
+  const Entry* entry = &table[slot - 1];
+  if (name == entry->name)
+    return entry;
+  return nullptr;
+}
+
+template <typename Entry, size_t N>
+const Entry* LookupByName(const Entry (&table)[N], const std::string& name) {
+  const Entry* end = table + N;
+  const Entry* it = std::lower_bound(
+      table, end, name, [](const Entry& entry, const std::string& key) {
+        return key.compare(entry.name) > 0;
+      });
+  if (it != end && name == it->name)
+    return it;
+  return nullptr;
+}
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_LOOKUP_TABLE_H_
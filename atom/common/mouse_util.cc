@@ -3,13 +3,14 @@
 // found in the LICENSE file.
 
 #include "atom/common/mouse_util.h"
-#include <string>
 
 using Cursor = blink::WebCursorInfo::Type;
 
 namespace atom {
 
-std::string CursorTypeToString(const content::CursorInfo& info) {
+const char* CursorTypeToString(const content::CursorInfo& info) {
+  // Returns pointers into static storage so emitting a cursor-changed
+  // event for every mouse move does not construct a fresh std::string.
   switch (info.type) {
     case Cursor::kTypePointer:
       return "default";
@@ -5,7 +5,6 @@
 #ifndef ATOM_COMMON_MOUSE_UTIL_H_
 #define ATOM_COMMON_MOUSE_UTIL_H_
 
-#include <string>
 #include "content/common/cursors/webcursor.h"
 #include "ipc/ipc_message_macros.h"
 
@@ -26,8 +25,8 @@
 
 namespace atom {
 
-// Returns the cursor's type as a string.
-std::string CursorTypeToString(const content::CursorInfo& info);
+// Returns the cursor's type as a statically allocated string.
+const char* CursorTypeToString(const content::CursorInfo& info);
 
 }  // namespace atom
 
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "atom/common/keyboard_util.h"
+#include "atom/common/lookup_table.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "content/public/browser/native_web_keyboard_event.h"
@@ -32,6 +33,58 @@ int VectorToBitArray(const std::vector<T>& vec) {
   return bits;
 }
 
+struct InputEventTypeEntry {
+  const char* name;
+  blink::WebInputEvent::Type type;
+};
+
+// Sorted by name so atom::LookupByName() can binary-search; enforced at
+// compile time below.
+constexpr InputEventTypeEntry kInputEventTypes[] = {
+    {"char", blink::WebInputEvent::kChar},
+    {"contextmenu", blink::WebInputEvent::kContextMenu},
+    {"keydown", blink::WebInputEvent::kRawKeyDown},
+    {"keyup", blink::WebInputEvent::kKeyUp},
+    {"mousedown", blink::WebInputEvent::kMouseDown},
+    {"mouseenter", blink::WebInputEvent::kMouseEnter},
+    {"mouseleave", blink::WebInputEvent::kMouseLeave},
+    {"mousemove", blink::WebInputEvent::kMouseMove},
+    {"mouseup", blink::WebInputEvent::kMouseUp},
+    {"mousewheel", blink::WebInputEvent::kMouseWheel},
+    {"touchcancel", blink::WebInputEvent::kTouchCancel},
+    {"touchend", blink::WebInputEvent::kTouchEnd},
+    {"touchmove", blink::WebInputEvent::kTouchMove},
+    {"touchstart", blink::WebInputEvent::kTouchStart},
+};
+static_assert(atom::IsSortedByName(kInputEventTypes),
+              "kInputEventTypes must be sorted by name");
+
+struct ModifierEntry {
+  const char* name;
+  blink::WebInputEvent::Modifiers modifier;
+};
+
+constexpr ModifierEntry kModifiers[] = {
+    {"alt", blink::WebInputEvent::kAltKey},
+    {"capslock", blink::WebInputEvent::kCapsLockOn},
+    {"cmd", blink::WebInputEvent::kMetaKey},
+    {"command", blink::WebInputEvent::kMetaKey},
+    {"control", blink::WebInputEvent::kControlKey},
+    {"ctrl", blink::WebInputEvent::kControlKey},
+    {"isautorepeat", blink::WebInputEvent::kIsAutoRepeat},
+    {"iskeypad", blink::WebInputEvent::kIsKeyPad},
+    {"left", blink::WebInputEvent::kIsLeft},
+    {"leftbuttondown", blink::WebInputEvent::kLeftButtonDown},
+    {"meta", blink::WebInputEvent::kMetaKey},
+    {"middlebuttondown", blink::WebInputEvent::kMiddleButtonDown},
+    {"numlock", blink::WebInputEvent::kNumLockOn},
+    {"right", blink::WebInputEvent::kIsRight},
+    {"rightbuttondown", blink::WebInputEvent::kRightButtonDown},
+    {"shift", blink::WebInputEvent::kShiftKey},
+};
+static_assert(atom::IsSortedByName(kModifiers),
+              "kModifiers must be sorted by name");
+
 }  // namespace
 
 namespace mate {
@@ -55,34 +108,10 @@ struct Converter<blink::WebInputEvent::Type> {
                      v8::Handle<v8::Value> val,
                      blink::WebInputEvent::Type* out) {
     std::string type = base::ToLowerASCII(V8ToString(val));
-    if (type == "mousedown")
-      *out = blink::WebInputEvent::kMouseDown;
-    else if (type == "mouseup")
-      *out = blink::WebInputEvent::kMouseUp;
-    else if (type == "mousemove")
-      *out = blink::WebInputEvent::kMouseMove;
-    else if (type == "mouseenter")
-      *out = blink::WebInputEvent::kMouseEnter;
-    else if (type == "mouseleave")
-      *out = blink::WebInputEvent::kMouseLeave;
-    else if (type == "contextmenu")
-      *out = blink::WebInputEvent::kContextMenu;
-    else if (type == "mousewheel")
-      *out = blink::WebInputEvent::kMouseWheel;
-    else if (type == "keydown")
-      *out = blink::WebInputEvent::kRawKeyDown;
-    else if (type == "keyup")
-      *out = blink::WebInputEvent::kKeyUp;
-    else if (type == "char")
-      *out = blink::WebInputEvent::kChar;
-    else if (type == "touchstart")
-      *out = blink::WebInputEvent::kTouchStart;
-    else if (type == "touchmove")
-      *out = blink::WebInputEvent::kTouchMove;
-    else if (type == "touchend")
-      *out = blink::WebInputEvent::kTouchEnd;
-    else if (type == "touchcancel")
-      *out = blink::WebInputEvent::kTouchCancel;
+    const InputEventTypeEntry* entry =
+        atom::LookupByName(kInputEventTypes, type);
+    if (entry)
+      *out = entry->type;
     return true;
   }
 };
@@ -111,32 +140,9 @@ struct Converter<blink::WebInputEvent::Modifiers> {
                      v8::Handle<v8::Value> val,
                      blink::WebInputEvent::Modifiers* out) {
     std::string modifier = base::ToLowerASCII(V8ToString(val));
-    if (modifier == "shift")
-      *out = blink::WebInputEvent::kShiftKey;
-    else if (modifier == "control" || modifier == "ctrl")
-      *out = blink::WebInputEvent::kControlKey;
-    else if (modifier == "alt")
-      *out = blink::WebInputEvent::kAltKey;
-    else if (modifier == "meta" || modifier == "command" || modifier == "cmd")
-      *out = blink::WebInputEvent::kMetaKey;
-    else if (modifier == "iskeypad")
-      *out = blink::WebInputEvent::kIsKeyPad;
-    else if (modifier == "isautorepeat")
-      *out = blink::WebInputEvent::kIsAutoRepeat;
-    else if (modifier == "leftbuttondown")
-      *out = blink::WebInputEvent::kLeftButtonDown;
-    else if (modifier == "middlebuttondown")
-      *out = blink::WebInputEvent::kMiddleButtonDown;
-    else if (modifier == "rightbuttondown")
-      *out = blink::WebInputEvent::kRightButtonDown;
-    else if (modifier == "capslock")
-      *out = blink::WebInputEvent::kCapsLockOn;
-    else if (modifier == "numlock")
-      *out = blink::WebInputEvent::kNumLockOn;
-    else if (modifier == "left")
-      *out = blink::WebInputEvent::kIsLeft;
-    else if (modifier == "right")
-      *out = blink::WebInputEvent::kIsRight;
+    const ModifierEntry* entry = atom::LookupByName(kModifiers, modifier);
+    if (entry)
+      *out = entry->modifier;
     return true;
   }
 };
@@ -145,7 +151,8 @@ blink::WebInputEvent::Type GetWebInputEventType(v8::Isolate* isolate,
                                                 v8::Local<v8::Value> val) {
   blink::WebInputEvent::Type type = blink::WebInputEvent::kUndefined;
   mate::Dictionary dict;
-  ConvertFromV8(isolate, val, &dict) && dict.Get("type", &type);
+  ConvertFromV8(isolate, val, &dict) &&
+      dict.Get(EternalKey(isolate, "type"), &type);
   return type;
 }
 
@@ -156,11 +163,11 @@ bool Converter<blink::WebInputEvent>::FromV8(v8::Isolate* isolate,
   if (!ConvertFromV8(isolate, val, &dict))
     return false;
   blink::WebInputEvent::Type type;
-  if (!dict.Get("type", &type))
+  if (!dict.Get(EternalKey(isolate, "type"), &type))
     return false;
   out->SetType(type);
   std::vector<blink::WebInputEvent::Modifiers> modifiers;
-  if (dict.Get("modifiers", &modifiers))
+  if (dict.Get(EternalKey(isolate, "modifiers"), &modifiers))
     out->SetModifiers(VectorToBitArray(modifiers));
   out->SetTimeStampSeconds(base::Time::Now().ToDoubleT());
   return true;
@@ -176,7 +183,7 @@ bool Converter<blink::WebKeyboardEvent>::FromV8(v8::Isolate* isolate,
     return false;
 
   std::string str;
-  if (!dict.Get("keyCode", &str))
+  if (!dict.Get(EternalKey(isolate, "keyCode"), &str))
     return false;
 
   bool shifted = false;
@@ -220,7 +227,7 @@ bool Converter<content::NativeWebKeyboardEvent>::FromV8(
     return false;
   if (!ConvertFromV8(isolate, val, static_cast<blink::WebKeyboardEvent*>(out)))
     return false;
-  dict.Get("skipInBrowser", &out->skip_in_browser);
+  dict.Get(EternalKey(isolate, "skipInBrowser"), &out->skip_in_browser);
   return true;
 }
 
@@ -230,19 +237,26 @@ v8::Local<v8::Value> Converter<content::NativeWebKeyboardEvent>::ToV8(
   mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
 
   if (in.GetType() == blink::WebInputEvent::Type::kRawKeyDown)
-    dict.Set("type", "keyDown");
+    dict.Set(EternalKey(isolate, "type"), "keyDown");
   else if (in.GetType() == blink::WebInputEvent::Type::kKeyUp)
-    dict.Set("type", "keyUp");
-  dict.Set("key", ui::KeycodeConverter::DomKeyToKeyString(in.dom_key));
-  dict.Set("code", ui::KeycodeConverter::DomCodeToCodeString(
-                       static_cast<ui::DomCode>(in.dom_code)));
+    dict.Set(EternalKey(isolate, "type"), "keyUp");
+  dict.Set(EternalKey(isolate, "key"),
+           ui::KeycodeConverter::DomKeyToKeyString(in.dom_key));
+  dict.Set(EternalKey(isolate, "code"),
+           ui::KeycodeConverter::DomCodeToCodeString(
+               static_cast<ui::DomCode>(in.dom_code)));
 
   using Modifiers = blink::WebInputEvent::Modifiers;
-  dict.Set("isAutoRepeat", (in.GetModifiers() & Modifiers::kIsAutoRepeat) != 0);
-  dict.Set("shift", (in.GetModifiers() & Modifiers::kShiftKey) != 0);
-  dict.Set("control", (in.GetModifiers() & Modifiers::kControlKey) != 0);
-  dict.Set("alt", (in.GetModifiers() & Modifiers::kAltKey) != 0);
-  dict.Set("meta", (in.GetModifiers() & Modifiers::kMetaKey) != 0);
+  dict.Set(EternalKey(isolate, "isAutoRepeat"),
+           (in.GetModifiers() & Modifiers::kIsAutoRepeat) != 0);
+  dict.Set(EternalKey(isolate, "shift"),
+           (in.GetModifiers() & Modifiers::kShiftKey) != 0);
+  dict.Set(EternalKey(isolate, "control"),
+           (in.GetModifiers() & Modifiers::kControlKey) != 0);
+  dict.Set(EternalKey(isolate, "alt"),
+           (in.GetModifiers() & Modifiers::kAltKey) != 0);
+  dict.Set(EternalKey(isolate, "meta"),
+           (in.GetModifiers() & Modifiers::kMetaKey) != 0);
 
   return dict.GetHandle();
 }
@@ -258,22 +272,23 @@ bool Converter<blink::WebMouseEvent>::FromV8(v8::Isolate* isolate,
 
   float x = 0.f;
   float y = 0.f;
-  if (!dict.Get("x", &x) || !dict.Get("y", &y))
+  if (!dict.Get(EternalKey(isolate, "x"), &x) ||
+      !dict.Get(EternalKey(isolate, "y"), &y))
     return false;
   out->SetPositionInWidget(x, y);
 
-  if (!dict.Get("button", &out->button))
+  if (!dict.Get(EternalKey(isolate, "button"), &out->button))
     out->button = blink::WebMouseEvent::Button::kLeft;
 
   float global_x = 0.f;
   float global_y = 0.f;
-  dict.Get("globalX", &global_x);
-  dict.Get("globalY", &global_y);
+  dict.Get(EternalKey(isolate, "globalX"), &global_x);
+  dict.Get(EternalKey(isolate, "globalY"), &global_y);
   out->SetPositionInScreen(global_x, global_y);
 
-  dict.Get("movementX", &out->movement_x);
-  dict.Get("movementY", &out->movement_y);
-  dict.Get("clickCount", &out->click_count);
+  dict.Get(EternalKey(isolate, "movementX"), &out->movement_x);
+  dict.Get(EternalKey(isolate, "movementY"), &out->movement_y);
+  dict.Get(EternalKey(isolate, "clickCount"), &out->click_count);
   return true;
 }
 
@@ -286,18 +301,21 @@ bool Converter<blink::WebMouseWheelEvent>::FromV8(
     return false;
   if (!ConvertFromV8(isolate, val, static_cast<blink::WebMouseEvent*>(out)))
     return false;
-  dict.Get("deltaX", &out->delta_x);
-  dict.Get("deltaY", &out->delta_y);
-  dict.Get("wheelTicksX", &out->wheel_ticks_x);
-  dict.Get("wheelTicksY", &out->wheel_ticks_y);
-  dict.Get("accelerationRatioX", &out->acceleration_ratio_x);
-  dict.Get("accelerationRatioY", &out->acceleration_ratio_y);
-  dict.Get("hasPreciseScrollingDeltas", &out->has_precise_scrolling_deltas);
+  dict.Get(EternalKey(isolate, "deltaX"), &out->delta_x);
+  dict.Get(EternalKey(isolate, "deltaY"), &out->delta_y);
+  dict.Get(EternalKey(isolate, "wheelTicksX"), &out->wheel_ticks_x);
+  dict.Get(EternalKey(isolate, "wheelTicksY"), &out->wheel_ticks_y);
+  dict.Get(EternalKey(isolate, "accelerationRatioX"),
+           &out->acceleration_ratio_x);
+  dict.Get(EternalKey(isolate, "accelerationRatioY"),
+           &out->acceleration_ratio_y);
+  dict.Get(EternalKey(isolate, "hasPreciseScrollingDeltas"),
+           &out->has_precise_scrolling_deltas);
 
 #if defined(USE_AURA)
   // Matches the behavior of ui/events/blink/web_input_event_traits.cc:
   bool can_scroll = true;
-  if (dict.Get("canScroll", &can_scroll) && !can_scroll) {
+  if (dict.Get(EternalKey(isolate, "canScroll"), &can_scroll) && !can_scroll) {
     out->has_precise_scrolling_deltas = false;
     out->SetModifiers(out->GetModifiers() & ~blink::WebInputEvent::kControlKey);
   }
@@ -311,7 +329,8 @@ bool Converter<blink::WebFloatPoint>::FromV8(v8::Isolate* isolate,
   mate::Dictionary dict;
   if (!ConvertFromV8(isolate, val, &dict))
     return false;
-  return dict.Get("x", &out->x) && dict.Get("y", &out->y);
+  return dict.Get(EternalKey(isolate, "x"), &out->x) &&
+         dict.Get(EternalKey(isolate, "y"), &out->y);
 }
 
 template <>
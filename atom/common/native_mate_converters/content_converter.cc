@@ -100,27 +100,29 @@ v8::Local<v8::Value> Converter<ContextMenuParamsWithWebContents>::ToV8(
     const ContextMenuParamsWithWebContents& val) {
   const auto& params = val.first;
   mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
-  dict.Set("x", params.x);
-  dict.Set("y", params.y);
-  dict.Set("linkURL", params.link_url);
-  dict.Set("linkText", params.link_text);
-  dict.Set("pageURL", params.page_url);
-  dict.Set("frameURL", params.frame_url);
-  dict.Set("srcURL", params.src_url);
-  dict.Set("mediaType", params.media_type);
-  dict.Set("mediaFlags", MediaFlagsToV8(isolate, params.media_flags));
+  dict.Set(EternalKey(isolate, "x"), params.x);
+  dict.Set(EternalKey(isolate, "y"), params.y);
+  dict.Set(EternalKey(isolate, "linkURL"), params.link_url);
+  dict.Set(EternalKey(isolate, "linkText"), params.link_text);
+  dict.Set(EternalKey(isolate, "pageURL"), params.page_url);
+  dict.Set(EternalKey(isolate, "frameURL"), params.frame_url);
+  dict.Set(EternalKey(isolate, "srcURL"), params.src_url);
+  dict.Set(EternalKey(isolate, "mediaType"), params.media_type);
+  dict.Set(EternalKey(isolate, "mediaFlags"),
+           MediaFlagsToV8(isolate, params.media_flags));
   bool has_image_contents =
       (params.media_type == blink::WebContextMenuData::kMediaTypeImage) &&
       params.has_image_contents;
-  dict.Set("hasImageContents", has_image_contents);
-  dict.Set("isEditable", params.is_editable);
-  dict.Set("editFlags", EditFlagsToV8(isolate, params.edit_flags));
-  dict.Set("selectionText", params.selection_text);
-  dict.Set("titleText", params.title_text);
-  dict.Set("misspelledWord", params.misspelled_word);
-  dict.Set("frameCharset", params.frame_charset);
-  dict.Set("inputFieldType", params.input_field_type);
-  dict.Set("menuSourceType", params.source_type);
+  dict.Set(EternalKey(isolate, "hasImageContents"), has_image_contents);
+  dict.Set(EternalKey(isolate, "isEditable"), params.is_editable);
+  dict.Set(EternalKey(isolate, "editFlags"),
+           EditFlagsToV8(isolate, params.edit_flags));
+  dict.Set(EternalKey(isolate, "selectionText"), params.selection_text);
+  dict.Set(EternalKey(isolate, "titleText"), params.title_text);
+  dict.Set(EternalKey(isolate, "misspelledWord"), params.misspelled_word);
+  dict.Set(EternalKey(isolate, "frameCharset"), params.frame_charset);
+  dict.Set(EternalKey(isolate, "inputFieldType"), params.input_field_type);
+  dict.Set(EternalKey(isolate, "menuSourceType"), params.source_type);
 
   if (params.custom_context.is_pepper_menu)
     dict.Set("menu", MenuToV8(isolate, val.second, params.custom_context,
@@ -226,8 +228,8 @@ v8::Local<v8::Value> Converter<content::Referrer>::ToV8(
     v8::Isolate* isolate,
     const content::Referrer& val) {
   mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
-  dict.Set("url", ConvertToV8(isolate, val.url));
-  dict.Set("policy", ConvertToV8(isolate, val.policy));
+  dict.Set(EternalKey(isolate, "url"), ConvertToV8(isolate, val.url));
+  dict.Set(EternalKey(isolate, "policy"), ConvertToV8(isolate, val.policy));
   return mate::ConvertToV8(isolate, dict);
 }
 
@@ -239,10 +241,10 @@ bool Converter<content::Referrer>::FromV8(v8::Isolate* isolate,
   if (!ConvertFromV8(isolate, val, &dict))
     return false;
 
-  if (!dict.Get("url", &out->url))
+  if (!dict.Get(EternalKey(isolate, "url"), &out->url))
     return false;
 
-  if (!dict.Get("policy", &out->policy))
+  if (!dict.Get(EternalKey(isolate, "policy"), &out->policy))
     return false;
 
   return true;
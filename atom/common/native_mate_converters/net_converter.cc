@@ -4,12 +4,16 @@
 
 #include "atom/common/native_mate_converters/net_converter.h"
 
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/common/native_mate_converters/gurl_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
+#include "base/macros.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/values.h"
 #include "native_mate/dictionary.h"
@@ -46,6 +50,141 @@ bool CertFromData(const std::string& data,
   return true;
 }
 
+// Backs a lazily materialized response-header object. Instead of copying
+// every header name and value into a fresh V8 object per conversion, the
+// object is created empty with a named interceptor and a header's value
+// array is built (then cached as an own property) only when JS actually
+// reads it. The holder retains the header block and deletes itself when
+// the wrapper object is collected.
+class LazyHeaderObject {
+ public:
+  static v8::Local<v8::Value> Create(
+      v8::Isolate* isolate,
+      scoped_refptr<net::HttpResponseHeaders> headers) {
+    auto* holder = new LazyHeaderObject(std::move(headers));
+    v8::Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+    templ->SetHandler(v8::NamedPropertyHandlerConfiguration(
+        &Getter, nullptr, &Query, &Deleter, &Enumerator,
+        v8::External::New(isolate, holder),
+        v8::PropertyHandlerFlags::kNonMasking));
+    v8::Local<v8::Object> object =
+        templ->NewInstance(isolate->GetCurrentContext()).ToLocalChecked();
+    holder->wrapper_.Reset(isolate, object);
+    holder->wrapper_.SetWeak(holder, &OnCollected,
+                             v8::WeakCallbackType::kParameter);
+    return object;
+  }
+
+ private:
+  explicit LazyHeaderObject(scoped_refptr<net::HttpResponseHeaders> headers)
+      : headers_(std::move(headers)) {}
+
+  static LazyHeaderObject* FromData(v8::Local<v8::Value> data) {
+    return static_cast<LazyHeaderObject*>(
+        v8::Local<v8::External>::Cast(data)->Value());
+  }
+
+  // Returns true with the UTF-8 spelling of |name| when the interceptor
+  // should serve it: an all-lowercase string naming a present header that
+  // has been neither deleted nor already materialized. The eager
+  // conversion only exposed lowercased keys, so other spellings fall
+  // through to the prototype chain. Once a name is materialized its own
+  // property answers reads, and its absence means JS deleted it.
+  bool GetHeaderName(v8::Local<v8::Name> name, std::string* out) {
+    if (!name->IsString())
+      return false;
+    std::string header_name = V8ToString(name);
+    if (header_name != base::ToLowerASCII(header_name))
+      return false;
+    if (deleted_.count(header_name) > 0 || materialized_.count(header_name) > 0)
+      return false;
+    if (!headers_->HasHeader(header_name))
+      return false;
+    *out = header_name;
+    return true;
+  }
+
+  static void Getter(v8::Local<v8::Name> name,
+                     const v8::PropertyCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    auto* holder = FromData(info.Data());
+    std::string header_name;
+    if (!holder->GetHeaderName(name, &header_name))
+      return;
+
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::Array> values = v8::Array::New(isolate);
+    size_t iter = 0;
+    std::string value;
+    uint32_t index = 0;
+    while (holder->headers_->EnumerateHeader(&iter, header_name, &value))
+      values->Set(context, index++, StringToV8(isolate, value)).FromJust();
+
+    // Cache the materialized array; with kNonMasking further reads (and
+    // deletes) hit the own property and skip the interceptor.
+    holder->materialized_.insert(header_name);
+    info.Holder()->CreateDataProperty(context, name, values).FromJust();
+    info.GetReturnValue().Set(values);
+  }
+
+  static void Query(v8::Local<v8::Name> name,
+                    const v8::PropertyCallbackInfo<v8::Integer>& info) {
+    auto* holder = FromData(info.Data());
+    std::string header_name;
+    if (!holder->GetHeaderName(name, &header_name))
+      return;
+    info.GetReturnValue().Set(v8::None);
+  }
+
+  static void Deleter(v8::Local<v8::Name> name,
+                      const v8::PropertyCallbackInfo<v8::Boolean>& info) {
+    auto* holder = FromData(info.Data());
+    std::string header_name;
+    if (!holder->GetHeaderName(name, &header_name))
+      return;
+    holder->deleted_.insert(header_name);
+    info.GetReturnValue().Set(true);
+  }
+
+  static void Enumerator(const v8::PropertyCallbackInfo<v8::Array>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    auto* holder = FromData(info.Data());
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::Array> result = v8::Array::New(isolate);
+    std::set<std::string> seen;
+    size_t iter = 0;
+    std::string key;
+    std::string value;
+    uint32_t index = 0;
+    while (holder->headers_->EnumerateHeaderLines(&iter, &key, &value)) {
+      key = base::ToLowerASCII(key);
+      // Materialized names already show up as own properties (or were
+      // deleted by JS after materializing) and V8 merges own properties
+      // into the result itself.
+      if (!seen.insert(key).second || holder->deleted_.count(key) > 0 ||
+          holder->materialized_.count(key) > 0)
+        continue;
+      // Internalized names dedupe inside V8, so repeated conversions of
+      // the usual header names share one string per isolate.
+      result->Set(context, index++, StringToSymbol(isolate, key)).FromJust();
+    }
+    info.GetReturnValue().Set(result);
+  }
+
+  static void OnCollected(const v8::WeakCallbackInfo<LazyHeaderObject>& data) {
+    delete data.GetParameter();
+  }
+
+  scoped_refptr<net::HttpResponseHeaders> headers_;
+  // Lowercased names removed by JS before their arrays were materialized.
+  std::set<std::string> deleted_;
+  // Lowercased names whose value arrays were cached as own properties.
+  std::set<std::string> materialized_;
+  v8::Global<v8::Object> wrapper_;
+
+  DISALLOW_COPY_AND_ASSIGN(LazyHeaderObject);
+};
+
 }  // namespace
 
 // static
@@ -153,25 +292,10 @@ v8::Local<v8::Value> Converter<net::CertPrincipal>::ToV8(
 v8::Local<v8::Value> Converter<net::HttpResponseHeaders*>::ToV8(
     v8::Isolate* isolate,
     net::HttpResponseHeaders* headers) {
-  base::DictionaryValue response_headers;
-  if (headers) {
-    size_t iter = 0;
-    std::string key;
-    std::string value;
-    while (headers->EnumerateHeaderLines(&iter, &key, &value)) {
-      key = base::ToLowerASCII(key);
-      if (response_headers.FindKey(key)) {
-        base::ListValue* values = nullptr;
-        if (response_headers.GetList(key, &values))
-          values->AppendString(value);
-      } else {
-        auto values = std::make_unique<base::ListValue>();
-        values->AppendString(value);
-        response_headers.Set(key, std::move(values));
-      }
-    }
-  }
-  return ConvertToV8(isolate, response_headers);
+  if (!headers)
+    return v8::Object::New(isolate);
+  return LazyHeaderObject::Create(
+      isolate, scoped_refptr<net::HttpResponseHeaders>(headers));
 }
 
 bool Converter<net::HttpResponseHeaders*>::FromV8(
@@ -184,6 +308,10 @@ bool Converter<net::HttpResponseHeaders*>::FromV8(
   auto context = isolate->GetCurrentContext();
   auto headers = v8::Local<v8::Object>::Cast(val);
   auto keys = headers->GetOwnPropertyNames();
+  // Typical header names and values fit in the arena's inline buffer,
+  // so building a header line does not allocate beyond |line|, which is
+  // reused across iterations.
+  std::string line;
   for (uint32_t i = 0; i < keys->Length(); i++) {
     v8::Local<v8::String> key, value;
     if (!keys->Get(i)->ToString(context).ToLocal(&key)) {
@@ -192,13 +320,15 @@ bool Converter<net::HttpResponseHeaders*>::FromV8(
     if (!headers->Get(key)->ToString(context).ToLocal(&value)) {
       return false;
     }
-    v8::String::Utf8Value key_utf8(key);
-    v8::String::Utf8Value value_utf8(value);
-    std::string k(*key_utf8, key_utf8.length());
-    std::string v(*value_utf8, value_utf8.length());
-    std::ostringstream tmp;
-    tmp << k << ": " << v;
-    out->AddHeader(tmp.str());
+    StringArena arena;
+    base::StringPiece k, v;
+    if (!arena.FromV8(isolate, key, &k) || !arena.FromV8(isolate, value, &v))
+      return false;
+    line.clear();
+    k.AppendToString(&line);
+    line.append(": ");
+    v.AppendToString(&line);
+    out->AddHeader(line);
   }
   return true;
 }
@@ -24,8 +24,16 @@ struct Converter<base::string16> {
     if (!val->IsString())
       return false;
 
-    v8::String::Value s(val);
-    out->assign(reinterpret_cast<const base::char16*>(*s), s.length());
+    // Write straight into the string16's storage instead of going through
+    // the temporary buffer v8::String::Value allocates and then copying it
+    // a second time with assign().
+    v8::Local<v8::String> str = v8::Local<v8::String>::Cast(val);
+    const int length = str->Length();
+    out->resize(length);
+    if (length > 0) {
+      str->Write(reinterpret_cast<uint16_t*>(&(*out)[0]), 0, length,
+                 v8::String::NO_NULL_TERMINATION);
+    }
     return true;
   }
 };
@@ -21,26 +21,34 @@ namespace atom {
 
 namespace {
 
-const int kMaxRecursionDepth = 100;
+const int kMaxNestingDepth = 100;
+
+// Copies |str| into |out| without transcoding when it is pure ASCII, where
+// the Latin-1 bytes V8 hands out are already valid UTF-8. Returns false
+// otherwise, leaving |out| unspecified. Both the one-byte read and the
+// ASCII scan are plain byte loops that vectorize, so large string payloads
+// move at memory bandwidth instead of through the scalar UTF-8 encoder.
+bool ReadOneByteAscii(v8::Local<v8::String> str, std::string* out) {
+  if (!str->ContainsOnlyOneByte())
+    return false;
+  const int length = str->Length();
+  out->resize(length);
+  if (length > 0) {
+    str->WriteOneByte(reinterpret_cast<uint8_t*>(&(*out)[0]), 0, length,
+                      v8::String::NO_NULL_TERMINATION);
+  }
+  uint8_t acc = 0;
+  for (int i = 0; i < length; ++i)
+    acc |= static_cast<uint8_t>((*out)[i]);
+  return (acc & 0x80) == 0;
+}
 
 }  // namespace
 
 // The state of a call to FromV8Value.
 class V8ValueConverter::FromV8ValueState {
  public:
-  // Level scope which updates the current depth of some FromV8ValueState.
-  class Level {
-   public:
-    explicit Level(FromV8ValueState* state) : state_(state) {
-      state_->max_recursion_depth_--;
-    }
-    ~Level() { state_->max_recursion_depth_++; }
-
-   private:
-    FromV8ValueState* state_;
-  };
-
-  FromV8ValueState() : max_recursion_depth_(kMaxRecursionDepth) {}
+  FromV8ValueState() {}
 
   // If |handle| is not in |unique_map_|, then add it to |unique_map_| and
   // return true.
@@ -68,7 +76,22 @@ class V8ValueConverter::FromV8ValueState {
     return true;
   }
 
-  bool HasReachedMaxRecursionDepth() { return max_recursion_depth_ < 0; }
+  // Returns the UTF-8 spelling of |key|, converting each distinct key
+  // object at most once. Property names of homogeneous object graphs are
+  // internalized strings shared between the objects, so repeated keys hit
+  // the cache by identity and skip the per-key Utf8Value conversion.
+  const std::string& GetInternedKey(v8::Local<v8::String> key) {
+    int hash = key->GetIdentityHash();
+    auto range = interned_keys_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.first == key)
+        return it->second.second;
+    }
+    v8::String::Utf8Value utf8(key);
+    auto iter = interned_keys_.insert(std::make_pair(
+        hash, std::make_pair(key, std::string(*utf8, utf8.length()))));
+    return iter->second.second;
+  }
 
  private:
   using HashToHandleMap = std::multimap<int, v8::Local<v8::Object>>;
@@ -91,37 +114,35 @@ class V8ValueConverter::FromV8ValueState {
 
   HashToHandleMap unique_map_;
 
-  int max_recursion_depth_;
+  // Identity-keyed cache of converted property names, multimapped by
+  // identity hash because distinct strings can share a hash.
+  std::multimap<int, std::pair<v8::Local<v8::String>, std::string>>
+      interned_keys_;
 };
 
-// A class to ensure that objects/arrays that are being converted by
-// this V8ValueConverterImpl do not have cycles.
-//
-// An example of cycle: var v = {}; v = {key: v};
-// Not an example of cycle: var v = {}; a = [v, v]; or w = {a: v, b: v};
-class V8ValueConverter::ScopedUniquenessGuard {
- public:
-  ScopedUniquenessGuard(V8ValueConverter::FromV8ValueState* state,
-                        v8::Local<v8::Object> value)
-      : state_(state),
-        value_(value),
-        is_valid_(state_->AddToUniquenessCheck(value_)) {}
-  ~ScopedUniquenessGuard() {
-    if (is_valid_) {
-      bool removed = state_->RemoveFromUniquenessCheck(value_);
-      DCHECK(removed);
-    }
-  }
-
-  bool is_valid() const { return is_valid_; }
-
- private:
-  typedef std::multimap<int, v8::Local<v8::Object>> HashToHandleMap;
-  V8ValueConverter::FromV8ValueState* state_;
-  v8::Local<v8::Object> value_;
-  bool is_valid_;
-
-  DISALLOW_COPY_AND_ASSIGN(ScopedUniquenessGuard);
+// One in-progress container on the explicit stack kept by FromV8ValueImpl.
+// The frame owns the partially built value until every child has been
+// converted, then hands it to the parent frame (or to the caller for the
+// root frame).
+struct V8ValueConverter::ConversionFrame {
+  ConversionFrame() {}
+  ConversionFrame(ConversionFrame&&) = default;
+  ConversionFrame& operator=(ConversionFrame&&) = default;
+
+  // The object being walked; kept so the frame can be removed from the
+  // uniqueness (cycle) check when it is popped.
+  v8::Local<v8::Object> handle;
+  // Context entered for |handle| when it was created in a different context
+  // than the current one; exited when the frame is popped.
+  v8::Local<v8::Context> entered_context;
+  // Own property names of |handle| for dictionaries; unused for lists.
+  v8::Local<v8::Array> property_names;
+  uint32_t index = 0;
+  uint32_t length = 0;
+  bool is_list = false;
+  // Key under which the finished value is stored in a dictionary parent.
+  std::string parent_key;
+  std::unique_ptr<base::Value> value;
 };
 
 V8ValueConverter::V8ValueConverter() {}
@@ -183,6 +204,16 @@ v8::Local<v8::Value> V8ValueConverter::ToV8ValueImpl(
     case base::Value::Type::STRING: {
       std::string val;
       value->GetAsString(&val);
+      // ASCII strings go in through NewFromOneByte, a plain copy, instead
+      // of the scalar UTF-8 decoder.
+      uint8_t acc = 0;
+      for (char c : val)
+        acc |= static_cast<uint8_t>(c);
+      if ((acc & 0x80) == 0) {
+        return v8::String::NewFromOneByte(
+            isolate, reinterpret_cast<const uint8_t*>(val.c_str()),
+            v8::String::kNormalString, val.length());
+      }
       return v8::String::NewFromUtf8(isolate, val.c_str(),
                                      v8::String::kNormalString, val.length());
     }
@@ -292,42 +323,58 @@ v8::Local<v8::Value> V8ValueConverter::ToArrayBuffer(
   return v8::Uint8Array::New(array_buffer, 0, length);
 }
 
-base::Value* V8ValueConverter::FromV8ValueImpl(FromV8ValueState* state,
-                                               v8::Local<v8::Value> val,
-                                               v8::Isolate* isolate) const {
-  FromV8ValueState::Level state_level(state);
-  if (state->HasReachedMaxRecursionDepth())
-    return nullptr;
-
-  if (val->IsExternal())
-    return std::make_unique<base::Value>().release();
+// Classifies |val| and, for scalar leaves, performs the conversion in
+// place. Returns kLeaf with |*leaf| set (possibly to nullptr, meaning the
+// value does not serialize, like JSON.stringify with undefined), or
+// kList/kDictionary with |*object| set to the container whose children the
+// caller should walk.
+V8ValueConverter::NodeKind V8ValueConverter::ClassifyNode(
+    v8::Local<v8::Value> val,
+    v8::Isolate* isolate,
+    v8::Local<v8::Object>* object,
+    base::Value** leaf) const {
+  *leaf = nullptr;
 
-  if (val->IsNull())
-    return std::make_unique<base::Value>().release();
+  if (val->IsExternal() || val->IsNull()) {
+    *leaf = new base::Value();
+    return NodeKind::kLeaf;
+  }
 
   auto context = isolate->GetCurrentContext();
 
-  if (val->IsBoolean())
-    return new base::Value(val->ToBoolean(context).ToLocalChecked()->Value());
+  if (val->IsBoolean()) {
+    *leaf = new base::Value(val->ToBoolean(context).ToLocalChecked()->Value());
+    return NodeKind::kLeaf;
+  }
 
-  if (val->IsInt32())
-    return new base::Value(val->ToInt32(context).ToLocalChecked()->Value());
+  if (val->IsInt32()) {
+    *leaf = new base::Value(val->ToInt32(context).ToLocalChecked()->Value());
+    return NodeKind::kLeaf;
+  }
 
   if (val->IsNumber()) {
     double val_as_double = val->ToNumber(context).ToLocalChecked()->Value();
-    if (!std::isfinite(val_as_double))
-      return nullptr;
-    return new base::Value(val_as_double);
+    // Non-finite numbers don't serialize; leave |*leaf| null.
+    if (std::isfinite(val_as_double))
+      *leaf = new base::Value(val_as_double);
+    return NodeKind::kLeaf;
   }
 
   if (val->IsString()) {
-    v8::String::Utf8Value utf8(val->ToString(context).ToLocalChecked());
-    return new base::Value(std::string(*utf8, utf8.length()));
+    v8::Local<v8::String> str = val->ToString(context).ToLocalChecked();
+    std::string out;
+    if (ReadOneByteAscii(str, &out)) {
+      *leaf = new base::Value(std::move(out));
+    } else {
+      v8::String::Utf8Value utf8(str);
+      *leaf = new base::Value(std::string(*utf8, utf8.length()));
+    }
+    return NodeKind::kLeaf;
   }
 
   if (val->IsUndefined())
     // JSON.stringify ignores undefined.
-    return nullptr;
+    return NodeKind::kLeaf;
 
   if (val->IsDate()) {
     v8::Date* date = v8::Date::Cast(*val);
@@ -338,168 +385,274 @@ base::Value* V8ValueConverter::FromV8ValueImpl(FromV8ValueState* state,
           toISOString.As<v8::Function>()->Call(val, 0, nullptr);
       if (!result.IsEmpty()) {
         v8::String::Utf8Value utf8(result->ToString(context).ToLocalChecked());
-        return new base::Value(std::string(*utf8, utf8.length()));
+        *leaf = new base::Value(std::string(*utf8, utf8.length()));
+        return NodeKind::kLeaf;
       }
     }
+    // A Date without a working toISOString falls through to the object
+    // checks below, matching the old recursive behavior.
   }
 
   if (val->IsRegExp()) {
-    if (!reg_exp_allowed_)
-      // JSON.stringify converts to an object.
-      return FromV8Object(val->ToObject(context).ToLocalChecked(), state,
-                          isolate);
-    return new base::Value(
-        *v8::String::Utf8Value(val->ToString(context).ToLocalChecked()));
+    if (reg_exp_allowed_) {
+      *leaf = new base::Value(
+          *v8::String::Utf8Value(val->ToString(context).ToLocalChecked()));
+      return NodeKind::kLeaf;
+    }
+    // JSON.stringify converts to an object.
+    *object = val->ToObject(context).ToLocalChecked();
+    return NodeKind::kDictionary;
   }
 
-  // v8::Value doesn't have a ToArray() method for some reason.
-  if (val->IsArray())
-    return FromV8Array(val.As<v8::Array>(), state, isolate);
+  if (val->IsArray()) {
+    *object = val.As<v8::Object>();
+    return NodeKind::kList;
+  }
 
   if (val->IsFunction()) {
     if (!function_allowed_)
       // JSON.stringify refuses to convert function(){}.
-      return nullptr;
-    return FromV8Object(val->ToObject(context).ToLocalChecked(), state,
-                        isolate);
+      return NodeKind::kLeaf;
+    *object = val->ToObject(context).ToLocalChecked();
+    return NodeKind::kDictionary;
   }
 
   if (node::Buffer::HasInstance(val)) {
-    return FromNodeBuffer(val, state, isolate);
+    *leaf = FromNodeBuffer(val, isolate);
+    return NodeKind::kLeaf;
   }
 
   if (val->IsObject()) {
-    return FromV8Object(val->ToObject(context).ToLocalChecked(), state,
-                        isolate);
+    *object = val->ToObject(context).ToLocalChecked();
+    return NodeKind::kDictionary;
   }
 
   LOG(ERROR) << "Unexpected v8 value type encountered.";
-  return nullptr;
+  return NodeKind::kLeaf;
 }
 
-base::Value* V8ValueConverter::FromV8Array(v8::Local<v8::Array> val,
-                                           FromV8ValueState* state,
-                                           v8::Isolate* isolate) const {
-  ScopedUniquenessGuard uniqueness_guard(state, val);
-  if (!uniqueness_guard.is_valid())
-    return std::make_unique<base::Value>().release();
+// Returns true after pushing a frame for |object| onto |stack|. Returns
+// false when |object| must not be walked, with |*placeholder| set to what
+// the parent should record instead: a null Value for a cycle, or nullptr
+// (does not serialize) when the nesting depth limit is hit.
+bool V8ValueConverter::PushContainerFrame(
+    FromV8ValueState* state,
+    v8::Local<v8::Object> object,
+    bool is_list,
+    v8::Isolate* isolate,
+    std::vector<ConversionFrame>* stack,
+    std::unique_ptr<base::Value>* placeholder) const {
+  if (stack->size() >= static_cast<size_t>(kMaxNestingDepth)) {
+    placeholder->reset();
+    return false;
+  }
 
-  std::unique_ptr<v8::Context::Scope> scope;
-  // If val was created in a different context than our current one, change to
-  // that context, but change back after val is converted.
-  if (!val->CreationContext().IsEmpty() &&
-      val->CreationContext() != isolate->GetCurrentContext())
-    scope.reset(new v8::Context::Scope(val->CreationContext()));
+  // Objects/arrays that already have a frame on the stack form a cycle,
+  // e.g. var v = {}; v = {key: v}; (but not var v = {}; a = [v, v];) and
+  // are converted to null instead of walked forever.
+  if (!state->AddToUniquenessCheck(object)) {
+    *placeholder = std::make_unique<base::Value>();
+    return false;
+  }
 
-  auto* result = new base::ListValue();
+  ConversionFrame frame;
+  frame.handle = object;
+  frame.is_list = is_list;
 
-  // Only fields with integer keys are carried over to the ListValue.
-  for (uint32_t i = 0; i < val->Length(); ++i) {
-    v8::TryCatch try_catch(isolate);
-    v8::Local<v8::Value> child_v8 = val->Get(i);
-    if (try_catch.HasCaught()) {
-      LOG(ERROR) << "Getter for index " << i << " threw an exception.";
-      child_v8 = v8::Null(isolate);
-    }
-
-    if (!val->HasRealIndexedProperty(i))
-      continue;
+  // If |object| was created in a different context than our current one,
+  // change to that context; it is changed back when the frame is popped.
+  if (!object->CreationContext().IsEmpty() &&
+      object->CreationContext() != isolate->GetCurrentContext()) {
+    frame.entered_context = object->CreationContext();
+    frame.entered_context->Enter();
+  }
 
-    base::Value* child = FromV8ValueImpl(state, child_v8, isolate);
-    if (child)
-      result->Append(std::unique_ptr<base::Value>(child));
-    else
-      // JSON.stringify puts null in places where values don't serialize, for
-      // example undefined and functions. Emulate that behavior.
-      result->Append(std::make_unique<base::Value>());
+  if (is_list) {
+    frame.length = object.As<v8::Array>()->Length();
+    frame.value = std::make_unique<base::ListValue>();
+  } else {
+    frame.property_names = object->GetOwnPropertyNames();
+    frame.length = frame.property_names->Length();
+    frame.value = std::make_unique<base::DictionaryValue>();
   }
-  return result;
-}
 
-base::Value* V8ValueConverter::FromNodeBuffer(v8::Local<v8::Value> value,
-                                              FromV8ValueState* state,
-                                              v8::Isolate* isolate) const {
-  auto vec = std::vector<char>(
-      node::Buffer::Data(value),
-      node::Buffer::Data(value) + node::Buffer::Length(value));
-  return std::make_unique<base::Value>(vec).release();
+  stack->push_back(std::move(frame));
+  return true;
 }
 
-base::Value* V8ValueConverter::FromV8Object(v8::Local<v8::Object> val,
-                                            FromV8ValueState* state,
-                                            v8::Isolate* isolate) const {
-  ScopedUniquenessGuard uniqueness_guard(state, val);
-  if (!uniqueness_guard.is_valid())
-    return std::make_unique<base::Value>().release();
-
-  std::unique_ptr<v8::Context::Scope> scope;
-  // If val was created in a different context than our current one, change to
-  // that context, but change back after val is converted.
-  if (!val->CreationContext().IsEmpty() &&
-      val->CreationContext() != isolate->GetCurrentContext())
-    scope.reset(new v8::Context::Scope(val->CreationContext()));
-
-  auto result = std::make_unique<base::DictionaryValue>();
-  v8::Local<v8::Array> property_names(val->GetOwnPropertyNames());
-
-  for (uint32_t i = 0; i < property_names->Length(); ++i) {
-    v8::Local<v8::Value> key(property_names->Get(i));
-
-    // Extend this test to cover more types as necessary and if sensible.
-    if (!key->IsString() && !key->IsNumber()) {
-      NOTREACHED() << "Key \"" << *v8::String::Utf8Value(key)
-                   << "\" "
-                      "is neither a string nor a number";
+// The conversion core: an explicit-stack walk over the value graph instead
+// of one C++ stack frame per node, so deeply nested IPC payloads can't
+// exhaust the thread stack and large flat payloads don't pay the per-call
+// overhead.
+base::Value* V8ValueConverter::FromV8ValueImpl(FromV8ValueState* state,
+                                               v8::Local<v8::Value> val,
+                                               v8::Isolate* isolate) const {
+  v8::Local<v8::Object> root_object;
+  base::Value* root_leaf = nullptr;
+  NodeKind kind = ClassifyNode(val, isolate, &root_object, &root_leaf);
+  if (kind == NodeKind::kLeaf)
+    return root_leaf;
+
+  std::vector<ConversionFrame> stack;
+  std::unique_ptr<base::Value> placeholder;
+  if (!PushContainerFrame(state, root_object, kind == NodeKind::kList, isolate,
+                          &stack, &placeholder))
+    return placeholder.release();
+
+  while (true) {
+    ConversionFrame& frame = stack.back();
+
+    if (frame.index >= frame.length) {
+      // Every child converted; pop the frame and hand the finished value
+      // to the parent (or to the caller for the root).
+      if (!frame.entered_context.IsEmpty())
+        frame.entered_context->Exit();
+      bool removed = state->RemoveFromUniquenessCheck(frame.handle);
+      DCHECK(removed);
+
+      std::unique_ptr<base::Value> finished = std::move(frame.value);
+      std::string key = std::move(frame.parent_key);
+      stack.pop_back();
+      if (stack.empty())
+        return finished.release();
+
+      ConversionFrame& parent = stack.back();
+      if (parent.is_list) {
+        static_cast<base::ListValue*>(parent.value.get())
+            ->Append(std::move(finished));
+      } else {
+        static_cast<base::DictionaryValue*>(parent.value.get())
+            ->SetWithoutPathExpansion(key, std::move(finished));
+      }
       continue;
     }
 
-    v8::String::Utf8Value name_utf8(
-        key->ToString(isolate->GetCurrentContext()).ToLocalChecked());
+    uint32_t i = frame.index++;
 
-    v8::TryCatch try_catch(isolate);
-    v8::Local<v8::Value> child_v8 = val->Get(key);
+    if (frame.is_list) {
+      auto* list = static_cast<base::ListValue*>(frame.value.get());
 
-    if (try_catch.HasCaught()) {
-      LOG(ERROR) << "Getter for property " << *name_utf8
-                 << " threw an exception.";
-      child_v8 = v8::Null(isolate);
-    }
+      v8::TryCatch try_catch(isolate);
+      v8::Local<v8::Value> child_v8 = frame.handle->Get(i);
+      if (try_catch.HasCaught()) {
+        LOG(ERROR) << "Getter for index " << i << " threw an exception.";
+        child_v8 = v8::Null(isolate);
+      }
 
-    std::unique_ptr<base::Value> child(
-        FromV8ValueImpl(state, child_v8, isolate));
-    if (!child.get())
-      // JSON.stringify skips properties whose values don't serialize, for
-      // example undefined and functions. Emulate that behavior.
-      continue;
+      // Only fields with integer keys are carried over to the ListValue.
+      if (!frame.handle.As<v8::Array>()->HasRealIndexedProperty(i))
+        continue;
+
+      v8::Local<v8::Object> child_object;
+      base::Value* child_leaf = nullptr;
+      NodeKind child_kind =
+          ClassifyNode(child_v8, isolate, &child_object, &child_leaf);
+      if (child_kind == NodeKind::kLeaf) {
+        if (child_leaf)
+          list->Append(std::unique_ptr<base::Value>(child_leaf));
+        else
+          // JSON.stringify puts null in places where values don't
+          // serialize, for example undefined and functions. Emulate that
+          // behavior.
+          list->Append(std::make_unique<base::Value>());
+      } else if (!PushContainerFrame(state, child_object,
+                                     child_kind == NodeKind::kList, isolate,
+                                     &stack, &placeholder)) {
+        // Both a cycle and exceeded depth become null in a list.
+        list->Append(placeholder ? std::move(placeholder)
+                                 : std::make_unique<base::Value>());
+      }
+    } else {
+      auto* dict = static_cast<base::DictionaryValue*>(frame.value.get());
 
-    // Strip null if asked (and since undefined is turned into null, undefined
-    // too). The use case for supporting this is JSON-schema support,
-    // specifically for extensions, where "optional" JSON properties may be
-    // represented as null, yet due to buggy legacy code elsewhere isn't
-    // treated as such (potentially causing crashes). For example, the
-    // "tabs.create" function takes an object as its first argument with an
-    // optional "windowId" property.
-    //
-    // Given just
-    //
-    //   tabs.create({})
-    //
-    // this will work as expected on code that only checks for the existence of
-    // a "windowId" property (such as that legacy code). However given
-    //
-    //   tabs.create({windowId: null})
-    //
-    // there *is* a "windowId" property, but since it should be an int, code
-    // on the browser which doesn't additionally check for null will fail.
-    // We can avoid all bugs related to this by stripping null.
-    if (strip_null_from_objects_ && child->is_none())
-      continue;
+      v8::Local<v8::Value> key(frame.property_names->Get(i));
+
+      // Extend this test to cover more types as necessary and if sensible.
+      if (!key->IsString() && !key->IsNumber()) {
+        NOTREACHED() << "Key \"" << *v8::String::Utf8Value(key)
+                     << "\" "
+                        "is neither a string nor a number";
+        continue;
+      }
+
+      // String keys go through the interning cache: the property names of
+      // the typical repeated-shape payload are the same handful of strings
+      // over and over.
+      const std::string* name;
+      std::string number_key;
+      if (key->IsString()) {
+        name = &state->GetInternedKey(key.As<v8::String>());
+      } else {
+        v8::String::Utf8Value utf8(
+            key->ToString(isolate->GetCurrentContext()).ToLocalChecked());
+        number_key.assign(*utf8, utf8.length());
+        name = &number_key;
+      }
+
+      v8::TryCatch try_catch(isolate);
+      v8::Local<v8::Value> child_v8 = frame.handle->Get(key);
+      if (try_catch.HasCaught()) {
+        LOG(ERROR) << "Getter for property " << *name
+                   << " threw an exception.";
+        child_v8 = v8::Null(isolate);
+      }
 
-    result->SetWithoutPathExpansion(std::string(*name_utf8, name_utf8.length()),
-                                    std::move(child));
+      v8::Local<v8::Object> child_object;
+      base::Value* child_leaf = nullptr;
+      NodeKind child_kind =
+          ClassifyNode(child_v8, isolate, &child_object, &child_leaf);
+      if (child_kind == NodeKind::kLeaf) {
+        std::unique_ptr<base::Value> child(child_leaf);
+        if (!child.get())
+          // JSON.stringify skips properties whose values don't serialize,
+          // for example undefined and functions. Emulate that behavior.
+          continue;
+
+        // Strip null if asked (and since undefined is turned into null,
+        // undefined too). The use case for supporting this is JSON-schema
+        // support, specifically for extensions, where "optional" JSON
+        // properties may be represented as null, yet due to buggy legacy
+        // code elsewhere isn't treated as such (potentially causing
+        // crashes). For example, the "tabs.create" function takes an object
+        // as its first argument with an optional "windowId" property.
+        //
+        // Given just
+        //
+        //   tabs.create({})
+        //
+        // this will work as expected on code that only checks for the
+        // existence of a "windowId" property (such as that legacy code).
+        // However given
+        //
+        //   tabs.create({windowId: null})
+        //
+        // there *is* a "windowId" property, but since it should be an int,
+        // code on the browser which doesn't additionally check for null
+        // will fail. We can avoid all bugs related to this by stripping
+        // null.
+        if (strip_null_from_objects_ && child->is_none())
+          continue;
+
+        dict->SetWithoutPathExpansion(*name, std::move(child));
+      } else if (PushContainerFrame(state, child_object,
+                                    child_kind == NodeKind::kList, isolate,
+                                    &stack, &placeholder)) {
+        stack.back().parent_key = *name;
+      } else if (placeholder && !strip_null_from_objects_) {
+        // A cycle converts to null (subject to null stripping); exceeded
+        // depth doesn't serialize at all.
+        dict->SetWithoutPathExpansion(*name, std::move(placeholder));
+      }
+    }
   }
+}
 
-  return result.release();
+base::Value* V8ValueConverter::FromNodeBuffer(v8::Local<v8::Value> value,
+                                              v8::Isolate* isolate) const {
+  auto vec = std::vector<char>(
+      node::Buffer::Data(value),
+      node::Buffer::Data(value) + node::Buffer::Length(value));
+  return std::make_unique<base::Value>(vec).release();
 }
 
 }  // namespace atom
@@ -5,6 +5,9 @@
 #ifndef ATOM_COMMON_NATIVE_MATE_CONVERTERS_V8_VALUE_CONVERTER_H_
 #define ATOM_COMMON_NATIVE_MATE_CONVERTERS_V8_VALUE_CONVERTER_H_
 
+#include <memory>
+#include <vector>
+
 #include "base/compiler_specific.h"
 #include "base/macros.h"
 #include "v8/include/v8.h"
@@ -31,7 +34,11 @@ class V8ValueConverter {
 
  private:
   class FromV8ValueState;
-  class ScopedUniquenessGuard;
+  struct ConversionFrame;
+
+  // What FromV8ValueImpl should do with a single node: store a finished
+  // leaf value, or walk the node's children as a list or dictionary.
+  enum class NodeKind { kLeaf, kList, kDictionary };
 
   v8::Local<v8::Value> ToV8ValueImpl(v8::Isolate* isolate,
                                      const base::Value* value) const;
@@ -46,15 +53,18 @@ class V8ValueConverter {
   base::Value* FromV8ValueImpl(FromV8ValueState* state,
                                v8::Local<v8::Value> value,
                                v8::Isolate* isolate) const;
-  base::Value* FromV8Array(v8::Local<v8::Array> array,
-                           FromV8ValueState* state,
-                           v8::Isolate* isolate) const;
+  NodeKind ClassifyNode(v8::Local<v8::Value> value,
+                        v8::Isolate* isolate,
+                        v8::Local<v8::Object>* object,
+                        base::Value** leaf) const;
+  bool PushContainerFrame(FromV8ValueState* state,
+                          v8::Local<v8::Object> object,
+                          bool is_list,
+                          v8::Isolate* isolate,
+                          std::vector<ConversionFrame>* stack,
+                          std::unique_ptr<base::Value>* placeholder) const;
   base::Value* FromNodeBuffer(v8::Local<v8::Value> value,
-                              FromV8ValueState* state,
                               v8::Isolate* isolate) const;
-  base::Value* FromV8Object(v8::Local<v8::Object> object,
-                            FromV8ValueState* state,
-                            v8::Isolate* isolate) const;
 
   // If true, we will convert RegExp JavaScript objects to string.
   bool reg_exp_allowed_ = false;
@@ -27,7 +27,8 @@
 
 #include "atom/common/node_includes.h"
 
-#define ELECTRON_BUILTIN_MODULES(V)          \
+// Modules only the browser process requires.
+#define ELECTRON_BROWSER_MODULES(V)          \
   V(atom_browser_app)                        \
   V(atom_browser_auto_updater)               \
   V(atom_browser_browser_view)               \
@@ -52,7 +53,10 @@
   V(atom_browser_web_contents_view)          \
   V(atom_browser_view)                       \
   V(atom_browser_web_view_manager)           \
-  V(atom_browser_window)                     \
+  V(atom_browser_window)
+
+// Modules shared by every process type.
+#define ELECTRON_COMMON_MODULES(V)           \
   V(atom_common_asar)                        \
   V(atom_common_clipboard)                   \
   V(atom_common_crash_reporter)              \
@@ -61,10 +65,18 @@
   V(atom_common_notification)                \
   V(atom_common_screen)                      \
   V(atom_common_shell)                       \
-  V(atom_common_v8_util)                     \
-  V(atom_renderer_ipc)                       \
+  V(atom_common_v8_util)
+
+// Modules only renderer and worker processes require.
+#define ELECTRON_RENDERER_MODULES(V) \
+  V(atom_renderer_ipc)               \
   V(atom_renderer_web_frame)
 
+#define ELECTRON_BUILTIN_MODULES(V) \
+  ELECTRON_BROWSER_MODULES(V)       \
+  ELECTRON_COMMON_MODULES(V)        \
+  ELECTRON_RENDERER_MODULES(V)
+
 #define ELECTRON_VIEW_MODULES(V) \
   V(atom_browser_box_layout)     \
   V(atom_browser_button)         \
@@ -149,8 +161,91 @@ base::FilePath GetResourcesPath(bool is_browser) {
   return resources_path;
 }
 
+base::LazyInstance<UvLoopMetrics>::Leaky g_uv_loop_metrics =
+    LAZY_INSTANCE_INITIALIZER;
+
 }  // namespace
 
+UvLoopMetrics::Snapshot::Snapshot() = default;
+
+UvLoopMetrics::Snapshot::Snapshot(const Snapshot& other) = default;
+
+UvLoopMetrics::Snapshot::~Snapshot() = default;
+
+UvLoopMetrics::UvLoopMetrics() {
+  iteration_ms_.reserve(kSampleWindow);
+  wakeup_lag_ms_.reserve(kSampleWindow);
+}
+
+UvLoopMetrics::~UvLoopMetrics() = default;
+
+// static
+UvLoopMetrics* UvLoopMetrics::Get() {
+  return g_uv_loop_metrics.Pointer();
+}
+
+void UvLoopMetrics::OnWakeupPosted() {
+  base::AutoLock auto_lock(lock_);
+  wakeup_posted_ = base::TimeTicks::Now();
+}
+
+void UvLoopMetrics::OnIterationStart() {
+  base::AutoLock auto_lock(lock_);
+  iteration_started_ = base::TimeTicks::Now();
+  // The first iteration and re-entrant runs are not preceded by a wakeup
+  // post, in which case there is no lag to record.
+  if (!wakeup_posted_.is_null()) {
+    AddSample(&wakeup_lag_ms_, &next_wakeup_lag_sample_,
+              iteration_started_ - wakeup_posted_);
+    wakeup_posted_ = base::TimeTicks();
+  }
+}
+
+void UvLoopMetrics::OnIterationEnd() {
+  base::AutoLock auto_lock(lock_);
+  if (iteration_started_.is_null())
+    return;
+  AddSample(&iteration_ms_, &next_iteration_sample_,
+            base::TimeTicks::Now() - iteration_started_);
+  iteration_started_ = base::TimeTicks();
+  iterations_++;
+}
+
+void UvLoopMetrics::OnPollStart() {
+  base::AutoLock auto_lock(lock_);
+  poll_started_ = base::TimeTicks::Now();
+}
+
+void UvLoopMetrics::OnPollEnd() {
+  base::AutoLock auto_lock(lock_);
+  if (poll_started_.is_null())
+    return;
+  total_poll_time_ += base::TimeTicks::Now() - poll_started_;
+  poll_started_ = base::TimeTicks();
+  polls_++;
+}
+
+void UvLoopMetrics::GetSnapshot(Snapshot* snapshot) {
+  base::AutoLock auto_lock(lock_);
+  snapshot->iterations = iterations_;
+  snapshot->polls = polls_;
+  snapshot->total_poll_time = total_poll_time_;
+  snapshot->iteration_ms = iteration_ms_;
+  snapshot->wakeup_lag_ms = wakeup_lag_ms_;
+}
+
+void UvLoopMetrics::AddSample(std::vector<double>* samples,
+                              size_t* next,
+                              base::TimeDelta delta) {
+  double ms = delta.InMillisecondsF();
+  if (samples->size() < kSampleWindow) {
+    samples->push_back(ms);
+  } else {
+    (*samples)[*next] = ms;
+  }
+  *next = (*next + 1) % kSampleWindow;
+}
+
 NodeBindings::NodeBindings(BrowserEnvironment browser_env)
     : browser_env_(browser_env), weak_factory_(this) {
   if (browser_env == WORKER) {
@@ -164,14 +259,16 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
 NodeBindings::~NodeBindings() {
   // Quit the embed thread.
   embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
-  WakeupEmbedThread();
+  if (embed_thread_started_) {
+    uv_sem_post(&embed_sem_);
+    WakeupEmbedThread();
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
 
-  // Clear uv.
-  uv_sem_destroy(&embed_sem_);
+    // Clear uv.
+    uv_sem_destroy(&embed_sem_);
+  }
   uv_close(reinterpret_cast<uv_handle_t*>(&dummy_uv_handle_), nullptr);
 
   // Clean up worker loop
@@ -179,15 +276,25 @@ NodeBindings::~NodeBindings() {
     stop_and_close_uv_loop(uv_loop_);
 }
 
-void NodeBindings::RegisterBuiltinModules() {
+void NodeBindings::RegisterBuiltinModules(ProcessKind kind) {
+  // Registration only records the module's name and init function; the
+  // object templates are still built lazily, on first require. Skipping
+  // the modules a process type can never require keeps its module list
+  // short and its startup cheap.
 #define V(modname) _register_##modname();
-  ELECTRON_BUILTIN_MODULES(V)
+  ELECTRON_COMMON_MODULES(V)
+  if (kind == ALL_MODULES || kind == BROWSER_MODULES) {
+    ELECTRON_BROWSER_MODULES(V)
 #if defined(ENABLE_VIEW_API)
-  ELECTRON_VIEW_MODULES(V)
+    ELECTRON_VIEW_MODULES(V)
 #endif
 #if defined(ENABLE_DESKTOP_CAPTURER)
-  ELECTRON_DESKTOP_CAPTURER_MODULE(V)
+    ELECTRON_DESKTOP_CAPTURER_MODULE(V)
 #endif
+  }
+  if (kind == ALL_MODULES || kind == RENDERER_MODULES) {
+    ELECTRON_RENDERER_MODULES(V)
+  }
 #undef V
 }
 
@@ -206,8 +313,9 @@ void NodeBindings::Initialize() {
     AtomCommandLine::InitializeFromCommandLine();
 #endif
 
-  // Explicitly register electron's builtin modules.
-  RegisterBuiltinModules();
+  // Explicitly register the builtin modules this process type can use.
+  RegisterBuiltinModules(browser_env_ == BROWSER ? BROWSER_MODULES
+                                                 : RENDERER_MODULES);
 
   // Init node.
   // (we assume node::Init would not modify the parameters under embedded mode).
@@ -290,12 +398,20 @@ void NodeBindings::LoadEnvironment(node::Environment* env) {
   mate::EmitEvent(env->isolate(), env->process_object(), "loaded");
 }
 
+bool NodeBindings::PollsOnEmbedThread() const {
+  return true;
+}
+
 void NodeBindings::PrepareMessageLoop() {
   // Add dummy handle for libuv, otherwise libuv would quit when there is
   // nothing to do.
   uv_async_init(uv_loop_, &dummy_uv_handle_, nullptr);
 
-  // Start worker that will interrupt main loop when having uv events.
+  // Start worker that will interrupt main loop when having uv events, unless
+  // the platform watches the uv backend fd from the message pump itself.
+  if (!PollsOnEmbedThread())
+    return;
+  embed_thread_started_ = true;
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
 }
@@ -331,9 +447,18 @@ void NodeBindings::UvRunOnce() {
   if (browser_env_ != BROWSER)
     TRACE_EVENT_BEGIN0("devtools.timeline", "FunctionCall");
 
+  // Worker loops are short-lived side loops; the metrics only track the
+  // process's main uv loop.
+  bool record_metrics = browser_env_ != WORKER;
+  if (record_metrics)
+    UvLoopMetrics::Get()->OnIterationStart();
+
   // Deal with uv events.
   int r = uv_run(uv_loop_, UV_RUN_NOWAIT);
 
+  if (record_metrics)
+    UvLoopMetrics::Get()->OnIterationEnd();
+
   if (browser_env_ != BROWSER)
     TRACE_EVENT_END0("devtools.timeline", "FunctionCall");
 
@@ -341,7 +466,8 @@ void NodeBindings::UvRunOnce() {
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
   // Tell the worker thread to continue polling.
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_started_)
+    uv_sem_post(&embed_sem_);
 }
 
 void NodeBindings::WakeupMainThread() {
@@ -369,11 +495,18 @@ void NodeBindings::EmbedThreadRunner(void* arg) {
     // this class is being destructed the PollEvents() would not be available
     // anymore. Because of it we must make sure we only invoke PollEvents()
     // when this class is alive.
+    bool record_metrics = self->browser_env_ != WORKER;
+    if (record_metrics)
+      UvLoopMetrics::Get()->OnPollStart();
     self->PollEvents();
+    if (record_metrics)
+      UvLoopMetrics::Get()->OnPollEnd();
     if (self->embed_closed_)
       break;
 
     // Deal with event in main thread.
+    if (record_metrics)
+      UvLoopMetrics::Get()->OnWakeupPosted();
     self->WakeupMainThread();
   }
 }
@@ -5,9 +5,14 @@
 #ifndef ATOM_COMMON_NODE_BINDINGS_H_
 #define ATOM_COMMON_NODE_BINDINGS_H_
 
+#include <vector>
+
+#include "base/lazy_instance.h"
 #include "base/macros.h"
 #include "base/memory/weak_ptr.h"
 #include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
 #include "uv.h"  // NOLINT(build/include)
 #include "v8/include/v8.h"
 
@@ -22,6 +27,72 @@ class MultiIsolatePlatform;
 
 namespace atom {
 
+// Process-wide health metrics for the embedded uv loop. The main thread
+// records iteration latency from UvRunOnce while the polling thread
+// records wakeup posts and time spent sleeping in PollEvents(); all state
+// is guarded by |lock_|. Read from JS via process.getUvLoopStats() so
+// telemetry can tell libuv lag apart from Chromium task lag.
+class UvLoopMetrics {
+ public:
+  // Number of recent samples kept per series for percentile queries.
+  static const size_t kSampleWindow = 512;
+
+  struct Snapshot {
+    Snapshot();
+    Snapshot(const Snapshot& other);
+    ~Snapshot();
+
+    uint64_t iterations = 0;
+    uint64_t polls = 0;
+    base::TimeDelta total_poll_time;
+    // Recent samples in milliseconds, unordered.
+    std::vector<double> iteration_ms;
+    std::vector<double> wakeup_lag_ms;
+  };
+
+  static UvLoopMetrics* Get();
+
+  // Called on the polling thread right before UvRunOnce is posted to the
+  // main thread; the gap until OnIterationStart is the wakeup lag.
+  void OnWakeupPosted();
+
+  // Called on the main thread around the uv_run in UvRunOnce.
+  void OnIterationStart();
+  void OnIterationEnd();
+
+  // Called on the polling thread around PollEvents().
+  void OnPollStart();
+  void OnPollEnd();
+
+  void GetSnapshot(Snapshot* snapshot);
+
+ private:
+  friend struct base::LazyInstanceTraitsBase<UvLoopMetrics>;
+
+  UvLoopMetrics();
+  ~UvLoopMetrics();
+
+  // Appends |delta| to |samples|, overwriting the oldest entry once the
+  // series has kSampleWindow entries. |next| is the series' write cursor.
+  void AddSample(std::vector<double>* samples,
+                 size_t* next,
+                 base::TimeDelta delta);
+
+  base::Lock lock_;
+  uint64_t iterations_ = 0;
+  uint64_t polls_ = 0;
+  base::TimeDelta total_poll_time_;
+  base::TimeTicks wakeup_posted_;
+  base::TimeTicks iteration_started_;
+  base::TimeTicks poll_started_;
+  std::vector<double> iteration_ms_;
+  std::vector<double> wakeup_lag_ms_;
+  size_t next_iteration_sample_ = 0;
+  size_t next_wakeup_lag_sample_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(UvLoopMetrics);
+};
+
 class NodeBindings {
  public:
   enum BrowserEnvironment {
@@ -30,8 +101,17 @@ class NodeBindings {
     WORKER,
   };
 
+  // Which group of builtin modules to register in a process. Template
+  // construction stays lazy either way; this only controls whose names
+  // get recorded in node's module list.
+  enum ProcessKind {
+    ALL_MODULES,
+    BROWSER_MODULES,
+    RENDERER_MODULES,
+  };
+
   static NodeBindings* Create(BrowserEnvironment browser_env);
-  static void RegisterBuiltinModules();
+  static void RegisterBuiltinModules(ProcessKind kind = ALL_MODULES);
   static bool IsInitialized();
 
   virtual ~NodeBindings();
@@ -62,6 +142,11 @@ class NodeBindings {
  protected:
   explicit NodeBindings(BrowserEnvironment browser_env);
 
+  // Whether uv events are delivered by the dedicated polling thread. On
+  // platforms that integrate the uv backend fd into the native message pump
+  // directly this returns false and no embed thread is created.
+  virtual bool PollsOnEmbedThread() const;
+
   // Called to poll events in new thread.
   virtual void PollEvents() = 0;
 
@@ -90,6 +175,9 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether the polling thread was actually created.
+  bool embed_thread_started_ = false;
+
   // Loop used when constructed in WORKER mode
   uv_loop_t worker_loop_;
 
@@ -8,6 +8,18 @@
 
 namespace atom {
 
+namespace {
+
+// GSource wrapper carrying the bindings pointer and the tag returned by
+// g_source_add_unix_fd for the uv backend fd.
+struct UvEventSource {
+  GSource source;
+  NodeBindingsLinux* bindings;
+  gpointer fd_tag;
+};
+
+}  // namespace
+
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
     : NodeBindings(browser_env), epoll_(epoll_create(1)) {
   int backend_fd = uv_backend_fd(uv_loop_);
@@ -17,13 +29,24 @@ NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
   epoll_ctl(epoll_, EPOLL_CTL_ADD, backend_fd, &ev);
 }
 
-NodeBindingsLinux::~NodeBindingsLinux() {}
+NodeBindingsLinux::~NodeBindingsLinux() {
+  if (uv_event_source_) {
+    g_source_destroy(uv_event_source_);
+    g_source_unref(uv_event_source_);
+  }
+}
 
 void NodeBindingsLinux::RunMessageLoop() {
   // Get notified when libuv's watcher queue changes.
   uv_loop_->data = this;
   uv_loop_->on_watcher_queue_updated = OnWatcherQueueChanged;
 
+  // In the browser process the glib message pump watches the uv backend fd
+  // itself; every other process keeps the polling thread (the renderer main
+  // loop has no fd-capable pump).
+  if (browser_env_ == BROWSER)
+    AttachUvEventSource();
+
   NodeBindings::RunMessageLoop();
 }
 
@@ -31,11 +54,16 @@ void NodeBindingsLinux::RunMessageLoop() {
 void NodeBindingsLinux::OnWatcherQueueChanged(uv_loop_t* loop) {
   NodeBindingsLinux* self = static_cast<NodeBindingsLinux*>(loop->data);
 
-  // We need to break the io polling in the epoll thread when loop's watcher
-  // queue changes, otherwise new events cannot be notified.
+  // We need to break the io polling when loop's watcher queue changes,
+  // otherwise new events cannot be notified. The async write makes the
+  // backend fd readable, which wakes whichever poller is watching it.
   self->WakeupEmbedThread();
 }
 
+bool NodeBindingsLinux::PollsOnEmbedThread() const {
+  return browser_env_ != BROWSER;
+}
+
 void NodeBindingsLinux::PollEvents() {
   int timeout = uv_backend_timeout(uv_loop_);
 
@@ -47,6 +75,45 @@ void NodeBindingsLinux::PollEvents() {
   } while (r == -1 && errno == EINTR);
 }
 
+// static
+gboolean NodeBindingsLinux::SourcePrepare(GSource* source, gint* timeout) {
+  auto* self = reinterpret_cast<UvEventSource*>(source)->bindings;
+  *timeout = uv_backend_timeout(self->uv_loop_);
+  return *timeout == 0;
+}
+
+// static
+gboolean NodeBindingsLinux::SourceCheck(GSource* source) {
+  auto* uv_source = reinterpret_cast<UvEventSource*>(source);
+  if (g_source_query_unix_fd(source, uv_source->fd_tag) & G_IO_IN)
+    return TRUE;
+  // A uv timer may have become due while glib was polling other fds.
+  return uv_backend_timeout(uv_source->bindings->uv_loop_) == 0;
+}
+
+// static
+gboolean NodeBindingsLinux::SourceDispatch(GSource* source,
+                                           GSourceFunc callback,
+                                           gpointer user_data) {
+  reinterpret_cast<UvEventSource*>(source)->bindings->UvRunOnce();
+  return G_SOURCE_CONTINUE;
+}
+
+void NodeBindingsLinux::AttachUvEventSource() {
+  static GSourceFuncs kUvEventSourceFuncs = {
+      &NodeBindingsLinux::SourcePrepare, &NodeBindingsLinux::SourceCheck,
+      &NodeBindingsLinux::SourceDispatch, nullptr};
+
+  GSource* source = g_source_new(&kUvEventSourceFuncs, sizeof(UvEventSource));
+  auto* uv_source = reinterpret_cast<UvEventSource*>(source);
+  uv_source->bindings = this;
+  uv_source->fd_tag =
+      g_source_add_unix_fd(source, uv_backend_fd(uv_loop_), G_IO_IN);
+  g_source_set_priority(source, G_PRIORITY_DEFAULT);
+  g_source_attach(source, g_main_context_default());
+  uv_event_source_ = source;
+}
+
 // static
 NodeBindings* NodeBindings::Create(BrowserEnvironment browser_env) {
   return new NodeBindingsLinux(browser_env);
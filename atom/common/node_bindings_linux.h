@@ -5,6 +5,8 @@
 #ifndef ATOM_COMMON_NODE_BINDINGS_LINUX_H_
 #define ATOM_COMMON_NODE_BINDINGS_LINUX_H_
 
+#include <glib.h>
+
 #include "atom/common/node_bindings.h"
 #include "base/compiler_specific.h"
 
@@ -21,11 +23,27 @@ class NodeBindingsLinux : public NodeBindings {
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
+  // NodeBindings:
+  bool PollsOnEmbedThread() const override;
   void PollEvents() override;
 
-  // Epoll to poll for uv's backend fd.
+  // glib integration, browser process only: the message pump polls the uv
+  // backend fd and honors uv timers through this GSource, so uv events are
+  // dispatched on the main thread without the embed thread and its wakeup
+  // hop.
+  static gboolean SourcePrepare(GSource* source, gint* timeout);
+  static gboolean SourceCheck(GSource* source);
+  static gboolean SourceDispatch(GSource* source,
+                                 GSourceFunc callback,
+                                 gpointer user_data);
+  void AttachUvEventSource();
+
+  // Epoll to poll for uv's backend fd. Only used when events are polled on
+  // the embed thread.
   int epoll_;
 
+  GSource* uv_event_source_ = nullptr;
+
   DISALLOW_COPY_AND_ASSIGN(NodeBindingsLinux);
 };
 
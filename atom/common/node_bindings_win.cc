@@ -7,6 +7,7 @@
 #include <windows.h>
 
 #include "base/logging.h"
+#include "base/macros.h"
 
 namespace atom {
 
@@ -18,17 +19,24 @@ NodeBindingsWin::~NodeBindingsWin() {}
 void NodeBindingsWin::PollEvents() {
   // If there are other kinds of events pending, uv_backend_timeout will
   // instruct us not to wait.
-  DWORD bytes, timeout;
-  ULONG_PTR key;
-  OVERLAPPED* overlapped;
-
-  timeout = uv_backend_timeout(uv_loop_);
-
-  GetQueuedCompletionStatus(uv_loop_->iocp, &bytes, &key, &overlapped, timeout);
-
-  // Give the event back so libuv can deal with it.
-  if (overlapped != NULL)
-    PostQueuedCompletionStatus(uv_loop_->iocp, bytes, key, overlapped);
+  DWORD timeout = uv_backend_timeout(uv_loop_);
+
+  // Dequeue completions in batches: a burst of fs/network completions then
+  // costs a single main-thread wakeup (and one uv_run) instead of one
+  // wakeup per completion.
+  OVERLAPPED_ENTRY entries[128];
+  ULONG count = 0;
+  if (!GetQueuedCompletionStatusEx(uv_loop_->iocp, entries, arraysize(entries),
+                                   &count, timeout, FALSE))
+    return;
+
+  // Give the events back so libuv can deal with them.
+  for (ULONG i = 0; i < count; i++) {
+    PostQueuedCompletionStatus(uv_loop_->iocp,
+                               entries[i].dwNumberOfBytesTransferred,
+                               entries[i].lpCompletionKey,
+                               entries[i].lpOverlapped);
+  }
 }
 
 // static
@@ -135,6 +135,10 @@ const char kDisableBlinkFeatures[] = "disableBlinkFeatures";
 // Enable the node integration in WebWorker.
 const char kNodeIntegrationInWorker[] = "nodeIntegrationInWorker";
 
+// Keep the per-thread worker node environment scaffolding warm between
+// workers instead of tearing it down with each one.
+const char kRecycleWorkerEnvironments[] = "recycleWorkerEnvironments";
+
 // Enable the web view tag.
 const char kWebviewTag[] = "webviewTag";
 
@@ -152,6 +156,9 @@ const char kAllowRunningInsecureContent[] = "allowRunningInsecureContent";
 
 const char kOffscreen[] = "offscreen";
 
+// Cap on how many frames per second the window's compositor produces.
+const char kFrameRate[] = "frameRate";
+
 }  // namespace options
 
 namespace switches {
@@ -192,6 +199,33 @@ const char kAppPath[] = "app-path";
 // The context ID for this process
 const char kContextId[] = "context-id";
 
+// Shared-memory asar index regions handed to child processes, as a
+// semicolon-separated list of "archive path:region size" pairs.
+const char kAsarIndexRegions[] = "asar-index-regions";
+
+// Record per-channel counts, payload sizes and dispatch latency for
+// renderer->browser IPC, surfaced through app.getIPCMetrics().
+const char kEnableIPCMetrics[] = "enable-ipc-metrics";
+
+// Comma-separated list of optional subsystems (see
+// atom/common/disabled_subsystems.h) whose initialization is skipped in
+// every process.
+const char kDisableSubsystems[] = "disable-subsystems";
+
+// V8 heap tuning for the main process, applied before the isolate is
+// created. Values are megabytes.
+const char kV8MaxOldSpaceSize[] = "v8-max-old-space-size";
+const char kV8MaxSemiSpaceSize[] = "v8-max-semi-space-size";
+const char kV8InitialOldSpaceSize[] = "v8-initial-old-space-size";
+
+// Renderer variants of the above, forwarded to every renderer process
+// through --js-flags so the fleet can run with tighter limits than the
+// main process.
+const char kRendererV8MaxOldSpaceSize[] = "renderer-v8-max-old-space-size";
+const char kRendererV8MaxSemiSpaceSize[] = "renderer-v8-max-semi-space-size";
+const char kRendererV8InitialOldSpaceSize[] =
+    "renderer-v8-initial-old-space-size";
+
 // The command line switch versions of the options.
 const char kBackgroundColor[] = "background-color";
 const char kPreloadScript[] = "preload";
@@ -209,6 +243,9 @@ const char kWebviewTag[] = "webview-tag";
 // Command switch passed to renderer process to control nodeIntegration.
 const char kNodeIntegrationInWorker[] = "node-integration-in-worker";
 
+// Recycle worker node environment scaffolding between workers.
+const char kRecycleWorkerEnvironments[] = "recycle-worker-environments";
+
 // Widevine options
 // Path to Widevine CDM binaries.
 const char kWidevineCdmPath[] = "widevine-cdm-path";
@@ -67,6 +67,7 @@ extern const char kScrollBounce[];
 extern const char kEnableBlinkFeatures[];
 extern const char kDisableBlinkFeatures[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kRecycleWorkerEnvironments[];
 extern const char kWebviewTag[];
 extern const char kNativeWindowOpen[];
 extern const char kCustomArgs[];
@@ -75,6 +76,7 @@ extern const char kSandbox[];
 extern const char kWebSecurity[];
 extern const char kAllowRunningInsecureContent[];
 extern const char kOffscreen[];
+extern const char kFrameRate[];
 
 }  // namespace options
 
@@ -94,6 +96,16 @@ extern const char kSecureSchemes[];
 extern const char kAppUserModelId[];
 extern const char kAppPath[];
 extern const char kContextId[];
+extern const char kAsarIndexRegions[];
+extern const char kEnableIPCMetrics[];
+extern const char kDisableSubsystems[];
+
+extern const char kV8MaxOldSpaceSize[];
+extern const char kV8MaxSemiSpaceSize[];
+extern const char kV8InitialOldSpaceSize[];
+extern const char kRendererV8MaxOldSpaceSize[];
+extern const char kRendererV8MaxSemiSpaceSize[];
+extern const char kRendererV8InitialOldSpaceSize[];
 
 extern const char kBackgroundColor[];
 extern const char kPreloadScript[];
@@ -107,6 +119,7 @@ extern const char kScrollBounce[];
 extern const char kHiddenPage[];
 extern const char kNativeWindowOpen[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kRecycleWorkerEnvironments[];
 extern const char kWebviewTag[];
 
 extern const char kWidevineCdmPath[];
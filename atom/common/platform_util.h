@@ -24,14 +24,27 @@ namespace platform_util {
 
 typedef base::Callback<void(const std::string&)> OpenExternalCallback;
 
+// Reports whether an asynchronous shell operation succeeded.
+typedef base::Callback<void(bool)> ShellOperationCallback;
+
 // Show the given file in a file manager. If possible, select the file.
 // Must be called from the UI thread.
 bool ShowItemInFolder(const base::FilePath& full_path);
 
+// The asynchronous version of ShowItemInFolder. The blocking work runs
+// off the calling thread where the platform allows it; |callback| must
+// not be null and is invoked on the calling thread with the result.
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const ShellOperationCallback& callback);
+
 // Open the given file in the desktop's default manner.
 // Must be called from the UI thread.
 bool OpenItem(const base::FilePath& full_path);
 
+// The asynchronous version of OpenItem.
+void OpenItem(const base::FilePath& full_path,
+              const ShellOperationCallback& callback);
+
 // Open the given external protocol URL in the desktop's default manner.
 // (For example, mailto: URLs in the default mail user agent.)
 bool OpenExternal(
@@ -55,6 +68,11 @@ void OpenExternal(
 // Move a file to trash.
 bool MoveItemToTrash(const base::FilePath& full_path);
 
+// The asynchronous version of MoveItemToTrash. Trashing a large
+// directory can block for seconds, so prefer this from UI code.
+void MoveItemToTrash(const base::FilePath& full_path,
+                     const ShellOperationCallback& callback);
+
 void Beep();
 
 #if defined(OS_MACOSX)
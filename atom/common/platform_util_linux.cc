@@ -6,12 +6,14 @@
 
 #include <stdio.h>
 
+#include "base/bind.h"
 #include "base/cancelable_callback.h"
 #include "base/environment.h"
 #include "base/files/file_util.h"
 #include "base/nix/xdg_util.h"
 #include "base/process/kill.h"
 #include "base/process/launch.h"
+#include "base/task_scheduler/post_task.h"
 #include "url/gurl.h"
 
 #define ELECTRON_TRASH "ELECTRON_TRASH"
@@ -62,6 +64,18 @@ bool XDGEmail(const std::string& email, const bool wait_for_exit) {
   return XDGUtil("xdg-email", email, wait_for_exit);
 }
 
+// Runs one of the blocking operations below on a worker so launching
+// (and possibly waiting on) the helper process cannot stall the calling
+// thread, and reports the result back to the calling sequence.
+void PostBlockingOperation(
+    bool (*operation)(const base::FilePath&),
+    const base::FilePath& full_path,
+    const platform_util::ShellOperationCallback& callback) {
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+      base::Bind(operation, full_path), callback);
+}
+
 }  // namespace
 
 namespace platform_util {
@@ -77,10 +91,22 @@ bool ShowItemInFolder(const base::FilePath& full_path) {
   return XDGOpen(dir.value(), false);
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const ShellOperationCallback& callback) {
+  bool (*operation)(const base::FilePath&) = &ShowItemInFolder;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 bool OpenItem(const base::FilePath& full_path) {
   return XDGOpen(full_path.value(), false);
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const ShellOperationCallback& callback) {
+  bool (*operation)(const base::FilePath&) = &OpenItem;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 bool OpenExternal(const GURL& url, bool activate) {
   // Don't wait for exit, since we don't want to wait for the browser/email
   // client window to close before returning
@@ -137,6 +163,14 @@ bool MoveItemToTrash(const base::FilePath& full_path) {
   return XDGUtilV(argv, true);
 }
 
+void MoveItemToTrash(const base::FilePath& full_path,
+                     const ShellOperationCallback& callback) {
+  // MoveItemToTrash waits for the trash helper to exit, which can take
+  // seconds on a large directory, so it must not run on the UI thread.
+  bool (*operation)(const base::FilePath&) = &MoveItemToTrash;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 void Beep() {
   // echo '\a' > /dev/console
   FILE* console = fopen("/dev/console", "r");
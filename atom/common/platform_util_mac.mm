@@ -120,6 +120,14 @@ bool ShowItemInFolder(const base::FilePath& path) {
   return true;
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const ShellOperationCallback& callback) {
+  // NSWorkspace#selectFile must run on the main thread, but it only
+  // sends an Apple Event to Finder and does not block on the result, so
+  // running it inline keeps the asynchronous contract in spirit.
+  callback.Run(ShowItemInFolder(full_path));
+}
+
 bool OpenItem(const base::FilePath& full_path) {
   DCHECK([NSThread isMainThread]);
   NSString* path_string = base::SysUTF8ToNSString(full_path.value());
@@ -139,6 +147,13 @@ bool OpenItem(const base::FilePath& full_path) {
                                launchIdentifiers:NULL];
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const ShellOperationCallback& callback) {
+  // NSWorkspaceLaunchAsync already makes the launch itself asynchronous
+  // and NSWorkspace wants the main thread, so run inline.
+  callback.Run(OpenItem(full_path));
+}
+
 bool OpenExternal(const GURL& url, bool activate) {
   DCHECK([NSThread isMainThread]);
   NSURL* ns_url = net::NSURLWithGURL(url);
@@ -178,6 +193,22 @@ bool MoveItemToTrash(const base::FilePath& full_path) {
   return status;
 }
 
+void MoveItemToTrash(const base::FilePath& full_path,
+                     const ShellOperationCallback& callback) {
+  // NSFileManager is thread safe and trashing a large directory can
+  // block for seconds, so do the work on a global queue the same way
+  // the asynchronous OpenExternal does.
+  __block ShellOperationCallback c = callback;
+  base::FilePath path = full_path;
+  dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0),
+                 ^{
+                   __block bool success = MoveItemToTrash(path);
+                   dispatch_async(dispatch_get_main_queue(), ^{
+                     c.Run(success);
+                   });
+                 });
+}
+
 void Beep() {
   NSBeep();
 }
@@ -22,6 +22,7 @@
 #include "base/logging.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_scheduler/post_task.h"
 #include "base/win/registry.h"
 #include "base/win/scoped_co_mem.h"
 #include "base/win/scoped_com_initializer.h"
@@ -226,6 +227,18 @@ HRESULT DeleteFileProgressSink::ResumeTimer() {
   return S_OK;
 }
 
+// Runs one of the blocking operations below on a worker and reports the
+// result back to the calling sequence. They are safe off the UI thread
+// because each one initializes COM for the thread it runs on.
+void PostBlockingOperation(
+    bool (*operation)(const base::FilePath&),
+    const base::FilePath& full_path,
+    const platform_util::ShellOperationCallback& callback) {
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
+      base::Bind(operation, full_path), callback);
+}
+
 }  // namespace
 
 namespace platform_util {
@@ -314,6 +327,12 @@ bool ShowItemInFolder(const base::FilePath& full_path) {
   }
 }
 
+void ShowItemInFolder(const base::FilePath& full_path,
+                      const ShellOperationCallback& callback) {
+  bool (*operation)(const base::FilePath&) = &ShowItemInFolder;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 bool OpenItem(const base::FilePath& full_path) {
   if (base::DirectoryExists(full_path))
     return ui::win::OpenFolderViaShell(full_path);
@@ -321,6 +340,12 @@ bool OpenItem(const base::FilePath& full_path) {
     return ui::win::OpenFileViaShell(full_path);
 }
 
+void OpenItem(const base::FilePath& full_path,
+              const ShellOperationCallback& callback) {
+  bool (*operation)(const base::FilePath&) = &OpenItem;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 bool OpenExternal(const base::string16& url, bool activate) {
   // Quote the input scheme to be sure that the command does not have
   // parameters unexpected by the external program. This url should already
@@ -391,6 +416,14 @@ bool MoveItemToTrash(const base::FilePath& path) {
          SUCCEEDED(pfo->PerformOperations());
 }
 
+void MoveItemToTrash(const base::FilePath& full_path,
+                     const ShellOperationCallback& callback) {
+  // IFileOperation blocks until the move finishes, which can take
+  // seconds on a large directory, so it must not run on the UI thread.
+  bool (*operation)(const base::FilePath&) = &MoveItemToTrash;
+  PostBlockingOperation(operation, full_path, callback);
+}
+
 void Beep() {
   MessageBeep(MB_OK);
 }
@@ -0,0 +1,99 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/common/shared_memory_ring_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace atom {
+
+// static
+bool SharedMemoryRingBuffer::Initialize(void* memory, size_t total_size) {
+  if (total_size <= sizeof(Header) + sizeof(uint32_t))
+    return false;
+
+  Header* header = new (memory) Header;
+  header->capacity = static_cast<uint32_t>(total_size - sizeof(Header));
+  header->dropped = 0;
+  header->write_pos.store(0, std::memory_order_relaxed);
+  header->read_pos.store(0, std::memory_order_relaxed);
+  return true;
+}
+
+SharedMemoryRingBuffer::Writer::Writer(void* memory, size_t total_size)
+    : header_(static_cast<Header*>(memory)),
+      data_(static_cast<char*>(memory) + sizeof(Header)) {}
+
+bool SharedMemoryRingBuffer::Writer::Push(const char* data, uint32_t size) {
+  uint32_t needed = sizeof(uint32_t) + size;
+  uint32_t read = header_->read_pos.load(std::memory_order_acquire);
+  uint32_t write = header_->write_pos.load(std::memory_order_relaxed);
+  if (needed > header_->capacity ||
+      needed > header_->capacity - (write - read)) {
+    header_->dropped++;
+    return false;
+  }
+
+  WriteBytes(write, &size, sizeof(uint32_t));
+  WriteBytes(write + sizeof(uint32_t), data, size);
+  // The release store publishes the record bytes to the consumer.
+  header_->write_pos.store(write + needed, std::memory_order_release);
+  return true;
+}
+
+void SharedMemoryRingBuffer::Writer::WriteBytes(uint32_t pos,
+                                                const void* data,
+                                                uint32_t size) {
+  uint32_t index = pos % header_->capacity;
+  uint32_t first = std::min(size, header_->capacity - index);
+  memcpy(data_ + index, data, first);
+  if (size > first)
+    memcpy(data_, static_cast<const char*>(data) + first, size - first);
+}
+
+SharedMemoryRingBuffer::Reader::Reader(void* memory, size_t total_size)
+    : header_(static_cast<Header*>(memory)),
+      data_(static_cast<char*>(memory) + sizeof(Header)) {}
+
+bool SharedMemoryRingBuffer::Reader::Pop(std::string* record) {
+  uint32_t write = header_->write_pos.load(std::memory_order_acquire);
+  uint32_t read = header_->read_pos.load(std::memory_order_relaxed);
+  if (write == read)
+    return false;
+
+  uint32_t size = 0;
+  ReadBytes(read, &size, sizeof(uint32_t));
+  if (sizeof(uint32_t) + size > write - read) {
+    // Corrupt length prefix from a misbehaving producer; resynchronize
+    // by discarding everything written so far.
+    header_->read_pos.store(write, std::memory_order_release);
+    return false;
+  }
+
+  record->resize(size);
+  if (size > 0)
+    ReadBytes(read + sizeof(uint32_t), &(*record)[0], size);
+  // The release store returns the space to the producer.
+  header_->read_pos.store(read + sizeof(uint32_t) + size,
+                          std::memory_order_release);
+  return true;
+}
+
+uint32_t SharedMemoryRingBuffer::Reader::dropped() const {
+  return header_->dropped;
+}
+
+void SharedMemoryRingBuffer::Reader::ReadBytes(uint32_t pos,
+                                               void* data,
+                                               uint32_t size) {
+  uint32_t index = pos % header_->capacity;
+  uint32_t first = std::min(size, header_->capacity - index);
+  memcpy(data, data_ + index, first);
+  if (size > first)
+    memcpy(static_cast<char*>(data) + first, data_, size - first);
+}
+
+}  // namespace atom
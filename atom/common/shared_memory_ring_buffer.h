@@ -0,0 +1,88 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_COMMON_SHARED_MEMORY_RING_BUFFER_H_
+#define ATOM_COMMON_SHARED_MEMORY_RING_BUFFER_H_
+
+#include <atomic>
+#include <string>
+
+#include "base/macros.h"
+
+namespace atom {
+
+// Lock-free single-producer/single-consumer ring buffer laid out in a
+// shared memory region, used to push high-rate loss-tolerant telemetry
+// records from a renderer to the browser without per-sample IPC. The
+// producer and consumer live in different processes and each only
+// advances its own position counter, so no locking is needed; when the
+// buffer is full the producer drops the record instead of blocking.
+//
+// Region layout: a Header followed by the data area. Records are a
+// uint32_t length prefix plus the payload, wrapping around the data
+// area as needed.
+class SharedMemoryRingBuffer {
+  struct Header {
+    uint32_t capacity;
+    // Records dropped by the producer because the buffer was full.
+    uint32_t dropped;
+    // Free-running byte counters; the difference is the used space and
+    // the counter modulo |capacity| is the index into the data area.
+    std::atomic<uint32_t> write_pos;
+    std::atomic<uint32_t> read_pos;
+  };
+
+ public:
+  // Prepares the header of a freshly created region. Must be called by
+  // the creating process before either end attaches, and |total_size|
+  // must leave room for the header and at least one record.
+  static bool Initialize(void* memory, size_t total_size);
+
+  // The producer end; exactly one per region, in the renderer.
+  class Writer {
+   public:
+    Writer(void* memory, size_t total_size);
+
+    // Appends one record, or drops it and returns false when there is
+    // not enough free space.
+    bool Push(const char* data, uint32_t size);
+
+   private:
+    void WriteBytes(uint32_t pos, const void* data, uint32_t size);
+
+    Header* header_;
+    char* data_;
+
+    DISALLOW_COPY_AND_ASSIGN(Writer);
+  };
+
+  // The consumer end; exactly one per region, in the browser.
+  class Reader {
+   public:
+    Reader(void* memory, size_t total_size);
+
+    // Removes the oldest record into |record|; returns false when the
+    // buffer is empty.
+    bool Pop(std::string* record);
+
+    // Number of records the producer has dropped so far. Written
+    // without synchronization by the producer, so only approximate.
+    uint32_t dropped() const;
+
+   private:
+    void ReadBytes(uint32_t pos, void* data, uint32_t size);
+
+    Header* header_;
+    char* data_;
+
+    DISALLOW_COPY_AND_ASSIGN(Reader);
+  };
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(SharedMemoryRingBuffer);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_COMMON_SHARED_MEMORY_RING_BUFFER_H_
@@ -3,11 +3,23 @@
 // found in the LICENSE file.
 
 #include "atom/renderer/api/atom_api_renderer_ipc.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
 #include "atom/common/api/api_messages.h"
+#include "atom/common/api/v8_value_serializer.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_bindings.h"
 #include "atom/common/node_includes.h"
+#include "atom/common/shared_memory_ring_buffer.h"
+#include "atom/renderer/ipc_stream_sender.h"
+#include "base/lazy_instance.h"
+#include "base/memory/shared_memory.h"
 #include "content/public/renderer/render_frame.h"
 #include "native_mate/dictionary.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
@@ -27,20 +39,175 @@ RenderFrame* GetCurrentRenderFrame() {
   return RenderFrame::FromWebFrame(frame);
 }
 
+namespace {
+
+// Extracts the raw bytes of an ArrayBuffer or TypedArray argument.
+bool GetBufferData(v8::Local<v8::Value> buffer,
+                   const char** data,
+                   size_t* size) {
+  if (buffer->IsArrayBufferView()) {
+    v8::Local<v8::ArrayBufferView> view = buffer.As<v8::ArrayBufferView>();
+    *data = static_cast<const char*>(view->Buffer()->GetContents().Data()) +
+            view->ByteOffset();
+    *size = view->ByteLength();
+    return true;
+  }
+  if (buffer->IsArrayBuffer()) {
+    v8::ArrayBuffer::Contents contents =
+        buffer.As<v8::ArrayBuffer>()->GetContents();
+    *data = static_cast<const char*>(contents.Data());
+    *size = contents.ByteLength();
+    return true;
+  }
+  return false;
+}
+
+// Writer ends of the telemetry ring buffers created by the browser for
+// this process, keyed by the id handed back to JS.
+struct TelemetryBuffer {
+  std::unique_ptr<base::SharedMemory> memory;
+  std::unique_ptr<SharedMemoryRingBuffer::Writer> writer;
+};
+base::LazyInstance<std::map<int, TelemetryBuffer>>::Leaky
+    g_telemetry_buffers = LAZY_INSTANCE_INITIALIZER;
+int g_next_telemetry_id = 0;
+
+}  // namespace
+
 void Send(mate::Arguments* args,
           const base::string16& channel,
-          const base::ListValue& arguments) {
+          v8::Local<v8::Value> arguments) {
   RenderFrame* render_frame = GetCurrentRenderFrame();
   if (render_frame == nullptr)
     return;
 
-  bool success = render_frame->Send(new AtomFrameHostMsg_Message(
-      render_frame->GetRoutingID(), channel, arguments));
+  // Encode the arguments once with the structured clone serializer so
+  // neither side walks the payload through base::Value.
+  bool success;
+  std::string serialized;
+  if (atom::SerializeV8Value(args->isolate(), arguments, &serialized)) {
+    success = render_frame->Send(new AtomFrameHostMsg_Message_Serialized(
+        render_frame->GetRoutingID(), channel, serialized));
+  } else {
+    // Values the clone algorithm rejects (e.g. functions) keep the old
+    // lossy base::Value conversion.
+    base::ListValue list;
+    if (!mate::ConvertFromV8(args->isolate(), arguments, &list)) {
+      args->ThrowError("Unable to convert arguments");
+      return;
+    }
+    success = render_frame->Send(new AtomFrameHostMsg_Message(
+        render_frame->GetRoutingID(), channel, list));
+  }
 
   if (!success)
     args->ThrowError("Unable to send AtomFrameHostMsg_Message");
 }
 
+// Ships an ArrayBuffer/TypedArray payload to the browser in a shared
+// memory region. The bytes are copied exactly once here; the browser
+// maps the region and wraps it in an ArrayBuffer without copying.
+void SendSharedBuffer(mate::Arguments* args,
+                      const base::string16& channel,
+                      v8::Local<v8::Value> buffer) {
+  RenderFrame* render_frame = GetCurrentRenderFrame();
+  if (render_frame == nullptr)
+    return;
+
+  const char* data = nullptr;
+  size_t size = 0;
+  if (!GetBufferData(buffer, &data, &size)) {
+    args->ThrowError("Expected an ArrayBuffer or a TypedArray");
+    return;
+  }
+
+  base::SharedMemory shared_memory;
+  if (!shared_memory.CreateAndMapAnonymous(std::max(size, size_t{1}))) {
+    args->ThrowError("Unable to allocate shared memory for the buffer");
+    return;
+  }
+  if (size > 0)
+    memcpy(shared_memory.memory(), data, size);
+
+  bool success = render_frame->Send(new AtomFrameHostMsg_SharedBufferMessage(
+      render_frame->GetRoutingID(), channel,
+      shared_memory.handle().Duplicate(), static_cast<uint32_t>(size)));
+
+  if (!success)
+    args->ThrowError("Unable to send AtomFrameHostMsg_SharedBufferMessage");
+}
+
+// Streams an ArrayBuffer/TypedArray payload to the browser in bounded
+// chunks with flow control (see IPCStreamSender), for payloads too
+// large for a single message or shared memory region.
+void SendStream(mate::Arguments* args,
+                const base::string16& channel,
+                v8::Local<v8::Value> buffer) {
+  RenderFrame* render_frame = GetCurrentRenderFrame();
+  if (render_frame == nullptr)
+    return;
+
+  const char* data = nullptr;
+  size_t size = 0;
+  if (!GetBufferData(buffer, &data, &size)) {
+    args->ThrowError("Expected an ArrayBuffer or a TypedArray");
+    return;
+  }
+
+  IPCStreamSender::Get()->Start(render_frame, channel, args->isolate(),
+                                buffer, data, size);
+}
+
+// Asks the browser to create a telemetry ring buffer (one sync message
+// at setup time), maps it writable and returns an id for WriteTelemetry,
+// or -1 on failure.
+int CreateTelemetryBuffer(mate::Arguments* args, uint32_t size) {
+  RenderFrame* render_frame = GetCurrentRenderFrame();
+  if (render_frame == nullptr)
+    return -1;
+
+  base::SharedMemoryHandle handle;
+  uint32_t actual_size = 0;
+  if (!render_frame->Send(new AtomFrameHostMsg_CreateTelemetryBuffer(
+          render_frame->GetRoutingID(), size, &handle, &actual_size)) ||
+      actual_size == 0) {
+    return -1;
+  }
+
+  auto shared_memory =
+      std::make_unique<base::SharedMemory>(handle, false /* read_only */);
+  if (!shared_memory->Map(actual_size))
+    return -1;
+
+  int id = ++g_next_telemetry_id;
+  TelemetryBuffer& buffer = g_telemetry_buffers.Get()[id];
+  buffer.writer = std::make_unique<SharedMemoryRingBuffer::Writer>(
+      shared_memory->memory(), actual_size);
+  buffer.memory = std::move(shared_memory);
+  return id;
+}
+
+// Pushes one record into a telemetry ring buffer; returns false when
+// the record was dropped because the buffer is full.
+bool WriteTelemetry(mate::Arguments* args,
+                    int id,
+                    v8::Local<v8::Value> record) {
+  auto iter = g_telemetry_buffers.Get().find(id);
+  if (iter == g_telemetry_buffers.Get().end()) {
+    args->ThrowError("Invalid telemetry buffer id");
+    return false;
+  }
+
+  const char* data = nullptr;
+  size_t size = 0;
+  if (!GetBufferData(record, &data, &size)) {
+    args->ThrowError("Expected an ArrayBuffer or a TypedArray");
+    return false;
+  }
+
+  return iter->second.writer->Push(data, static_cast<uint32_t>(size));
+}
+
 base::ListValue SendSync(mate::Arguments* args,
                          const base::string16& channel,
                          const base::ListValue& arguments) {
@@ -66,7 +233,11 @@ void Initialize(v8::Local<v8::Object> exports,
                 void* priv) {
   mate::Dictionary dict(context->GetIsolate(), exports);
   dict.SetMethod("send", &Send);
+  dict.SetMethod("sendSharedBuffer", &SendSharedBuffer);
+  dict.SetMethod("sendStream", &SendStream);
   dict.SetMethod("sendSync", &SendSync);
+  dict.SetMethod("createTelemetryBuffer", &CreateTelemetryBuffer);
+  dict.SetMethod("writeTelemetry", &WriteTelemetry);
 }
 
 }  // namespace api
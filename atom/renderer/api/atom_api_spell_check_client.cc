@@ -9,6 +9,7 @@
 
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "base/logging.h"
+#include "base/stl_util.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "chrome/renderer/spellchecker/spellcheck_worditerator.h"
 #include "native_mate/converter.h"
@@ -23,6 +24,11 @@ namespace api {
 
 namespace {
 
+// Maximum number of known-correct words kept in the native cache. The cache
+// is simply cleared when it fills up; typing workloads repopulate it with the
+// hot words almost immediately.
+const size_t kMaxWordCacheSize = 4096;
+
 bool HasWordCharacters(const base::string16& text, int index) {
   const base::char16* data = text.data();
   int length = text.length();
@@ -70,9 +76,11 @@ SpellCheckClient::SpellCheckClient(const std::string& language,
 
   character_attributes_.SetDefaultLanguage(language);
 
-  // Persistent the method.
+  // Persistent the methods. spellCheckWords is optional; when present whole
+  // batches of words are checked with a single call into JavaScript.
   mate::Dictionary dict(isolate, provider);
   dict.Get("spellCheck", &spell_check_);
+  dict.Get("spellCheckWords", &spell_check_words_);
 }
 
 SpellCheckClient::~SpellCheckClient() {
@@ -128,7 +136,7 @@ void SpellCheckClient::SpellCheckText(
     const base::string16& text,
     bool stop_at_first_result,
     std::vector<blink::WebTextCheckingResult>* results) {
-  if (text.empty() || spell_check_.IsEmpty())
+  if (text.empty() || (spell_check_.IsEmpty() && spell_check_words_.IsEmpty()))
     return;
 
   if (!text_iterator_.IsInitialized() &&
@@ -148,6 +156,11 @@ void SpellCheckClient::SpellCheckText(
   text_iterator_.SetText(text.c_str(), text.size());
 
   SpellCheckScope scope(*this);
+
+  // Gather the words to check first; words already known to be correct are
+  // filtered out here so the common all-correct case never reaches
+  // JavaScript.
+  std::vector<Word> words;
   base::string16 word;
   int word_start;
   int word_length;
@@ -158,19 +171,34 @@ void SpellCheckClient::SpellCheckText(
     if (status == SpellcheckWordIterator::IS_SKIPPABLE)
       continue;
 
+    if (ContainsKey(correct_word_cache_, word))
+      continue;
+
+    words.push_back({word, word_start, word_length});
+  }
+
+  if (words.empty())
+    return;
+
+  if (!scope.spell_check_words_.IsEmpty()) {
+    SpellCheckWordsBatch(scope, words, stop_at_first_result, results);
+    return;
+  }
+
+  for (const auto& entry : words) {
     // Found a word (or a contraction) that the spellchecker can check the
     // spelling of.
-    if (SpellCheckWord(scope, word))
+    if (SpellCheckWord(scope, entry.text))
       continue;
 
     // If the given word is a concatenated word of two or more valid words
     // (e.g. "hello:hello"), we should treat it as a valid word.
-    if (IsValidContraction(scope, word))
+    if (IsValidContraction(scope, entry.text))
       continue;
 
     blink::WebTextCheckingResult result;
-    result.location = word_start;
-    result.length = word_length;
+    result.location = entry.start;
+    result.length = entry.length;
     results->push_back(result);
 
     if (stop_at_first_result)
@@ -178,19 +206,72 @@ void SpellCheckClient::SpellCheckText(
   }
 }
 
-bool SpellCheckClient::SpellCheckWord(
-    const SpellCheckScope& scope,
-    const base::string16& word_to_check) const {
+bool SpellCheckClient::SpellCheckWord(const SpellCheckScope& scope,
+                                      const base::string16& word_to_check) {
   DCHECK(!scope.spell_check_.IsEmpty());
 
+  if (ContainsKey(correct_word_cache_, word_to_check))
+    return true;
+
   v8::Local<v8::Value> word = mate::ConvertToV8(isolate_, word_to_check);
   v8::Local<v8::Value> result =
       scope.spell_check_->Call(scope.provider_, 1, &word);
 
-  if (!result.IsEmpty() && result->IsBoolean())
-    return result->BooleanValue();
-  else
-    return true;
+  if (!result.IsEmpty() && result->IsBoolean() && !result->BooleanValue())
+    return false;
+
+  if (correct_word_cache_.size() >= kMaxWordCacheSize)
+    correct_word_cache_.clear();
+  correct_word_cache_.insert(word_to_check);
+  return true;
+}
+
+void SpellCheckClient::SpellCheckWordsBatch(
+    const SpellCheckScope& scope,
+    const std::vector<Word>& words,
+    bool stop_at_first_result,
+    std::vector<blink::WebTextCheckingResult>* results) {
+  DCHECK(!scope.spell_check_words_.IsEmpty());
+
+  std::vector<base::string16> word_list;
+  word_list.reserve(words.size());
+  for (const auto& entry : words)
+    word_list.push_back(entry.text);
+
+  v8::Local<v8::Value> argv = mate::ConvertToV8(isolate_, word_list);
+  v8::Local<v8::Value> result =
+      scope.spell_check_words_->Call(scope.provider_, 1, &argv);
+
+  // The provider returns the subset of words that are misspelled; treat an
+  // unexpected return value as everything being spelled correctly.
+  std::vector<base::string16> misspelled_list;
+  if (result.IsEmpty() ||
+      !mate::ConvertFromV8(isolate_, result, &misspelled_list))
+    misspelled_list.clear();
+  std::set<base::string16> misspelled(misspelled_list.begin(),
+                                      misspelled_list.end());
+
+  for (const auto& entry : words) {
+    if (!ContainsKey(misspelled, entry.text)) {
+      if (correct_word_cache_.size() >= kMaxWordCacheSize)
+        correct_word_cache_.clear();
+      correct_word_cache_.insert(entry.text);
+      continue;
+    }
+
+    // If the given word is a concatenated word of two or more valid words
+    // (e.g. "hello:hello"), we should treat it as a valid word.
+    if (!scope.spell_check_.IsEmpty() && IsValidContraction(scope, entry.text))
+      continue;
+
+    blink::WebTextCheckingResult result;
+    result.location = entry.start;
+    result.length = entry.length;
+    results->push_back(result);
+
+    if (stop_at_first_result)
+      return;
+  }
 }
 
 // Returns whether or not the given string is a valid contraction.
@@ -235,7 +316,8 @@ SpellCheckClient::SpellCheckScope::SpellCheckScope(
       context_scope_(
           v8::Local<v8::Context>::New(client.isolate_, client.context_)),
       provider_(client.provider_.NewHandle()),
-      spell_check_(client.spell_check_.NewHandle()) {}
+      spell_check_(client.spell_check_.NewHandle()),
+      spell_check_words_(client.spell_check_words_.NewHandle()) {}
 
 SpellCheckClient::SpellCheckScope::~SpellCheckScope() = default;
 
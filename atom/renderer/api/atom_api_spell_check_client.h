@@ -5,6 +5,7 @@
 #ifndef ATOM_RENDERER_API_ATOM_API_SPELL_CHECK_CLIENT_H_
 #define ATOM_RENDERER_API_ATOM_API_SPELL_CHECK_CLIENT_H_
 
+#include <set>
 #include <string>
 #include <vector>
 
@@ -58,11 +59,19 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
     v8::Context::Scope context_scope_;
     v8::Local<v8::Object> provider_;
     v8::Local<v8::Function> spell_check_;
+    v8::Local<v8::Function> spell_check_words_;
 
     explicit SpellCheckScope(const SpellCheckClient& client);
     ~SpellCheckScope();
   };
 
+  // A word to be checked together with its position in the original text.
+  struct Word {
+    base::string16 text;
+    int start;
+    int length;
+  };
+
   // Check the spelling of text.
   void SpellCheckText(const base::string16& text,
                       bool stop_at_first_result,
@@ -70,7 +79,14 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
 
   // Call JavaScript to check spelling a word.
   bool SpellCheckWord(const SpellCheckScope& scope,
-                      const base::string16& word_to_check) const;
+                      const base::string16& word_to_check);
+
+  // Check a whole batch of words with a single call into JavaScript, via the
+  // provider's optional spellCheckWords method.
+  void SpellCheckWordsBatch(const SpellCheckScope& scope,
+                            const std::vector<Word>& words,
+                            bool stop_at_first_result,
+                            std::vector<blink::WebTextCheckingResult>* results);
 
   // Returns whether or not the given word is a contraction of valid words
   // (e.g. "word:word").
@@ -97,10 +113,17 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
 
+  // Words the provider has confirmed as correctly spelled. Rechecking the
+  // same paragraph while the user types is the common case, so hitting this
+  // cache avoids crossing into JavaScript at all. The cache lives as long as
+  // this client; setting a new provider starts from an empty cache.
+  std::set<base::string16> correct_word_cache_;
+
   v8::Isolate* isolate_;
   v8::Persistent<v8::Context> context_;
   mate::ScopedPersistent<v8::Object> provider_;
   mate::ScopedPersistent<v8::Function> spell_check_;
+  mate::ScopedPersistent<v8::Function> spell_check_words_;
 
   DISALLOW_COPY_AND_ASSIGN(SpellCheckClient);
 };
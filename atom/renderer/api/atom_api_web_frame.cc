@@ -12,6 +12,8 @@
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/renderer/api/atom_api_spell_check_client.h"
 #include "base/memory/memory_pressure_listener.h"
+#include "base/strings/string_util.h"
+#include "base/strings/utf_string_conversions.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_visitor.h"
 #include "content/public/renderer/render_view.h"
@@ -277,6 +279,79 @@ void WebFrame::ExecuteJavaScript(const base::string16& code,
       has_user_gesture, callback.release());
 }
 
+void WebFrame::PrecompileScript(const std::string& name,
+                                const std::vector<std::string>& parameters,
+                                const base::string16& body,
+                                mate::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  // Wrap the body in a function expression so the compiled script can be
+  // invoked with arguments; the wrapper itself is what gets cached.
+  base::string16 wrapped = base::ASCIIToUTF16("(function (") +
+                           base::UTF8ToUTF16(base::JoinString(parameters,
+                                                              ", ")) +
+                           base::ASCIIToUTF16(") {\n") + body +
+                           base::ASCIIToUTF16("\n})");
+
+  v8::TryCatch try_catch(isolate);
+  v8::ScriptOrigin origin(mate::StringToV8(isolate, name));
+  v8::ScriptCompiler::Source source(
+      mate::ConvertToV8(isolate, wrapped).As<v8::String>(), origin);
+  v8::Local<v8::UnboundScript> script;
+  if (!v8::ScriptCompiler::CompileUnboundScript(
+           isolate, &source, v8::ScriptCompiler::kProduceCodeCache)
+           .ToLocal(&script)) {
+    try_catch.ReThrow();
+    return;
+  }
+  precompiled_scripts_[name].Reset(isolate, script);
+}
+
+v8::Local<v8::Value> WebFrame::ExecutePrecompiledScript(
+    const std::string& name,
+    mate::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  auto iter = precompiled_scripts_.find(name);
+  if (iter == precompiled_scripts_.end()) {
+    args->ThrowError("No script has been precompiled with name \"" + name +
+                     "\"");
+    return v8::Local<v8::Value>();
+  }
+
+  v8::Local<v8::Context> context = web_frame_->MainWorldScriptContext();
+  v8::Context::Scope context_scope(context);
+  v8::TryCatch try_catch(isolate);
+
+  // Binding a cached UnboundScript only instantiates the function wrapper;
+  // the expensive parse/compile happened once in PrecompileScript.
+  v8::Local<v8::Value> function;
+  if (!v8::Local<v8::UnboundScript>::New(isolate, iter->second)
+           ->BindToCurrentContext()
+           ->Run(context)
+           .ToLocal(&function)) {
+    try_catch.ReThrow();
+    return v8::Local<v8::Value>();
+  }
+
+  std::vector<v8::Local<v8::Value>> call_args;
+  v8::Local<v8::Value> arg;
+  while (args->GetNext(&arg))
+    call_args.push_back(arg);
+
+  v8::Local<v8::Value> result;
+  if (!function.As<v8::Function>()
+           ->Call(context, context->Global(), call_args.size(),
+                  call_args.empty() ? nullptr : call_args.data())
+           .ToLocal(&result)) {
+    try_catch.ReThrow();
+    return v8::Local<v8::Value>();
+  }
+  return result;
+}
+
+void WebFrame::ReleasePrecompiledScript(const std::string& name) {
+  precompiled_scripts_.erase(name);
+}
+
 void WebFrame::ExecuteJavaScriptInIsolatedWorld(
     int world_id,
     const std::vector<mate::Dictionary>& scripts,
@@ -349,6 +424,25 @@ blink::WebCache::ResourceTypeStats WebFrame::GetResourceUsage(
   return stats;
 }
 
+void WebFrame::SetCacheCapacity(double capacity, mate::Arguments* args) {
+  if (capacity < 0) {
+    args->ThrowError("Cache capacity must not be negative");
+    return;
+  }
+  // The budget applies to this renderer's whole in-memory resource cache;
+  // shrinking it evicts down to the new capacity immediately.
+  blink::WebCache::SetCapacity(static_cast<size_t>(capacity));
+}
+
+v8::Local<v8::Value> WebFrame::GetCacheUsage(v8::Isolate* isolate) {
+  blink::WebCache::UsageStats stats;
+  blink::WebCache::GetUsageStats(&stats);
+  mate::Dictionary dict = mate::Dictionary::CreateEmpty(isolate);
+  dict.Set("capacity", static_cast<double>(stats.capacity));
+  dict.Set("size", static_cast<double>(stats.size));
+  return dict.GetHandle();
+}
+
 void WebFrame::ClearCache(v8::Isolate* isolate) {
   isolate->IdleNotificationDeadline(0.5);
   blink::WebCache::Clear();
@@ -478,6 +572,11 @@ void WebFrame::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("executeJavaScript", &WebFrame::ExecuteJavaScript)
       .SetMethod("executeJavaScriptInIsolatedWorld",
                  &WebFrame::ExecuteJavaScriptInIsolatedWorld)
+      .SetMethod("precompileScript", &WebFrame::PrecompileScript)
+      .SetMethod("executePrecompiledScript",
+                 &WebFrame::ExecutePrecompiledScript)
+      .SetMethod("releasePrecompiledScript",
+                 &WebFrame::ReleasePrecompiledScript)
       .SetMethod("setIsolatedWorldSecurityOrigin",
                  &WebFrame::SetIsolatedWorldSecurityOrigin)
       .SetMethod("setIsolatedWorldContentSecurityPolicy",
@@ -485,6 +584,8 @@ void WebFrame::BuildPrototype(v8::Isolate* isolate,
       .SetMethod("setIsolatedWorldHumanReadableName",
                  &WebFrame::SetIsolatedWorldHumanReadableName)
       .SetMethod("getResourceUsage", &WebFrame::GetResourceUsage)
+      .SetMethod("setCacheCapacity", &WebFrame::SetCacheCapacity)
+      .SetMethod("getCacheUsage", &WebFrame::GetCacheUsage)
       .SetMethod("clearCache", &WebFrame::ClearCache)
       .SetMethod("getFrameForSelector", &WebFrame::GetFrameForSelector)
       .SetMethod("findFrameByName", &WebFrame::FindFrameByName)
@@ -5,6 +5,7 @@
 #ifndef ATOM_RENDERER_API_ATOM_API_WEB_FRAME_H_
 #define ATOM_RENDERER_API_ATOM_API_WEB_FRAME_H_
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -81,6 +82,17 @@ class WebFrame : public mate::Wrappable<WebFrame> {
       const std::vector<mate::Dictionary>& scripts,
       mate::Arguments* args);
 
+  // Compiled-script cache. PrecompileScript compiles |body| once as a
+  // function taking |parameters| and retains the v8::UnboundScript, so
+  // ExecutePrecompiledScript can run it repeatedly without reparsing.
+  void PrecompileScript(const std::string& name,
+                        const std::vector<std::string>& parameters,
+                        const base::string16& body,
+                        mate::Arguments* args);
+  v8::Local<v8::Value> ExecutePrecompiledScript(const std::string& name,
+                                                mate::Arguments* args);
+  void ReleasePrecompiledScript(const std::string& name);
+
   // Isolated world related methods
   void SetIsolatedWorldSecurityOrigin(int world_id,
                                       const std::string& origin_url);
@@ -91,6 +103,8 @@ class WebFrame : public mate::Wrappable<WebFrame> {
 
   // Resource related methods
   blink::WebCache::ResourceTypeStats GetResourceUsage(v8::Isolate* isolate);
+  void SetCacheCapacity(double capacity, mate::Arguments* args);
+  v8::Local<v8::Value> GetCacheUsage(v8::Isolate* isolate);
   void ClearCache(v8::Isolate* isolate);
 
   // Frame navigation
@@ -106,6 +120,10 @@ class WebFrame : public mate::Wrappable<WebFrame> {
 
   std::unique_ptr<SpellCheckClient> spell_check_client_;
 
+  // Named scripts compiled by PrecompileScript. UnboundScripts are not tied
+  // to a context, so entries stay valid across navigations.
+  std::map<std::string, v8::Global<v8::UnboundScript>> precompiled_scripts_;
+
   blink::WebLocalFrame* web_frame_;
 
   DISALLOW_COPY_AND_ASSIGN(WebFrame);
@@ -50,7 +50,9 @@ void TrimStringVectorForIPC(std::vector<base::string16>* strings) {
 }  // namespace
 
 AutofillAgent::AutofillAgent(content::RenderFrame* frame)
-    : content::RenderFrameObserver(frame), weak_ptr_factory_(this) {
+    : content::RenderFrameObserver(frame),
+      weak_ptr_factory_(this),
+      popup_weak_ptr_factory_(this) {
   render_frame()->GetWebFrame()->SetAutofillClient(this);
 }
 
@@ -181,16 +183,53 @@ bool AutofillAgent::IsUserGesture() const {
 }
 
 void AutofillAgent::HidePopup() {
-  Send(new AtomAutofillFrameHostMsg_HidePopup(render_frame()->GetRoutingID()));
+  pending_popup_hide_ = true;
+  pending_popup_element_.Reset();
+  pending_popup_values_.clear();
+  pending_popup_labels_.clear();
+  SchedulePopupFlush();
 }
 
 void AutofillAgent::ShowPopup(const blink::WebFormControlElement& element,
                               const std::vector<base::string16>& values,
                               const std::vector<base::string16>& labels) {
-  gfx::RectF bounds =
-      render_frame()->GetRenderView()->ElementBoundsInWindow(element);
-  Send(new AtomAutofillFrameHostMsg_ShowPopup(render_frame()->GetRoutingID(),
-                                              bounds, values, labels));
+  pending_popup_hide_ = false;
+  pending_popup_element_ = element;
+  pending_popup_values_ = values;
+  pending_popup_labels_ = labels;
+  SchedulePopupFlush();
+}
+
+void AutofillAgent::SchedulePopupFlush() {
+  if (popup_flush_pending_)
+    return;
+  popup_flush_pending_ = true;
+  base::ThreadTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&AutofillAgent::FlushPopupState,
+                                popup_weak_ptr_factory_.GetWeakPtr()));
+}
+
+void AutofillAgent::FlushPopupState() {
+  popup_flush_pending_ = false;
+
+  if (pending_popup_hide_) {
+    pending_popup_hide_ = false;
+    Send(
+        new AtomAutofillFrameHostMsg_HidePopup(render_frame()->GetRoutingID()));
+    return;
+  }
+
+  if (pending_popup_element_.IsNull())
+    return;
+
+  // The element bounds are computed here, at flush time, so a burst of
+  // mutations or scroll ticks produces one message with the final geometry.
+  gfx::RectF bounds = render_frame()->GetRenderView()->ElementBoundsInWindow(
+      pending_popup_element_);
+  Send(new AtomAutofillFrameHostMsg_ShowPopup(
+      render_frame()->GetRoutingID(), bounds, pending_popup_values_,
+      pending_popup_labels_));
+  pending_popup_element_.Reset();
 }
 
 void AutofillAgent::OnAcceptSuggestion(base::string16 suggestion) {
@@ -55,6 +55,12 @@ class AutofillAgent : public content::RenderFrameObserver,
   void ShowPopup(const blink::WebFormControlElement&,
                  const std::vector<base::string16>&,
                  const std::vector<base::string16>&);
+  // Sends the most recent popup state to the browser. Show/hide requests
+  // only record the desired state and schedule one flush per message-loop
+  // turn, so bursts of DOM mutations and scroll ticks collapse into a
+  // single IPC carrying the final geometry.
+  void SchedulePopupFlush();
+  void FlushPopupState();
   void ShowSuggestions(const blink::WebFormControlElement& element,
                        const ShowSuggestionsOptions& options);
   void OnAcceptSuggestion(base::string16 suggestion);
@@ -69,8 +75,20 @@ class AutofillAgent : public content::RenderFrameObserver,
   // already focused, or if it caused the focus to change.
   bool was_focused_before_now_ = false;
 
+  // The popup state waiting to be flushed to the browser. See
+  // FlushPopupState().
+  bool popup_flush_pending_ = false;
+  bool pending_popup_hide_ = false;
+  blink::WebFormControlElement pending_popup_element_;
+  std::vector<base::string16> pending_popup_values_;
+  std::vector<base::string16> pending_popup_labels_;
+
   base::WeakPtrFactory<AutofillAgent> weak_ptr_factory_;
 
+  // Separate factory for popup flush tasks, so debouncing text-change events
+  // (which invalidates |weak_ptr_factory_|) cannot cancel a pending flush.
+  base::WeakPtrFactory<AutofillAgent> popup_weak_ptr_factory_;
+
   DISALLOW_COPY_AND_ASSIGN(AutofillAgent);
 };
 
@@ -5,12 +5,15 @@
 #include "atom/renderer/atom_render_frame_observer.h"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atom/common/api/api_messages.h"
 #include "atom/common/api/event_emitter_caller.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_includes.h"
+#include "atom/renderer/injected_stylesheet_manager.h"
+#include "atom/renderer/ipc_stream_sender.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_frame.h"
@@ -83,6 +86,14 @@ void AtomRenderFrameObserver::DidClearWindowObject() {
 
 void AtomRenderFrameObserver::DidCreateDocumentElement() {
   document_created_ = true;
+
+  InjectedStylesheetManager* stylesheet_manager =
+      renderer_client_->injected_stylesheet_manager();
+  if (stylesheet_manager) {
+    blink::WebDocument document =
+        render_frame_->GetWebFrame()->GetDocument();
+    stylesheet_manager->ApplyToDocument(&document);
+  }
 }
 
 void AtomRenderFrameObserver::DidCreateScriptContext(
@@ -110,7 +121,24 @@ void AtomRenderFrameObserver::DraggableRegionsChanged() {
     region.draggable = webregion.draggable;
     regions.push_back(region);
   }
-  Send(new AtomFrameHostMsg_UpdateDraggableRegions(routing_id(), regions));
+
+  pending_regions_ = std::move(regions);
+  // While the timer runs further changes only update |pending_regions_|,
+  // so a burst of DOM mutations results in at most one update per frame.
+  if (draggable_regions_timer_.IsRunning())
+    return;
+  SendDraggableRegionsIfChanged();
+  draggable_regions_timer_.Start(
+      FROM_HERE, base::TimeDelta::FromMilliseconds(16), this,
+      &AtomRenderFrameObserver::SendDraggableRegionsIfChanged);
+}
+
+void AtomRenderFrameObserver::SendDraggableRegionsIfChanged() {
+  if (pending_regions_ == last_sent_regions_)
+    return;
+  last_sent_regions_ = pending_regions_;
+  Send(new AtomFrameHostMsg_UpdateDraggableRegions(routing_id(),
+                                                   last_sent_regions_));
 }
 
 void AtomRenderFrameObserver::WillReleaseScriptContext(
@@ -161,6 +189,8 @@ bool AtomRenderFrameObserver::OnMessageReceived(const IPC::Message& message) {
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(AtomRenderFrameObserver, message)
     IPC_MESSAGE_HANDLER(AtomFrameMsg_Message, OnBrowserMessage)
+    IPC_MESSAGE_HANDLER(AtomFrameMsg_MessageToFrame, OnBrowserMessageToFrame)
+    IPC_MESSAGE_HANDLER(AtomFrameMsg_StreamAck, OnStreamAck)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
 
@@ -194,6 +224,24 @@ void AtomRenderFrameObserver::OnBrowserMessage(bool send_to_all,
   }
 }
 
+void AtomRenderFrameObserver::OnBrowserMessageToFrame(
+    const base::string16& channel,
+    const base::ListValue& args) {
+  // See OnBrowserMessage for why messages are held until the document
+  // element exists.
+  if (!document_created_)
+    return;
+
+  // The message was routed to this frame on purpose, so unlike
+  // OnBrowserMessage there is no main-frame restriction and no fan-out.
+  EmitIPCEvent(render_frame_->GetWebFrame(), channel, args);
+}
+
+void AtomRenderFrameObserver::OnStreamAck(int32_t stream_id,
+                                           uint64_t bytes_received) {
+  IPCStreamSender::Get()->OnAck(stream_id, bytes_received);
+}
+
 void AtomRenderFrameObserver::EmitIPCEvent(blink::WebLocalFrame* frame,
                                            const base::string16& channel,
                                            const base::ListValue& args) {
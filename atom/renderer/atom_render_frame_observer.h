@@ -5,8 +5,12 @@
 #ifndef ATOM_RENDERER_ATOM_RENDER_FRAME_OBSERVER_H_
 #define ATOM_RENDERER_ATOM_RENDER_FRAME_OBSERVER_H_
 
+#include <vector>
+
+#include "atom/common/draggable_region.h"
 #include "atom/renderer/renderer_client_base.h"
 #include "base/strings/string16.h"
+#include "base/timer/timer.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
 
@@ -50,14 +54,25 @@ class AtomRenderFrameObserver : public content::RenderFrameObserver {
   void CreateIsolatedWorldContext();
   bool IsMainWorld(int world_id);
   bool IsIsolatedWorld(int world_id);
+  void OnBrowserMessageToFrame(const base::string16& channel,
+                               const base::ListValue& args);
   void OnBrowserMessage(bool send_to_all,
                         const base::string16& channel,
                         const base::ListValue& args);
+  void OnStreamAck(int32_t stream_id, uint64_t bytes_received);
+  void SendDraggableRegionsIfChanged();
 
   content::RenderFrame* render_frame_;
   RendererClientBase* renderer_client_;
   bool document_created_ = false;
 
+  // DOM mutations can report draggable regions many times per frame; the
+  // regions last sent to the browser and a trailing-edge timer let us drop
+  // unchanged sets and coalesce bursts to roughly once per frame.
+  std::vector<DraggableRegion> last_sent_regions_;
+  std::vector<DraggableRegion> pending_regions_;
+  base::OneShotTimer draggable_regions_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(AtomRenderFrameObserver);
 };
 
@@ -5,8 +5,10 @@
 #include "atom/renderer/atom_render_view_observer.h"
 
 #include "atom/common/api/api_messages.h"
+#include "base/memory/memory_pressure_listener.h"
 #include "content/public/renderer/render_view.h"
 #include "ipc/ipc_message_macros.h"
+#include "third_party/WebKit/public/web/WebKit.h"
 #include "third_party/WebKit/public/web/WebView.h"
 
 namespace atom {
@@ -20,6 +22,7 @@ bool AtomRenderViewObserver::OnMessageReceived(const IPC::Message& message) {
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(AtomRenderViewObserver, message)
     IPC_MESSAGE_HANDLER(AtomViewMsg_Offscreen, OnOffscreen)
+    IPC_MESSAGE_HANDLER(AtomViewMsg_MemoryPressure, OnMemoryPressure)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
 
@@ -34,4 +37,15 @@ void AtomRenderViewObserver::OnOffscreen() {
   blink::WebView::SetUseExternalPopupMenus(false);
 }
 
+void AtomRenderViewObserver::OnMemoryPressure(int32_t level) {
+  // Fans out to every in-process listener, which makes blink drop its
+  // caches and V8 schedule pressure GCs.
+  base::MemoryPressureListener::NotifyMemoryPressure(
+      static_cast<base::MemoryPressureListener::MemoryPressureLevel>(level));
+  // A critical signal additionally collects down to a minimal heap now
+  // instead of waiting for the next GC cycle.
+  if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL)
+    blink::MainThreadIsolate()->LowMemoryNotification();
+}
+
 }  // namespace atom
@@ -22,6 +22,7 @@ class AtomRenderViewObserver : public content::RenderViewObserver {
   void OnDestruct() override;
 
   void OnOffscreen();
+  void OnMemoryPressure(int32_t level);
 
   DISALLOW_COPY_AND_ASSIGN(AtomRenderViewObserver);
 };
@@ -6,6 +6,7 @@
 
 #include "atom/common/api/api_messages.h"
 #include "atom/common/api/atom_bindings.h"
+#include "atom/common/api/v8_code_cache.h"
 #include "atom/common/native_mate_converters/string16_converter.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/node_bindings.h"
@@ -81,11 +82,29 @@ base::CommandLine::StringVector GetArgv() {
   return base::CommandLine::ForCurrentProcess()->argv();
 }
 
+// Compiles a (pre-wrapped) preload script through the disk-backed code
+// cache, keyed by the script's path and mtime, and returns the function
+// the wrapper evaluates to. Returns null when compilation fails so the
+// caller can fall back to a plain eval.
+v8::Local<v8::Value> CompilePreloadScript(v8::Isolate* isolate,
+                                          const base::FilePath& path,
+                                          v8::Local<v8::String> source) {
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Script> script;
+  if (!code_cache::CompileUserScript(context, path, source).ToLocal(&script))
+    return v8::Null(isolate);
+  v8::Local<v8::Value> result;
+  if (!script->Run(context).ToLocal(&result))
+    return v8::Null(isolate);
+  return result;
+}
+
 void InitializeBindings(v8::Local<v8::Object> binding,
                         v8::Local<v8::Context> context) {
   auto* isolate = context->GetIsolate();
   mate::Dictionary b(isolate, binding);
   b.SetMethod("get", GetBinding);
+  b.SetMethod("compilePreloadScript", CompilePreloadScript);
   b.SetMethod("crash", AtomBindings::Crash);
   b.SetMethod("hang", AtomBindings::Hang);
   b.SetMethod("getArgv", GetArgv);
@@ -127,8 +146,8 @@ class AtomSandboxedRenderFrameObserver : public AtomRenderFrameObserver {
 }  // namespace
 
 AtomSandboxedRendererClient::AtomSandboxedRendererClient() {
-  // Explicitly register electron's builtin modules.
-  NodeBindings::RegisterBuiltinModules();
+  // Explicitly register the renderer-usable builtin modules.
+  NodeBindings::RegisterBuiltinModules(NodeBindings::RENDERER_MODULES);
 }
 
 AtomSandboxedRendererClient::~AtomSandboxedRendererClient() {}
@@ -164,10 +183,12 @@ void AtomSandboxedRendererClient::DidCreateScriptContext(
   std::string left = "(function(binding, preloadPath, require) {\n";
   std::string right = "\n})";
   // Compile the wrapper and run it to get the function object
-  auto script = v8::Script::Compile(v8::String::Concat(
+  auto source = v8::String::Concat(
       mate::ConvertToV8(isolate, left)->ToString(),
       v8::String::Concat(node::preload_bundle_value.ToStringChecked(isolate),
-                         mate::ConvertToV8(isolate, right)->ToString())));
+                         mate::ConvertToV8(isolate, right)->ToString()));
+  auto script = atom::code_cache::Compile(context, "preload_bundle", source)
+                    .ToLocalChecked();
   auto func =
       v8::Handle<v8::Function>::Cast(script->Run(context).ToLocalChecked());
   // Create and initialize the binding object
@@ -23,38 +23,40 @@ bool ContentSettingsObserver::AllowDatabase(
     const blink::WebString& name,
     const blink::WebString& display_name,
     unsigned estimated_size) {
-  blink::WebFrame* frame = render_frame()->GetWebFrame();
-  if (frame->GetSecurityOrigin().IsUnique() ||
-      frame->Top()->GetSecurityOrigin().IsUnique())
-    return false;
-  auto origin = blink::WebStringToGURL(frame->GetSecurityOrigin().ToString());
-  if (!origin.IsStandard())
-    return false;
-  return true;
+  return IsStorageAccessAllowed();
 }
 
 bool ContentSettingsObserver::AllowStorage(bool local) {
-  blink::WebFrame* frame = render_frame()->GetWebFrame();
-  if (frame->GetSecurityOrigin().IsUnique() ||
-      frame->Top()->GetSecurityOrigin().IsUnique())
-    return false;
-  auto origin = blink::WebStringToGURL(frame->GetSecurityOrigin().ToString());
-  if (!origin.IsStandard())
-    return false;
-  return true;
+  return IsStorageAccessAllowed();
 }
 
 bool ContentSettingsObserver::AllowIndexedDB(
     const blink::WebString& name,
     const blink::WebSecurityOrigin& security_origin) {
+  return IsStorageAccessAllowed();
+}
+
+bool ContentSettingsObserver::IsStorageAccessAllowed() {
+  if (storage_access_allowed_)
+    return *storage_access_allowed_;
+
+  bool allowed = true;
   blink::WebFrame* frame = render_frame()->GetWebFrame();
   if (frame->GetSecurityOrigin().IsUnique() ||
-      frame->Top()->GetSecurityOrigin().IsUnique())
-    return false;
-  auto origin = blink::WebStringToGURL(frame->GetSecurityOrigin().ToString());
-  if (!origin.IsStandard())
-    return false;
-  return true;
+      frame->Top()->GetSecurityOrigin().IsUnique()) {
+    allowed = false;
+  } else {
+    auto origin = blink::WebStringToGURL(frame->GetSecurityOrigin().ToString());
+    allowed = origin.IsStandard();
+  }
+
+  storage_access_allowed_ = allowed;
+  return allowed;
+}
+
+void ContentSettingsObserver::DidCreateDocumentElement() {
+  // A new document can have a different security origin, so start over.
+  storage_access_allowed_.reset();
 }
 
 void ContentSettingsObserver::OnDestruct() {
@@ -6,6 +6,7 @@
 #define ATOM_RENDERER_CONTENT_SETTINGS_OBSERVER_H_
 
 #include "base/compiler_specific.h"
+#include "base/optional.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "third_party/WebKit/public/platform/WebContentSettingsClient.h"
 
@@ -27,8 +28,18 @@ class ContentSettingsObserver : public content::RenderFrameObserver,
 
  private:
   // content::RenderFrameObserver implementation.
+  void DidCreateDocumentElement() override;
   void OnDestruct() override;
 
+  // Computes whether the frame's current origin may access storage, caching
+  // the decision so pages that hammer localStorage do not redo the origin
+  // checks on every call.
+  bool IsStorageAccessAllowed();
+
+  // The cached decision for the current document; reset whenever the frame
+  // gets a new document (and with it a possibly different origin).
+  base::Optional<bool> storage_access_allowed_;
+
   DISALLOW_COPY_AND_ASSIGN(ContentSettingsObserver);
 };
 
@@ -52,8 +52,27 @@ void GuestViewContainer::DidResizeElement(const gfx::Size& new_size) {
   if (element_resize_callback_.is_null())
     return;
 
+  pending_resize_size_ = new_size;
+  if (resize_pending_)
+    return;
+
+  resize_pending_ = true;
   base::ThreadTaskRunnerHandle::Get()->PostTask(
-      FROM_HERE, base::BindOnce(element_resize_callback_, new_size));
+      FROM_HERE, base::BindOnce(&GuestViewContainer::DeliverPendingResize,
+                                weak_ptr_factory_.GetWeakPtr()));
+}
+
+void GuestViewContainer::DeliverPendingResize() {
+  resize_pending_ = false;
+
+  // Intermediate sizes were superseded while the task was queued; only the
+  // latest one matters, and delivering a size the guest already has would
+  // trigger a pointless relayout.
+  if (pending_resize_size_ == last_delivered_size_)
+    return;
+
+  last_delivered_size_ = pending_resize_size_;
+  element_resize_callback_.Run(pending_resize_size_);
 }
 
 base::WeakPtr<content::BrowserPluginDelegate> GuestViewContainer::GetWeakPtr() {
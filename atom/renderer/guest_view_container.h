@@ -8,10 +8,7 @@
 #include "base/callback.h"
 #include "content/public/renderer/browser_plugin_delegate.h"
 #include "content/public/renderer/render_frame.h"
-
-namespace gfx {
-class Size;
-}
+#include "ui/gfx/geometry/size.h"
 
 namespace atom {
 
@@ -32,10 +29,21 @@ class GuestViewContainer : public content::BrowserPluginDelegate {
   base::WeakPtr<BrowserPluginDelegate> GetWeakPtr() final;
 
  private:
+  // Delivers the most recent element size to the resize callback. Resize
+  // events only record the desired size and schedule one delivery per
+  // message-loop turn, so dragging a split-pane resizes the guest once per
+  // turn instead of once per mouse move.
+  void DeliverPendingResize();
+
   int element_instance_id_;
 
   ResizeCallback element_resize_callback_;
 
+  // See DeliverPendingResize().
+  bool resize_pending_ = false;
+  gfx::Size pending_resize_size_;
+  gfx::Size last_delivered_size_;
+
   base::WeakPtrFactory<GuestViewContainer> weak_ptr_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(GuestViewContainer);
@@ -0,0 +1,46 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/renderer/injected_stylesheet_manager.h"
+
+#include "atom/common/api/api_messages.h"
+#include "content/public/renderer/render_thread.h"
+#include "third_party/WebKit/public/web/WebDocument.h"
+
+namespace atom {
+
+InjectedStylesheetManager::InjectedStylesheetManager() {
+  content::RenderThread::Get()->AddObserver(this);
+}
+
+InjectedStylesheetManager::~InjectedStylesheetManager() {}
+
+void InjectedStylesheetManager::ApplyToDocument(blink::WebDocument* document) {
+  for (const auto& sheet : stylesheets_)
+    document->InsertStyleSheet(sheet.second);
+}
+
+bool InjectedStylesheetManager::OnControlMessageReceived(
+    const IPC::Message& message) {
+  bool handled = true;
+  IPC_BEGIN_MESSAGE_MAP(InjectedStylesheetManager, message)
+    IPC_MESSAGE_HANDLER(AtomMsg_AddInjectedStylesheet, OnAddInjectedStylesheet)
+    IPC_MESSAGE_HANDLER(AtomMsg_RemoveInjectedStylesheet,
+                        OnRemoveInjectedStylesheet)
+    IPC_MESSAGE_UNHANDLED(handled = false)
+  IPC_END_MESSAGE_MAP()
+  return handled;
+}
+
+void InjectedStylesheetManager::OnAddInjectedStylesheet(
+    int key,
+    const std::string& css) {
+  stylesheets_[key] = blink::WebString::FromUTF8(css);
+}
+
+void InjectedStylesheetManager::OnRemoveInjectedStylesheet(int key) {
+  stylesheets_.erase(key);
+}
+
+}  // namespace atom
@@ -0,0 +1,47 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_RENDERER_INJECTED_STYLESHEET_MANAGER_H_
+#define ATOM_RENDERER_INJECTED_STYLESHEET_MANAGER_H_
+
+#include <map>
+#include <string>
+
+#include "content/public/renderer/render_thread_observer.h"
+#include "third_party/WebKit/public/platform/WebString.h"
+
+namespace blink {
+class WebDocument;
+}
+
+namespace atom {
+
+// Keeps the session-level stylesheets registered through
+// session.addInjectedStylesheet in the renderer process, so each new
+// document gets them inserted without any per-navigation IPC.
+class InjectedStylesheetManager : public content::RenderThreadObserver {
+ public:
+  InjectedStylesheetManager();
+  ~InjectedStylesheetManager() override;
+
+  // Inserts all registered stylesheets into |document|.
+  void ApplyToDocument(blink::WebDocument* document);
+
+ private:
+  // content::RenderThreadObserver:
+  bool OnControlMessageReceived(const IPC::Message& message) override;
+
+  void OnAddInjectedStylesheet(int key, const std::string& css);
+  void OnRemoveInjectedStylesheet(int key);
+
+  // The UTF-8 to WebString conversion is done once when a sheet arrives;
+  // documents only get the cached WebString inserted.
+  std::map<int, blink::WebString> stylesheets_;
+
+  DISALLOW_COPY_AND_ASSIGN(InjectedStylesheetManager);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_RENDERER_INJECTED_STYLESHEET_MANAGER_H_
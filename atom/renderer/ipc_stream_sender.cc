@@ -0,0 +1,91 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "atom/renderer/ipc_stream_sender.h"
+
+#include <algorithm>
+#include <string>
+
+#include "atom/common/api/api_messages.h"
+#include "content/public/renderer/render_frame.h"
+
+namespace atom {
+
+namespace {
+
+base::LazyInstance<IPCStreamSender>::Leaky g_ipc_stream_sender =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+// static
+IPCStreamSender* IPCStreamSender::Get() {
+  return g_ipc_stream_sender.Pointer();
+}
+
+IPCStreamSender::IPCStreamSender() {}
+
+IPCStreamSender::~IPCStreamSender() {}
+
+int IPCStreamSender::Start(content::RenderFrame* render_frame,
+                           const base::string16& channel,
+                           v8::Isolate* isolate,
+                           v8::Local<v8::Value> buffer,
+                           const char* data,
+                           size_t size) {
+  int stream_id = ++next_stream_id_;
+  Stream& stream = streams_[stream_id];
+  stream.routing_id = render_frame->GetRoutingID();
+  stream.buffer.Reset(isolate, buffer);
+  stream.data = data;
+  stream.size = size;
+
+  render_frame->Send(new AtomFrameHostMsg_StreamBegin(
+      stream.routing_id, channel, stream_id, size));
+  SendMore(stream_id);
+  return stream_id;
+}
+
+void IPCStreamSender::OnAck(int stream_id, uint64_t bytes_received) {
+  auto iter = streams_.find(stream_id);
+  if (iter == streams_.end())
+    return;
+
+  iter->second.acked =
+      std::min(static_cast<size_t>(bytes_received), iter->second.size);
+  SendMore(stream_id);
+}
+
+void IPCStreamSender::SendMore(int stream_id) {
+  auto iter = streams_.find(stream_id);
+  if (iter == streams_.end())
+    return;
+  Stream& stream = iter->second;
+
+  content::RenderFrame* render_frame =
+      content::RenderFrame::FromRoutingID(stream.routing_id);
+  if (!render_frame) {
+    // The frame went away mid-stream; the browser drops the partial
+    // stream with the frame.
+    streams_.erase(iter);
+    return;
+  }
+
+  while (stream.offset < stream.size &&
+         stream.offset - stream.acked < kMaxInFlight) {
+    size_t length = std::min(kChunkSize, stream.size - stream.offset);
+    render_frame->Send(new AtomFrameHostMsg_StreamChunk(
+        stream.routing_id, stream_id,
+        std::string(stream.data + stream.offset, length)));
+    stream.offset += length;
+  }
+
+  if (stream.offset == stream.size && stream.acked == stream.size) {
+    render_frame->Send(
+        new AtomFrameHostMsg_StreamEnd(stream.routing_id, stream_id));
+    streams_.erase(iter);
+  }
+}
+
+}  // namespace atom
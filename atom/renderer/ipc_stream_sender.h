@@ -0,0 +1,83 @@
+// Copyright (c) 2018 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ATOM_RENDERER_IPC_STREAM_SENDER_H_
+#define ATOM_RENDERER_IPC_STREAM_SENDER_H_
+
+#include <map>
+
+#include "base/lazy_instance.h"
+#include "base/macros.h"
+#include "base/strings/string16.h"
+#include "v8/include/v8.h"
+
+namespace content {
+class RenderFrame;
+}
+
+namespace atom {
+
+// Sends binary payloads that are too large for a single IPC message to
+// the browser as a sequence of fixed-size chunks. The browser
+// acknowledges received bytes (AtomFrameMsg_StreamAck) and only a
+// bounded window of chunks is kept in flight, so a multi-hundred-MB
+// transfer never queues more than a few MB in the channel. The source
+// ArrayBuffer is pinned until the stream completes, so chunks are sent
+// straight from its backing store without walking through base::Value.
+class IPCStreamSender {
+ public:
+  // Bytes carried by each AtomFrameHostMsg_StreamChunk.
+  static const size_t kChunkSize = 1024 * 1024;
+
+  // Maximum unacknowledged bytes before the sender waits for an ack.
+  static const size_t kMaxInFlight = 8 * 1024 * 1024;
+
+  static IPCStreamSender* Get();
+
+  // Starts streaming |size| bytes at |data| to the browser over
+  // |render_frame|. |buffer| is the JS value owning the bytes; it is
+  // kept alive until the last chunk is acknowledged. Returns the id of
+  // the new stream.
+  int Start(content::RenderFrame* render_frame,
+            const base::string16& channel,
+            v8::Isolate* isolate,
+            v8::Local<v8::Value> buffer,
+            const char* data,
+            size_t size);
+
+  // Called by AtomRenderFrameObserver when the browser acknowledges
+  // |bytes_received| bytes of the stream.
+  void OnAck(int stream_id, uint64_t bytes_received);
+
+ private:
+  friend struct base::LazyInstanceTraitsBase<IPCStreamSender>;
+
+  struct Stream {
+    int routing_id = 0;
+    v8::Global<v8::Value> buffer;
+    const char* data = nullptr;
+    size_t size = 0;
+    // Bytes sent and bytes acknowledged so far; the gap between the two
+    // is what is in flight.
+    size_t offset = 0;
+    size_t acked = 0;
+  };
+
+  IPCStreamSender();
+  ~IPCStreamSender();
+
+  // Sends chunks until the stream is done or the in-flight window is
+  // full, then the final AtomFrameHostMsg_StreamEnd once everything is
+  // acknowledged.
+  void SendMore(int stream_id);
+
+  int next_stream_id_ = 0;
+  std::map<int, Stream> streams_;
+
+  DISALLOW_COPY_AND_ASSIGN(IPCStreamSender);
+};
+
+}  // namespace atom
+
+#endif  // ATOM_RENDERER_IPC_STREAM_SENDER_H_
@@ -5,6 +5,7 @@
 #include "atom/renderer/preferences_manager.h"
 
 #include "atom/common/api/api_messages.h"
+#include "base/strings/string_number_conversions.h"
 #include "content/public/renderer/render_thread.h"
 
 namespace atom {
@@ -19,14 +20,46 @@ bool PreferencesManager::OnControlMessageReceived(const IPC::Message& message) {
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(PreferencesManager, message)
     IPC_MESSAGE_HANDLER(AtomMsg_UpdatePreferences, OnUpdatePreferences)
+    IPC_MESSAGE_HANDLER(AtomMsg_UpdatePreferenceEntries,
+                        OnUpdatePreferenceEntries)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
   return handled;
 }
 
 void PreferencesManager::OnUpdatePreferences(
-    const base::ListValue& preferences) {
-  preferences_ = preferences.CreateDeepCopy();
+    int version,
+    const base::DictionaryValue& entries) {
+  entries_ = entries.CreateDeepCopy();
+  version_ = version;
+  RebuildPreferences();
+}
+
+void PreferencesManager::OnUpdatePreferenceEntries(
+    int version,
+    const base::DictionaryValue& added,
+    const std::vector<int>& removed) {
+  // Ignore deltas that arrive before the initial snapshot or that are
+  // older than what has already been applied.
+  if (!entries_ || version <= version_)
+    return;
+  for (int id : removed)
+    entries_->RemoveWithoutPathExpansion(base::IntToString(id), nullptr);
+  for (base::DictionaryValue::Iterator iter(added); !iter.IsAtEnd();
+       iter.Advance()) {
+    entries_->SetWithoutPathExpansion(iter.key(),
+                                      iter.value().CreateDeepCopy());
+  }
+  version_ = version;
+  RebuildPreferences();
+}
+
+void PreferencesManager::RebuildPreferences() {
+  preferences_.reset(new base::ListValue);
+  for (base::DictionaryValue::Iterator iter(*entries_); !iter.IsAtEnd();
+       iter.Advance()) {
+    preferences_->Append(iter.value().CreateDeepCopy());
+  }
 }
 
 }  // namespace atom
@@ -6,6 +6,7 @@
 #define ATOM_RENDERER_PREFERENCES_MANAGER_H_
 
 #include <memory>
+#include <vector>
 
 #include "base/values.h"
 #include "content/public/renderer/render_thread_observer.h"
@@ -23,7 +24,17 @@ class PreferencesManager : public content::RenderThreadObserver {
   // content::RenderThreadObserver:
   bool OnControlMessageReceived(const IPC::Message& message) override;
 
-  void OnUpdatePreferences(const base::ListValue& preferences);
+  void OnUpdatePreferences(int version, const base::DictionaryValue& entries);
+  void OnUpdatePreferenceEntries(int version,
+                                 const base::DictionaryValue& added,
+                                 const std::vector<int>& removed);
+
+  void RebuildPreferences();
+
+  // Entries keyed by id, so incremental updates only carry the changed
+  // keys instead of re-sending and re-converting the whole set.
+  std::unique_ptr<base::DictionaryValue> entries_;
+  int version_ = -1;
 
   std::unique_ptr<base::ListValue> preferences_;
 
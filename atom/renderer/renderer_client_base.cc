@@ -7,7 +7,9 @@
 #include <string>
 #include <vector>
 
+#include "atom/common/asar/asar_header_cache.h"
 #include "atom/common/color_util.h"
+#include "atom/common/disabled_subsystems.h"
 #include "atom/common/native_mate_converters/value_converter.h"
 #include "atom/common/options_switches.h"
 #include "atom/renderer/atom_autofill_agent.h"
@@ -15,6 +17,7 @@
 #include "atom/renderer/atom_render_view_observer.h"
 #include "atom/renderer/content_settings_observer.h"
 #include "atom/renderer/guest_view_container.h"
+#include "atom/renderer/injected_stylesheet_manager.h"
 #include "atom/renderer/preferences_manager.h"
 #include "base/command_line.h"
 #include "base/strings/string_split.h"
@@ -93,6 +96,11 @@ void RendererClientBase::AddRenderBindings(
 }
 
 void RendererClientBase::RenderThreadStarted() {
+  // Map the asar indexes the browser process shared with us, so opening
+  // an archive here doesn't re-read and re-parse its header.
+  asar::AsarHeaderCache::GetInstance()->InitFromCommandLine(
+      *base::CommandLine::ForCurrentProcess(), asar::kAsarIndexDescriptorStart);
+
   blink::WebCustomElement::AddEmbedderCustomElementName("webview");
   blink::WebCustomElement::AddEmbedderCustomElementName("browserplugin");
 
@@ -124,6 +132,7 @@ void RendererClientBase::RenderThreadStarted() {
   blink::WebSecurityPolicy::RegisterURLSchemeAsAllowingServiceWorkers("file");
   blink::SchemeRegistry::RegisterURLSchemeAsSupportingFetchAPI("file");
 
+  injected_stylesheet_manager_.reset(new InjectedStylesheetManager);
   preferences_manager_.reset(new PreferencesManager);
 
 #if defined(OS_WIN)
@@ -155,15 +164,18 @@ void RendererClientBase::RenderFrameCreated(
   new PepperHelper(render_frame);
 #endif
   new ContentSettingsObserver(render_frame);
-  new printing::PrintWebViewHelper(render_frame);
+  if (!subsystems::IsDisabled(subsystems::kPrinting))
+    new printing::PrintWebViewHelper(render_frame);
 
   // This is required for widevine plugin detection provided during runtime.
   blink::ResetPluginCache();
 
 #if defined(ENABLE_PDF_VIEWER)
   // Allow access to file scheme from pdf viewer.
-  blink::WebSecurityPolicy::AddOriginAccessWhitelistEntry(
-      GURL(kPdfViewerUIOrigin), "file", "", true);
+  if (!subsystems::IsDisabled(subsystems::kPdf)) {
+    blink::WebSecurityPolicy::AddOriginAccessWhitelistEntry(
+        GURL(kPdfViewerUIOrigin), "file", "", true);
+  }
 #endif  // defined(ENABLE_PDF_VIEWER)
 }
 
@@ -192,6 +204,8 @@ void RendererClientBase::DidClearWindowObject(
 std::unique_ptr<blink::WebSpeechSynthesizer>
 RendererClientBase::OverrideSpeechSynthesizer(
     blink::WebSpeechSynthesizerClient* client) {
+  if (subsystems::IsDisabled(subsystems::kSpeech))
+    return nullptr;
   return std::make_unique<TtsDispatcher>(client);
 }
 
@@ -13,6 +13,7 @@
 
 namespace atom {
 
+class InjectedStylesheetManager;
 class PreferencesManager;
 
 class RendererClientBase : public content::ContentRendererClient {
@@ -29,6 +30,10 @@ class RendererClientBase : public content::ContentRendererClient {
 
   bool isolated_world() const { return isolated_world_; }
 
+  InjectedStylesheetManager* injected_stylesheet_manager() const {
+    return injected_stylesheet_manager_.get();
+  }
+
   // Get the context that the Electron API is running in.
   v8::Local<v8::Context> GetContext(blink::WebLocalFrame* frame,
                                     v8::Isolate* isolate) const;
@@ -55,6 +60,7 @@ class RendererClientBase : public content::ContentRendererClient {
       override;
 
  private:
+  std::unique_ptr<InjectedStylesheetManager> injected_stylesheet_manager_;
   std::unique_ptr<PreferencesManager> preferences_manager_;
   bool isolated_world_;
 };
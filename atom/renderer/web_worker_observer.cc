@@ -8,6 +8,8 @@
 #include "atom/common/api/event_emitter_caller.h"
 #include "atom/common/asar/asar_util.h"
 #include "atom/common/node_bindings.h"
+#include "atom/common/options_switches.h"
+#include "base/command_line.h"
 #include "base/lazy_instance.h"
 #include "base/threading/thread_local.h"
 
@@ -31,21 +33,27 @@ WebWorkerObserver* WebWorkerObserver::GetCurrent() {
 
 WebWorkerObserver::WebWorkerObserver()
     : node_bindings_(NodeBindings::Create(NodeBindings::WORKER)),
-      atom_bindings_(new AtomBindings(node_bindings_->uv_loop())) {
+      atom_bindings_(new AtomBindings(node_bindings_->uv_loop())),
+      recycle_(base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kRecycleWorkerEnvironments)) {
   lazy_tls.Pointer()->Set(this);
 }
 
 WebWorkerObserver::~WebWorkerObserver() {
   lazy_tls.Pointer()->Set(nullptr);
-  node::FreeEnvironment(node_bindings_->uv_env());
+  if (node_bindings_->uv_env())
+    node::FreeEnvironment(node_bindings_->uv_env());
   asar::ClearArchives();
 }
 
 void WebWorkerObserver::ContextCreated(v8::Local<v8::Context> context) {
   v8::Context::Scope context_scope(context);
 
-  // Start the embed thread.
-  node_bindings_->PrepareMessageLoop();
+  // Start the embed thread. A recycled observer already has one running.
+  if (!message_loop_prepared_) {
+    message_loop_prepared_ = true;
+    node_bindings_->PrepareMessageLoop();
+  }
 
   // Setup node environment for each window.
   node::Environment* env = node_bindings_->CreateEnvironment(context);
@@ -68,6 +76,16 @@ void WebWorkerObserver::ContextWillDestroy(v8::Local<v8::Context> context) {
   if (env)
     mate::EmitEvent(env->isolate(), env->process_object(), "exit");
 
+  // In recycle mode only the per-context node environment is released; the
+  // observer keeps its uv loop and embed thread warm for the next worker
+  // hosted on this thread, which avoids most of the environment setup cost.
+  if (recycle_) {
+    if (env)
+      node::FreeEnvironment(env);
+    node_bindings_->set_uv_env(nullptr);
+    return;
+  }
+
   delete this;
 }
 
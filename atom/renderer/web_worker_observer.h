@@ -29,6 +29,13 @@ class WebWorkerObserver {
   std::unique_ptr<NodeBindings> node_bindings_;
   std::unique_ptr<AtomBindings> atom_bindings_;
 
+  // When --recycle-worker-environments is passed the observer stays parked in
+  // its thread-local slot after the worker context goes away, keeping the uv
+  // loop, embed thread and asar archive cache warm for the next worker that
+  // runs on this thread.
+  bool recycle_ = false;
+  bool message_loop_prepared_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(WebWorkerObserver);
 };
 
@@ -93,6 +93,7 @@ BrowserContext::BrowserContext(const std::string& partition, bool in_memory)
 
 BrowserContext::~BrowserContext() {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  InspectableWebContentsImpl::DiscardPrewarmedDevTools(this);
   NotifyWillBeDestroyed(this);
   ShutdownStoragePartitions();
   if (BrowserThread::IsMessageLoopValid(BrowserThread::IO)) {
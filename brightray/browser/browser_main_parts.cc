@@ -12,14 +12,17 @@
 #include <string>
 
 #if defined(OS_LINUX)
+#include <fontconfig/fontconfig.h>
 #include <glib.h>  // for g_setenv()
 #endif
 
+#include "base/base_switches.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
 #include "base/message_loop/message_loop.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task_scheduler/post_task.h"
 #include "brightray/browser/browser_client.h"
 #include "brightray/browser/browser_context.h"
 #include "brightray/browser/devtools_manager_delegate.h"
@@ -148,6 +151,26 @@ int X11EmptyIOErrorHandler(Display* d) {
 }
 #endif
 
+#if defined(OS_LINUX)
+// Fontconfig builds its font caches lazily on first use, which on a cold
+// cache (e.g. NFS-backed home directories) can take seconds inside the
+// renderer during first text layout. Force the scan on a background thread
+// early in browser startup instead: the resulting on-disk caches are what
+// renderers mmap later, so they find them hot by the time text is laid out.
+void WarmUpFontconfig() {
+  FcInit();
+  // Listing one property forces every configured font directory to be
+  // scanned and its cache written; parsing the config alone does not.
+  FcPattern* pattern = FcPatternCreate();
+  FcObjectSet* object_set = FcObjectSetBuild(FC_FAMILY, nullptr);
+  FcFontSet* font_set = FcFontList(nullptr, pattern, object_set);
+  if (font_set)
+    FcFontSetDestroy(font_set);
+  FcObjectSetDestroy(object_set);
+  FcPatternDestroy(pattern);
+}
+#endif
+
 base::string16 MediaStringProvider(media::MessageId id) {
   switch (id) {
     case media::DEFAULT_AUDIO_DEVICE_NAME:
@@ -180,11 +203,21 @@ void OverrideAppLogsPath() {
 
 int BrowserMainParts::PreEarlyInitialization() {
   std::unique_ptr<base::FeatureList> feature_list(new base::FeatureList);
+  // Honor --enable-features/--disable-features from the command line, so
+  // apps can opt into Chromium features like ParallelDownloading with
+  // app.commandLine.appendSwitch.
+  auto* command_line = base::CommandLine::ForCurrentProcess();
+  std::string enable_features =
+      command_line->GetSwitchValueASCII(::switches::kEnableFeatures);
+  std::string disable_features =
+      command_line->GetSwitchValueASCII(::switches::kDisableFeatures);
   // TODO(deepak1556): Disable guest webcontents based on OOPIF feature.
   // Disable surface synchronization and async wheel events to make OSR work.
-  feature_list->InitializeFromCommandLine(
-      "",
-      "GuestViewCrossProcessFrames,SurfaceSynchronization,AsyncWheelEvents");
+  if (!disable_features.empty())
+    disable_features += ",";
+  disable_features +=
+      "GuestViewCrossProcessFrames,SurfaceSynchronization,AsyncWheelEvents";
+  feature_list->InitializeFromCommandLine(enable_features, disable_features);
   base::FeatureList::SetInstance(std::move(feature_list));
   OverrideAppLogsPath();
 #if defined(USE_X11)
@@ -255,6 +288,16 @@ void BrowserMainParts::PreMainMessageLoopRun() {
   content::WebUIControllerFactory::RegisterFactory(
       WebUIControllerFactory::GetInstance());
 
+#if defined(OS_LINUX)
+  // Kick off the fontconfig cache scan now so it overlaps the rest of
+  // initialization instead of blocking the first text layout.
+  base::PostTaskWithTraits(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BACKGROUND,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::BindOnce(&WarmUpFontconfig));
+#endif
+
   // --remote-debugging-port
   auto* command_line = base::CommandLine::ForCurrentProcess();
   if (command_line->HasSwitch(switches::kRemoteDebuggingPort))
@@ -4,6 +4,8 @@
 
 #include "brightray/browser/devtools_embedder_message_dispatcher.h"
 
+#include <unordered_map>
+
 #include "base/bind.h"
 #include "base/values.h"
 
@@ -146,7 +148,9 @@ class DispatcherImpl : public DevToolsEmbedderMessageDispatcher {
  private:
   using Handler =
       base::Callback<bool(const DispatchCallback&, const base::ListValue&)>;
-  using HandlerMap = std::map<std::string, Handler>;
+  // The table is fully built in CreateForDevToolsFrontend and only looked up
+  // afterwards; hashed lookup keeps per-message cost flat during bursts.
+  using HandlerMap = std::unordered_map<std::string, Handler>;
   HandlerMap handlers_;
 };
 
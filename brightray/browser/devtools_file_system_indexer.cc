@@ -9,12 +9,15 @@
 #include <algorithm>
 #include <iterator>
 #include <set>
+#include <utility>
 
 #include "base/bind.h"
 #include "base/files/file_enumerator.h"
+#include "base/files/file_path_watcher.h"
 #include "base/files/file_util.h"
 #include "base/files/file_util_proxy.h"
 #include "base/lazy_instance.h"
+#include "base/sys_info.h"
 #include "base/logging.h"
 #include "base/sequence_checker.h"
 #include "base/stl_util.h"
@@ -98,12 +101,13 @@ class Index {
 base::LazyInstance<Index>::Leaky g_trigram_index = LAZY_INSTANCE_INITIALIZER;
 
 TrigramChar TrigramCharForChar(char c) {
-  static TrigramChar* trigram_chars = nullptr;
-  if (!trigram_chars) {
-    trigram_chars = new TrigramChar[256];
+  // Initialized through a function-local static so the table can be shared
+  // safely by concurrent shard tasks.
+  static const TrigramChar* trigram_chars = []() {
+    TrigramChar* chars = new TrigramChar[256];
     for (size_t i = 0; i < 256; ++i) {
       if (i > 127) {
-        trigram_chars[i] = kUndefinedTrigramChar;
+        chars[i] = kUndefinedTrigramChar;
         continue;
       }
       char ch = static_cast<char>(i);
@@ -114,12 +118,12 @@ TrigramChar TrigramCharForChar(char c) {
 
       bool is_binary_char = ch < 9 || (ch >= 14 && ch < 32) || ch == 127;
       if (is_binary_char) {
-        trigram_chars[i] = kBinaryTrigramChar;
+        chars[i] = kBinaryTrigramChar;
         continue;
       }
 
       if (ch < ' ') {
-        trigram_chars[i] = kUndefinedTrigramChar;
+        chars[i] = kUndefinedTrigramChar;
         continue;
       }
 
@@ -128,9 +132,10 @@ TrigramChar TrigramCharForChar(char c) {
       ch -= ' ';
       char signed_trigram_count = static_cast<char>(kTrigramCharacterCount);
       CHECK(ch >= 0 && ch < signed_trigram_count);
-      trigram_chars[i] = ch;
+      chars[i] = ch;
     }
-  }
+    return chars;
+  }();
   unsigned char uc = static_cast<unsigned char>(c);
   return trigram_chars[uc];
 }
@@ -260,6 +265,66 @@ void Index::NormalizeVectors() {
 
 typedef Callback<void(bool, const vector<bool>&)> IndexerCallback;
 
+// Reads |file_path| in chunks and extracts the set of trigrams it contains.
+// Returns false if the file could not be read. Binary files are reported as
+// successfully indexed with no trigrams so they are not rescanned on the next
+// pass. Runs on the task scheduler pool.
+bool ExtractFileTrigrams(const FilePath& file_path,
+                         vector<bool>* trigrams_set,
+                         vector<Trigram>* trigrams) {
+  base::File file(file_path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  if (!file.IsValid())
+    return false;
+  std::unique_ptr<char[]> data_ptr(new char[kMaxReadLength]);
+  const char* const data = data_ptr.get();
+  int64_t offset = 0;
+  for (;;) {
+    int bytes_read = file.Read(offset, data_ptr.get(), kMaxReadLength);
+    if (bytes_read < 0)
+      return false;
+    if (bytes_read < 3)
+      return true;
+    size_t size = static_cast<size_t>(bytes_read);
+    vector<TrigramChar> trigram_chars;
+    trigram_chars.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+      TrigramChar trigram_char = TrigramCharForChar(data[i]);
+      if (trigram_char == kBinaryTrigramChar) {
+        trigrams->clear();
+        return true;
+      }
+      trigram_chars.push_back(trigram_char);
+    }
+    for (size_t i = 0; i + 2 < size; ++i) {
+      Trigram trigram = TrigramAtIndex(trigram_chars, i);
+      if ((trigram != kUndefinedTrigram) && !(*trigrams_set)[trigram]) {
+        (*trigrams_set)[trigram] = true;
+        trigrams->push_back(trigram);
+      }
+    }
+    offset += bytes_read - 2;
+  }
+}
+
+const int kReindexDelayMs = 1000;
+
+// Recursive watchers for the indexed roots, plus the roots with a reindex
+// already pending. Both only touched on the impl sequence; leaked so the
+// watchers are never destroyed on the wrong sequence.
+struct WatcherState {
+  std::map<FilePath, std::unique_ptr<base::FilePathWatcher>> watchers;
+  std::set<FilePath> pending_reindex;
+};
+
+base::LazyInstance<WatcherState>::Leaky g_watcher_state =
+    LAZY_INSTANCE_INITIALIZER;
+
+// Progress callbacks for watcher-driven reindexing jobs, which have no
+// frontend to report to.
+void NoopTotalWork(int total_work) {}
+void NoopWorked(int worked) {}
+void NoopDone() {}
+
 }  // namespace
 
 DevToolsFileSystemIndexer::FileSystemIndexingJob::FileSystemIndexingJob(
@@ -271,11 +336,11 @@ DevToolsFileSystemIndexer::FileSystemIndexingJob::FileSystemIndexingJob(
       total_work_callback_(total_work_callback),
       worked_callback_(worked_callback),
       done_callback_(done_callback),
+      next_file_index_(0),
+      shard_count_(0),
+      shards_merged_(0),
       files_indexed_(0),
-      stopped_(false) {
-  current_trigrams_set_.resize(kTrigramCount);
-  current_trigrams_.reserve(kTrigramCount);
-}
+      stopped_(false) {}
 
 DevToolsFileSystemIndexer::FileSystemIndexingJob::~FileSystemIndexingJob() {}
 
@@ -308,8 +373,7 @@ void DevToolsFileSystemIndexer::FileSystemIndexingJob::CollectFilesToIndex() {
     BrowserThread::PostTask(
         BrowserThread::UI, FROM_HERE,
         BindOnce(total_work_callback_, file_path_times_.size()));
-    indexing_it_ = file_path_times_.begin();
-    IndexFiles();
+    DispatchFilesToShards();
     return;
   }
   Time saved_last_modified_time =
@@ -323,90 +387,62 @@ void DevToolsFileSystemIndexer::FileSystemIndexingJob::CollectFilesToIndex() {
       FROM_HERE, BindOnce(&FileSystemIndexingJob::CollectFilesToIndex, this));
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::IndexFiles() {
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::DispatchFilesToShards() {
   DCHECK(impl_task_runner()->RunsTasksInCurrentSequence());
-  if (stopped_)
-    return;
-  if (indexing_it_ == file_path_times_.end()) {
+  files_to_index_.reserve(file_path_times_.size());
+  for (const auto& entry : file_path_times_)
+    files_to_index_.push_back(entry.first);
+  if (files_to_index_.empty()) {
     g_trigram_index.Get().NormalizeVectors();
     BrowserThread::PostTask(BrowserThread::UI, FROM_HERE, done_callback_);
     return;
   }
-  FilePath file_path = indexing_it_->first;
-  current_file_.Initialize(file_path,
-                           base::File::FLAG_OPEN | base::File::FLAG_READ);
-  if (!current_file_.IsValid()) {
-    FinishFileIndexing(false);
-    return;
+  next_file_index_ = 0;
+  shard_count_ =
+      std::max(1, std::min(base::SysInfo::NumberOfProcessors(),
+                           static_cast<int>(files_to_index_.size())));
+  for (int i = 0; i < shard_count_; ++i) {
+    base::PostTaskWithTraits(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::BACKGROUND},
+        BindOnce(&FileSystemIndexingJob::IndexShard, this));
   }
-  current_file_offset_ = 0;
-  current_trigrams_.clear();
-  std::fill(current_trigrams_set_.begin(), current_trigrams_set_.end(), false);
-  ReadFromFile();
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::ReadFromFile() {
-  if (stopped_) {
-    CloseFile();
-    return;
-  }
-  std::unique_ptr<char[]> data_ptr(new char[kMaxReadLength]);
-  const char* const data = data_ptr.get();
-  int bytes_read =
-      current_file_.Read(current_file_offset_, data_ptr.get(), kMaxReadLength);
-  if (bytes_read < 0) {
-    FinishFileIndexing(false);
-    return;
-  }
-
-  if (bytes_read < 3) {
-    FinishFileIndexing(true);
-    return;
-  }
-
-  size_t size = static_cast<size_t>(bytes_read);
-  vector<TrigramChar> trigram_chars;
-  trigram_chars.reserve(size);
-  for (size_t i = 0; i < size; ++i) {
-    TrigramChar trigram_char = TrigramCharForChar(data[i]);
-    if (trigram_char == kBinaryTrigramChar) {
-      current_trigrams_.clear();
-      FinishFileIndexing(true);
-      return;
-    }
-    trigram_chars.push_back(trigram_char);
-  }
-
-  for (size_t i = 0; i + 2 < size; ++i) {
-    Trigram trigram = TrigramAtIndex(trigram_chars, i);
-    if ((trigram != kUndefinedTrigram) && !current_trigrams_set_[trigram]) {
-      current_trigrams_set_[trigram] = true;
-      current_trigrams_.push_back(trigram);
-    }
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::IndexShard() {
+  std::unique_ptr<ShardResults> results = std::make_unique<ShardResults>();
+  vector<bool> trigrams_set(kTrigramCount);
+  vector<Trigram> trigrams;
+  trigrams.reserve(kTrigramCount);
+  for (;;) {
+    size_t index = next_file_index_.fetch_add(1);
+    if (index >= files_to_index_.size() || stopped_)
+      break;
+    const FilePath& file_path = files_to_index_[index];
+    trigrams.clear();
+    std::fill(trigrams_set.begin(), trigrams_set.end(), false);
+    if (ExtractFileTrigrams(file_path, &trigrams_set, &trigrams))
+      results->push_back(std::make_pair(file_path, trigrams));
+    impl_task_runner()->PostTask(
+        FROM_HERE, BindOnce(&FileSystemIndexingJob::ReportWorked, this));
   }
-  current_file_offset_ += bytes_read - 2;
   impl_task_runner()->PostTask(
-      FROM_HERE, base::BindOnce(&FileSystemIndexingJob::ReadFromFile, this));
+      FROM_HERE, BindOnce(&FileSystemIndexingJob::MergeShardResults, this,
+                          std::move(results)));
 }
 
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::FinishFileIndexing(
-    bool success) {
+void DevToolsFileSystemIndexer::FileSystemIndexingJob::MergeShardResults(
+    std::unique_ptr<ShardResults> results) {
   DCHECK(impl_task_runner()->RunsTasksInCurrentSequence());
-  CloseFile();
-  if (success) {
-    FilePath file_path = indexing_it_->first;
-    g_trigram_index.Get().SetTrigramsForFile(file_path, current_trigrams_,
-                                             file_path_times_[file_path]);
+  if (!stopped_) {
+    for (const auto& entry : *results) {
+      g_trigram_index.Get().SetTrigramsForFile(entry.first, entry.second,
+                                               file_path_times_[entry.first]);
+    }
   }
-  ReportWorked();
-  ++indexing_it_;
-  impl_task_runner()->PostTask(
-      FROM_HERE, base::BindOnce(&FileSystemIndexingJob::IndexFiles, this));
-}
-
-void DevToolsFileSystemIndexer::FileSystemIndexingJob::CloseFile() {
-  if (current_file_.IsValid())
-    current_file_.Close();
+  if (++shards_merged_ < shard_count_ || stopped_)
+    return;
+  g_trigram_index.Get().NormalizeVectors();
+  BrowserThread::PostTask(BrowserThread::UI, FROM_HERE, done_callback_);
 }
 
 void DevToolsFileSystemIndexer::FileSystemIndexingJob::ReportWorked() {
@@ -436,11 +472,68 @@ DevToolsFileSystemIndexer::DevToolsFileSystemIndexer() {
 DevToolsFileSystemIndexer::~DevToolsFileSystemIndexer() {
   impl_task_runner()->PostTask(FROM_HERE, base::BindOnce([]() {
                                  --g_instance_count;
-                                 if (!g_instance_count)
+                                 if (!g_instance_count) {
                                    g_trigram_index.Get().Reset();
+                                   g_watcher_state.Get().watchers.clear();
+                                 }
                                }));
 }
 
+// static
+void DevToolsFileSystemIndexer::WatchPathOnImplSequence(const FilePath& root) {
+  DCHECK(impl_task_runner()->RunsTasksInCurrentSequence());
+  auto& watchers = g_watcher_state.Get().watchers;
+  if (watchers.find(root) != watchers.end())
+    return;
+  auto watcher = std::make_unique<base::FilePathWatcher>();
+  if (!watcher->Watch(root, true /* recursive */,
+                      Bind(&DevToolsFileSystemIndexer::OnFileSystemChanged,
+                           root))) {
+    // Recursive watches are not supported on every file system; explicit
+    // reindexing still works, it just rescans all modification times.
+    return;
+  }
+  watchers[root] = std::move(watcher);
+}
+
+// static
+void DevToolsFileSystemIndexer::OnFileSystemChanged(const FilePath& root,
+                                                    const FilePath& path,
+                                                    bool error) {
+  DCHECK(impl_task_runner()->RunsTasksInCurrentSequence());
+  if (error)
+    return;
+  // Coalesce change bursts (builds, branch switches) into one pass.
+  if (!g_watcher_state.Get().pending_reindex.insert(root).second)
+    return;
+  impl_task_runner()->PostDelayedTask(
+      FROM_HERE,
+      BindOnce(&DevToolsFileSystemIndexer::TriggerReindexOnImplSequence, root),
+      TimeDelta::FromMilliseconds(kReindexDelayMs));
+}
+
+// static
+void DevToolsFileSystemIndexer::TriggerReindexOnImplSequence(
+    const FilePath& root) {
+  DCHECK(impl_task_runner()->RunsTasksInCurrentSequence());
+  g_watcher_state.Get().pending_reindex.erase(root);
+  if (!g_instance_count)
+    return;
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      BindOnce(&DevToolsFileSystemIndexer::StartReindexJobOnUI, root));
+}
+
+// static
+void DevToolsFileSystemIndexer::StartReindexJobOnUI(const FilePath& root) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  // Modification times gate the work, so only files that actually changed
+  // since the last pass are re-read.
+  scoped_refptr<FileSystemIndexingJob> job = new FileSystemIndexingJob(
+      root, Bind(&NoopTotalWork), Bind(&NoopWorked), Bind(&NoopDone));
+  job->Start();
+}
+
 scoped_refptr<DevToolsFileSystemIndexer::FileSystemIndexingJob>
 DevToolsFileSystemIndexer::IndexPath(
     const string& file_system_path,
@@ -452,6 +545,9 @@ DevToolsFileSystemIndexer::IndexPath(
       FilePath::FromUTF8Unsafe(file_system_path), total_work_callback,
       worked_callback, done_callback);
   indexing_job->Start();
+  impl_task_runner()->PostTask(
+      FROM_HERE, BindOnce(&DevToolsFileSystemIndexer::WatchPathOnImplSequence,
+                          FilePath::FromUTF8Unsafe(file_system_path)));
   return indexing_job;
 }
 
@@ -7,9 +7,11 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/callback.h"
@@ -47,14 +49,21 @@ class DevToolsFileSystemIndexer
                           const DoneCallback& done_callback);
     virtual ~FileSystemIndexingJob();
 
+    typedef int32_t Trigram;
+    typedef std::vector<std::pair<base::FilePath, std::vector<Trigram>>>
+        ShardResults;
+
     void Start();
     void StopOnImplSequence();
     void CollectFilesToIndex();
-    void IndexFiles();
-    void ReadFromFile();
-    void OnRead(base::File::Error error, const char* data, int bytes_read);
-    void FinishFileIndexing(bool success);
-    void CloseFile();
+    // Fans the collected files out to a pool of shard tasks.
+    void DispatchFilesToShards();
+    // Runs on the task scheduler pool. Each shard task claims files from
+    // |next_file_index_| until none are left, so shards that hit small files
+    // steal work from shards stuck on big ones.
+    void IndexShard();
+    // Folds one shard's trigrams into the global index on the impl sequence.
+    void MergeShardResults(std::unique_ptr<ShardResults> results);
     void ReportWorked();
 
     base::FilePath file_system_path_;
@@ -64,16 +73,16 @@ class DevToolsFileSystemIndexer
     std::unique_ptr<base::FileEnumerator> file_enumerator_;
     typedef std::map<base::FilePath, base::Time> FilePathTimesMap;
     FilePathTimesMap file_path_times_;
-    FilePathTimesMap::const_iterator indexing_it_;
-    base::File current_file_;
-    int64_t current_file_offset_;
-    typedef int32_t Trigram;
-    std::vector<Trigram> current_trigrams_;
-    // The index in this vector is the trigram id.
-    std::vector<bool> current_trigrams_set_;
+    // Set up on the impl sequence before the shard tasks are posted, read-only
+    // while they run.
+    std::vector<base::FilePath> files_to_index_;
+    // Next index in |files_to_index_| to claim. Incremented by shard tasks.
+    std::atomic<size_t> next_file_index_;
+    int shard_count_;
+    int shards_merged_;
     base::TimeTicks last_worked_notification_time_;
     int files_indexed_;
-    bool stopped_;
+    std::atomic<bool> stopped_;
   };
 
   DevToolsFileSystemIndexer();
@@ -100,6 +109,17 @@ class DevToolsFileSystemIndexer
                                   const std::string& query,
                                   const SearchCallback& callback);
 
+  // File-change driven reindexing. A recursive watcher is installed for every
+  // indexed root; changes schedule a debounced incremental job that only
+  // touches files whose modification time moved. All static because the
+  // watchers outlive any single indexer instance.
+  static void WatchPathOnImplSequence(const base::FilePath& root);
+  static void OnFileSystemChanged(const base::FilePath& root,
+                                  const base::FilePath& path,
+                                  bool error);
+  static void TriggerReindexOnImplSequence(const base::FilePath& root);
+  static void StartReindexJobOnUI(const base::FilePath& root);
+
   DISALLOW_COPY_AND_ASSIGN(DevToolsFileSystemIndexer);
 };
 
@@ -6,9 +6,12 @@
 
 #include <string>
 
+#include "base/bind.h"
+#include "base/debug/alias.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
+#include "base/task_scheduler/post_task.h"
 #include "content/public/browser/devtools_frontend_host.h"
 #include "content/public/browser/url_data_source.h"
 #include "content/public/browser/web_contents.h"
@@ -53,6 +56,26 @@ std::string GetMimeTypeForPath(const std::string& path) {
   return "text/html";
 }
 
+// The frontend bundle is served straight out of the memory-mapped resource
+// pak, so the first DevTools open otherwise stalls on page faults while
+// tens of MB fault in on demand. Touch the critical-path resources on a
+// background thread so they are resident by the time the frontend requests
+// them.
+void PrefaultFrontendResources() {
+  static const char* const kCriticalResources[] = {
+      "inspector.html", "inspector.js", "shell.js", "inspector.css",
+  };
+  for (const char* resource_name : kCriticalResources) {
+    base::StringPiece resource =
+        content::DevToolsFrontendHost::GetFrontendResource(resource_name);
+    // Reading one byte per page is enough to fault the mapping in.
+    size_t sum = 0;
+    for (size_t i = 0; i < resource.size(); i += 4096)
+      sum += static_cast<unsigned char>(resource[i]);
+    base::debug::Alias(&sum);
+  }
+}
+
 class BundledDataSource : public content::URLDataSource {
  public:
   BundledDataSource() {}
@@ -115,6 +138,14 @@ DevToolsUI::DevToolsUI(content::BrowserContext* browser_context,
     : WebUIController(web_ui) {
   web_ui->SetBindings(0);
   content::URLDataSource::Add(browser_context, new BundledDataSource());
+
+  static bool prefault_posted = false;
+  if (!prefault_posted) {
+    prefault_posted = true;
+    base::PostTaskWithTraits(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+        base::Bind(&PrefaultFrontendResources));
+  }
 }
 
 }  // namespace brightray
@@ -3,6 +3,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE-CHROMIUM file.
 
+#include <map>
+#include <memory>
 #include <utility>
 
 #include "brightray/browser/inspectable_web_contents_impl.h"
@@ -130,6 +132,32 @@ GURL GetDevToolsURL(bool can_dock) {
   return GURL(url_string);
 }
 
+// Pre-warmed DevTools frontends ----------------------------------------------
+
+// Hidden frontends that have already loaded the bundle, at most one per
+// browser context. Adopting one from here means ShowDevTools navigates an
+// already-running renderer with the frontend code cached instead of
+// spawning a process and parsing tens of MB from scratch.
+using PrewarmedFrontendMap =
+    std::map<content::BrowserContext*, std::unique_ptr<content::WebContents>>;
+
+PrewarmedFrontendMap* GetPrewarmedFrontends() {
+  static PrewarmedFrontendMap* frontends = new PrewarmedFrontendMap;
+  return frontends;
+}
+
+void FillPrewarmedFrontend(content::BrowserContext* browser_context) {
+  std::unique_ptr<content::WebContents> web_contents(
+      content::WebContents::Create(
+          content::WebContents::CreateParams(browser_context)));
+  web_contents->GetController().LoadURL(GetDevToolsURL(true),
+                                        content::Referrer(),
+                                        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
+                                        std::string());
+  web_contents->WasHidden();
+  (*GetPrewarmedFrontends())[browser_context] = std::move(web_contents);
+}
+
 // ResponseWriter -------------------------------------------------------------
 
 class ResponseWriter : public net::URLFetcherResponseWriter {
@@ -196,6 +224,25 @@ void InspectableWebContentsImpl::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kDevToolsPreferences);
 }
 
+// static
+void InspectableWebContentsImpl::SetDevToolsPrewarm(
+    content::BrowserContext* browser_context,
+    bool enabled) {
+  auto* prewarmed = GetPrewarmedFrontends();
+  if (enabled) {
+    if (prewarmed->find(browser_context) == prewarmed->end())
+      FillPrewarmedFrontend(browser_context);
+  } else {
+    prewarmed->erase(browser_context);
+  }
+}
+
+// static
+void InspectableWebContentsImpl::DiscardPrewarmedDevTools(
+    content::BrowserContext* browser_context) {
+  GetPrewarmedFrontends()->erase(browser_context);
+}
+
 InspectableWebContentsImpl::InspectableWebContentsImpl(
     content::WebContents* web_contents)
     : frontend_loaded_(false),
@@ -305,9 +352,20 @@ void InspectableWebContentsImpl::ShowDevTools() {
       DevToolsEmbedderMessageDispatcher::CreateForDevToolsFrontend(this));
 
   if (!external_devtools_web_contents_) {  // no external devtools
-    managed_devtools_web_contents_.reset(
-        content::WebContents::Create(content::WebContents::CreateParams(
-            web_contents_->GetBrowserContext())));
+    auto* browser_context = web_contents_->GetBrowserContext();
+    auto* prewarmed = GetPrewarmedFrontends();
+    auto iter = prewarmed->find(browser_context);
+    if (iter != prewarmed->end() && iter->second) {
+      // Adopt the pre-warmed hidden frontend; the navigation below runs in
+      // its already-warm renderer with the bundle cached.
+      managed_devtools_web_contents_ = std::move(iter->second);
+      prewarmed->erase(iter);
+      FillPrewarmedFrontend(browser_context);
+    } else {
+      managed_devtools_web_contents_.reset(
+          content::WebContents::Create(
+              content::WebContents::CreateParams(browser_context)));
+    }
     managed_devtools_web_contents_->SetDelegate(this);
   }
 
@@ -622,18 +680,40 @@ void InspectableWebContentsImpl::HandleMessageFromDevToolsFrontend(
     return;
   }
 
+  std::unique_ptr<base::Value> parsed_message(base::JSONReader::Read(message));
+  if (!parsed_message) {
+    LOG(ERROR) << "Invalid message was sent to embedder: " << message;
+    return;
+  }
+
+  // A top-level list is a batch of messages that shares this one parse.
+  // Heavy traffic such as a timeline recording groups many calls into a
+  // single payload instead of paying JSON and dispatch overhead per call.
+  base::ListValue* batch = nullptr;
+  if (parsed_message->GetAsList(&batch)) {
+    for (const auto& entry : *batch) {
+      if (!DispatchParsedFrontendMessage(entry))
+        LOG(ERROR) << "Invalid message in batch sent to embedder: " << message;
+    }
+    return;
+  }
+
+  if (!DispatchParsedFrontendMessage(*parsed_message))
+    LOG(ERROR) << "Invalid message was sent to embedder: " << message;
+}
+
+bool InspectableWebContentsImpl::DispatchParsedFrontendMessage(
+    const base::Value& message) {
   std::string method;
   base::ListValue empty_params;
-  base::ListValue* params = &empty_params;
+  const base::ListValue* params = &empty_params;
 
-  base::DictionaryValue* dict = nullptr;
-  std::unique_ptr<base::Value> parsed_message(base::JSONReader::Read(message));
-  if (!parsed_message || !parsed_message->GetAsDictionary(&dict) ||
+  const base::DictionaryValue* dict = nullptr;
+  if (!message.GetAsDictionary(&dict) ||
       !dict->GetString(kFrontendHostMethod, &method) ||
       (dict->HasKey(kFrontendHostParams) &&
        !dict->GetList(kFrontendHostParams, &params))) {
-    LOG(ERROR) << "Invalid message was sent to embedder: " << message;
-    return;
+    return false;
   }
   int id = 0;
   dict->GetInteger(kFrontendHostId, &id);
@@ -641,6 +721,7 @@ void InspectableWebContentsImpl::HandleMessageFromDevToolsFrontend(
       base::Bind(&InspectableWebContentsImpl::SendMessageAck,
                  weak_factory_.GetWeakPtr(), id),
       method, params);
+  return true;
 }
 
 void InspectableWebContentsImpl::DispatchProtocolMessage(
@@ -39,6 +39,18 @@ class InspectableWebContentsImpl
  public:
   static void RegisterPrefs(PrefRegistrySimple* pref_registry);
 
+  // Keeps one hidden, pre-loaded DevTools frontend per |browser_context| so
+  // the next ShowDevTools adopts an already-running renderer with the
+  // frontend bundle loaded and cached, making open latency near-instant.
+  // The pool is refilled after a frontend is consumed.
+  static void SetDevToolsPrewarm(content::BrowserContext* browser_context,
+                                 bool enabled);
+
+  // Drops any pre-warmed frontend for |browser_context|; called when the
+  // context is being destroyed.
+  static void DiscardPrewarmedDevTools(
+      content::BrowserContext* browser_context);
+
   explicit InspectableWebContentsImpl(content::WebContents*);
   ~InspectableWebContentsImpl() override;
 
@@ -174,6 +186,10 @@ class InspectableWebContentsImpl
 
   void SendMessageAck(int request_id, const base::Value* arg1);
 
+  // Dispatches one already-parsed frontend message. Returns false if the
+  // message does not have the expected shape.
+  bool DispatchParsedFrontendMessage(const base::Value& message);
+
   bool frontend_loaded_;
   scoped_refptr<content::DevToolsAgentHost> agent_host_;
   std::unique_ptr<content::DevToolsFrontendHost> frontend_host_;
@@ -4,6 +4,7 @@
 
 #include "brightray/browser/media/media_capture_devices_dispatcher.h"
 
+#include "base/bind.h"
 #include "base/logging.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/media_capture_devices.h"
@@ -41,7 +42,9 @@ MediaCaptureDevicesDispatcher* MediaCaptureDevicesDispatcher::GetInstance() {
 }
 
 MediaCaptureDevicesDispatcher::MediaCaptureDevicesDispatcher()
-    : is_device_enumeration_disabled_(false) {
+    : is_device_enumeration_disabled_(false),
+      cached_audio_devices_valid_(false),
+      cached_video_devices_valid_(false) {
   // MediaCaptureDevicesDispatcher is a singleton. It should be created on
   // UI thread.
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
@@ -54,7 +57,12 @@ MediaCaptureDevicesDispatcher::GetAudioCaptureDevices() {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   if (is_device_enumeration_disabled_)
     return EmptyDevices();
-  return content::MediaCaptureDevices::GetInstance()->GetAudioCaptureDevices();
+  if (!cached_audio_devices_valid_) {
+    cached_audio_devices_ =
+        content::MediaCaptureDevices::GetInstance()->GetAudioCaptureDevices();
+    cached_audio_devices_valid_ = true;
+  }
+  return cached_audio_devices_;
 }
 
 const MediaStreamDevices&
@@ -62,7 +70,12 @@ MediaCaptureDevicesDispatcher::GetVideoCaptureDevices() {
   DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
   if (is_device_enumeration_disabled_)
     return EmptyDevices();
-  return content::MediaCaptureDevices::GetInstance()->GetVideoCaptureDevices();
+  if (!cached_video_devices_valid_) {
+    cached_video_devices_ =
+        content::MediaCaptureDevices::GetInstance()->GetVideoCaptureDevices();
+    cached_video_devices_valid_ = true;
+  }
+  return cached_video_devices_;
 }
 
 void MediaCaptureDevicesDispatcher::GetDefaultDevices(
@@ -127,9 +140,32 @@ void MediaCaptureDevicesDispatcher::DisableDeviceEnumerationForTesting() {
   is_device_enumeration_disabled_ = true;
 }
 
-void MediaCaptureDevicesDispatcher::OnAudioCaptureDevicesChanged() {}
+void MediaCaptureDevicesDispatcher::OnAudioCaptureDevicesChanged() {
+  // Called on the IO thread; the cache lives on the UI thread.
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::BindOnce(
+          &MediaCaptureDevicesDispatcher::InvalidateCachedAudioDevices,
+          base::Unretained(this)));
+}
+
+void MediaCaptureDevicesDispatcher::OnVideoCaptureDevicesChanged() {
+  BrowserThread::PostTask(
+      BrowserThread::UI, FROM_HERE,
+      base::BindOnce(
+          &MediaCaptureDevicesDispatcher::InvalidateCachedVideoDevices,
+          base::Unretained(this)));
+}
+
+void MediaCaptureDevicesDispatcher::InvalidateCachedAudioDevices() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  cached_audio_devices_valid_ = false;
+}
 
-void MediaCaptureDevicesDispatcher::OnVideoCaptureDevicesChanged() {}
+void MediaCaptureDevicesDispatcher::InvalidateCachedVideoDevices() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  cached_video_devices_valid_ = false;
+}
 
 void MediaCaptureDevicesDispatcher::OnMediaRequestStateChanged(
     int render_process_id,
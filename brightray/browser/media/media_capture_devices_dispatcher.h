@@ -72,9 +72,22 @@ class MediaCaptureDevicesDispatcher : public content::MediaObserver {
   MediaCaptureDevicesDispatcher();
   ~MediaCaptureDevicesDispatcher() override;
 
+  // Invalidate the cached snapshots on the UI thread; the device-change
+  // notifications above arrive on the IO thread.
+  void InvalidateCachedAudioDevices();
+  void InvalidateCachedVideoDevices();
+
   // Flag used by unittests to disable device enumeration.
   bool is_device_enumeration_disabled_;
 
+  // Cached snapshots of the capture devices, refreshed lazily and
+  // invalidated from system device-change notifications, so the repeated
+  // per-constraint lookups during getUserMedia do not re-enumerate.
+  bool cached_audio_devices_valid_;
+  bool cached_video_devices_valid_;
+  content::MediaStreamDevices cached_audio_devices_;
+  content::MediaStreamDevices cached_video_devices_;
+
   DISALLOW_COPY_AND_ASSIGN(MediaCaptureDevicesDispatcher);
 };
 
@@ -4,10 +4,19 @@
 
 #include "brightray/browser/net_log.h"
 
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/command_line.h"
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/format_macros.h"
+#include "base/json/json_writer.h"
+#include "base/strings/stringprintf.h"
+#include "base/synchronization/lock.h"
+#include "base/task_scheduler/post_task.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "net/log/file_net_log_observer.h"
 #include "net/log/net_log_util.h"
@@ -30,11 +39,94 @@ std::unique_ptr<base::DictionaryValue> GetConstants() {
   return constants;
 }
 
+// Writes |json| at |path|; runs on a blocking task runner.
+bool WriteRingBufferDump(const base::FilePath& path, const std::string& json) {
+  return base::WriteFile(path, json.data(), static_cast<int>(json.size())) ==
+         static_cast<int>(json.size());
+}
+
+void RunDumpCallback(base::OnceCallback<void(bool)> callback, bool success) {
+  if (callback)
+    std::move(callback).Run(success);
+}
+
 }  // namespace
 
+// Records every NetLog entry into a fixed ring of small binary records. Only
+// the integral fields are captured — parameter serialization is what makes
+// file logging too expensive to leave enabled — so the steady-state cost is
+// a lock and a few stores per event, with memory bounded by the capacity.
+class NetLogRingBufferObserver : public net::NetLog::ThreadSafeObserver {
+ public:
+  explicit NetLogRingBufferObserver(size_t capacity) : records_(capacity) {}
+  ~NetLogRingBufferObserver() override {}
+
+  // net::NetLog::ThreadSafeObserver:
+  void OnAddEntry(const net::NetLogEntry& entry) override {
+    base::AutoLock lock(lock_);
+    Record& record = records_[next_index_];
+    record.type = static_cast<uint32_t>(entry.type());
+    record.source_id = entry.source().id;
+    record.source_type = static_cast<uint32_t>(entry.source().type);
+    record.phase = static_cast<uint32_t>(entry.phase());
+    record.time_ms = (base::TimeTicks::Now() - base::TimeTicks()).InMilliseconds();
+    next_index_ = (next_index_ + 1) % records_.size();
+    if (stored_ < records_.size())
+      ++stored_;
+  }
+
+  // Serializes the buffered events, oldest first, in the NetLog JSON layout
+  // so the usual viewers can load the dump.
+  std::string SerializeToJSON() const {
+    std::vector<Record> snapshot;
+    {
+      base::AutoLock lock(lock_);
+      snapshot.reserve(stored_);
+      size_t start = (next_index_ + records_.size() - stored_) % records_.size();
+      for (size_t i = 0; i < stored_; ++i)
+        snapshot.push_back(records_[(start + i) % records_.size()]);
+    }
+
+    std::string constants_json;
+    base::JSONWriter::Write(*GetConstants(), &constants_json);
+
+    std::string json = "{\"constants\":" + constants_json + ",\"events\":[";
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+      const Record& record = snapshot[i];
+      if (i > 0)
+        json.push_back(',');
+      base::StringAppendF(
+          &json,
+          "{\"type\":%u,\"source\":{\"id\":%u,\"type\":%u},"
+          "\"phase\":%u,\"time\":\"%" PRId64 "\"}",
+          record.type, record.source_id, record.source_type, record.phase,
+          record.time_ms);
+    }
+    json.append("]}");
+    return json;
+  }
+
+ private:
+  struct Record {
+    uint32_t type;
+    uint32_t source_id;
+    uint32_t source_type;
+    uint32_t phase;
+    int64_t time_ms;
+  };
+
+  mutable base::Lock lock_;
+  std::vector<Record> records_;
+  size_t next_index_ = 0;
+  size_t stored_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(NetLogRingBufferObserver);
+};
+
 NetLog::NetLog() {}
 
 NetLog::~NetLog() {
+  StopRingBufferLogging();
   StopDynamicLogging();
   StopLogging();
 }
@@ -100,4 +192,42 @@ void NetLog::StopDynamicLogging(base::OnceClosure callback) {
   dynamic_file_net_log_path_ = base::FilePath();
 }
 
+void NetLog::StartRingBufferLogging(size_t max_events) {
+  if (ring_buffer_observer_ || max_events == 0)
+    return;
+
+  ring_buffer_observer_.reset(new NetLogRingBufferObserver(max_events));
+  // Parameters are never serialized by the observer, so the capture mode
+  // only gates which events are delivered.
+  AddObserver(ring_buffer_observer_.get(), net::NetLogCaptureMode::Default());
+}
+
+void NetLog::StopRingBufferLogging() {
+  if (!ring_buffer_observer_)
+    return;
+
+  RemoveObserver(ring_buffer_observer_.get());
+  ring_buffer_observer_.reset();
+}
+
+bool NetLog::IsRingBufferLogging() {
+  return !!ring_buffer_observer_;
+}
+
+void NetLog::DumpRingBuffer(const base::FilePath& path,
+                            base::OnceCallback<void(bool)> callback) {
+  if (!ring_buffer_observer_ || path.empty()) {
+    RunDumpCallback(std::move(callback), false);
+    return;
+  }
+
+  // Serialization only snapshots the ring under its lock; the file write is
+  // pushed to a blocking task runner.
+  base::PostTaskWithTraitsAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::BACKGROUND},
+      base::BindOnce(&WriteRingBufferDump, path,
+                     ring_buffer_observer_->SerializeToJSON()),
+      base::BindOnce(&RunDumpCallback, std::move(callback)));
+}
+
 }  // namespace brightray
@@ -15,6 +15,8 @@ class FileNetLogObserver;
 
 namespace brightray {
 
+class NetLogRingBufferObserver;
+
 class NetLog : public net::NetLog {
  public:
   NetLog();
@@ -28,12 +30,27 @@ class NetLog : public net::NetLog {
   base::FilePath GetDynamicLoggingPath();
   void StopDynamicLogging(base::OnceClosure callback = base::OnceClosure());
 
+  // Bounded in-memory capture of recent events, cheap enough to leave
+  // enabled in production: only the integral entry fields are recorded into
+  // a fixed ring of |max_events| binary records, never the parameters whose
+  // serialization makes file logging expensive.
+  void StartRingBufferLogging(size_t max_events);
+  void StopRingBufferLogging();
+  bool IsRingBufferLogging();
+
+  // Asynchronously writes the buffered events as a JSON file at |path| and
+  // runs |callback| with whether the write succeeded.
+  void DumpRingBuffer(const base::FilePath& path,
+                      base::OnceCallback<void(bool)> callback);
+
  private:
   // This observer handles writing NetLogs.
   std::unique_ptr<net::FileNetLogObserver> file_net_log_observer_;
   std::unique_ptr<net::FileNetLogObserver> dynamic_file_net_log_observer_;
   base::FilePath dynamic_file_net_log_path_;
 
+  std::unique_ptr<NetLogRingBufferObserver> ring_buffer_observer_;
+
   DISALLOW_COPY_AND_ASSIGN(NetLog);
 };
 
@@ -39,6 +39,7 @@
 #include "net/proxy_resolution/proxy_config.h"
 #include "net/proxy_resolution/proxy_config_service.h"
 #include "net/proxy_resolution/proxy_service.h"
+#include "net/socket/client_socket_pool_manager.h"
 #include "net/ssl/channel_id_service.h"
 #include "net/ssl/default_channel_id_store.h"
 #include "net/ssl/ssl_config_service_defaults.h"
@@ -341,6 +342,27 @@ net::URLRequestContext* URLRequestContextGetter::GetURLRequestContext() {
     // Give |storage_| ownership at the end in case it's |mapped_host_resolver|.
     storage_->set_host_resolver(std::move(host_resolver));
 
+    // Socket pool limits are captured by the pools the session creates
+    // below, so setting them here scopes them to this context.
+    int max_sockets_per_host = 0;
+    int max_sockets_per_proxy = 0;
+    int max_sockets_total = 0;
+    delegate_->GetSocketPoolLimits(&max_sockets_per_host,
+                                   &max_sockets_per_proxy,
+                                   &max_sockets_total);
+    if (max_sockets_per_host > 0) {
+      net::ClientSocketPoolManager::set_max_sockets_per_group(
+          net::HttpNetworkSession::NORMAL_SOCKET_POOL, max_sockets_per_host);
+    }
+    if (max_sockets_per_proxy > 0) {
+      net::ClientSocketPoolManager::set_max_sockets_per_proxy_server(
+          net::HttpNetworkSession::NORMAL_SOCKET_POOL, max_sockets_per_proxy);
+    }
+    if (max_sockets_total > 0) {
+      net::ClientSocketPoolManager::set_max_sockets_per_pool(
+          net::HttpNetworkSession::NORMAL_SOCKET_POOL, max_sockets_total);
+    }
+
     net::HttpNetworkSession::Context network_session_context;
     net::URLRequestContextBuilder::SetHttpNetworkSessionComponents(
         url_request_context_.get(), &network_session_context);
@@ -61,6 +61,13 @@ class URLRequestContextGetter : public net::URLRequestContextGetter {
     virtual void NotifyCookieChange(const net::CanonicalCookie& cookie,
                                     bool removed,
                                     net::CookieChangeCause cause) {}
+    // Socket pool limits for this context's HttpNetworkSession; leave a
+    // value at 0 to keep the stock limit. The pools capture the limits
+    // when the session is created, so they apply per context even
+    // though the underlying setters are static.
+    virtual void GetSocketPoolLimits(int* max_sockets_per_host,
+                                     int* max_sockets_per_proxy,
+                                     int* max_sockets_total) {}
   };
 
   URLRequestContextGetter(
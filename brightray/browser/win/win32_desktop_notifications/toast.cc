@@ -444,6 +444,8 @@ void DesktopNotificationController::Toast::Draw() {
     ExtTextOut(hdc_, close_pos.x, close_pos.y, 0, nullptr, &close, 1, nullptr);
   }
 
+  drawn_highlighted_ = is_highlighted_;
+  drawn_close_hot_ = is_close_hot_;
   is_content_updated_ = true;
 }
 
@@ -452,10 +454,20 @@ void DesktopNotificationController::Toast::Invalidate() {
 }
 
 bool DesktopNotificationController::Toast::IsRedrawNeeded() const {
-  return !is_content_updated_;
+  // The surface must be recomposed when the content was invalidated or when
+  // the highlight state it was drawn with no longer matches.
+  return !is_content_updated_ || drawn_highlighted_ != is_highlighted_ ||
+         drawn_close_hot_ != is_close_hot_;
 }
 
 void DesktopNotificationController::Toast::UpdateBufferSize() {
+  // The layout only depends on the notification content and system fonts,
+  // both of which invalidate it through ResetContents(). Animation ticks
+  // reuse the cached result instead of re-measuring text and re-scaling the
+  // image every frame.
+  if (is_layout_valid_)
+    return;
+
   if (hdc_) {
     SIZE new_size;
     {
@@ -519,6 +531,8 @@ void DesktopNotificationController::Toast::UpdateBufferSize() {
       }
     }
 
+    is_layout_valid_ = true;
+
     if (new_size.cx != this->toast_size_.cx ||
         new_size.cy != this->toast_size_.cy) {
       HDC hdc_screen = GetDC(NULL);
@@ -586,6 +600,11 @@ void DesktopNotificationController::Toast::UpdateScaledImage(const SIZE& size) {
 }
 
 void DesktopNotificationController::Toast::UpdateContents() {
+  // Mouse tracking calls this on every move; only recompose and push the
+  // surface when its appearance actually changed.
+  if (!IsRedrawNeeded())
+    return;
+
   Draw();
 
   if (IsWindowVisible(hwnd_)) {
@@ -634,6 +653,7 @@ void DesktopNotificationController::Toast::ResetContents() {
     scaled_image_ = NULL;
   }
 
+  is_layout_valid_ = false;
   Invalidate();
 }
 
@@ -83,8 +83,16 @@ class DesktopNotificationController::Toast {
   bool ease_in_active_ = false;
   bool ease_out_active_ = false;
   bool is_content_updated_ = false;
+  // True while the computed layout (margins, toast size, scaled image) still
+  // matches the notification content, so animation ticks can skip the GDI
+  // text-metric and image-scaling work entirely.
+  bool is_layout_valid_ = false;
   bool is_highlighted_ = false;
   bool is_close_hot_ = false;
+  // State the cached surface was last composed with. Mouse tracking and
+  // animation reuse the bitmap as long as these still match.
+  bool drawn_highlighted_ = false;
+  bool drawn_close_hot_ = false;
   DWORD ease_in_start_, ease_out_start_, stack_collapse_start_;
   float ease_in_pos_ = 0, ease_out_pos_ = 0, stack_collapse_pos_ = 0;
 };
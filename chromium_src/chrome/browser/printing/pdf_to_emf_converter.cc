@@ -155,18 +155,28 @@ class PostScriptMetaFile : public LazyEmf {
 class PdfConverterUtilityProcessHostClient
     : public content::UtilityProcessHostClient {
  public:
-  PdfConverterUtilityProcessHostClient(
-      base::WeakPtr<PdfConverterImpl> converter,
-      const PdfRenderSettings& settings);
-
-  void Start(const scoped_refptr<base::RefCountedMemory>& data,
+  PdfConverterUtilityProcessHostClient();
+
+  // Starts conversion of a document. May be called again on a client whose
+  // previous document finished cleanly; the warm utility process is then
+  // reused, skipping the process launch.
+  void Start(base::WeakPtr<PdfConverterImpl> converter,
+             const PdfRenderSettings& settings,
+             const scoped_refptr<base::RefCountedMemory>& data,
              const PdfConverter::StartCallback& start_callback);
 
   void GetPage(int page_number,
                const PdfConverter::GetPageCallback& get_page_callback);
 
+  void GetPages(const std::vector<int>& page_numbers,
+                const PdfConverter::GetPageCallback& get_page_callback);
+
   void Stop();
 
+  // Set on the UI thread before the first document starts; true for the one
+  // client whose utility process is kept warm between documents.
+  void set_reusable(bool reusable) { reusable_ = reusable; }
+
   // UtilityProcessHostClient implementation.
   void OnProcessCrashed(int exit_code) override;
   void OnProcessLaunchFailed(int exit_code) override;
@@ -228,6 +238,8 @@ class PdfConverterUtilityProcessHostClient
   void OnTempPdfReady(ScopedTempFile pdf);
   void OnTempFileReady(GetPageCallbackData* callback_data,
                        ScopedTempFile temp_file);
+  void OnTempFilesReady(const std::vector<GetPageCallbackData*>& callback_datas,
+                        std::vector<ScopedTempFile> temp_files);
 
   // Additional message handler needed for Pdf to Emf
   void OnPreCacheFontCharacters(const LOGFONT& log_font,
@@ -251,6 +263,9 @@ class PdfConverterUtilityProcessHostClient
   using GetPageCallbacks = std::queue<GetPageCallbackData>;
   GetPageCallbacks get_page_callbacks_;
 
+  // Whether this client's utility process is kept warm between documents.
+  bool reusable_ = false;
+
   const scoped_refptr<base::SequencedTaskRunner> blocking_task_runner_;
 
   DISALLOW_COPY_AND_ASSIGN(PdfConverterUtilityProcessHostClient);
@@ -277,19 +292,19 @@ class PdfConverterImpl : public PdfConverter {
     return weak_ptr_factory_.GetWeakPtr();
   }
 
-  void Start(const scoped_refptr<base::RefCountedMemory>& data,
-             const PdfRenderSettings& conversion_settings,
-             const StartCallback& start_callback);
-
   void GetPage(int page_number,
                const GetPageCallback& get_page_callback) override;
 
+  void GetPages(const std::vector<int>& page_numbers,
+                const GetPageCallback& get_page_callback) override;
+
   // Helps to cancel callbacks if this object is destroyed.
   void RunCallback(const base::Closure& callback);
 
   void Start(
       const scoped_refptr<PdfConverterUtilityProcessHostClient>& utility_client,
       const scoped_refptr<base::RefCountedMemory>& data,
+      const PdfRenderSettings& conversion_settings,
       const StartCallback& start_callback);
 
  private:
@@ -300,6 +315,28 @@ class PdfConverterImpl : public PdfConverter {
   DISALLOW_COPY_AND_ASSIGN(PdfConverterImpl);
 };
 
+// The client whose utility process is kept warm for the session, so that
+// consecutive documents skip the process launch. UI thread only.
+PdfConverterUtilityProcessHostClient* g_warm_utility_client = nullptr;
+bool g_warm_utility_client_idle = false;
+
+void MarkWarmClientIdle(
+    const scoped_refptr<PdfConverterUtilityProcessHostClient>& client) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  if (g_warm_utility_client == client.get())
+    g_warm_utility_client_idle = true;
+}
+
+void DropWarmClient(
+    const scoped_refptr<PdfConverterUtilityProcessHostClient>& client) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  if (g_warm_utility_client == client.get()) {
+    g_warm_utility_client->Release();
+    g_warm_utility_client = nullptr;
+    g_warm_utility_client_idle = false;
+  }
+}
+
 ScopedTempFile CreateTempFile(scoped_refptr<RefCountedTempDir>* temp_dir) {
   if (!temp_dir->get())
     *temp_dir = base::MakeRefCounted<RefCountedTempDir>();
@@ -323,6 +360,15 @@ ScopedTempFile CreateTempFile(scoped_refptr<RefCountedTempDir>* temp_dir) {
   return file;
 }
 
+std::vector<ScopedTempFile> CreateTempFiles(
+    size_t count,
+    scoped_refptr<RefCountedTempDir>* temp_dir) {
+  std::vector<ScopedTempFile> files;
+  for (size_t i = 0; i < count; ++i)
+    files.push_back(CreateTempFile(temp_dir));
+  return files;
+}
+
 ScopedTempFile CreateTempPdfFile(
     const scoped_refptr<base::RefCountedMemory>& data,
     scoped_refptr<RefCountedTempDir>* temp_dir) {
@@ -407,38 +453,43 @@ bool PostScriptMetaFile::SafePlayback(HDC hdc) const {
   return true;
 }
 
-PdfConverterUtilityProcessHostClient::PdfConverterUtilityProcessHostClient(
-    base::WeakPtr<PdfConverterImpl> converter,
-    const PdfRenderSettings& settings)
-    : converter_(converter),
-      settings_(settings),
-      blocking_task_runner_(base::CreateSequencedTaskRunnerWithTraits(
+PdfConverterUtilityProcessHostClient::PdfConverterUtilityProcessHostClient()
+    : blocking_task_runner_(base::CreateSequencedTaskRunnerWithTraits(
           {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {}
 
 PdfConverterUtilityProcessHostClient::~PdfConverterUtilityProcessHostClient() {}
 
 void PdfConverterUtilityProcessHostClient::Start(
+    base::WeakPtr<PdfConverterImpl> converter,
+    const PdfRenderSettings& settings,
     const scoped_refptr<base::RefCountedMemory>& data,
     const PdfConverter::StartCallback& start_callback) {
   if (!BrowserThread::CurrentlyOn(BrowserThread::IO)) {
     BrowserThread::PostTask(
         BrowserThread::IO, FROM_HERE,
-        base::Bind(&PdfConverterUtilityProcessHostClient::Start, this, data,
-                   start_callback));
+        base::Bind(&PdfConverterUtilityProcessHostClient::Start, this,
+                   converter, settings, data, start_callback));
     return;
   }
 
+  converter_ = converter;
+  settings_ = settings;
+
   // Store callback before any OnFailed() call to make it called on failure.
   start_callback_ = start_callback;
 
-  // NOTE: This process _must_ be sandboxed, otherwise the pdf dll will load
-  // gdiplus.dll, change how rendering happens, and not be able to correctly
-  // generate when sent to a metafile DC.
-  utility_process_host_ = content::UtilityProcessHost::Create(
-                              this, base::ThreadTaskRunnerHandle::Get())
-                              ->AsWeakPtr();
-  utility_process_host_->SetName(GetName());
+  // A client that already converted a document still has its utility process
+  // alive; reuse it and skip the launch.
+  if (!utility_process_host_) {
+    // NOTE: This process _must_ be sandboxed, otherwise the pdf dll will load
+    // gdiplus.dll, change how rendering happens, and not be able to correctly
+    // generate when sent to a metafile DC.
+    utility_process_host_ = content::UtilityProcessHost::Create(
+                                this, base::ThreadTaskRunnerHandle::Get())
+                                ->AsWeakPtr();
+    utility_process_host_->SetName(GetName());
+  }
 
   base::PostTaskAndReplyWithResult(
       blocking_task_runner_.get(), FROM_HERE,
@@ -489,6 +540,35 @@ void PdfConverterUtilityProcessHostClient::GetPage(
                  &get_page_callbacks_.back()));
 }
 
+void PdfConverterUtilityProcessHostClient::GetPages(
+    const std::vector<int>& page_numbers,
+    const PdfConverter::GetPageCallback& get_page_callback) {
+  if (!BrowserThread::CurrentlyOn(BrowserThread::IO)) {
+    BrowserThread::PostTask(
+        BrowserThread::IO, FROM_HERE,
+        base::Bind(&PdfConverterUtilityProcessHostClient::GetPages, this,
+                   page_numbers, get_page_callback));
+    return;
+  }
+
+  // Store callbacks before any OnFailed() call to make them called on failure.
+  std::vector<GetPageCallbackData*> callback_datas;
+  for (int page_number : page_numbers) {
+    get_page_callbacks_.push(
+        GetPageCallbackData(page_number, get_page_callback));
+    callback_datas.push_back(&get_page_callbacks_.back());
+  }
+
+  if (!utility_process_host_)
+    return OnFailed();
+
+  base::PostTaskAndReplyWithResult(
+      blocking_task_runner_.get(), FROM_HERE,
+      base::Bind(&CreateTempFiles, callback_datas.size(), &temp_dir_),
+      base::Bind(&PdfConverterUtilityProcessHostClient::OnTempFilesReady, this,
+                 callback_datas));
+}
+
 void PdfConverterUtilityProcessHostClient::OnTempFileReady(
     GetPageCallbackData* callback_data,
     ScopedTempFile temp_file) {
@@ -502,6 +582,27 @@ void PdfConverterUtilityProcessHostClient::OnTempFileReady(
   SendGetPageMessage(callback_data->page_number(), transit);
 }
 
+void PdfConverterUtilityProcessHostClient::OnTempFilesReady(
+    const std::vector<GetPageCallbackData*>& callback_datas,
+    std::vector<ScopedTempFile> temp_files) {
+  DCHECK_CURRENTLY_ON(BrowserThread::IO);
+  if (!utility_process_host_ || temp_files.size() != callback_datas.size())
+    return OnFailed();
+  std::vector<int> page_numbers;
+  std::vector<IPC::PlatformFileForTransit> transits;
+  for (size_t i = 0; i < temp_files.size(); ++i) {
+    if (!temp_files[i])
+      return OnFailed();
+    page_numbers.push_back(callback_datas[i]->page_number());
+    transits.push_back(IPC::GetPlatformFileForTransit(
+        temp_files[i]->file().GetPlatformFile(), false));
+    callback_datas[i]->set_file(std::move(temp_files[i]));
+  }
+  // Should reply with one OnPageDone() per page, in order.
+  Send(new ChromeUtilityMsg_RenderPDFPagesToMetafiles_GetPages(page_numbers,
+                                                               transits));
+}
+
 void PdfConverterUtilityProcessHostClient::OnPageDone(bool success,
                                                       float scale_factor) {
   DCHECK_CURRENTLY_ON(BrowserThread::IO);
@@ -532,7 +633,25 @@ void PdfConverterUtilityProcessHostClient::Stop() {
         base::Bind(&PdfConverterUtilityProcessHostClient::Stop, this));
     return;
   }
+  // Keep the process warm for the next document when this is the session's
+  // reusable client and the document finished cleanly. If callbacks are still
+  // pending the document was abandoned mid-conversion and the process may yet
+  // reply for it, so retire it instead of risking replies being attributed to
+  // the next document.
+  if (reusable_ && utility_process_host_ && start_callback_.is_null() &&
+      get_page_callbacks_.empty()) {
+    converter_ = base::WeakPtr<PdfConverterImpl>();
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::Bind(&MarkWarmClientIdle, base::RetainedRef(this)));
+    return;
+  }
   SendStopMessage();
+  if (reusable_) {
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::Bind(&DropWarmClient, base::RetainedRef(this)));
+  }
 }
 
 void PdfConverterUtilityProcessHostClient::OnProcessCrashed(int exit_code) {
@@ -558,6 +677,11 @@ void PdfConverterUtilityProcessHostClient::OnFailed() {
   while (!get_page_callbacks_.empty())
     OnPageDone(false, 0.0f);
   utility_process_host_.reset();
+  if (reusable_) {
+    BrowserThread::PostTask(
+        BrowserThread::UI, FROM_HERE,
+        base::Bind(&DropWarmClient, base::RetainedRef(this)));
+  }
 }
 
 void PdfConverterUtilityProcessHostClient::OnPreCacheFontCharacters(
@@ -638,10 +762,12 @@ PdfConverterImpl::~PdfConverterImpl() {
 void PdfConverterImpl::Start(
     const scoped_refptr<PdfConverterUtilityProcessHostClient>& utility_client,
     const scoped_refptr<base::RefCountedMemory>& data,
+    const PdfRenderSettings& conversion_settings,
     const StartCallback& start_callback) {
   DCHECK(!utility_client_);
   utility_client_ = utility_client;
-  utility_client_->Start(data, start_callback);
+  utility_client_->Start(GetWeakPtr(), conversion_settings, data,
+                         start_callback);
 }
 
 void PdfConverterImpl::GetPage(int page_number,
@@ -649,6 +775,11 @@ void PdfConverterImpl::GetPage(int page_number,
   utility_client_->GetPage(page_number, get_page_callback);
 }
 
+void PdfConverterImpl::GetPages(const std::vector<int>& page_numbers,
+                                const GetPageCallback& get_page_callback) {
+  utility_client_->GetPages(page_numbers, get_page_callback);
+}
+
 void PdfConverterImpl::RunCallback(const base::Closure& callback) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
   callback.Run();
@@ -663,11 +794,24 @@ std::unique_ptr<PdfConverter> PdfConverter::StartPdfConverter(
     const scoped_refptr<base::RefCountedMemory>& data,
     const PdfRenderSettings& conversion_settings,
     const StartCallback& start_callback) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
   std::unique_ptr<PdfConverterImpl> converter =
       std::make_unique<PdfConverterImpl>();
-  converter->Start(new PdfConverterUtilityProcessHostClient(
-                       converter->GetWeakPtr(), conversion_settings),
-                   data, start_callback);
+  scoped_refptr<PdfConverterUtilityProcessHostClient> utility_client;
+  if (g_warm_utility_client && g_warm_utility_client_idle) {
+    utility_client = g_warm_utility_client;
+    g_warm_utility_client_idle = false;
+  } else {
+    utility_client = new PdfConverterUtilityProcessHostClient();
+    if (!g_warm_utility_client) {
+      // The first client of the session becomes the reusable one; its utility
+      // process stays warm between documents.
+      utility_client->set_reusable(true);
+      utility_client->AddRef();
+      g_warm_utility_client = utility_client.get();
+    }
+  }
+  converter->Start(utility_client, data, conversion_settings, start_callback);
   return std::move(converter);
 }
 
@@ -6,6 +6,7 @@
 #define CHROME_BROWSER_PRINTING_PDF_TO_EMF_CONVERTER_H_
 
 #include <memory>
+#include <vector>
 
 #include "base/callback.h"
 #include "base/memory/ref_counted_memory.h"
@@ -37,6 +38,11 @@ class PdfConverter {
   // if conversion succeeded.
   virtual void GetPage(int page_number,
                        const GetPageCallback& get_page_callback) = 0;
+
+  // Same as GetPage() for a batch of pages sent to the utility process in a
+  // single request. |get_page_callback| is called once per page, in order.
+  virtual void GetPages(const std::vector<int>& page_numbers,
+                        const GetPageCallback& get_page_callback) = 0;
 };
 }  // namespace printing
 
@@ -222,11 +222,15 @@ class PrintJob::PdfConversionState {
 
   void GetMorePages(const PdfConverter::GetPageCallback& get_page_callback) {
     const int kMaxNumberOfTempFilesPerDocument = 3;
+    std::vector<int> page_numbers;
     while (pages_in_progress_ < kMaxNumberOfTempFilesPerDocument &&
            current_page_ < page_count_) {
       ++pages_in_progress_;
-      converter_->GetPage(current_page_++, get_page_callback);
+      page_numbers.push_back(current_page_++);
     }
+    // Request the whole window in one batch to save IPC round trips.
+    if (!page_numbers.empty())
+      converter_->GetPages(page_numbers, get_page_callback);
   }
 
   void OnPageProcessed(const PdfConverter::GetPageCallback& get_page_callback) {
@@ -298,6 +302,16 @@ void PrintJob::OnPdfPageConverted(int page_number,
                      scale_factor, pdf_conversion_state_->page_size(),
                      pdf_conversion_state_->content_area());
 
+  // Nudge the worker right away so spooling of this page overlaps the
+  // conversion of the next one. Without this the worker only discovers new
+  // pages through its 500ms poll and the printer sits idle in between.
+  if (worker_ && is_job_pending_) {
+    worker_->PostTask(FROM_HERE,
+                      base::Bind(&HoldRefCallback, WrapRefCounted(this),
+                                 base::Bind(&PrintJobWorker::OnNewPage,
+                                            base::Unretained(worker_.get()))));
+  }
+
   pdf_conversion_state_->GetMorePages(
       base::Bind(&PrintJob::OnPdfPageConverted, this));
 }
@@ -4,8 +4,13 @@
 
 #include "chrome/browser/printing/print_preview_message_handler.h"
 
+#include <algorithm>
+
 #include "base/bind.h"
+#include "base/files/file.h"
 #include "base/memory/shared_memory.h"
+#include "base/task_scheduler/post_task.h"
+#include "base/threading/thread_restrictions.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/printing/print_job_manager.h"
 #include "chrome/browser/printing/printer_query.h"
@@ -57,6 +62,36 @@ void FreeNodeBufferData(char* data, void* hint) {
   delete[] data;
 }
 
+// Writes the PDF straight from the renderer's shared memory to |path|. The
+// document is never copied into browser or JS heap, so peak memory stays
+// independent of the document size.
+bool SavePDFOnBlockingTaskRunner(
+    const PrintHostMsg_DidPreviewDocument_Params& params,
+    const base::FilePath& path) {
+  base::AssertBlockingAllowed();
+  std::unique_ptr<base::SharedMemory> shared_buf(
+      new base::SharedMemory(params.metafile_data_handle, true));
+  if (!shared_buf->Map(params.data_size))
+    return false;
+  base::File file(path,
+                  base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+  if (!file.IsValid()) {
+    PLOG(ERROR) << "Failed to create " << path.value();
+    return false;
+  }
+  const char* data = static_cast<const char*>(shared_buf->memory());
+  uint32_t written = 0;
+  while (written < params.data_size) {
+    int chunk_size = static_cast<int>(
+        std::min<uint32_t>(params.data_size - written, 1 << 23));
+    int result = file.WriteAtCurrentPos(data + written, chunk_size);
+    if (result <= 0)
+      return false;
+    written += result;
+  }
+  return true;
+}
+
 }  // namespace
 
 namespace printing {
@@ -79,6 +114,18 @@ void PrintPreviewMessageHandler::OnMetafileReadyForPrinting(
     return;
   }
 
+  auto path_iter = print_to_pdf_path_map_.find(params.preview_request_id);
+  if (path_iter != print_to_pdf_path_map_.end()) {
+    base::FilePath path = path_iter->second;
+    print_to_pdf_path_map_.erase(path_iter);
+    base::PostTaskWithTraitsAndReplyWithResult(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+        base::Bind(&SavePDFOnBlockingTaskRunner, params, path),
+        base::Bind(&PrintPreviewMessageHandler::RunSavePDFCallback,
+                   base::Unretained(this), params.preview_request_id));
+    return;
+  }
+
   BrowserThread::PostTaskAndReplyWithResult(
       BrowserThread::IO, FROM_HERE, base::Bind(&CopyPDFDataOnIOThread, params),
       base::Bind(&PrintPreviewMessageHandler::RunPrintToPDFCallback,
@@ -89,6 +136,7 @@ void PrintPreviewMessageHandler::OnMetafileReadyForPrinting(
 void PrintPreviewMessageHandler::OnPrintPreviewFailed(int document_cookie,
                                                       int request_id) {
   StopWorker(document_cookie);
+  print_to_pdf_path_map_.erase(request_id);
   RunPrintToPDFCallback(request_id, 0, nullptr);
 }
 
@@ -112,6 +160,10 @@ void PrintPreviewMessageHandler::PrintToPDF(
   options.GetInteger(printing::kPreviewRequestID, &request_id);
   print_to_pdf_callback_map_[request_id] = callback;
 
+  std::string path;
+  if (options.GetString("path", &path) && !path.empty())
+    print_to_pdf_path_map_[request_id] = base::FilePath::FromUTF8Unsafe(path);
+
   content::RenderFrameHost* rfh = web_contents()->GetMainFrame();
   rfh->Send(new PrintMsg_PrintPreview(rfh->GetRoutingID(), options));
 }
@@ -139,4 +191,23 @@ void PrintPreviewMessageHandler::RunPrintToPDFCallback(int request_id,
   print_to_pdf_callback_map_.erase(request_id);
 }
 
+void PrintPreviewMessageHandler::RunSavePDFCallback(int request_id,
+                                                    bool success) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  v8::Isolate* isolate = v8::Isolate::GetCurrent();
+  v8::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  if (success) {
+    print_to_pdf_callback_map_[request_id].Run(v8::Null(isolate),
+                                               v8::Null(isolate));
+  } else {
+    v8::Local<v8::String> error_message =
+        v8::String::NewFromUtf8(isolate, "Failed to save PDF");
+    print_to_pdf_callback_map_[request_id].Run(
+        v8::Exception::Error(error_message), v8::Null(isolate));
+  }
+  print_to_pdf_callback_map_.erase(request_id);
+}
+
 }  // namespace printing
@@ -9,6 +9,7 @@
 
 #include "atom/browser/api/atom_api_web_contents.h"
 #include "base/compiler_specific.h"
+#include "base/files/file_path.h"
 #include "content/public/browser/web_contents_observer.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -49,9 +50,14 @@ class PrintPreviewMessageHandler
   void OnPrintPreviewFailed(int document_cookie, int request_id);
 
   void RunPrintToPDFCallback(int request_id, uint32_t data_size, char* data);
+  void RunSavePDFCallback(int request_id, bool success);
 
   PrintToPDFCallbackMap print_to_pdf_callback_map_;
 
+  // Target files for requests that write the PDF straight to disk instead of
+  // returning a buffer. Keyed by request id.
+  std::map<int, base::FilePath> print_to_pdf_path_map_;
+
   DISALLOW_COPY_AND_ASSIGN(PrintPreviewMessageHandler);
 };
 
@@ -246,9 +246,15 @@ void PrintViewManagerBase::OnNotifyPrintJobEvent(
       ShouldQuitFromInnerMessageLoop();
       break;
     }
+    case JobEventDetails::PAGE_DONE: {
+#if defined(OS_WIN)
+      if (!page_callback.is_null())
+        page_callback.Run(event_details.page()->page_number(), number_pages_);
+#endif
+      break;
+    }
     case JobEventDetails::NEW_DOC:
     case JobEventDetails::NEW_PAGE:
-    case JobEventDetails::PAGE_DONE:
     case JobEventDetails::DOC_DONE: {
       // Don't care about the actual printing process.
       break;
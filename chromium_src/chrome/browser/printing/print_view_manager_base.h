@@ -51,6 +51,12 @@ class PrintViewManagerBase : public content::NotificationObserver,
 
   void SetCallback(const base::Callback<void(bool)>& cb) { callback = cb; };
 
+  // Called once per spooled page with the 1-based page number and the total
+  // page count. Only fired on Windows, where the job is spooled page by page.
+  void SetPageCallback(const base::Callback<void(int, int)>& cb) {
+    page_callback = cb;
+  };
+
  protected:
   explicit PrintViewManagerBase(content::WebContents* web_contents);
 
@@ -163,6 +169,8 @@ class PrintViewManagerBase : public content::NotificationObserver,
 
   base::Callback<void(bool)> callback;
 
+  base::Callback<void(int, int)> page_callback;
+
   DISALLOW_COPY_AND_ASSIGN(PrintViewManagerBase);
 };
 
@@ -19,6 +19,7 @@
 #include "base/memory/ref_counted.h"
 #include "base/process/process.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
 #include "ui/gfx/native_widget_types.h"
 
 #if defined(OS_POSIX) && !defined(OS_ANDROID)
@@ -88,6 +89,13 @@ class ProcessSingleton {
   // Clear any lock state during shutdown.
   void Cleanup();
 
+  // Wall-clock duration of the last NotifyOtherProcessOrCreate() call that
+  // reached a verdict. Lets embedders verify how long handing a command line
+  // off to an already-running instance took.
+  base::TimeDelta last_notify_duration() const {
+    return last_notify_duration_;
+  }
+
 #if defined(OS_POSIX) && !defined(OS_ANDROID)
   static void DisablePromptForTesting();
 #endif
@@ -126,6 +134,9 @@ class ProcessSingleton {
  private:
   NotificationCallback notification_callback_;  // Handler for notifications.
 
+  // See last_notify_duration().
+  base::TimeDelta last_notify_duration_;
+
 #if defined(OS_WIN)
   HWND remote_window_;               // The HWND_MESSAGE of another browser.
   base::win::MessageWindow window_;  // The message-only window.
@@ -134,6 +145,12 @@ class ProcessSingleton {
   base::FilePath user_data_dir_;
   ShouldKillRemoteProcessCallback should_kill_remote_process_callback_;
 #elif defined(OS_POSIX) && !defined(OS_ANDROID)
+  // One-shot handshake with a healthy running instance: single connect,
+  // vectored write of the command line and working directory, short wait for
+  // the ACK. Returns PROCESS_NONE when the caller should fall back to the
+  // retrying path.
+  NotifyResult FastNotifyOtherProcess(const base::TimeDelta& ack_timeout);
+
   // Start listening to the socket.
   void StartListening(int sock);
 
@@ -247,12 +247,14 @@ ProcessSingleton::NotifyResult ProcessSingleton::NotifyOtherProcess() {
 }
 
 ProcessSingleton::NotifyResult ProcessSingleton::NotifyOtherProcessOrCreate() {
+  const base::TimeTicks begin_ticks = base::TimeTicks::Now();
   ProcessSingleton::NotifyResult result = PROCESS_NONE;
   if (!Create()) {
     result = NotifyOtherProcess();
     if (result == PROCESS_NONE)
       result = PROFILE_IN_USE;
   }
+  last_notify_duration_ = base::TimeTicks::Now() - begin_ticks;
   return result;
 }
 
@@ -105,6 +105,12 @@ IPC_MESSAGE_CONTROL2(ChromeUtilityMsg_RenderPDFPagesToMetafiles_GetPage,
                      int /* page_number */,
                      IPC::PlatformFileForTransit /* output_file */)
 
+// Requests conversion of a batch of pages in one round trip. The utility
+// process replies with one ..._PageDone message per page, in the given order.
+IPC_MESSAGE_CONTROL2(ChromeUtilityMsg_RenderPDFPagesToMetafiles_GetPages,
+                     std::vector<int> /* page_numbers */,
+                     std::vector<IPC::PlatformFileForTransit> /* output_files */)
+
 // Requests utility process to stop conversion and exit.
 IPC_MESSAGE_CONTROL0(ChromeUtilityMsg_RenderPDFPagesToMetafiles_Stop)
 
@@ -17,6 +17,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "chrome/common/print_messages.h"
 #include "content/public/common/web_preferences.h"
 #include "content/public/renderer/render_frame.h"
@@ -54,6 +55,10 @@ namespace {
 
 const double kMinDpi = 1.0;
 
+// Maximum amount of time a single preview rendering slice may occupy the
+// renderer main thread before yielding back to the message loop.
+const int kMaxPreviewSliceMs = 50;
+
 int GetDPI(const PrintMsg_Print_Params* print_params) {
 #if defined(OS_MACOSX)
   // On the Mac, the printable area is in points, don't do any scaling based
@@ -602,6 +607,7 @@ PrintWebViewHelper::PrintWebViewHelper(content::RenderFrame* render_frame)
       is_loading_(false),
       is_scripted_preview_delayed_(false),
       ipc_nesting_level_(0),
+      preview_generation_(0),
       weak_ptr_factory_(this) {}
 
 PrintWebViewHelper::~PrintWebViewHelper() {}
@@ -685,6 +691,11 @@ void PrintWebViewHelper::OnPrintPreview(const base::DictionaryValue& settings) {
 
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
 
+  // A previous preview may still be rendering in slices (or have failed
+  // mid-render); abandon it in favor of the new request.
+  if (print_preview_context_.IsRendering())
+    print_preview_context_.Failed(false);
+
   print_preview_context_.InitWithFrame(frame);
   if (!print_preview_context_.source_frame()) {
     DidFinishPrinting(FAIL_PREVIEW);
@@ -734,14 +745,16 @@ void PrintWebViewHelper::OnFramePreparedForPreviewDocument() {
     PrepareFrameForPreviewDocument();
     return;
   }
-  DidFinishPrinting(CreatePreviewDocument() ? OK : FAIL_PREVIEW);
+  // On success printing finishes asynchronously from the last rendering
+  // slice; see RenderPreviewDocumentSlice().
+  if (!CreatePreviewDocument())
+    DidFinishPrinting(FAIL_PREVIEW);
 }
 
 bool PrintWebViewHelper::CreatePreviewDocument() {
   if (!print_pages_params_)
     return false;
 
-  const PrintMsg_Print_Params& print_params = print_pages_params_->params;
   const std::vector<int>& pages = print_pages_params_->pages;
 
   if (!print_preview_context_.CreatePreviewDocument(prep_frame_view_.release(),
@@ -749,11 +762,31 @@ bool PrintWebViewHelper::CreatePreviewDocument() {
     return false;
   }
 
+  // Rendering happens in slices posted back to the main thread so that a
+  // long document does not block the page for its entire duration.
+  ++preview_generation_;
+  RenderPreviewDocumentSlice(preview_generation_);
+  return true;
+}
+
+void PrintWebViewHelper::RenderPreviewDocumentSlice(int generation) {
+  // A newer preview request may have superseded the one this slice was
+  // posted for.
+  if (generation != preview_generation_ || !print_pages_params_ ||
+      !print_preview_context_.IsRendering()) {
+    return;
+  }
+
+  const PrintMsg_Print_Params& print_params = print_pages_params_->params;
+  base::TimeTicks slice_start = base::TimeTicks::Now();
+
   while (!print_preview_context_.IsFinalPageRendered()) {
     int page_number = print_preview_context_.GetNextPageNumber();
     DCHECK_GE(page_number, 0);
-    if (!RenderPreviewPage(page_number, print_params))
-      return false;
+    if (!RenderPreviewPage(page_number, print_params)) {
+      DidFinishPrinting(FAIL_PREVIEW);
+      return;
+    }
 
     // We must call PrepareFrameAndViewForPrint::FinishPrinting() (by way of
     // print_preview_context_.AllPagesRendered()) before calling
@@ -768,12 +801,25 @@ bool PrintWebViewHelper::CreatePreviewDocument() {
     if (print_preview_context_.IsLastPageOfPrintReadyMetafile()) {
       DCHECK(print_preview_context_.IsModifiable() ||
              print_preview_context_.IsFinalPageRendered());
-      if (!FinalizePrintReadyDocument())
-        return false;
+      if (!FinalizePrintReadyDocument()) {
+        DidFinishPrinting(FAIL_PREVIEW);
+        return;
+      }
+    }
+
+    if (!print_preview_context_.IsFinalPageRendered() &&
+        (base::TimeTicks::Now() - slice_start).InMilliseconds() >
+            kMaxPreviewSliceMs) {
+      // Yield so queued input and script can run, then keep rendering.
+      base::ThreadTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE,
+          base::Bind(&PrintWebViewHelper::RenderPreviewDocumentSlice,
+                     weak_ptr_factory_.GetWeakPtr(), generation));
+      return;
     }
   }
   print_preview_context_.Finished();
-  return true;
+  DidFinishPrinting(OK);
 }
 
 bool PrintWebViewHelper::FinalizePrintReadyDocument() {
@@ -130,9 +130,16 @@ class PrintWebViewHelper
   bool RenderPreviewPage(int page_number,
                          const PrintMsg_Print_Params& print_params);
 
-  // Initialize the print preview document.
+  // Initialize the print preview document and start rendering it in
+  // main-thread slices.
   bool CreatePreviewDocument();
 
+  // Renders preview pages until the slice budget is exhausted, then posts
+  // itself again so long documents do not block the renderer main thread.
+  // |generation| identifies the preview request the slice belongs to; stale
+  // slices from a superseded request are dropped.
+  void RenderPreviewDocumentSlice(int generation);
+
   // Main printing code -------------------------------------------------------
 
   void Print(blink::WebLocalFrame* frame,
@@ -375,6 +382,10 @@ class PrintWebViewHelper
   bool is_scripted_preview_delayed_;
   int ipc_nesting_level_;
 
+  // Incremented for each preview document; lets rendering slices detect that
+  // they belong to an abandoned request.
+  int preview_generation_;
+
   PrintPreviewContext print_preview_context_;
 
   // Used to fix a race condition where the source is a PDF and print preview
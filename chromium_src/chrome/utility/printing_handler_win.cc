@@ -4,6 +4,8 @@
 
 #include "chrome/utility/printing_handler_win.h"
 
+#include <algorithm>
+
 #include "base/files/file_util.h"
 #include "base/lazy_instance.h"
 #include "base/path_service.h"
@@ -51,6 +53,8 @@ bool PrintingHandlerWin::OnMessageReceived(const IPC::Message& message) {
                         OnRenderPDFPagesToMetafile)
     IPC_MESSAGE_HANDLER(ChromeUtilityMsg_RenderPDFPagesToMetafiles_GetPage,
                         OnRenderPDFPagesToMetafileGetPage)
+    IPC_MESSAGE_HANDLER(ChromeUtilityMsg_RenderPDFPagesToMetafiles_GetPages,
+                        OnRenderPDFPagesToMetafileGetPages)
     IPC_MESSAGE_HANDLER(ChromeUtilityMsg_RenderPDFPagesToMetafiles_Stop,
                         OnRenderPDFPagesToMetafileStop)
     IPC_MESSAGE_UNHANDLED(handled = false)
@@ -99,6 +103,14 @@ void PrintingHandlerWin::OnRenderPDFPagesToMetafileGetPage(
       success, scale_factor));
 }
 
+void PrintingHandlerWin::OnRenderPDFPagesToMetafileGetPages(
+    const std::vector<int>& page_numbers,
+    const std::vector<IPC::PlatformFileForTransit>& output_files) {
+  size_t count = std::min(page_numbers.size(), output_files.size());
+  for (size_t i = 0; i < count; ++i)
+    OnRenderPDFPagesToMetafileGetPage(page_numbers[i], output_files[i]);
+}
+
 void PrintingHandlerWin::OnRenderPDFPagesToMetafileStop() {
   ReleaseProcessIfNeeded();
 }
@@ -5,6 +5,8 @@
 #ifndef CHROME_UTILITY_PRINTING_HANDLER_WIN_H_
 #define CHROME_UTILITY_PRINTING_HANDLER_WIN_H_
 
+#include <vector>
+
 #include "base/compiler_specific.h"
 #include "base/macros.h"
 #include "chrome/utility/utility_message_handler.h"
@@ -33,6 +35,9 @@ class PrintingHandlerWin : public UtilityMessageHandler {
   void OnRenderPDFPagesToMetafileGetPage(
       int page_number,
       IPC::PlatformFileForTransit output_file);
+  void OnRenderPDFPagesToMetafileGetPages(
+      const std::vector<int>& page_numbers,
+      const std::vector<IPC::PlatformFileForTransit>& output_files);
   void OnRenderPDFPagesToMetafileStop();
 
   int LoadPDF(base::File pdf_file);
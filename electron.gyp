@@ -527,6 +527,36 @@
         }
       ],
     },  # target app2asar
+    {
+      # Builds everything needed by script/startup-perf.py, which launches
+      # the binary with tools/startup_perf and reports cold/warm startup
+      # phase timings (through first window paint and first IPC) as JSON.
+      'target_name': 'electron_startup_perftests',
+      'type': 'none',
+      'dependencies': [
+        '<(project_name)',
+      ],
+    },  # target electron_startup_perftests
+    {
+      # Builds everything needed by script/asar-perf.py, which launches
+      # the binary with tools/asar_perf and reports asar header parse,
+      # lookup, read bandwidth and require-storm numbers as JSON.
+      'target_name': 'electron_asar_perftests',
+      'type': 'none',
+      'dependencies': [
+        '<(project_name)',
+      ],
+    },  # target electron_asar_perftests
+    {
+      # Builds everything needed by script/window-leak-check.py, which
+      # launches the binary with tools/window_leak and fails on memory or
+      # wrapper growth across repeated window open/close cycles.
+      'target_name': 'electron_window_leaktests',
+      'type': 'none',
+      'dependencies': [
+        '<(project_name)',
+      ],
+    },  # target electron_window_leaktests
     {
       'target_name': 'atom_js2c_copy',
       'type': 'none',
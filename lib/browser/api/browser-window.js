@@ -174,6 +174,54 @@ BrowserWindow.fromDevToolsWebContents = (webContents) => {
   }
 }
 
+// Pre-warmed hidden windows keyed by the serialized options they were
+// created with. Creating a window pays renderer spawn, Node environment
+// boot and first composite before it is interactive; a pooled window has
+// already paid all three and only needs to navigate and show.
+const windowPool = new Map()
+
+const poolKey = (options) => JSON.stringify(options || {})
+
+BrowserWindow.prewarm = (options, count = 1) => {
+  const key = poolKey(options)
+  if (!windowPool.has(key)) windowPool.set(key, [])
+  const pool = windowPool.get(key)
+  for (let i = 0; i < count; i++) {
+    const win = new BrowserWindow(Object.assign({}, options, {show: false}))
+    // Boot the renderer and Node environment ahead of time.
+    win.loadURL('about:blank')
+    win.once('closed', () => {
+      const index = pool.indexOf(win)
+      if (index !== -1) pool.splice(index, 1)
+    })
+    pool.push(win)
+  }
+}
+
+BrowserWindow.fromPool = (options) => {
+  const pool = windowPool.get(poolKey(options))
+  if (!pool || pool.length === 0) return null
+  return pool.shift()
+}
+
+BrowserWindow.getPoolSize = (options) => {
+  const pool = windowPool.get(poolKey(options))
+  return pool ? pool.length : 0
+}
+
+BrowserWindow.clearPool = (options) => {
+  const keys = options === undefined
+    ? Array.from(windowPool.keys()) : [poolKey(options)]
+  for (const key of keys) {
+    const pool = windowPool.get(key)
+    if (!pool) continue
+    windowPool.delete(key)
+    for (const win of pool) {
+      if (!win.isDestroyed()) win.destroy()
+    }
+  }
+}
+
 // Helpers.
 Object.assign(BrowserWindow.prototype, {
   loadURL (...args) {
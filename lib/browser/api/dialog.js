@@ -83,7 +83,7 @@ module.exports = {
       }
     }
 
-    let {buttonLabel, defaultPath, filters, properties, title, message, securityScopedBookmarks = false} = options
+    let {buttonLabel, defaultPath, filters, properties, title, message, securityScopedBookmarks = false, streamBatches = false} = options
 
     if (properties == null) {
       properties = ['openFile']
@@ -126,11 +126,21 @@ module.exports = {
       throw new TypeError('Message must be a string')
     }
 
+    const settings = {title, buttonLabel, defaultPath, filters, message, securityScopedBookmarks, window}
+    settings.properties = dialogProperties
+
+    if (streamBatches) {
+      if (typeof callback !== 'function') {
+        throw new TypeError('streamBatches requires a callback')
+      }
+      return binding.showOpenDialogStream(settings, function (success, batch, done) {
+        return success ? callback(batch, done) : callback()
+      })
+    }
+
     const wrappedCallback = typeof callback === 'function' ? function (success, result, bookmarkData) {
       return success ? callback(result, bookmarkData) : callback()
     } : null
-    const settings = {title, buttonLabel, defaultPath, filters, message, securityScopedBookmarks, window}
-    settings.properties = dialogProperties
     return binding.showOpenDialog(settings, wrappedCallback)
   },
 
@@ -13,4 +13,29 @@ emitter.removeAllListeners = function (...args) {
 // Do not throw exception when channel name is "error".
 emitter.on('error', () => {})
 
+// Handlers for ipcRenderer.invoke(), keyed by channel. Dispatched by
+// the ELECTRON_BROWSER_INVOKE handler in rpc-server.js.
+emitter._invokeHandlers = new Map()
+
+emitter.handle = function (channel, handler) {
+  if (typeof handler !== 'function') {
+    throw new TypeError('Expected handler to be a function')
+  }
+  if (emitter._invokeHandlers.has(channel)) {
+    throw new Error(`Attempted to register a second handler for '${channel}'`)
+  }
+  emitter._invokeHandlers.set(channel, handler)
+}
+
+emitter.handleOnce = function (channel, handler) {
+  emitter.handle(channel, function (...args) {
+    emitter.removeHandler(channel)
+    return handler(...args)
+  })
+}
+
+emitter.removeHandler = function (channel) {
+  emitter._invokeHandlers.delete(channel)
+}
+
 module.exports = emitter
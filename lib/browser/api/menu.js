@@ -124,6 +124,27 @@ Menu.prototype.insert = function (pos, item) {
   this.commandsMap[item.commandId] = item
 }
 
+// Remove a single item so menus can be updated in place instead of being
+// rebuilt from scratch; combined with insert() this replaces one item
+// without reconverting the accelerators of every other item.
+Menu.prototype.remove = function (pos) {
+  const item = this.items[pos]
+  if (item == null) {
+    throw new RangeError(`Cannot remove item at position ${pos}`)
+  }
+
+  this.removeItem(pos)
+  this.items.splice(pos, 1)
+  delete this.commandsMap[item.commandId]
+
+  if (item.groupId != null && this.groupsMap[item.groupId] != null) {
+    const group = this.groupsMap[item.groupId]
+    const index = group.indexOf(item)
+    if (index !== -1) group.splice(index, 1)
+    if (group.length === 0) delete this.groupsMap[item.groupId]
+  }
+}
+
 Menu.prototype._callMenuWillShow = function () {
   if (this.delegate) this.delegate.menuWillShow(this)
   this.items.forEach(item => {
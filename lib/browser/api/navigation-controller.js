@@ -19,6 +19,7 @@ ipcMain.on('ELECTRON_SYNC_NAVIGATION_CONTROLLER', function (event, method, ...ar
 var NavigationController = (function () {
   function NavigationController (webContents) {
     this.webContents = webContents
+    this.historyLimit = 0
     this.clearHistory()
 
     // webContents may have already navigated to a page.
@@ -48,6 +49,9 @@ var NavigationController = (function () {
         this.currentIndex++
         this.history.push(url)
       }
+      if (this.historyLimit > 0 && this.history.length > this.historyLimit) {
+        this.trimHistory(this.historyLimit)
+      }
     })
   }
 
@@ -108,6 +112,42 @@ var NavigationController = (function () {
     this.inPageIndex = -1
   }
 
+  NavigationController.prototype.setHistoryLimit = function (limit) {
+    this.historyLimit = (typeof limit === 'number' && limit > 0) ? Math.floor(limit) : 0
+    if (this.historyLimit > 0) {
+      this.trimHistory(this.historyLimit)
+    }
+  }
+
+  NavigationController.prototype.getHistoryLimit = function () {
+    return this.historyLimit
+  }
+
+  NavigationController.prototype.trimHistory = function (maxEntries) {
+    if (typeof maxEntries !== 'number' || maxEntries < 1) {
+      return
+    }
+    maxEntries = Math.floor(maxEntries)
+    // Drop the oldest entries first, but never the current one.
+    while (this.history.length > maxEntries && this.currentIndex > 0) {
+      this.history.shift()
+      this.currentIndex--
+      if (this.pendingIndex > 0) {
+        this.pendingIndex--
+      }
+      if (this.inPageIndex > 0) {
+        this.inPageIndex--
+      }
+    }
+    // If the current entry is already the oldest one, drop forward entries.
+    if (this.history.length > maxEntries) {
+      this.history = this.history.slice(0, maxEntries)
+    }
+    // Also prune Chromium's controller, which is where session history
+    // actually holds memory.
+    this.webContents._trimHistory(maxEntries)
+  }
+
   NavigationController.prototype.goBack = function () {
     if (!this.canGoBack()) {
       return
@@ -56,6 +56,10 @@ class IncomingMessage extends Readable {
     return this.urlRequest.httpVersionMinor
   }
 
+  get connectionInfo () {
+    return this.urlRequest.connectionInfo
+  }
+
   get rawTrailers () {
     throw new Error('HTTP trailers are not supported.')
   }
@@ -197,6 +201,12 @@ class ClientRequest extends EventEmitter {
       }
     }
 
+    // Ask the server to close the connection after the response when the
+    // socket should not go back to the pool for reuse.
+    if (options.keepAlive === false && !('connection' in this.extraHeaders)) {
+      this.setHeader('Connection', 'close')
+    }
+
     // Set when the request uses chunked encoding. Can be switched
     // to true only once and never set back to false.
     this.chunkedEncodingEnabled = false
@@ -363,6 +373,18 @@ Net.prototype.request = function (options, callback) {
   return new ClientRequest(options, callback)
 }
 
+Net.prototype.resolveHost = function (host, callback) {
+  if (typeof host !== 'string') {
+    throw new TypeError('host must be a string')
+  }
+  if (typeof callback !== 'function') {
+    throw new TypeError('callback must be a function')
+  }
+  this._resolveHost(host, (error, addresses) => {
+    callback(error ? new Error(error) : null, addresses)
+  })
+}
+
 net.ClientRequest = ClientRequest
 
 module.exports = net
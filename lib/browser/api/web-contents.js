@@ -104,6 +104,33 @@ WebContents.prototype.sendToAll = function (channel, ...args) {
   return this._send(true, channel, args)
 }
 
+// WebContents::sendToFrame(frameId, channel, args..)
+WebContents.prototype.sendToFrame = function (frameId, channel, ...args) {
+  if (typeof frameId !== 'number') throw new Error('Missing required frameId argument')
+  if (channel == null) throw new Error('Missing required channel argument')
+  return this._sendToFrame(frameId, channel, args)
+}
+
+// WebContents::sendCoalesced(channel, args..)
+//
+// Like send(), but messages issued within the same event loop iteration
+// are batched into one IPC message and unpacked in the renderer, so
+// high-frequency channels stop waking the renderer per message.
+WebContents.prototype.sendCoalesced = function (channel, ...args) {
+  if (channel == null) throw new Error('Missing required channel argument')
+  if (this._coalescedMessages == null) {
+    this._coalescedMessages = []
+    setImmediate(() => {
+      const messages = this._coalescedMessages
+      this._coalescedMessages = null
+      if (!this.isDestroyed()) {
+        this._send(false, 'ELECTRON_INTERNAL_RENDERER_COALESCED_MESSAGES', messages)
+      }
+    })
+  }
+  this._coalescedMessages.push([channel, args])
+}
+
 // Following methods are mapped to webFrame.
 const webFrameMethods = [
   'insertCSS',
@@ -206,6 +233,12 @@ WebContents.prototype.printToPDF = function (options, callback) {
   if (options.printBackground) {
     printingSetting.shouldPrintBackgrounds = options.printBackground
   }
+  if (options.path) {
+    if (typeof options.path !== 'string') {
+      return callback(new Error('path must be a string'))
+    }
+    printingSetting.path = options.path
+  }
 
   if (options.pageSize) {
     const pageSize = options.pageSize
@@ -277,6 +310,9 @@ WebContents.prototype._init = function () {
   this.on('ipc-message', function (event, [channel, ...args]) {
     ipcMain.emit(channel, event, ...args)
   })
+  this.on('ipc-message-buffer', function (event, channel, buffer) {
+    ipcMain.emit(channel, event, buffer)
+  })
   this.on('ipc-message-sync', function (event, [channel, ...args]) {
     Object.defineProperty(event, 'returnValue', {
       set: function (value) {
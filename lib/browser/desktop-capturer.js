@@ -10,8 +10,9 @@ let requestsQueue = []
 
 const electronSources = 'ELECTRON_BROWSER_DESKTOP_CAPTURER_GET_SOURCES'
 const capturerResult = (id) => `ELECTRON_RENDERER_DESKTOP_CAPTURER_RESULT_${id}`
+const capturerSource = (id) => `ELECTRON_RENDERER_DESKTOP_CAPTURER_SOURCE_${id}`
 
-ipcMain.on(electronSources, (event, captureWindow, captureScreen, thumbnailSize, id) => {
+ipcMain.on(electronSources, (event, captureWindow, captureScreen, thumbnailSize, id, streaming) => {
   const request = {
     id,
     options: {
@@ -19,6 +20,7 @@ ipcMain.on(electronSources, (event, captureWindow, captureScreen, thumbnailSize,
       captureScreen,
       thumbnailSize
     },
+    streaming,
     webContents: event.sender
   }
   requestsQueue.push(request)
@@ -34,6 +36,27 @@ ipcMain.on(electronSources, (event, captureWindow, captureScreen, thumbnailSize,
 })
 
 desktopCapturer.emit = (event, name, sources) => {
+  if (name === 'source-thumbnail-ready') {
+    // A single source finished capturing; stream it to every pending request
+    // that asked for incremental results and matches the one being handled.
+    const source = sources
+    const handledRequest = requestsQueue[0]
+    if (handledRequest == null) return
+    const result = {
+      id: source.id,
+      name: source.name,
+      thumbnail: source.thumbnail.toDataURL(),
+      display_id: source.display_id
+    }
+    requestsQueue.forEach(request => {
+      if (request.streaming && request.webContents &&
+          deepEqual(handledRequest.options, request.options)) {
+        request.webContents.send(capturerSource(request.id), result)
+      }
+    })
+    return
+  }
+
   // Receiving sources result from main process, now send them back to renderer.
   const handledRequest = requestsQueue.shift()
   const handledWebContents = handledRequest.webContents
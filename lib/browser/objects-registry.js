@@ -42,6 +42,20 @@ class ObjectsRegistry {
     if (pointer != null) return pointer.object
   }
 
+  // Get the metadata version of an object. Renderers cache member
+  // snapshots keyed by this counter; a bump invalidates their caches.
+  getVersion (id) {
+    const pointer = this.storage[id]
+    return pointer != null ? pointer.version : 0
+  }
+
+  // Bump the metadata version after an operation that may have mutated
+  // the object.
+  bumpVersion (id) {
+    const pointer = this.storage[id]
+    if (pointer != null) pointer.version++
+  }
+
   // Dereference an object according to its ID.
   remove (webContentsId, id) {
     // Dereference from the storage.
@@ -71,7 +85,8 @@ class ObjectsRegistry {
       id = ++this.nextId
       this.storage[id] = {
         count: 0,
-        object: object
+        object: object,
+        version: 0
       }
       v8Util.setHiddenValue(object, 'atomId', id)
     }
@@ -92,6 +92,7 @@ let valueToMeta = function (sender, value, optimizeSimpleObject = false) {
     // passed to renderer we would assume the renderer keeps a reference of
     // it.
     meta.id = objectsRegistry.add(sender, value)
+    meta.version = objectsRegistry.getVersion(meta.id)
     meta.members = getObjectMembers(value)
     meta.proto = getObjectPrototype(value)
   } else if (meta.type === 'buffer') {
@@ -332,6 +333,7 @@ ipcMain.on('ELECTRON_BROWSER_MEMBER_CONSTRUCTOR', function (event, id, method, a
       throwRPCError(`Cannot call constructor '${method}' on missing remote object ${id}`)
     }
 
+    objectsRegistry.bumpVersion(id)
     event.returnValue = valueToMeta(event.sender, new object[method](...args))
   } catch (error) {
     event.returnValue = exceptionToMeta(event.sender, error)
@@ -347,6 +349,8 @@ ipcMain.on('ELECTRON_BROWSER_MEMBER_CALL', function (event, id, method, args) {
       throwRPCError(`Cannot call function '${method}' on missing remote object ${id}`)
     }
 
+    // The method may mutate the object, so invalidate cached snapshots.
+    objectsRegistry.bumpVersion(id)
     callFunction(event, obj[method], obj, args)
   } catch (error) {
     event.returnValue = exceptionToMeta(event.sender, error)
@@ -363,12 +367,39 @@ ipcMain.on('ELECTRON_BROWSER_MEMBER_SET', function (event, id, name, args) {
     }
 
     obj[name] = args[0]
+    objectsRegistry.bumpVersion(id)
     event.returnValue = null
   } catch (error) {
     event.returnValue = exceptionToMeta(event.sender, error)
   }
 })
 
+// Return a versioned snapshot of the object's plain data members in one
+// round trip. Only data properties with primitive values are included --
+// accessors are not invoked and object-valued members are left to the
+// per-property path so their lifetimes stay renderer-managed.
+ipcMain.on('ELECTRON_BROWSER_MEMBERS_SNAPSHOT', function (event, id) {
+  try {
+    let obj = objectsRegistry.get(id)
+
+    if (obj == null) {
+      throwRPCError(`Cannot snapshot members of missing remote object ${id}`)
+    }
+
+    const values = {}
+    for (const name of Object.getOwnPropertyNames(obj)) {
+      const descriptor = Object.getOwnPropertyDescriptor(obj, name)
+      if (descriptor.get !== undefined) continue
+      const value = descriptor.value
+      if (value !== null && (typeof value === 'object' || typeof value === 'function')) continue
+      values[name] = valueToMeta(event.sender, value)
+    }
+    event.returnValue = {version: objectsRegistry.getVersion(id), values}
+  } catch (error) {
+    event.returnValue = exceptionToMeta(event.sender, error)
+  }
+})
+
 ipcMain.on('ELECTRON_BROWSER_MEMBER_GET', function (event, id, name) {
   try {
     let obj = objectsRegistry.get(id)
@@ -383,8 +414,11 @@ ipcMain.on('ELECTRON_BROWSER_MEMBER_GET', function (event, id, name) {
   }
 })
 
-ipcMain.on('ELECTRON_BROWSER_DEREFERENCE', function (event, id) {
-  objectsRegistry.remove(event.sender.getId(), id)
+ipcMain.on('ELECTRON_BROWSER_DEREFERENCE', function (event, ids) {
+  const webContentsId = event.sender.getId()
+  for (const id of ids) {
+    objectsRegistry.remove(webContentsId, id)
+  }
 })
 
 ipcMain.on('ELECTRON_BROWSER_CONTEXT_RELEASE', (e, contextId) => {
@@ -417,6 +451,20 @@ ipcMain.on('ELECTRON_BROWSER_ASYNC_CALL_TO_GUEST_VIEW', function (event, request
   }
 })
 
+ipcMain.on('ELECTRON_BROWSER_INVOKE', function (event, requestId, channel, ...args) {
+  const respond = function (error, result) {
+    event.sender.send(`ELECTRON_RENDERER_INVOKE_RESPONSE_${requestId}`, error, result)
+  }
+  const handler = ipcMain._invokeHandlers.get(channel)
+  if (handler == null) {
+    respond({message: `No handler registered for '${channel}'`}, null)
+    return
+  }
+  Promise.resolve().then(() => handler(event, ...args)).then(
+    (result) => respond(null, result),
+    (error) => respond({message: error != null ? `${error.message || error}` : 'Unknown error'}, null))
+})
+
 ipcMain.on('ELECTRON_BROWSER_SEND_TO', function (event, sendToAll, webContentsId, channel, ...args) {
   let contents = webContents.fromId(webContentsId)
   if (!contents) {
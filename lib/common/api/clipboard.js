@@ -4,6 +4,16 @@ if (process.platform === 'linux' && process.type === 'renderer') {
 } else {
   const clipboard = process.atomBinding('clipboard')
 
+  // Promise-returning variants that keep the bulk of the work off the
+  // calling thread.
+  clipboard.readImageAsync = function (...args) {
+    return new Promise((resolve) => clipboard._readImageAsync(...args, resolve))
+  }
+
+  clipboard.readBufferAsync = function (format) {
+    return new Promise((resolve) => clipboard._readBufferAsync(format, resolve))
+  }
+
   // Read/write to find pasteboard over IPC since only main process is notified
   // of changes
   if (process.platform === 'darwin' && process.type === 'renderer') {
@@ -16,6 +16,7 @@ class CrashReporter {
       companyName,
       extra,
       ignoreSystemCrashHandler,
+      microDump,
       submitURL,
       uploadToServer
     } = options
@@ -25,6 +26,7 @@ class CrashReporter {
     }
 
     if (ignoreSystemCrashHandler == null) ignoreSystemCrashHandler = false
+    if (microDump == null) microDump = false
     if (extra == null) extra = {}
 
     if (extra._productName == null) extra._productName = this.getProductName()
@@ -55,7 +57,7 @@ class CrashReporter {
       })
     }
 
-    binding.start(this.getProductName(), companyName, submitURL, this.getCrashesDirectory(), uploadToServer, ignoreSystemCrashHandler, extra)
+    binding.start(this.getProductName(), companyName, submitURL, this.getCrashesDirectory(), uploadToServer, ignoreSystemCrashHandler, microDump, extra)
   }
 
   getLastCrashReport () {
@@ -1 +1,27 @@
-module.exports = process.atomBinding('native_image')
+'use strict'
+
+const nativeImage = process.atomBinding('native_image')
+
+const nativeImagePrototype = Object.getPrototypeOf(nativeImage.createEmpty())
+
+// Promise-returning wrappers over the native async variants, which run the
+// scaling/encoding on the worker pool instead of the main thread.
+nativeImagePrototype.toPNGAsync = function (options = {}) {
+  return new Promise((resolve) => this._toPNGAsync(options, resolve))
+}
+
+nativeImagePrototype.toJPEGAsync = function (quality) {
+  return new Promise((resolve) => this._toJPEGAsync(quality, resolve))
+}
+
+nativeImagePrototype.resizeAsync = function (options = {}) {
+  return new Promise((resolve) => this._resizeAsync(options, resolve))
+}
+
+// Resizes many images at once; each image becomes its own worker-pool task,
+// so a batch runs in parallel across cores.
+nativeImage.resizeBatch = function (images, options = {}) {
+  return Promise.all(images.map((image) => image.resizeAsync(options)))
+}
+
+module.exports = nativeImage
@@ -491,6 +491,16 @@
         const realPath = archive.copyFileOut(filePath)
         return fs.readFile(realPath, options, callback)
       }
+      if (info.compressed) {
+        logASARAccess(asarPath, filePath, info.offset)
+        const buffer = archive.readFile(filePath)
+        return process.nextTick(function () {
+          if (!buffer) {
+            return notFoundError(asarPath, filePath, callback)
+          }
+          callback(null, encoding ? buffer.toString(encoding) : buffer)
+        })
+      }
 
       const buffer = Buffer.alloc(info.size)
       const fd = archive.getFd()
@@ -540,6 +550,14 @@
         throw new TypeError('Bad arguments')
       }
       const {encoding} = options
+      if (info.compressed) {
+        logASARAccess(asarPath, filePath, info.offset)
+        const buffer = archive.readFile(filePath)
+        if (!buffer) {
+          notFoundError(asarPath, filePath)
+        }
+        return encoding ? buffer.toString(encoding) : buffer
+      }
       const buffer = Buffer.alloc(info.size)
       const fd = archive.getFd()
       if (!(fd >= 0)) {
@@ -613,6 +631,14 @@
           encoding: 'utf8'
         })
       }
+      if (info.compressed) {
+        logASARAccess(asarPath, filePath, info.offset)
+        const buffer = archive.readFile(filePath)
+        if (!buffer) {
+          return
+        }
+        return buffer.toString('utf8')
+      }
       const buffer = Buffer.alloc(info.size)
       const fd = archive.getFd()
       if (!(fd >= 0)) {
@@ -623,6 +649,21 @@
       return buffer.toString('utf8')
     }
 
+    // Module resolution probes many sibling paths per require() call
+    // (p, p.js, p.json, p.node, p/package.json, p/index.js, ...), and
+    // most of them do not exist. Resolve the whole family with one
+    // existsMany() round trip on the first probe and answer the rest
+    // from this cache; archive contents are immutable, so cached codes
+    // never go stale.
+    const moduleStatCache = new Map()
+    const moduleStatSuffixes = [
+      '', '.js', '.json', '.node',
+      `${path.sep}package.json`,
+      `${path.sep}index.js`,
+      `${path.sep}index.json`,
+      `${path.sep}index.node`
+    ]
+
     const {internalModuleStat} = process.binding('fs')
     process.binding('fs').internalModuleStat = function (p) {
       const [isAsar, asarPath, filePath] = splitPath(p)
@@ -635,17 +676,25 @@
       if (!archive) {
         return -34
       }
-      const stats = archive.stat(filePath)
+      const cacheKey = `${asarPath}\0${filePath}`
+      let code = moduleStatCache.get(cacheKey)
+      if (code === undefined) {
+        if (moduleStatCache.size > 16384) {
+          moduleStatCache.clear()
+        }
+        const codes = archive.existsMany(
+          moduleStatSuffixes.map((suffix) => filePath + suffix))
 
-      // -ENOENT
-      if (!stats) {
-        return -34
-      }
-      if (stats.isDirectory) {
-        return 1
-      } else {
-        return 0
+        // -ENOENT
+        if (!codes) {
+          return -34
+        }
+        for (let i = 0; i < moduleStatSuffixes.length; i++) {
+          moduleStatCache.set(`${asarPath}\0${filePath}${moduleStatSuffixes[i]}`, codes[i])
+        }
+        code = codes[0]
       }
+      return code
     }
 
     // Calling mkdir for directory inside asar archive should throw ENOTDIR
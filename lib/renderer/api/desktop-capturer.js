@@ -27,8 +27,24 @@ exports.getSources = function (options, callback) {
   }
 
   const id = incrementId()
-  ipcRenderer.send('ELECTRON_BROWSER_DESKTOP_CAPTURER_GET_SOURCES', captureWindow, captureScreen, options.thumbnailSize, id)
+  const streaming = typeof options.onSource === 'function'
+  if (streaming) {
+    // Deliver each source as soon as its thumbnail has been captured instead
+    // of waiting for the whole enumeration to finish.
+    ipcRenderer.on(`ELECTRON_RENDERER_DESKTOP_CAPTURER_SOURCE_${id}`, (event, source) => {
+      options.onSource({
+        id: source.id,
+        name: source.name,
+        thumbnail: nativeImage.createFromDataURL(source.thumbnail),
+        display_id: source.display_id
+      })
+    })
+  }
+  ipcRenderer.send('ELECTRON_BROWSER_DESKTOP_CAPTURER_GET_SOURCES', captureWindow, captureScreen, options.thumbnailSize, id, streaming)
   return ipcRenderer.once(`ELECTRON_RENDERER_DESKTOP_CAPTURER_RESULT_${id}`, (event, sources) => {
+    if (streaming) {
+      ipcRenderer.removeAllListeners(`ELECTRON_RENDERER_DESKTOP_CAPTURER_SOURCE_${id}`)
+    }
     callback(null, (() => {
       const results = []
       sources.forEach(source => {
@@ -10,8 +10,78 @@ ipcRenderer.send = function (...args) {
   return binding.send('ipc-message', args)
 }
 
+// How long each sendSync call blocked the renderer, aggregated by
+// channel. Sync round trips are the main source of main-thread jank, so
+// keep enough data to find the remaining users and migrate them to
+// invoke().
+const sendSyncStats = new Map()
+
 ipcRenderer.sendSync = function (...args) {
-  return binding.sendSync('ipc-message-sync', args)[0]
+  const start = process.hrtime()
+  try {
+    return binding.sendSync('ipc-message-sync', args)[0]
+  } finally {
+    const delta = process.hrtime(start)
+    const ms = delta[0] * 1000 + delta[1] / 1e6
+    const channel = typeof args[0] === 'string' ? args[0] : '<unknown>'
+    const entry = sendSyncStats.get(channel) || {count: 0, totalMs: 0, maxMs: 0}
+    entry.count += 1
+    entry.totalMs += ms
+    entry.maxMs = Math.max(entry.maxMs, ms)
+    sendSyncStats.set(channel, entry)
+  }
+}
+
+ipcRenderer.getSendSyncStats = function () {
+  const stats = {}
+  for (const [channel, entry] of sendSyncStats) {
+    stats[channel] = Object.assign({}, entry)
+  }
+  return stats
+}
+
+let nextInvokeId = 0
+ipcRenderer.invoke = function (channel, ...args) {
+  if (typeof channel !== 'string') {
+    throw new TypeError('First argument has to be a channel name')
+  }
+  return new Promise((resolve, reject) => {
+    const requestId = ++nextInvokeId
+    ipcRenderer.once(`ELECTRON_RENDERER_INVOKE_RESPONSE_${requestId}`, function (event, error, result) {
+      if (error != null) {
+        reject(new Error(error.message))
+      } else {
+        resolve(result)
+      }
+    })
+    ipcRenderer.send('ELECTRON_BROWSER_INVOKE', requestId, channel, ...args)
+  })
+}
+
+ipcRenderer.sendBuffer = function (channel, buffer) {
+  if (typeof channel !== 'string') {
+    throw new TypeError('First argument has to be a channel name')
+  }
+  return binding.sendSharedBuffer(channel, buffer)
+}
+
+ipcRenderer.sendStream = function (channel, buffer) {
+  if (typeof channel !== 'string') {
+    throw new TypeError('First argument has to be a channel name')
+  }
+  return binding.sendStream(channel, buffer)
+}
+
+ipcRenderer.createTelemetryBuffer = function (size) {
+  const id = binding.createTelemetryBuffer(size)
+  if (id < 0) {
+    throw new Error('Unable to create telemetry buffer')
+  }
+  return {
+    write (record) {
+      return binding.writeTelemetry(id, record)
+    }
+  }
 }
 
 ipcRenderer.sendToHost = function (...args) {
@@ -9,6 +9,42 @@ const bufferUtils = require('../../common/buffer-utils')
 const callbacksRegistry = new CallbacksRegistry()
 const remoteObjectCache = v8Util.createIDWeakMap()
 
+// Versioned member snapshots: metaId => {version, values: Map(name => value)}.
+// A snapshot holds the primitive-valued data members of a remote object,
+// fetched in one sync IPC, so repeated property access on a stable object
+// does not go back to the browser. The browser bumps the object's version
+// on every mutating operation; a meta arriving with a different version
+// drops the stale snapshot.
+const memberSnapshots = new Map()
+
+function invalidateSnapshot (metaId) {
+  memberSnapshots.delete(metaId)
+}
+
+function noteObjectVersion (metaId, version) {
+  if (version == null) return
+  const snapshot = memberSnapshots.get(metaId)
+  if (snapshot !== undefined && snapshot.version !== version) {
+    memberSnapshots.delete(metaId)
+  }
+}
+
+// Fetch (or return the cached) member snapshot for a remote object.
+function getMemberSnapshot (metaId) {
+  let snapshot = memberSnapshots.get(metaId)
+  if (snapshot !== undefined) return snapshot
+
+  const result = ipcRenderer.sendSync('ELECTRON_BROWSER_MEMBERS_SNAPSHOT', metaId)
+  if (result.type === 'exception') metaToValue(result)
+
+  snapshot = {version: result.version, values: new Map()}
+  for (const name of Object.keys(result.values)) {
+    snapshot.values.set(name, metaToValue(result.values[name]))
+  }
+  memberSnapshots.set(metaId, snapshot)
+  return snapshot
+}
+
 // Convert the arguments object into an array of meta data.
 function wrapArgs (args, visited = new Set()) {
   const valueToMeta = (value) => {
@@ -108,6 +144,7 @@ function setObjectMembers (ref, object, metaId, members) {
           command = 'ELECTRON_BROWSER_MEMBER_CALL'
         }
         const ret = ipcRenderer.sendSync(command, metaId, member.name, wrapArgs(args))
+        invalidateSnapshot(metaId)
         return metaToValue(ret)
       }
 
@@ -125,6 +162,10 @@ function setObjectMembers (ref, object, metaId, members) {
       descriptor.configurable = true
     } else if (member.type === 'get') {
       descriptor.get = () => {
+        const snapshot = getMemberSnapshot(metaId)
+        if (snapshot.values.has(member.name)) {
+          return snapshot.values.get(member.name)
+        }
         const command = 'ELECTRON_BROWSER_MEMBER_GET'
         const meta = ipcRenderer.sendSync(command, metaId, member.name)
         return metaToValue(meta)
@@ -135,6 +176,7 @@ function setObjectMembers (ref, object, metaId, members) {
           const args = wrapArgs([value])
           const command = 'ELECTRON_BROWSER_MEMBER_SET'
           const meta = ipcRenderer.sendSync(command, metaId, member.name, args)
+          invalidateSnapshot(metaId)
           if (meta != null) metaToValue(meta)
           return value
         }
@@ -211,6 +253,7 @@ function metaToValue (meta) {
     return types[meta.type]()
   } else {
     let ret
+    noteObjectVersion(meta.id, meta.version)
     if (remoteObjectCache.has(meta.id)) {
       return remoteObjectCache.get(meta.id)
     }
@@ -22,7 +22,17 @@ globalPaths.push(path.join(__dirname, 'api', 'exports'))
 // The global variable will be used by ipc for event dispatching
 var v8Util = process.atomBinding('v8_util')
 
-v8Util.setHiddenValue(global, 'ipc', new events.EventEmitter())
+const ipcEmitter = new events.EventEmitter()
+v8Util.setHiddenValue(global, 'ipc', ipcEmitter)
+
+// Unpack batches sent by webContents.sendCoalesced: one IPC message
+// carrying the [channel, args] pairs queued during the same browser
+// loop iteration.
+ipcEmitter.on('ELECTRON_INTERNAL_RENDERER_COALESCED_MESSAGES', function (event, messages) {
+  for (const [channel, args] of messages) {
+    ipcEmitter.emit(channel, event, ...args)
+  }
+})
 
 // Use electron module after everything is ready.
 
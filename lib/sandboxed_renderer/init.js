@@ -11,7 +11,17 @@ const v8Util = process.atomBinding('v8_util')
 v8Util.setHiddenValue(global, 'Buffer', Buffer)
 // The `lib/renderer/api/ipc-renderer.js` module looks for the ipc object in the
 // "ipc" hidden value
-v8Util.setHiddenValue(global, 'ipc', new events.EventEmitter())
+const ipcEmitter = new events.EventEmitter()
+v8Util.setHiddenValue(global, 'ipc', ipcEmitter)
+
+// Unpack batches sent by webContents.sendCoalesced: one IPC message
+// carrying the [channel, args] pairs queued during the same browser
+// loop iteration.
+ipcEmitter.on('ELECTRON_INTERNAL_RENDERER_COALESCED_MESSAGES', function (event, messages) {
+  for (const [channel, args] of messages) {
+    ipcEmitter.emit(channel, event, ...args)
+  }
+})
 // The process object created by browserify is not an event emitter, fix it so
 // the API is more compatible with non-sandboxed renderers.
 for (let prop of Object.keys(events.EventEmitter.prototype)) {
@@ -102,10 +112,15 @@ if (preloadSrc) {
   ${preloadSrc}
   })`
 
-  // eval in window scope:
+  // Compile through the disk-backed code cache (keyed by path + mtime)
+  // so later renderers deserialize bytecode instead of recompiling.
+  // Falls back to an eval in window scope:
   // http://www.ecma-international.org/ecma-262/5.1/#sec-10.4.2
-  const geval = eval
-  const preloadFn = geval(preloadWrapperSrc)
+  let preloadFn = binding.compilePreloadScript(preloadPath, preloadWrapperSrc)
+  if (typeof preloadFn !== 'function') {
+    const geval = eval
+    preloadFn = geval(preloadWrapperSrc)
+  }
   const {setImmediate, clearImmediate} = require('timers')
   preloadFn(preloadRequire, preloadProcess, Buffer, global, setImmediate, clearImmediate)
 } else if (preloadError) {
@@ -4,6 +4,10 @@
 
 #include "native_mate/converter.h"
 
+#include <map>
+#include <string>
+
+#include "base/lazy_instance.h"
 #include "v8/include/v8.h"
 
 using v8::Array;
@@ -20,6 +24,29 @@ using v8::Value;
 
 namespace mate {
 
+namespace {
+
+// Per-isolate tables of eternal key strings handed out by EternalKey().
+// The eternals intentionally never die, so the table leaks with the
+// process; it only ever holds the small fixed set of literal keys used
+// by hot converters.
+using EternalKeyTable = std::map<std::string, v8::Eternal<v8::String>>;
+base::LazyInstance<std::map<v8::Isolate*, EternalKeyTable>>::Leaky
+    g_eternal_keys = LAZY_INSTANCE_INITIALIZER;
+
+// True when every byte has the high bit clear, i.e. the buffer is pure
+// ASCII and identical to its Latin-1 and UTF-8 encodings. The loop is a
+// branch-free byte OR that compilers vectorize to SSE/NEON, so the scan
+// runs at memory bandwidth.
+bool IsAllAscii(const char* data, size_t length) {
+  uint8_t acc = 0;
+  for (size_t i = 0; i < length; ++i)
+    acc |= static_cast<uint8_t>(data[i]);
+  return (acc & 0x80) == 0;
+}
+
+}  // namespace
+
 Local<Value> Converter<bool>::ToV8(Isolate* isolate, bool val) {
   return v8::Boolean::New(isolate, val);
 }
@@ -127,6 +154,13 @@ Local<Value> Converter<const char*>::ToV8(
 
 Local<Value> Converter<base::StringPiece>::ToV8(
     Isolate* isolate, const base::StringPiece& val) {
+  // Pure ASCII payloads skip V8's scalar UTF-8 decoder entirely;
+  // NewFromOneByte ingests them with a plain copy into a one-byte string.
+  if (IsAllAscii(val.data(), val.length())) {
+    return v8::String::NewFromOneByte(
+        isolate, reinterpret_cast<const uint8_t*>(val.data()),
+        v8::String::kNormalString, static_cast<uint32_t>(val.length()));
+  }
   return v8::String::NewFromUtf8(isolate,
                                  val.data(),
                                  v8::String::kNormalString,
@@ -143,12 +177,58 @@ bool Converter<std::string>::FromV8(Isolate* isolate, Local<Value> val,
   if (!val->IsString())
     return false;
   Local<String> str = Local<String>::Cast(val);
+  // One-byte fast path: read the string out as Latin-1, which V8 does with
+  // a straight copy, and keep the result when it turns out to be pure
+  // ASCII -- the common case for IPC payloads. Latin-1 bytes above 0x7F
+  // need two UTF-8 bytes, so those strings fall through to WriteUtf8.
+  if (str->ContainsOnlyOneByte()) {
+    int length = str->Length();
+    out->resize(length);
+    if (length > 0) {
+      str->WriteOneByte(reinterpret_cast<uint8_t*>(&(*out)[0]), 0, length,
+                        String::NO_NULL_TERMINATION);
+    }
+    if (IsAllAscii(out->data(), length))
+      return true;
+  }
   int length = str->Utf8Length();
   out->resize(length);
   str->WriteUtf8(&(*out)[0], length, NULL, String::NO_NULL_TERMINATION);
   return true;
 }
 
+StringArena::StringArena() {}
+
+StringArena::~StringArena() {}
+
+bool StringArena::FromV8(Isolate* isolate,
+                         Local<Value> val,
+                         base::StringPiece* out) {
+  if (!val->IsString())
+    return false;
+  Local<String> str = Local<String>::Cast(val);
+  size_t length = static_cast<size_t>(str->Utf8Length());
+  if (length <= kInlineSize - used_) {
+    char* buffer = inline_buffer_ + used_;
+    str->WriteUtf8(buffer, static_cast<int>(length), NULL,
+                   String::NO_NULL_TERMINATION);
+    used_ += length;
+    *out = base::StringPiece(buffer, length);
+    return true;
+  }
+
+  // Does not fit in the inline buffer (or what is left of it); fall
+  // back to a heap string owned by the arena.
+  overflow_.push_back(std::make_unique<std::string>(length, '\0'));
+  std::string* storage = overflow_.back().get();
+  if (length > 0) {
+    str->WriteUtf8(&(*storage)[0], static_cast<int>(length), NULL,
+                   String::NO_NULL_TERMINATION);
+  }
+  *out = base::StringPiece(*storage);
+  return true;
+}
+
 Local<Value> Converter<Local<Function>>::ToV8(Isolate* isolate,
                                               Local<Function> val) {
   return val;
@@ -235,6 +315,17 @@ v8::Local<v8::String> StringToSymbol(v8::Isolate* isolate,
                                  static_cast<uint32_t>(val.length()));
 }
 
+v8::Local<v8::String> EternalKey(v8::Isolate* isolate, const char* key) {
+  EternalKeyTable& keys = g_eternal_keys.Get()[isolate];
+  auto iter = keys.find(key);
+  if (iter == keys.end()) {
+    iter = keys.emplace(key, v8::Eternal<v8::String>(
+                                 isolate, StringToSymbol(isolate, key)))
+               .first;
+  }
+  return iter->second.Get(isolate);
+}
+
 std::string V8ToString(v8::Local<v8::Value> value) {
   if (value.IsEmpty())
     return std::string();
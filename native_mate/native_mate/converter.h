@@ -6,10 +6,12 @@
 #define NATIVE_MATE_CONVERTER_H_
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <set>
 
+#include "base/macros.h"
 #include "base/strings/string_piece.h"
 #include "v8/include/v8.h"
 
@@ -146,8 +148,45 @@ struct Converter<std::string> {
 v8::Local<v8::String> StringToSymbol(v8::Isolate* isolate,
                                       const base::StringPiece& input);
 
+// Returns a handle for |key| backed by a per-isolate v8::Eternal table,
+// creating the string on first use. Meant for dictionary keys on hot
+// conversion paths, so repeated conversions never re-allocate the key
+// string. The handles live as long as the isolate: only pass string
+// literals, never dynamic strings.
+v8::Local<v8::String> EternalKey(v8::Isolate* isolate, const char* key);
+
 std::string V8ToString(v8::Local<v8::Value> value);
 
+// Stack-backed storage for converting V8 strings into base::StringPiece
+// without heap allocation. V8 does not expose the internal bytes of a
+// string, so the contents still have to be written out once, but short
+// strings (IPC channel names, header names and values) land in the
+// inline buffer instead of a freshly allocated std::string. The pieces
+// stay valid for the lifetime of the arena, which is expected to live
+// on the stack of a single call.
+class StringArena {
+ public:
+  static const size_t kInlineSize = 512;
+
+  StringArena();
+  ~StringArena();
+
+  // Writes |val|'s UTF-8 contents into the arena and points |out| at
+  // them; returns false when |val| is not a string.
+  bool FromV8(v8::Isolate* isolate,
+              v8::Local<v8::Value> val,
+              base::StringPiece* out);
+
+ private:
+  char inline_buffer_[kInlineSize];
+  size_t used_ = 0;
+  // Strings that did not fit in the inline buffer, held by pointer so
+  // handed-out pieces stay valid when the vector grows.
+  std::vector<std::unique_ptr<std::string>> overflow_;
+
+  DISALLOW_COPY_AND_ASSIGN(StringArena);
+};
+
 template<>
 struct Converter<v8::Local<v8::Function> > {
   static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
@@ -5,6 +5,8 @@
 #ifndef NATIVE_MATE_DICTIONARY_H_
 #define NATIVE_MATE_DICTIONARY_H_
 
+#include <utility>
+
 #include "native_mate/converter.h"
 #include "native_mate/object_template_builder.h"
 
@@ -54,6 +56,33 @@ class Dictionary {
     return ConvertFromV8(isolate_, val, out);
   }
 
+  // Overload for pre-built key handles (see EternalKey() in converter.h),
+  // so hot-path callers don't allocate a new key string per lookup.
+  template<typename T>
+  bool Get(v8::Local<v8::String> key, T* out) const {
+    v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+    if (!internal::IsTrue(GetHandle()->Has(context, key)))
+      return false;
+
+    v8::Local<v8::Value> val;
+    if (!GetHandle()->Get(context, key).ToLocal(&val))
+      return false;
+    return ConvertFromV8(isolate_, val, out);
+  }
+
+  // Fetches several (key, out-pointer) pairs in one pass, sharing the
+  // context lookup across keys and skipping the per-key existence check
+  // that Get() pays; heavy options parsing becomes a single traversal.
+  // Absent (or undefined) keys leave their out parameter untouched.
+  // Returns the number of keys successfully converted.
+  //
+  //   options.GetMany("width", &width, "height", &height);
+  template<typename... KVPairs>
+  int GetMany(KVPairs&&... pairs) const {
+    return GetManyHelper(isolate_->GetCurrentContext(),
+                         std::forward<KVPairs>(pairs)...);
+  }
+
   template<typename T>
   bool GetHidden(const base::StringPiece& key, T* out) const {
     v8::Local<v8::Context> context = isolate_->GetCurrentContext();
@@ -80,6 +109,17 @@ class Dictionary {
     return !result.IsNothing() && result.FromJust();
   }
 
+  // Overload for pre-built key handles, matching Get() above.
+  template<typename T>
+  bool Set(v8::Local<v8::String> key, const T& val) {
+    v8::Local<v8::Value> v8_value;
+    if (!TryConvertToV8(isolate_, val, &v8_value))
+      return false;
+    v8::Maybe<bool> result =
+        GetHandle()->Set(isolate_->GetCurrentContext(), key, v8_value);
+    return !result.IsNothing() && result.FromJust();
+  }
+
   template<typename T>
   bool SetHidden(const base::StringPiece& key, T val) {
     v8::Local<v8::Value> v8_value;
@@ -129,6 +169,22 @@ class Dictionary {
   v8::Isolate* isolate_;
 
  private:
+  int GetManyHelper(v8::Local<v8::Context> context) const { return 0; }
+
+  template<typename T, typename... Rest>
+  int GetManyHelper(v8::Local<v8::Context> context,
+                    const base::StringPiece& key,
+                    T* out,
+                    Rest&&... rest) const {
+    int count = 0;
+    v8::Local<v8::Value> val;
+    if (GetHandle()->Get(context, StringToV8(isolate_, key)).ToLocal(&val) &&
+        !val->IsUndefined() && ConvertFromV8(isolate_, val, out)) {
+      count = 1;
+    }
+    return count + GetManyHelper(context, std::forward<Rest>(rest)...);
+  }
+
   v8::Local<v8::Object> object_;
 };
 
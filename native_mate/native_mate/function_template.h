@@ -5,8 +5,12 @@
 #ifndef NATIVE_MATE_FUNCTION_TEMPLATE_H_
 #define NATIVE_MATE_FUNCTION_TEMPLATE_H_
 
+#include <tuple>
+#include <type_traits>
+
 #include "base/callback.h"
 #include "base/logging.h"
+#include "base/trace_event/trace_event.h"
 #include "native_mate/arguments.h"
 #include "native_mate/wrappable_base.h"
 #include "v8/include/v8.h"
@@ -215,6 +219,104 @@ class Invoker<IndicesHolder<indices...>, ArgTypes...>
   Arguments* args_;
 };
 
+// Parameter types the fast invoker below can convert straight from the
+// callback info. The special types that reach into the Arguments object
+// (and anything unusual enough not to be on a hot path) stay on the
+// general Invoker.
+template <typename T>
+struct IsPlainArgument {
+  static const bool value = true;
+};
+template <>
+struct IsPlainArgument<Arguments> {
+  static const bool value = false;
+};
+template <>
+struct IsPlainArgument<Arguments*> {
+  static const bool value = false;
+};
+template <>
+struct IsPlainArgument<v8::Isolate*> {
+  static const bool value = false;
+};
+
+template <typename... ArgTypes>
+struct AllPlainArguments {
+  static const bool value = true;
+};
+template <typename ArgType, typename... ArgTypes>
+struct AllPlainArguments<ArgType, ArgTypes...> {
+  static const bool value =
+      IsPlainArgument<typename CallbackParamTraits<ArgType>::LocalType>::value &&
+      AllPlainArguments<ArgTypes...>::value;
+};
+
+// Allocation-free invoker used for the common signatures: the converted
+// arguments live in a tuple on the stack and conversion stops at the
+// first argument that fails, instead of running every ArgumentHolder
+// constructor and collecting their |ok| flags afterwards.
+template <typename IndicesType, typename... ArgTypes>
+class FastInvoker {};
+
+template <size_t... indices, typename... ArgTypes>
+class FastInvoker<IndicesHolder<indices...>, ArgTypes...> {
+ public:
+  FastInvoker(Arguments* args, int create_flags)
+      : args_(args), create_flags_(create_flags) {
+    ok_ = Convert(IndicesHolder<indices...>());
+  }
+
+  bool IsOK() { return ok_; }
+
+  template <typename ReturnType>
+  void DispatchToCallback(base::Callback<ReturnType(ArgTypes...)> callback) {
+    v8::MicrotasksScope script_scope(
+        args_->isolate(), v8::MicrotasksScope::kRunMicrotasks);
+    args_->Return(callback.Run(std::get<indices>(values_)...));
+  }
+
+  void DispatchToCallback(base::Callback<void(ArgTypes...)> callback) {
+    v8::MicrotasksScope script_scope(
+        args_->isolate(), v8::MicrotasksScope::kRunMicrotasks);
+    callback.Run(std::get<indices>(values_)...);
+  }
+
+ private:
+  bool Convert(IndicesHolder<>) { return true; }
+
+  template <size_t index, size_t... rest>
+  bool Convert(IndicesHolder<index, rest...>) {
+    if (index == 0 &&
+        (create_flags_ & HolderIsFirstArgument) &&
+        Destroyable::IsDestroyed(args_)) {
+      args_->ThrowError("Object has been destroyed");
+      return false;
+    }
+    if (!GetNextArgument(args_, create_flags_, index == 0,
+                         &std::get<index>(values_))) {
+      args_->ThrowError();
+      return false;
+    }
+    return Convert(IndicesHolder<rest...>());
+  }
+
+  Arguments* args_;
+  int create_flags_;
+  bool ok_;
+  std::tuple<typename CallbackParamTraits<ArgTypes>::LocalType...> values_;
+};
+
+// Picks FastInvoker for the signatures it supports and falls back to
+// the general Invoker for the rest. The arity cap keeps the expanded
+// Convert() chains small; anything longer is not a hot call anyway.
+template <typename IndicesType, typename... ArgTypes>
+struct InvokerFor {
+  using type = typename std::conditional<
+      sizeof...(ArgTypes) <= 4 && AllPlainArguments<ArgTypes...>::value,
+      FastInvoker<IndicesType, ArgTypes...>,
+      Invoker<IndicesType, ArgTypes...>>::type;
+};
+
 // DispatchToCallback converts all the JavaScript arguments to C++ types and
 // invokes the base::Callback.
 template <typename Sig>
@@ -224,6 +326,9 @@ template <typename ReturnType, typename... ArgTypes>
 struct Dispatcher<ReturnType(ArgTypes...)> {
   static void DispatchToCallback(
       const v8::FunctionCallbackInfo<v8::Value>& info) {
+    // This runs for every bound method call, so the category check is
+    // the only cost while tracing is off.
+    TRACE_EVENT0("electron.native_mate", "mate::DispatchToCallback");
     Arguments args(info);
     v8::Local<v8::External> v8_holder;
     args.GetData(&v8_holder);
@@ -234,7 +339,8 @@ struct Dispatcher<ReturnType(ArgTypes...)> {
     HolderT* holder = static_cast<HolderT*>(holder_base);
 
     using Indices = typename IndicesGenerator<sizeof...(ArgTypes)>::type;
-    Invoker<Indices, ArgTypes...> invoker(&args, holder->flags);
+    typename InvokerFor<Indices, ArgTypes...>::type invoker(&args,
+                                                            holder->flags);
     if (invoker.IsOK())
       invoker.DispatchToCallback(holder->callback);
   }
@@ -4,8 +4,78 @@
 
 #include "native_mate/object_template_builder.h"
 
+#include <map>
+#include <string>
+
 namespace mate {
 
+namespace internal {
+
+// Holds the factories for lazily installed methods of one object
+// template. A pointer travels to the interceptor below as the handler
+// data; the registry lives as long as the template (i.e. the isolate).
+class LazyMethodRegistry {
+ public:
+  using Factory = base::Callback<v8::Local<v8::FunctionTemplate>(v8::Isolate*)>;
+
+  void Add(const base::StringPiece& name, const Factory& factory) {
+    factories_[name.as_string()] = factory;
+  }
+
+  // Named property interceptor: builds, caches and returns the method's
+  // function on first lookup. Installed with kNonMasking, so once the
+  // function is defined as an own property the interceptor is skipped.
+  static void Getter(v8::Local<v8::Name> name,
+                     const v8::PropertyCallbackInfo<v8::Value>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    auto* registry = static_cast<LazyMethodRegistry*>(
+        v8::Local<v8::External>::Cast(info.Data())->Value());
+
+    if (!name->IsString())
+      return;
+    std::string method_name = V8ToString(name);
+    auto iter = registry->factories_.find(method_name);
+    if (iter == registry->factories_.end())
+      return;
+
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::Function> function;
+    if (!iter->second.Run(isolate)
+             ->GetFunction(context)
+             .ToLocal(&function)) {
+      return;
+    }
+    function->SetName(v8::Local<v8::String>::Cast(name));
+    info.Holder()->CreateDataProperty(context, name, function).FromJust();
+    info.GetReturnValue().Set(function);
+  }
+
+  // Keeps not-yet-materialized methods visible to enumeration; the ones
+  // already cached show up as plain own properties.
+  static void Enumerator(const v8::PropertyCallbackInfo<v8::Array>& info) {
+    v8::Isolate* isolate = info.GetIsolate();
+    auto* registry = static_cast<LazyMethodRegistry*>(
+        v8::Local<v8::External>::Cast(info.Data())->Value());
+
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    v8::Local<v8::Array> result = v8::Array::New(isolate);
+    uint32_t index = 0;
+    for (const auto& pair : registry->factories_) {
+      v8::Local<v8::String> name = StringToSymbol(isolate, pair.first);
+      v8::Maybe<bool> has = info.Holder()->HasOwnProperty(context, name);
+      if (has.IsJust() && has.FromJust())
+        continue;
+      result->Set(context, index++, name).FromJust();
+    }
+    info.GetReturnValue().Set(result);
+  }
+
+ private:
+  std::map<std::string, Factory> factories_;
+};
+
+}  // namespace internal
+
 ObjectTemplateBuilder::ObjectTemplateBuilder(
     v8::Isolate* isolate,
     v8::Local<v8::ObjectTemplate> templ)
@@ -21,6 +91,20 @@ ObjectTemplateBuilder& ObjectTemplateBuilder::SetImpl(
   return *this;
 }
 
+ObjectTemplateBuilder& ObjectTemplateBuilder::SetLazyMethodImpl(
+    const base::StringPiece& name, const LazyMethodFactory& factory) {
+  if (!lazy_registry_) {
+    lazy_registry_ = new internal::LazyMethodRegistry;
+    template_->SetHandler(v8::NamedPropertyHandlerConfiguration(
+        &internal::LazyMethodRegistry::Getter, nullptr, nullptr, nullptr,
+        &internal::LazyMethodRegistry::Enumerator,
+        v8::External::New(isolate_, lazy_registry_),
+        v8::PropertyHandlerFlags::kNonMasking));
+  }
+  lazy_registry_->Add(name, factory);
+  return *this;
+}
+
 ObjectTemplateBuilder& ObjectTemplateBuilder::SetPropertyImpl(
     const base::StringPiece& name, v8::Local<v8::FunctionTemplate> getter,
     v8::Local<v8::FunctionTemplate> setter) {
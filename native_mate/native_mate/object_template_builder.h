@@ -60,8 +60,20 @@ struct CallbackTraits<v8::Local<v8::FunctionTemplate> > {
   }
 };
 
+// Builds the function template for a lazily installed method; bound
+// with the native callback and run from the named property interceptor
+// the first time the method is looked up.
+template<typename T>
+v8::Local<v8::FunctionTemplate> CreateLazyTemplate(T callback,
+                                                   v8::Isolate* isolate) {
+  return CallbackTraits<T>::CreateTemplate(isolate, callback);
+}
+
 }  // namespace
 
+namespace internal {
+class LazyMethodRegistry;
+}
 
 // ObjectTemplateBuilder provides a handy interface to creating
 // v8::ObjectTemplate instances with various sorts of properties.
@@ -90,6 +102,17 @@ class ObjectTemplateBuilder {
     return SetImpl(name,
                    CallbackTraits<T>::CreateTemplate(isolate_, callback));
   }
+  // Like SetMethod, but defers building the v8::FunctionTemplate until
+  // the method is first looked up; never-used methods cost one registry
+  // entry instead of a template. The lazily created function is cached
+  // on the instantiated object, so later lookups skip the interceptor.
+  template<typename T>
+  ObjectTemplateBuilder& SetLazyMethod(const base::StringPiece& name,
+                                       T callback) {
+    return SetLazyMethodImpl(name, base::Bind(&CreateLazyTemplate<T>,
+                                              callback));
+  }
+
   template<typename T>
   ObjectTemplateBuilder& SetProperty(const base::StringPiece& name,
                                      T getter) {
@@ -114,8 +137,13 @@ class ObjectTemplateBuilder {
   v8::Local<v8::ObjectTemplate> Build();
 
  private:
+  using LazyMethodFactory =
+      base::Callback<v8::Local<v8::FunctionTemplate>(v8::Isolate*)>;
+
   ObjectTemplateBuilder& SetImpl(const base::StringPiece& name,
                                  v8::Local<v8::Data> val);
+  ObjectTemplateBuilder& SetLazyMethodImpl(const base::StringPiece& name,
+                                           const LazyMethodFactory& factory);
   ObjectTemplateBuilder& SetPropertyImpl(
       const base::StringPiece& name, v8::Local<v8::FunctionTemplate> getter,
       v8::Local<v8::FunctionTemplate> setter);
@@ -124,6 +152,10 @@ class ObjectTemplateBuilder {
 
   // ObjectTemplateBuilder should only be used on the stack.
   v8::Local<v8::ObjectTemplate> template_;
+
+  // Owned by the template (via an External) once the first lazy method
+  // is added; templates live for the isolate, so this is never freed.
+  internal::LazyMethodRegistry* lazy_registry_ = nullptr;
 };
 
 }  // namespace mate
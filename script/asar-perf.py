@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+
+"""Benchmarks the asar read path.
+
+Launches the asar benchmark app (tools/asar_perf) several times and
+collects header parse time vs. file count, random lookup rate,
+sequential and random read bandwidth, and a require-storm simulation.
+Results are reported as machine-readable JSON with per-metric medians,
+suitable for comparing archive format changes.
+
+Build the electron_asar_perftests target first, then run:
+
+  script/asar-perf.py --build-dir out/R --runs 5 --output results.json
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+SOURCE_ROOT = os.path.abspath(os.path.dirname(os.path.dirname(__file__)))
+RESULT_PREFIX = 'ASAR_PERF_RESULT '
+APP_PATH = os.path.join(SOURCE_ROOT, 'tools', 'asar_perf')
+
+
+def electron_binary(build_dir):
+  if sys.platform == 'darwin':
+    return os.path.join(build_dir, 'Electron.app', 'Contents', 'MacOS',
+                        'Electron')
+  elif sys.platform == 'win32':
+    return os.path.join(build_dir, 'electron.exe')
+  else:
+    return os.path.join(build_dir, 'electron')
+
+
+def run_once(binary):
+  output = subprocess.check_output([binary, APP_PATH])
+  for line in output.splitlines():
+    line = line.decode('utf-8') if isinstance(line, bytes) else line
+    if line.startswith(RESULT_PREFIX):
+      return json.loads(line[len(RESULT_PREFIX):])
+  raise RuntimeError('no result line in benchmark output')
+
+
+def median(values):
+  ordered = sorted(values)
+  middle = len(ordered) // 2
+  if len(ordered) % 2 == 1:
+    return ordered[middle]
+  return (ordered[middle - 1] + ordered[middle]) / 2.0
+
+
+def aggregate(runs):
+  keys = set()
+  for run in runs:
+    keys.update(run.keys())
+  return {key: median([run[key] for run in runs if key in run])
+          for key in keys}
+
+
+def main():
+  args = parse_args()
+  binary = electron_binary(args.build_dir)
+  if not os.path.exists(binary):
+    print('electron binary not found at {0}'.format(binary))
+    return 1
+
+  runs = [run_once(binary) for _ in range(args.runs)]
+
+  results = {
+    'medians': aggregate(runs),
+    'runs': runs,
+  }
+  output = json.dumps(results, indent=2, sort_keys=True)
+  if args.output:
+    with open(args.output, 'w') as f:
+      f.write(output + '\n')
+  else:
+    print(output)
+  return 0
+
+
+def parse_args():
+  parser = argparse.ArgumentParser(description='Benchmark the asar read '
+                                               'path')
+  parser.add_argument('--build-dir', default=os.path.join('out', 'R'),
+                      help='Directory containing the electron binary')
+  parser.add_argument('--runs', type=int, default=5,
+                      help='Number of benchmark runs to aggregate')
+  parser.add_argument('--output',
+                      help='Write JSON results to this file instead of '
+                           'stdout')
+  return parser.parse_args()
+
+
+if __name__ == '__main__':
+  sys.exit(main())
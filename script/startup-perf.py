@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+
+"""Measures cold and warm Electron startup.
+
+Launches the startup benchmark app (tools/startup_perf) several times and
+collects the AtomBrowserMainParts phase timings reported by
+app.getStartupTimings(), plus first window paint and first renderer IPC.
+The first run after a build is reported as "cold", subsequent runs as
+"warm" with per-phase medians, as machine-readable JSON suitable for
+trending in CI.
+
+Build the electron_startup_perftests target first, then run:
+
+  script/startup-perf.py --build-dir out/R --runs 10 --output results.json
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+SOURCE_ROOT = os.path.abspath(os.path.dirname(os.path.dirname(__file__)))
+RESULT_PREFIX = 'STARTUP_PERF_RESULT '
+APP_PATH = os.path.join(SOURCE_ROOT, 'tools', 'startup_perf')
+
+
+def electron_binary(build_dir):
+  if sys.platform == 'darwin':
+    return os.path.join(build_dir, 'Electron.app', 'Contents', 'MacOS',
+                        'Electron')
+  elif sys.platform == 'win32':
+    return os.path.join(build_dir, 'electron.exe')
+  else:
+    return os.path.join(build_dir, 'electron')
+
+
+def run_once(binary):
+  output = subprocess.check_output([binary, APP_PATH])
+  for line in output.splitlines():
+    line = line.decode('utf-8') if isinstance(line, bytes) else line
+    if line.startswith(RESULT_PREFIX):
+      return json.loads(line[len(RESULT_PREFIX):])
+  raise RuntimeError('no result line in benchmark output')
+
+
+def median(values):
+  ordered = sorted(values)
+  middle = len(ordered) // 2
+  if len(ordered) % 2 == 1:
+    return ordered[middle]
+  return (ordered[middle - 1] + ordered[middle]) / 2.0
+
+
+def aggregate(runs):
+  keys = set()
+  for run in runs:
+    keys.update(run.keys())
+  return {key: median([run[key] for run in runs if key in run])
+          for key in keys}
+
+
+def main():
+  args = parse_args()
+  binary = electron_binary(args.build_dir)
+  if not os.path.exists(binary):
+    print('electron binary not found at {0}'.format(binary))
+    return 1
+
+  # The first launch pays for cold page/disk caches; keep it separate so
+  # warm-start numbers are not skewed by it.
+  cold = run_once(binary)
+  warm_runs = [run_once(binary) for _ in range(args.runs)]
+
+  results = {
+    'cold': cold,
+    'warm': {
+      'medians': aggregate(warm_runs),
+      'runs': warm_runs,
+    },
+  }
+  output = json.dumps(results, indent=2, sort_keys=True)
+  if args.output:
+    with open(args.output, 'w') as f:
+      f.write(output + '\n')
+  else:
+    print(output)
+  return 0
+
+
+def parse_args():
+  parser = argparse.ArgumentParser(description='Measure Electron startup')
+  parser.add_argument('--build-dir', default=os.path.join('out', 'R'),
+                      help='Directory containing the electron binary')
+  parser.add_argument('--runs', type=int, default=10,
+                      help='Number of warm runs after the cold one')
+  parser.add_argument('--output',
+                      help='Write JSON results to this file instead of '
+                           'stdout')
+  return parser.parse_args()
+
+
+if __name__ == '__main__':
+  sys.exit(main())
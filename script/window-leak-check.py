@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+
+"""Checks for memory growth across repeated window open/close cycles.
+
+Launches the leak harness app (tools/window_leak), which opens and
+closes a window N times and snapshots per-process memory and live
+wrapper counts after a forced GC each cycle. The run fails — with a
+non-zero exit code suitable for CI — when wrappers outlive their
+windows or a memory series grows monotonically above the noise floor.
+
+Build the electron_window_leaktests target first, then run:
+
+  script/window-leak-check.py --build-dir out/R --cycles 20
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+SOURCE_ROOT = os.path.abspath(os.path.dirname(os.path.dirname(__file__)))
+RESULT_PREFIX = 'WINDOW_LEAK_RESULT '
+APP_PATH = os.path.join(SOURCE_ROOT, 'tools', 'window_leak')
+
+
+def electron_binary(build_dir):
+  if sys.platform == 'darwin':
+    return os.path.join(build_dir, 'Electron.app', 'Contents', 'MacOS',
+                        'Electron')
+  elif sys.platform == 'win32':
+    return os.path.join(build_dir, 'electron.exe')
+  else:
+    return os.path.join(build_dir, 'electron')
+
+
+def main():
+  args = parse_args()
+  binary = electron_binary(args.build_dir)
+  if not os.path.exists(binary):
+    print('electron binary not found at {0}'.format(binary))
+    return 1
+
+  env = os.environ.copy()
+  env['WINDOW_LEAK_CYCLES'] = str(args.cycles)
+  process = subprocess.Popen([binary, APP_PATH], env=env,
+                             stdout=subprocess.PIPE)
+  stdout, _ = process.communicate()
+
+  result = None
+  for line in stdout.splitlines():
+    line = line.decode('utf-8') if isinstance(line, bytes) else line
+    if line.startswith(RESULT_PREFIX):
+      result = json.loads(line[len(RESULT_PREFIX):])
+  if result is None:
+    print('no result line in harness output')
+    return 1
+
+  output = json.dumps(result, indent=2, sort_keys=True)
+  if args.output:
+    with open(args.output, 'w') as f:
+      f.write(output + '\n')
+  else:
+    print(output)
+
+  if not result['passed']:
+    for failure in result['failures']:
+      print('LEAK: {0}'.format(failure))
+    return 1
+  return 0
+
+
+def parse_args():
+  parser = argparse.ArgumentParser(description='Check window lifecycle '
+                                               'memory growth')
+  parser.add_argument('--build-dir', default=os.path.join('out', 'R'),
+                      help='Directory containing the electron binary')
+  parser.add_argument('--cycles', type=int, default=20,
+                      help='Number of measured open/close cycles')
+  parser.add_argument('--output',
+                      help='Write JSON results to this file instead of '
+                           'stdout')
+  return parser.parse_args()
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -823,6 +823,35 @@ describe('app module', () => {
     })
   })
 
+  describe('getAllocatorStats() API', () => {
+    it('reports allocator stats or marks them unsupported', () => {
+      const stats = app.getAllocatorStats()
+      expect(stats).to.have.own.property('supported').that.is.a('boolean')
+      if (stats.supported) {
+        expect(stats.allocatedSize).to.be.above(0, 'allocated size is not > 0')
+        expect(stats.heapSize).to.be.at.least(stats.allocatedSize)
+      }
+    })
+
+    it('can release free memory', () => {
+      app.releaseFreeMemory()
+    })
+  })
+
+  describe('getLongTaskMetrics() API', () => {
+    it('returns zeroed counters before monitoring starts', () => {
+      const metrics = app.getLongTaskMetrics()
+      expect(metrics).to.have.own.property('longTaskCount').that.is.a('number')
+      expect(metrics).to.have.own.property('totalDuration').that.is.a('number')
+      expect(metrics).to.have.own.property('maxDuration').that.is.a('number')
+    })
+
+    it('can start and stop monitoring', () => {
+      app.startLongTaskMonitoring({threshold: 100})
+      app.stopLongTaskMonitoring()
+    })
+  })
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus()
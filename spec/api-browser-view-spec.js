@@ -108,6 +108,23 @@ describe('BrowserView module', () => {
       w.setBrowserView(view)
       w.setBrowserView(view)
     })
+
+    it('reattaches a detached view to another window without reloading', (done) => {
+      view = new BrowserView()
+      w.setBrowserView(view)
+      view.webContents.once('did-finish-load', () => {
+        w.setBrowserView(null)
+        const w2 = new BrowserWindow({show: false})
+        view.webContents.once('did-start-loading', () => {
+          done(new Error('view should not reload when reattached'))
+        })
+        w2.setBrowserView(view)
+        expect(w2.getBrowserView().webContents.id).to.equal(view.webContents.id)
+        w2.setBrowserView(null)
+        closeWindow(w2).then(() => done())
+      })
+      view.webContents.loadURL('about:blank')
+    })
   })
 
   describe('BrowserWindow.getBrowserView()', () => {
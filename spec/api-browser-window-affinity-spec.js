@@ -4,7 +4,7 @@ const {expect} = require('chai')
 const path = require('path')
 
 const {remote} = require('electron')
-const {ipcMain, BrowserWindow} = remote
+const {app, ipcMain, BrowserWindow} = remote
 const {closeWindow} = require('./window-helpers')
 
 describe('BrowserWindow with affinity module', () => {
@@ -88,6 +88,44 @@ describe('BrowserWindow with affinity module', () => {
     })
   })
 
+  describe('BrowserWindow with a default affinity', () => {
+    before(() => {
+      app.setDefaultRendererAffinity('defaultAffinityGroup')
+    })
+
+    after(() => {
+      app.setDefaultRendererAffinity('')
+    })
+
+    it('groups windows that do not set their own affinity', done => {
+      Promise.all([
+        createWindowWithWebPrefs({}),
+        createWindowWithWebPrefs({})
+      ]).then(([w1, w2]) => {
+        expect(w1.webContents.getOSProcessId())
+          .to.equal(w2.webContents.getOSProcessId(), 'Should have the same OS process ID')
+        return Promise.all([
+          closeWindow(w1, {assertSingleWindow: false}),
+          closeWindow(w2, {assertSingleWindow: false})
+        ])
+      }).then(() => { done() })
+    })
+
+    it('lets a window opt into its own group over the default', done => {
+      Promise.all([
+        createWindowWithWebPrefs({}),
+        createWindowWithWebPrefs({ affinity: 'notTheDefaultGroup' })
+      ]).then(([w1, w2]) => {
+        expect(w1.webContents.getOSProcessId())
+          .to.not.equal(w2.webContents.getOSProcessId(), 'Should have different OS process IDs')
+        return Promise.all([
+          closeWindow(w1, {assertSingleWindow: false}),
+          closeWindow(w2, {assertSingleWindow: false})
+        ])
+      }).then(() => { done() })
+    })
+  })
+
   describe(`BrowserWindow with an affinity : nodeIntegration=false`, () => {
     const preload = path.join(fixtures, 'module', 'send-later.js')
     const affinityWithNodeTrue = 'affinityWithNodeTrue'
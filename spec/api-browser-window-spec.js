@@ -375,6 +375,21 @@ describe('BrowserWindow module', () => {
       })
       w.hide()
     })
+    it('emits occlusion-changed and updates isOccluded', (done) => {
+      w.show()
+      assert.equal(w.isOccluded(), false)
+      w.once('occlusion-changed', (event, occluded) => {
+        assert.equal(occluded, true)
+        assert.equal(w.isOccluded(), true)
+        w.once('occlusion-changed', (event, occluded) => {
+          assert.equal(occluded, false)
+          assert.equal(w.isOccluded(), false)
+          done()
+        })
+        w.show()
+      })
+      w.hide()
+    })
   })
 
   describe('BrowserWindow.showInactive()', () => {
@@ -862,6 +877,89 @@ describe('BrowserWindow module', () => {
     })
   })
 
+  describe('BrowserWindow.prewarm(options)', () => {
+    const poolOptions = {width: 320, height: 240}
+
+    afterEach(() => {
+      BrowserWindow.clearPool()
+    })
+
+    it('pools hidden windows that can be claimed later', () => {
+      BrowserWindow.prewarm(poolOptions, 2)
+      assert.equal(BrowserWindow.getPoolSize(poolOptions), 2)
+
+      const claimed = BrowserWindow.fromPool(poolOptions)
+      assert.notEqual(claimed, null)
+      assert.equal(claimed.isVisible(), false)
+      assert.equal(BrowserWindow.getPoolSize(poolOptions), 1)
+      claimed.destroy()
+    })
+
+    it('returns null when the pool is empty', () => {
+      assert.equal(BrowserWindow.fromPool(poolOptions), null)
+    })
+
+    it('removes closed windows from the pool', () => {
+      BrowserWindow.prewarm(poolOptions)
+      const pooled = BrowserWindow.getAllWindows().find((win) => win !== w)
+      pooled.destroy()
+      assert.equal(BrowserWindow.getPoolSize(poolOptions), 0)
+    })
+
+    it('clearPool destroys pooled windows', () => {
+      BrowserWindow.prewarm(poolOptions, 2)
+      BrowserWindow.clearPool(poolOptions)
+      assert.equal(BrowserWindow.getPoolSize(poolOptions), 0)
+    })
+  })
+
+  describe('BrowserWindow.setFrameRate(frameRate)', () => {
+    it('make window with initial frame rate cap', () => {
+      w.destroy()
+      w = new BrowserWindow({
+        show: false,
+        width: 400,
+        height: 400,
+        frameRate: 4
+      })
+      assert.equal(w.getFrameRate(), 4)
+    })
+    it('allows adjusting the cap at runtime', () => {
+      w.setFrameRate(30)
+      assert.equal(w.getFrameRate(), 30)
+      w.setFrameRate(0)
+      assert.equal(w.getFrameRate(), 0)
+    })
+    it('rejects rates out of range', () => {
+      assert.throws(() => {
+        w.setFrameRate(-1)
+      }, /frameRate must be between 0 and 240/)
+      assert.throws(() => {
+        w.setFrameRate(1000)
+      }, /frameRate must be between 0 and 240/)
+    })
+  })
+
+  describe('BrowserWindow.animateBounds(bounds, duration[, easing])', () => {
+    it('animates to the target bounds and emits the finished event', (done) => {
+      const target = {x: 100, y: 100, width: 400, height: 300}
+      w.once('bounds-animation-finished', () => {
+        assertBoundsEqual(w.getBounds(), target)
+        done()
+      })
+      w.animateBounds(target, 50)
+    })
+    it('rejects invalid durations and easings', () => {
+      const target = {x: 100, y: 100, width: 400, height: 300}
+      assert.throws(() => {
+        w.animateBounds(target, 0)
+      }, /duration must be a positive number of milliseconds/)
+      assert.throws(() => {
+        w.animateBounds(target, 50, 'bounce')
+      }, /easing must be one of/)
+    })
+  })
+
   describe('BrowserWindow.setOpacity(opacity)', () => {
     it('make window with initial opacity', () => {
       w.destroy()
@@ -2141,6 +2239,19 @@ describe('BrowserWindow module', () => {
       })
       w.loadURL('file://' + fixtures + '/pages/save_page/index.html')
     })
+
+    it('should save page as MHTML to disk', (done) => {
+      const savePageMhtmlPath = path.join(fixtures, 'save_page.mhtml')
+      w.webContents.on('did-finish-load', () => {
+        w.webContents.savePage(savePageMhtmlPath, 'MHTML', function (error) {
+          assert.equal(error, null)
+          assert(fs.statSync(savePageMhtmlPath).size > 0)
+          fs.unlinkSync(savePageMhtmlPath)
+          done()
+        })
+      })
+      w.loadURL('file://' + fixtures + '/pages/save_page/index.html')
+    })
   })
 
   describe('BrowserWindow options argument is optional', () => {
@@ -3228,6 +3339,35 @@ describe('BrowserWindow module', () => {
         w.loadURL('file://' + fixtures + '/api/offscreen-rendering.html')
       })
     })
+
+    describe('window.webContents.setPaintDamagedRegionOnly(onlyDamaged)', () => {
+      it('round-trips the setting', (done) => {
+        w.webContents.on('dom-ready', () => {
+          assert.equal(w.webContents.paintsDamagedRegionOnly(), false)
+          w.webContents.setPaintDamagedRegionOnly(true)
+          assert.equal(w.webContents.paintsDamagedRegionOnly(), true)
+          w.webContents.setPaintDamagedRegionOnly(false)
+          done()
+        })
+        w.loadURL('file://' + fixtures + '/api/offscreen-rendering.html')
+      })
+    })
+
+    describe('window.webContents.setAsynchronousPaintDispatch(enabled)', () => {
+      it('still delivers paint events when enabled', (done) => {
+        w.webContents.on('dom-ready', () => {
+          w.webContents.setAsynchronousPaintDispatch(true)
+          assert.equal(w.webContents.usesAsynchronousPaintDispatch(), true)
+          w.webContents.once('paint', function (event, rect, data) {
+            assert.notEqual(data.length, 0)
+            w.webContents.setAsynchronousPaintDispatch(false)
+            assert.equal(w.webContents.usesAsynchronousPaintDispatch(), false)
+            done()
+          })
+        })
+        w.loadURL('file://' + fixtures + '/api/offscreen-rendering.html')
+      })
+    })
   })
 })
 
@@ -123,6 +123,24 @@ describe('clipboard module', () => {
     })
   })
 
+  describe('clipboard.writeDeferred(formats, provider)', () => {
+    it('renders a format when it is requested', () => {
+      let requested = []
+      clipboard.writeDeferred(['text/electron-spec'], (format) => {
+        requested.push(format)
+        return Buffer.from('deferred payload', 'utf8')
+      })
+      expect(clipboard.read('text/electron-spec')).to.equal('deferred payload')
+      expect(requested).to.include('text/electron-spec')
+    })
+
+    it('throws an error when no formats are given', () => {
+      expect(() => {
+        clipboard.writeDeferred([], () => '')
+      }).to.throw(/formats must not be empty/)
+    })
+  })
+
   describe('clipboard.readBuffer(format)', () => {
     before(function () {
       if (process.platform !== 'darwin') {
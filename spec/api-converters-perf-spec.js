@@ -0,0 +1,138 @@
+'use strict'
+
+const chai = require('chai')
+const dirtyChai = require('dirty-chai')
+
+const {expect} = chai
+chai.use(dirtyChai)
+
+const {ipcRenderer, remote, webFrame} = require('electron')
+
+// Benchmarks for the conversion layer every API call goes through:
+// native_mate's function_template dispatch, V8ValueConverter for IPC
+// payloads, net_converter-shaped header maps and blink_converter input
+// events. The assertions only check that values survive the round trip;
+// the interesting output is the rates logged below, tracked release to
+// release in CI.
+describe('converters performance', function () {
+  this.timeout(60000)
+
+  const report = (name, value) => {
+    console.log(`        [perf] ${name}: ${value}`)
+  }
+
+  it('dispatches native_mate bound methods at a high rate', () => {
+    // webFrame.getZoomFactor is a trivial in-process call, so the time
+    // measured is almost entirely function_template.h dispatch plus the
+    // return value conversion.
+    const count = 100000
+    const start = Date.now()
+    for (let i = 0; i < count; i++) {
+      webFrame.getZoomFactor()
+    }
+    const elapsed = Date.now() - start
+    expect(webFrame.getZoomFactor()).to.be.a('number')
+    report('native method dispatch', `${Math.round(count / (elapsed / 1000))} calls/s`)
+  })
+
+  it('round-trips options-style dictionaries', () => {
+    // Shaped like a typical BrowserWindow/webPreferences options object:
+    // nested dicts with mixed bools, numbers and strings.
+    const options = {
+      width: 800,
+      height: 600,
+      show: false,
+      title: 'perf window',
+      webPreferences: {
+        nodeIntegration: true,
+        contextIsolation: false,
+        preload: '/tmp/long/path/to/some/preload/script.js',
+        zoomFactor: 1.25
+      }
+    }
+    const count = 5000
+    const start = Date.now()
+    for (let i = 0; i < count; i++) {
+      ipcRenderer.sendSync('echo', options)
+    }
+    const elapsed = Date.now() - start
+    expect(ipcRenderer.sendSync('echo', options)).to.deep.equal(options)
+    // Each iteration runs V8ValueConverter four times: serialize and
+    // parse in each direction.
+    report('options dict round trip', `${Math.round(count / (elapsed / 1000))} dicts/s`)
+  })
+
+  it('round-trips large flat arrays', () => {
+    const array = new Array(100000)
+    for (let i = 0; i < array.length; i++) {
+      array[i] = i
+    }
+    const rounds = 20
+    const start = Date.now()
+    for (let i = 0; i < rounds; i++) {
+      ipcRenderer.sendSync('echo', array)
+    }
+    const elapsed = Date.now() - start
+    expect(ipcRenderer.sendSync('echo', array).length).to.equal(array.length)
+    const elements = array.length * rounds
+    report('large array throughput', `${Math.round(elements / (elapsed / 1000))} elements/s`)
+  })
+
+  it('round-trips multi-megabyte strings', () => {
+    // Dominated by the string transcoding at the V8 boundary: the ASCII
+    // body should take the one-byte fast paths in both directions, the
+    // mixed body pays for real UTF-8 transcoding.
+    const asciiBody = 'abcdefgh'.repeat(512 * 1024)  // 4 MB.
+    const mixedBody = 'abcdefgé'.repeat(512 * 1024)
+    const rounds = 20
+    for (const [name, body] of [['ascii', asciiBody], ['mixed', mixedBody]]) {
+      const start = Date.now()
+      for (let i = 0; i < rounds; i++) {
+        ipcRenderer.sendSync('echo', body)
+      }
+      const elapsed = Date.now() - start
+      expect(ipcRenderer.sendSync('echo', body)).to.equal(body)
+      const megabytes = (body.length * rounds) / (1024 * 1024)
+      report(`${name} string throughput`,
+        `${Math.round(megabytes / (elapsed / 1000))} MB/s`)
+    }
+  })
+
+  it('round-trips header-map-shaped objects', () => {
+    // Shaped like the requestHeaders/responseHeaders dictionaries built
+    // by net_converter: many short string keys and values.
+    const headers = {}
+    for (let i = 0; i < 40; i++) {
+      headers[`X-Custom-Header-${i}`] = `value-${i}-abcdefghijklmnopqrstuvwxyz`
+    }
+    const count = 5000
+    const start = Date.now()
+    for (let i = 0; i < count; i++) {
+      ipcRenderer.sendSync('echo', headers)
+    }
+    const elapsed = Date.now() - start
+    expect(ipcRenderer.sendSync('echo', headers)).to.deep.equal(headers)
+    report('header map round trip', `${Math.round(count / (elapsed / 1000))} maps/s`)
+  })
+
+  it('converts input event dictionaries', () => {
+    // Exercises blink_converter's WebInputEvent conversion through
+    // sendInputEvent. The remote call adds IPC overhead on top of the
+    // conversion itself, so treat this as a boundary-layer figure
+    // rather than a pure converter one.
+    const contents = remote.getCurrentWebContents()
+    const count = 1000
+    const start = Date.now()
+    for (let i = 0; i < count; i++) {
+      contents.sendInputEvent({
+        type: 'mouseMove',
+        x: i % 200,
+        y: (i * 7) % 200,
+        movementX: 1,
+        movementY: 1
+      })
+    }
+    const elapsed = Date.now() - start
+    report('input event conversion', `${Math.round(count / (elapsed / 1000))} events/s`)
+  })
+})
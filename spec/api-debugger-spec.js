@@ -129,6 +129,51 @@ describe('debugger module', () => {
       w.webContents.debugger.sendCommand('Console.enable')
     })
 
+    it('returns raw responses from sendRawCommand', done => {
+      w.webContents.loadURL('about:blank')
+      try {
+        w.webContents.debugger.attach()
+      } catch (err) {
+        return done(`unexpected error : ${err}`)
+      }
+
+      const params = JSON.stringify({expression: '4+2'})
+      w.webContents.debugger.sendRawCommand('Runtime.evaluate', params,
+        (response) => {
+          const parsed = JSON.parse(response)
+          expect(parsed.result.result.value).to.equal(6)
+
+          w.webContents.debugger.detach()
+          done()
+        })
+    })
+
+    it('delivers batched raw events when batching is enabled', done => {
+      const url = process.platform !== 'win32'
+        ? `file://${path.join(fixtures, 'pages', 'a.html')}`
+        : `file:///${path.join(fixtures, 'pages', 'a.html').replace(/\\/g, '/')}`
+      w.webContents.loadURL(url)
+
+      try {
+        w.webContents.debugger.attach()
+      } catch (err) {
+        done(`unexpected error : ${err}`)
+      }
+
+      w.webContents.debugger.setMessageBatching(true)
+      w.webContents.debugger.on('messages', (e, messages) => {
+        const parsed = messages.map((message) => JSON.parse(message))
+        const added = parsed.find((m) => m.method === 'Console.messageAdded')
+        if (added) {
+          expect(added.params.message.text).to.equal('a')
+
+          w.webContents.debugger.detach()
+          done()
+        }
+      })
+      w.webContents.debugger.sendCommand('Console.enable')
+    })
+
     it('returns error message when command fails', done => {
       w.webContents.loadURL('about:blank')
       try {
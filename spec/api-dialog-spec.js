@@ -23,6 +23,10 @@ describe('dialog module', () => {
       expect(() => {
         dialog.showOpenDialog({message: {}})
       }).to.throw(/Message must be a string/)
+
+      expect(() => {
+        dialog.showOpenDialog({streamBatches: true})
+      }).to.throw(/streamBatches requires a callback/)
     })
   })
 
@@ -33,4 +33,17 @@ describe('globalShortcut module', () => {
     globalShortcut.unregisterAll()
     expect(globalShortcut.isRegistered(accelerator)).to.be.false()
   })
+
+  it('can register and unregister multiple accelerators', () => {
+    const accelerators = ['CommandOrControl+X+1', 'CommandOrControl+X+2']
+
+    expect(globalShortcut.isRegistered(accelerators[0])).to.be.false()
+    expect(globalShortcut.isRegistered(accelerators[1])).to.be.false()
+    globalShortcut.registerAll(accelerators, () => {})
+    expect(globalShortcut.isRegistered(accelerators[0])).to.be.true()
+    expect(globalShortcut.isRegistered(accelerators[1])).to.be.true()
+    globalShortcut.unregisterSome(accelerators)
+    expect(globalShortcut.isRegistered(accelerators[0])).to.be.false()
+    expect(globalShortcut.isRegistered(accelerators[1])).to.be.false()
+  })
 })
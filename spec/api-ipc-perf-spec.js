@@ -0,0 +1,72 @@
+'use strict'
+
+const chai = require('chai')
+const dirtyChai = require('dirty-chai')
+
+const {expect} = chai
+chai.use(dirtyChai)
+
+const {ipcRenderer} = require('electron')
+
+// Benchmarks covering the atom_api_renderer_ipc ->
+// AtomFrameHostMsg_Message -> atom_api_web_contents round trip. The
+// assertions only check that traffic makes it through; the interesting
+// output is the rates logged below, tracked release to release in CI.
+describe('ipc performance', function () {
+  this.timeout(60000)
+
+  const report = (name, value) => {
+    console.log(`        [perf] ${name}: ${value}`)
+  }
+
+  it('sustains a high small-message rate', (done) => {
+    const count = 2000
+    let received = 0
+    const start = Date.now()
+    const listener = () => {
+      if (++received === count) {
+        const elapsed = Date.now() - start
+        ipcRenderer.removeListener('message', listener)
+        report('small-message rate', `${Math.round(count / (elapsed / 1000))} msg/s`)
+        done()
+      }
+    }
+    ipcRenderer.on('message', listener)
+    for (let i = 0; i < count; i++) {
+      ipcRenderer.send('message', i)
+    }
+  })
+
+  it('sustains large-buffer bandwidth', (done) => {
+    const buffer = Buffer.alloc(8 * 1024 * 1024, 0x62)
+    const rounds = 4
+    let received = 0
+    const start = Date.now()
+    const listener = (event, message) => {
+      expect(message.length).to.equal(buffer.length)
+      if (++received === rounds) {
+        const elapsed = Date.now() - start
+        ipcRenderer.removeListener('message', listener)
+        // Each round crosses the boundary twice: renderer -> browser
+        // and the echo back.
+        const megabytes = (buffer.length * rounds * 2) / (1024 * 1024)
+        report('large-buffer bandwidth', `${Math.round(megabytes / (elapsed / 1000))} MB/s`)
+        done()
+      } else {
+        ipcRenderer.send('message', buffer)
+      }
+    }
+    ipcRenderer.on('message', listener)
+    ipcRenderer.send('message', buffer)
+  })
+
+  it('measures sync round-trip latency', () => {
+    const count = 200
+    const start = Date.now()
+    for (let i = 0; i < count; i++) {
+      expect(ipcRenderer.sendSync('echo', i)).to.equal(i)
+    }
+    const elapsed = Date.now() - start
+    report('sync round-trip latency', `${(elapsed / count).toFixed(2)} ms avg`)
+  })
+})
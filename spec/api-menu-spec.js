@@ -590,6 +590,28 @@ describe('Menu module', () => {
     })
   })
 
+  describe('Menu.remove', () => {
+    it('should remove the item at the given index', () => {
+      const menu = Menu.buildFromTemplate([
+        {label: '1'},
+        {label: '2'},
+        {label: '3'}
+      ])
+
+      menu.remove(1)
+      assert.equal(menu.items.length, 2)
+      assert.equal(menu.items[0].label, '1')
+      assert.equal(menu.items[1].label, '3')
+    })
+
+    it('throws when the index is out of range', () => {
+      const menu = Menu.buildFromTemplate([{label: '1'}])
+      assert.throws(() => {
+        menu.remove(5)
+      }, /Cannot remove item at position 5/)
+    })
+  })
+
   describe('Menu.append', () => {
     it('should add the item to the end of the menu', () => {
       const menu = Menu.buildFromTemplate([
@@ -242,6 +242,37 @@ describe('net module', () => {
       session.defaultSession.webRequest.onBeforeRequest(null)
     })
 
+    it('should send a Connection close header when keepAlive is false', (done) => {
+      const requestUrl = '/requestUrl'
+      server.on('request', (request, response) => {
+        switch (request.url) {
+          case requestUrl:
+            assert.equal(request.headers.connection, 'close')
+            response.statusCode = 200
+            response.statusMessage = 'OK'
+            response.end()
+            break
+          default:
+            handleUnexpectedURL(request, response)
+        }
+      })
+      const urlRequest = net.request({
+        method: 'GET',
+        url: `${server.url}${requestUrl}`,
+        keepAlive: false
+      })
+      urlRequest.on('response', (response) => {
+        assert.equal(response.statusCode, 200)
+        response.pause()
+        response.on('data', () => {})
+        response.on('end', () => {
+          done()
+        })
+        response.resume()
+      })
+      urlRequest.end()
+    })
+
     it('request/response objects should emit expected events', (done) => {
       const requestUrl = '/requestUrl'
       const bodyData = randomString(kOneMegaByte)
@@ -1408,6 +1439,41 @@ describe('net module', () => {
       urlRequest.end()
     })
 
+    it('should expose connection info on the response', (done) => {
+      const requestUrl = '/requestUrl'
+      server.on('request', (request, response) => {
+        switch (request.url) {
+          case requestUrl:
+            response.statusCode = 200
+            response.statusMessage = 'OK'
+            response.end()
+            break
+          default:
+            handleUnexpectedURL(request, response)
+        }
+      })
+      const urlRequest = net.request(`${server.url}${requestUrl}`)
+      urlRequest.on('response', (response) => {
+        const connectionInfo = response.connectionInfo
+        assert(typeof connectionInfo === 'object')
+        assert(typeof connectionInfo.reused === 'boolean')
+        assert(typeof connectionInfo.fromCache === 'boolean')
+        assert(typeof connectionInfo.protocol === 'string')
+        assert(connectionInfo.protocol.length > 0)
+        assert(typeof connectionInfo.connectTime === 'number')
+        assert(typeof connectionInfo.sslTime === 'number')
+        assert(typeof connectionInfo.timeToFirstByte === 'number')
+        assert(connectionInfo.timeToFirstByte >= 0)
+        response.pause()
+        response.on('data', () => {})
+        response.on('end', () => {
+          done()
+        })
+        response.resume()
+      })
+      urlRequest.end()
+    })
+
     it('should be able to pipe a net response into a writable stream', (done) => {
       const nodeRequestUrl = '/nodeRequestUrl'
       const netRequestUrl = '/netRequestUrl'
@@ -1619,6 +1685,52 @@ describe('net module', () => {
       `)
     })
   })
+
+  describe('host resolution API', () => {
+    it('resolves localhost to an address', (done) => {
+      net.resolveHost('localhost', (error, addresses) => {
+        assert.equal(error, null)
+        assert(Array.isArray(addresses))
+        assert(addresses.length > 0)
+        done()
+      })
+    })
+
+    it('answers repeated lookups from the cache', (done) => {
+      net.resolveHost('localhost', (error) => {
+        assert.equal(error, null)
+        const before = net.getHostResolverStats().hits
+        net.resolveHost('localhost', (error, addresses) => {
+          assert.equal(error, null)
+          assert(addresses.length > 0)
+          assert(net.getHostResolverStats().hits > before)
+          done()
+        })
+      })
+    })
+
+    it('reports cache stats', () => {
+      const stats = net.getHostResolverStats()
+      assert.equal(typeof stats.size, 'number')
+      assert.equal(typeof stats.hits, 'number')
+      assert.equal(typeof stats.misses, 'number')
+      assert.equal(typeof stats.evictions, 'number')
+    })
+
+    it('prewarms hosts from configureHostResolver', (done) => {
+      net.configureHostResolver({prewarm: ['localhost']})
+      // The prewarm resolution is asynchronous; poll the cache until the
+      // entry lands.
+      const check = () => {
+        if (net.getHostResolverStats().size > 0) {
+          done()
+        } else {
+          setTimeout(check, 50)
+        }
+      }
+      check()
+    })
+  })
 })
 
 function handleUnexpectedURL (request, response) {
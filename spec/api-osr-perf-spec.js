@@ -0,0 +1,87 @@
+'use strict'
+
+const chai = require('chai')
+const dirtyChai = require('dirty-chai')
+const path = require('path')
+
+const {expect} = chai
+chai.use(dirtyChai)
+
+const {remote} = require('electron')
+const {BrowserWindow} = remote
+
+const features = process.atomBinding('features')
+
+// Benchmarks covering the offscreen rendering pipeline: begin-frame ->
+// compositor -> OnPaint -> 'paint' event. The assertions only check that
+// frames flow; the interesting output is the rates and latencies logged
+// below, tracked release to release in CI.
+describe('osr performance', function () {
+  this.timeout(120000)
+
+  const fixtures = path.resolve(__dirname, 'fixtures')
+  let w = null
+
+  const report = (name, value) => {
+    console.log(`        [perf] ${name}: ${value}`)
+  }
+
+  beforeEach(function () {
+    if (!features.isOffscreenRenderingEnabled()) {
+      this.skip()
+    }
+  })
+
+  afterEach(() => {
+    if (w != null) w.destroy()
+    w = null
+  })
+
+  const measure = (width, height, frameRate, done) => {
+    w = new BrowserWindow({
+      width: width,
+      height: height,
+      show: false,
+      webPreferences: {
+        backgroundThrottling: false,
+        offscreen: true
+      }
+    })
+    w.webContents.setFrameRate(frameRate)
+
+    const measureMs = 3000
+    let frames = 0
+    let started = null
+    const listener = () => {
+      if (started == null) started = Date.now()
+      frames++
+      // Keep the compositor busy so every begin-frame paints.
+      w.webContents.invalidate()
+      if (Date.now() - started >= measureMs) {
+        w.webContents.removeListener('paint', listener)
+        const elapsed = Date.now() - started
+        const stats = w.webContents.getPaintStats()
+        expect(stats.framesDelivered).to.be.above(0)
+        report(`${width}x${height}@${frameRate}`,
+          `${Math.round(frames / (elapsed / 1000))} fps, ` +
+          `${stats.meanPaintLatency.toFixed(2)} ms mean latency, ` +
+          `${stats.framesDropped} dropped`)
+        done()
+      }
+    }
+    w.webContents.on('paint', listener)
+    w.loadURL('file://' + fixtures + '/api/offscreen-rendering.html')
+  }
+
+  it('delivers frames at 800x600 @ 30 fps', (done) => {
+    measure(800, 600, 30, done)
+  })
+
+  it('delivers frames at 1280x720 @ 60 fps', (done) => {
+    measure(1280, 720, 60, done)
+  })
+
+  it('delivers frames at 1920x1080 @ 60 fps', (done) => {
+    measure(1920, 1080, 60, done)
+  })
+})
@@ -41,4 +41,55 @@ describe('process module', () => {
       assert.equal(typeof heapStats.doesZapGarbage, 'boolean')
     })
   })
+
+  describe('process.getUvLoopStats()', () => {
+    it('returns loop statistics', () => {
+      const stats = process.getUvLoopStats()
+      assert.equal(typeof stats.iterations, 'number')
+      for (const series of [stats.iterationLatency, stats.wakeupLag]) {
+        assert.equal(typeof series.p50, 'number')
+        assert.equal(typeof series.p90, 'number')
+        assert.equal(typeof series.p99, 'number')
+        assert.equal(typeof series.max, 'number')
+      }
+      assert.equal(typeof stats.poll.count, 'number')
+      assert.equal(typeof stats.poll.totalMs, 'number')
+      assert(stats.handles.total >= stats.handles.active)
+    })
+
+    it('counts loop iterations', (done) => {
+      const before = process.getUvLoopStats().iterations
+      setTimeout(() => {
+        assert(process.getUvLoopStats().iterations > before)
+        done()
+      }, 50)
+    })
+  })
+
+  describe('process.startCPUProfiling()', () => {
+    it('writes a loadable profile to the given path', (done) => {
+      const fs = require('fs')
+      const path = require('path')
+      const profilePath = path.join(require('electron').remote.app.getPath('temp'), 'spec.cpuprofile')
+      process.startCPUProfiling()
+      setTimeout(() => {
+        assert.equal(process.stopCPUProfiling(profilePath), true)
+        const profile = JSON.parse(fs.readFileSync(profilePath))
+        assert(Array.isArray(profile.nodes))
+        assert(profile.nodes.length > 0)
+        assert(Array.isArray(profile.samples))
+        assert(Array.isArray(profile.timeDeltas))
+        fs.unlinkSync(profilePath)
+        done()
+      }, 100)
+    })
+
+    it('throws when profiling is already in progress', () => {
+      process.startCPUProfiling()
+      assert.throws(() => {
+        process.startCPUProfiling()
+      }, /already in progress/)
+      process.stopCPUProfiling('')
+    })
+  })
 })
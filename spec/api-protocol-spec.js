@@ -277,6 +277,51 @@ describe('protocol module', () => {
         })
       })
     })
+
+    it('decompresses a gzipped response', (done) => {
+      const gzipped = require('zlib').gzipSync(buffer)
+      const handler = (request, callback) => {
+        callback({
+          data: gzipped,
+          mimeType: 'text/html',
+          contentEncoding: 'gzip'
+        })
+      }
+      protocol.registerBufferProtocol(protocolName, handler, (error) => {
+        if (error) return done(error)
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: (data) => {
+            assert.equal(data, text)
+            done()
+          },
+          error: (xhr, errorType, error) => done(error)
+        })
+      })
+    })
+
+    it('fails on an unknown contentEncoding', (done) => {
+      const handler = (request, callback) => {
+        callback({
+          data: buffer,
+          mimeType: 'text/html',
+          contentEncoding: 'snappy'
+        })
+      }
+      protocol.registerBufferProtocol(protocolName, handler, (error) => {
+        if (error) return done(error)
+        $.ajax({
+          url: protocolName + '://fake-host',
+          cache: false,
+          success: () => done('request succeeded but it should not'),
+          error: (xhr, errorType) => {
+            assert.equal(errorType, 'error')
+            done()
+          }
+        })
+      })
+    })
   })
 
   describe('protocol.registerFileProtocol', () => {
@@ -189,6 +189,17 @@ describe('remote module', () => {
       property.property = 1127
     })
 
+    it('serves repeated reads of primitive properties from the snapshot cache', () => {
+      const property = remote.require(path.join(fixtures, 'module', 'property.js'))
+      assert.equal(property.property, 1127)
+      assert.equal(property.property, 1127)
+
+      // A set through remote invalidates the snapshot.
+      property.property = 2048
+      assert.equal(property.property, 2048)
+      property.property = 1127  // revert back
+    })
+
     it('rethrows errors getting/setting properties', () => {
       const foo = remote.require(path.join(fixtures, 'module', 'error-properties.js'))
 
@@ -126,6 +126,29 @@ describe('session module', () => {
       })
     })
 
+    it('batches writes in write-behind mode', (done) => {
+      const {cookies} = session.defaultSession
+      cookies.setWriteBehind(true, {intervalMs: 10})
+      let remaining = 2
+      const onSet = (error) => {
+        if (error) {
+          cookies.setWriteBehind(false)
+          return done(error)
+        }
+        if (--remaining > 0) return
+        cookies.get({url}, (error, list) => {
+          cookies.setWriteBehind(false)
+          if (error) return done(error)
+          const names = list.map((cookie) => cookie.name)
+          assert(names.includes('write-behind-1'))
+          assert(names.includes('write-behind-2'))
+          done()
+        })
+      }
+      cookies.set({url, name: 'write-behind-1', value: '1'}, onSet)
+      cookies.set({url, name: 'write-behind-2', value: '2'}, onSet)
+    })
+
     it('should remove cookies', (done) => {
       session.defaultSession.cookies.set({
         url: url,
@@ -495,6 +518,97 @@ describe('session module', () => {
     })
   })
 
+  describe('ses.preResolveProxies(urls)', () => {
+    it('resolves the same decision as resolveProxy', (done) => {
+      const config = {proxyRules: 'http=myproxy:80'}
+      session.defaultSession.setProxy(config, () => {
+        session.defaultSession.preResolveProxies(['http://example.com'])
+        session.defaultSession.resolveProxy('http://example.com', (proxy) => {
+          assert.equal(proxy, 'PROXY myproxy:80')
+          done()
+        })
+      })
+    })
+  })
+
+  describe('ses.getCacheStats(callback)', () => {
+    it('reports cache effectiveness counters', (done) => {
+      session.defaultSession.getCacheStats((stats) => {
+        assert.equal(typeof stats, 'object')
+        assert.equal(typeof stats.hitCount, 'number')
+        assert.equal(typeof stats.missCount, 'number')
+        assert.equal(typeof stats.revalidationCount, 'number')
+        assert.equal(typeof stats.cacheBytes, 'number')
+        assert.equal(typeof stats.networkBytes, 'number')
+        assert.equal(typeof stats.entryCount, 'number')
+        done()
+      })
+    })
+
+    it('resets the counters on resetCacheStats', (done) => {
+      // A dedicated partition so traffic from other specs cannot bump the
+      // counters between the reset and the read.
+      const ses = session.fromPartition('cache-stats')
+      ses.resetCacheStats(() => {
+        ses.getCacheStats((stats) => {
+          assert.equal(stats.hitCount, 0)
+          assert.equal(stats.missCount, 0)
+          assert.equal(stats.revalidationCount, 0)
+          assert.equal(stats.cacheBytes, 0)
+          assert.equal(stats.networkBytes, 0)
+          done()
+        })
+      })
+    })
+  })
+
+  describe('ses.preconnect(url, numSockets)', () => {
+    it('accepts a valid url', () => {
+      session.defaultSession.preconnect('https://example.com', 2)
+    })
+
+    it('throws on an invalid url', () => {
+      assert.throws(() => {
+        session.defaultSession.preconnect('not-a-url')
+      }, /valid http\(s\) url/)
+    })
+
+    it('throws on an invalid socket count', () => {
+      assert.throws(() => {
+        session.defaultSession.preconnect('https://example.com', 7)
+      }, /numSockets must be between 1 and 6/)
+    })
+  })
+
+  describe('ses.addInjectedStylesheet(css)', () => {
+    it('applies the stylesheet to new documents', (done) => {
+      const ses = session.fromPartition('injected-stylesheet')
+      const handle = ses.addInjectedStylesheet(
+        'body { background-color: rgb(1, 2, 3); }')
+      const w2 = new BrowserWindow({show: false, webPreferences: {session: ses}})
+      w2.webContents.once('did-finish-load', () => {
+        w2.webContents.executeJavaScript(
+          'getComputedStyle(document.body).backgroundColor', (color) => {
+            assert.equal(color, 'rgb(1, 2, 3)')
+            ses.removeInjectedStylesheet(handle)
+            closeWindow(w2).then(() => done())
+          })
+      })
+      w2.loadURL('data:text/html,<body></body>')
+    })
+  })
+
+  describe('ses.setSpareRendererPoolSize(size)', () => {
+    it('stores and reports the configured pool size', () => {
+      const ses = session.fromPartition('spare-renderer-pool')
+      assert.equal(ses.getSpareRendererPoolSize(), 0)
+      ses.setSpareRendererPoolSize(1)
+      assert.equal(ses.getSpareRendererPoolSize(), 1)
+      ses.setSpareRendererPoolSize(0)
+      assert.equal(ses.getSpareRendererPoolSize(), 0)
+    })
+  })
+
   describe('ses.getBlobData(identifier, callback)', () => {
     it('returns blob data for uuid', (done) => {
       const scheme = 'temp'
@@ -80,3 +80,19 @@ describe('shell module', () => {
     })
   })
 })
+
+describe('shell module asynchronous operations', () => {
+  describe('shell.moveItemToTrash(fullPath[, callback])', () => {
+    it('reports completion through the callback', (done) => {
+      const tmpFile = path.join(os.tmpdir(), `electron-trash-item-${Date.now()}`)
+      fs.writeFileSync(tmpFile, 'delete me')
+      // The trash helper may be unavailable on CI, so only assert that
+      // the operation was queued and the callback received a boolean.
+      assert.equal(shell.moveItemToTrash(tmpFile, (success) => {
+        assert.equal(typeof success, 'boolean')
+        if (fs.existsSync(tmpFile)) fs.unlinkSync(tmpFile)
+        done()
+      }), true)
+    })
+  })
+})
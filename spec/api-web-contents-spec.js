@@ -300,6 +300,92 @@ describe('webContents module', () => {
     })
   })
 
+  describe('sendToFrame(frameId, channel)', () => {
+    it('replies directly to the sending frame', (done) => {
+      ipcMain.once('ping-frame', (event) => {
+        assert.equal(typeof event.frameId, 'number')
+        assert.equal(w.webContents.sendToFrame(event.frameId, 'pong-frame'), true)
+      })
+      ipcMain.once('pong-frame-received', () => done())
+      w.loadURL(`file://${path.join(__dirname, 'fixtures', 'pages', 'frame-id-reply.html')}`)
+    })
+
+    it('returns false for an unknown frame', () => {
+      assert.equal(w.webContents.sendToFrame(99999, 'nowhere'), false)
+    })
+
+    it('throws when the frame id is missing', () => {
+      assert.throws(() => {
+        w.webContents.sendToFrame('oops', 'channel')
+      }, /Missing required frameId argument/)
+    })
+  })
+
+  describe('sendInputEvents(events)', () => {
+    beforeEach((done) => {
+      w.loadURL(`file://${path.join(__dirname, 'fixtures', 'pages', 'key-events.html')}`)
+      w.webContents.once('did-finish-load', () => done())
+    })
+
+    it('injects a batch of events in order', (done) => {
+      const keys = []
+      ipcMain.on('keydown', (event, key) => {
+        keys.push(key)
+        if (keys.length === 2) {
+          ipcMain.removeAllListeners('keydown')
+          assert.deepEqual(keys, ['a', 'b'])
+          done()
+        }
+      })
+      w.webContents.sendInputEvents([
+        {type: 'keyDown', keyCode: 'A'},
+        {type: 'keyDown', keyCode: 'B'}
+      ])
+    })
+
+    it('honors time offsets for replay pacing', (done) => {
+      const start = Date.now()
+      ipcMain.once('keydown', () => {
+        assert(Date.now() - start >= 40)
+        done()
+      })
+      w.webContents.sendInputEvents([
+        {type: 'keyDown', keyCode: 'A', time: 50}
+      ])
+    })
+
+    it('rejects the whole batch on a malformed entry', () => {
+      assert.throws(() => {
+        w.webContents.sendInputEvents([
+          {type: 'keyDown', keyCode: 'A'},
+          {type: 'invalid'}
+        ])
+      }, /Invalid event object at index 1/)
+    })
+  })
+
+  describe('getInputLatencyStats()', () => {
+    it('returns aggregate latency numbers', (done) => {
+      w.loadURL(`file://${path.join(__dirname, 'fixtures', 'pages', 'key-events.html')}`)
+      w.webContents.once('did-finish-load', () => {
+        ipcMain.once('keydown', () => {
+          // The ack may land just after the renderer reply; poll briefly.
+          const check = () => {
+            const stats = w.webContents.getInputLatencyStats()
+            assert(stats.eventCount >= 1)
+            for (const key of ['meanMs', 'maxMs', 'p50Ms', 'p90Ms', 'p99Ms']) {
+              assert.equal(typeof stats[key], 'number')
+            }
+            if (stats.sampleCount >= 1) return done()
+            setTimeout(check, 50)
+          }
+          check()
+        })
+        w.webContents.sendInputEvent({type: 'keyDown', keyCode: 'A'})
+      })
+    })
+  })
+
   it('supports inserting CSS', (done) => {
     w.loadURL('about:blank')
     w.webContents.insertCSS('body { background-repeat: round; }')
@@ -581,6 +667,44 @@ describe('webContents module', () => {
     })
   })
 
+  describe('history limit api', () => {
+    const pages = [1, 2, 3, 4].map((i) => `data:text/html,<title>page${i}</title>`)
+
+    const loadPages = (callback) => {
+      let loaded = 0
+      w.webContents.on('did-finish-load', () => {
+        loaded++
+        if (loaded < pages.length) {
+          w.webContents.loadURL(pages[loaded])
+        } else {
+          callback()
+        }
+      })
+      w.webContents.loadURL(pages[0])
+    }
+
+    it('trimHistory drops the oldest entries but keeps the current one', (done) => {
+      loadPages(() => {
+        assert.equal(w.webContents.length(), pages.length)
+        w.webContents.trimHistory(2)
+        assert.equal(w.webContents.length(), 2)
+        assert.equal(w.webContents.getURL(), pages[pages.length - 1])
+        assert(w.webContents.canGoBack())
+        done()
+      })
+    })
+
+    it('setHistoryLimit bounds the history as navigations commit', (done) => {
+      w.webContents.setHistoryLimit(2)
+      assert.equal(w.webContents.getHistoryLimit(), 2)
+      loadPages(() => {
+        assert.equal(w.webContents.length(), 2)
+        assert.equal(w.webContents.getURL(), pages[pages.length - 1])
+        done()
+      })
+    })
+  })
+
   describe('will-prevent-unload event', () => {
     it('does not emit if beforeunload returns undefined', (done) => {
       w.once('closed', () => {
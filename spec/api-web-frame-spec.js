@@ -132,6 +132,40 @@ describe('webFrame module', function () {
     }
   })
 
+  describe('webFrame.setCacheCapacity', function () {
+    it('reports the configured capacity in getCacheUsage', function () {
+      const original = webFrame.getCacheUsage()
+      assert(original.capacity > 0)
+      assert(original.size >= 0)
+      webFrame.setCacheCapacity(32 * 1024 * 1024)
+      assert.equal(webFrame.getCacheUsage().capacity, 32 * 1024 * 1024)
+      webFrame.setCacheCapacity(original.capacity)
+    })
+
+    it('throws on a negative capacity', function () {
+      assert.throws(function () {
+        webFrame.setCacheCapacity(-1)
+      }, /must not be negative/)
+    })
+  })
+
+  describe('webFrame.precompileScript', function () {
+    it('executes a precompiled script with arguments', function () {
+      webFrame.precompileScript('area', ['width', 'height'], 'return width * height')
+      assert.equal(webFrame.executePrecompiledScript('area', 3, 4), 12)
+      webFrame.releasePrecompiledScript('area')
+      assert.throws(function () {
+        webFrame.executePrecompiledScript('area')
+      }, /No script has been precompiled with name "area"/)
+    })
+
+    it('throws when the script fails to compile', function () {
+      assert.throws(function () {
+        webFrame.precompileScript('broken', [], 'return }{')
+      })
+    })
+  })
+
   it('supports setting the visual and layout zoom level limits', function () {
     assert.doesNotThrow(function () {
       webFrame.setVisualZoomLevelLimits(1, 50)
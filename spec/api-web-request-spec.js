@@ -138,6 +138,28 @@ describe('webRequest module', () => {
         error: (xhr, errorType) => done(errorType)
       })
     })
+
+    it('does not block the request in observe-only mode', (done) => {
+      // The event and the response are delivered independently; wait
+      // for both before finishing.
+      let pending = 2
+      const finish = () => {
+        if (--pending === 0) done()
+      }
+      ses.webRequest.onBeforeRequest({ observeOnly: true }, (details) => {
+        assert.equal(details.url, defaultURL)
+        finish()
+      })
+      $.ajax({
+        url: defaultURL,
+        success: (data) => {
+          // The request completed without the listener calling back.
+          assert.equal(data, '/')
+          finish()
+        },
+        error: (xhr, errorType) => done(errorType)
+      })
+    })
   })
 
   describe('webRequest.onBeforeSendHeaders', () => {
@@ -402,4 +424,50 @@ describe('webRequest module', () => {
       })
     })
   })
+
+  describe('webRequest.setDeclarativeRules', () => {
+    afterEach(() => {
+      ses.webRequest.setDeclarativeRules([])
+      ses.webRequest.onBeforeRequest(null)
+    })
+
+    it('can block the request without a listener', (done) => {
+      ses.webRequest.setDeclarativeRules([
+        {action: 'block', urls: [defaultURL + '*']}
+      ])
+      $.ajax({
+        url: defaultURL,
+        success: () => done('unexpected success'),
+        error: () => done()
+      })
+    })
+
+    it('can redirect the request', (done) => {
+      ses.webRequest.setDeclarativeRules([
+        {action: 'redirect', urls: [defaultURL + 'source*'], redirectURL: defaultURL + 'redirect'}
+      ])
+      $.ajax({
+        url: defaultURL + 'source',
+        success: (data) => {
+          assert.equal(data, '/redirect')
+          done()
+        },
+        error: (xhr, errorType) => done(errorType)
+      })
+    })
+
+    it('lets an allow rule skip the onBeforeRequest listener', (done) => {
+      ses.webRequest.setDeclarativeRules([
+        {action: 'allow', urls: [defaultURL + '*']}
+      ])
+      ses.webRequest.onBeforeRequest((details, callback) => {
+        done('listener should not have been consulted')
+      })
+      $.ajax({
+        url: defaultURL,
+        success: () => done(),
+        error: (xhr, errorType) => done(errorType)
+      })
+    })
+  })
 })
@@ -700,6 +700,27 @@ describe('asar package', function () {
       })
     })
 
+    describe('internalModuleStat', function () {
+      var internalModuleStat = process.binding('fs').internalModuleStat
+
+      it('returns 0 for a file', function () {
+        var p = path.join(fixtures, 'asar', 'a.asar', 'file1')
+        assert.equal(internalModuleStat(p), 0)
+      })
+
+      it('returns 1 for a directory', function () {
+        var p = path.join(fixtures, 'asar', 'a.asar', 'dir1')
+        assert.equal(internalModuleStat(p), 1)
+      })
+
+      it('returns -34 for a missing path, repeatedly', function () {
+        var p = path.join(fixtures, 'asar', 'a.asar', 'not-exist')
+        // Twice, so the second probe is answered from the stat cache.
+        assert.equal(internalModuleStat(p), -34)
+        assert.equal(internalModuleStat(p), -34)
+      })
+    })
+
     describe('process.noAsar', function () {
       var errorName = process.platform === 'win32' ? 'ENOENT' : 'ENOTDIR'
 
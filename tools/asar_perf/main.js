@@ -0,0 +1,164 @@
+// Benchmark app used by script/asar-perf.py. Generates asar archives in a
+// temporary directory, exercises the read path (header parse, lookups,
+// file reads and a require storm) through the patched fs, then prints the
+// results as a single machine-readable line and exits.
+//
+// Archives are written directly by this script rather than through the
+// asar npm module, so the suite keeps working — and stays comparable —
+// when the archive format the writer emits changes.
+const {app} = require('electron')
+const fs = require('original-fs')
+const os = require('os')
+const path = require('path')
+
+const RESULT_PREFIX = 'ASAR_PERF_RESULT '
+
+// Writes a flat asar archive at |archivePath| containing |files|, an
+// array of {name, data} entries. Mirrors the header layout produced by
+// the asar writer: a pickle carrying the header size, then a pickle
+// carrying the JSON header, then the concatenated file contents.
+function writeArchive (archivePath, files) {
+  const header = {files: {}}
+  let offset = 0
+  for (const {name, data} of files) {
+    header.files[name] = {size: data.length, offset: String(offset)}
+    offset += data.length
+  }
+
+  const json = Buffer.from(JSON.stringify(header))
+  const paddedJsonLength = (json.length + 3) & ~3
+  const headerPickle = Buffer.alloc(8 + paddedJsonLength)
+  headerPickle.writeUInt32LE(4 + paddedJsonLength, 0)
+  headerPickle.writeUInt32LE(json.length, 4)
+  json.copy(headerPickle, 8)
+
+  const sizePickle = Buffer.alloc(8)
+  sizePickle.writeUInt32LE(4, 0)
+  sizePickle.writeUInt32LE(headerPickle.length, 4)
+
+  const fd = fs.openSync(archivePath, 'w')
+  fs.writeSync(fd, sizePickle)
+  fs.writeSync(fd, headerPickle)
+  for (const {data} of files) {
+    fs.writeSync(fd, data)
+  }
+  fs.closeSync(fd)
+}
+
+function makeFiles (count, size) {
+  const files = []
+  for (let i = 0; i < count; i++) {
+    files.push({name: `file_${i}.txt`, data: Buffer.alloc(size, i & 0xFF)})
+  }
+  return files
+}
+
+function nowMs () {
+  const [seconds, nanoseconds] = process.hrtime()
+  return seconds * 1000 + nanoseconds / 1e6
+}
+
+// Fisher-Yates with a fixed linear congruential generator, so "random"
+// access patterns are identical between runs and across versions.
+function shuffle (array) {
+  let seed = 0x2545F491
+  const next = () => {
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return seed
+  }
+  for (let i = array.length - 1; i > 0; i--) {
+    const j = next() % (i + 1)
+    const tmp = array[i]
+    array[i] = array[j]
+    array[j] = tmp
+  }
+  return array
+}
+
+function run () {
+  const tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'asar-perf-'))
+  const results = {}
+  const patchedFs = require('fs')
+
+  // Header parse time as a function of file count: the first stat into a
+  // fresh archive pays for reading and parsing the whole header.
+  for (const count of [100, 1000, 10000]) {
+    const archive = path.join(tmpDir, `header_${count}.asar`)
+    writeArchive(archive, makeFiles(count, 16))
+    const start = nowMs()
+    patchedFs.statSync(path.join(archive, 'file_0.txt'))
+    results[`headerParseMs_${count}`] = nowMs() - start
+  }
+
+  // Random lookup rate against the already-parsed 10000-entry header.
+  {
+    const archive = path.join(tmpDir, 'header_10000.asar')
+    const lookups = 20000
+    const names = shuffle(makeFiles(10000, 0).map((file) => file.name))
+    const start = nowMs()
+    for (let i = 0; i < lookups; i++) {
+      patchedFs.statSync(path.join(archive, names[i % names.length]))
+    }
+    results.lookupsPerSecond = lookups / ((nowMs() - start) / 1000)
+  }
+
+  // Read bandwidth: 64 x 256KB files, first in archive order then in a
+  // fixed shuffled order.
+  {
+    const fileSize = 256 * 1024
+    const files = makeFiles(64, fileSize)
+    const archive = path.join(tmpDir, 'read.asar')
+    writeArchive(archive, files)
+    const totalMB = (64 * fileSize) / (1024 * 1024)
+
+    let start = nowMs()
+    for (const {name} of files) {
+      patchedFs.readFileSync(path.join(archive, name))
+    }
+    results.sequentialReadMBps = totalMB / ((nowMs() - start) / 1000)
+
+    const shuffled = shuffle(files.map((file) => file.name))
+    start = nowMs()
+    for (const name of shuffled) {
+      patchedFs.readFileSync(path.join(archive, name))
+    }
+    results.randomReadMBps = totalMB / ((nowMs() - start) / 1000)
+  }
+
+  // Require storm: cold-require 1000 tiny modules out of one archive, the
+  // pattern a large app hits on startup.
+  {
+    const count = 1000
+    const modules = []
+    for (let i = 0; i < count; i++) {
+      modules.push({
+        name: `mod_${i}.js`,
+        data: Buffer.from(`module.exports = ${i}\n`)
+      })
+    }
+    const archive = path.join(tmpDir, 'modules.asar')
+    writeArchive(archive, modules)
+    const start = nowMs()
+    for (let i = 0; i < count; i++) {
+      require(path.join(archive, `mod_${i}.js`))
+    }
+    results.requiresPerSecond = count / ((nowMs() - start) / 1000)
+  }
+
+  for (const name of fs.readdirSync(tmpDir)) {
+    fs.unlinkSync(path.join(tmpDir, name))
+  }
+  fs.rmdirSync(tmpDir)
+
+  process.stdout.write(RESULT_PREFIX + JSON.stringify(results) + '\n')
+  app.exit(0)
+}
+
+app.once('ready', () => {
+  try {
+    run()
+  } catch (error) {
+    process.stderr.write(`asar-perf: ${error.stack}\n`)
+    app.exit(1)
+  }
+})
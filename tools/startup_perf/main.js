@@ -0,0 +1,41 @@
+// Benchmark app used by script/startup-perf.py. Opens one window, waits
+// for the first paint and the first renderer IPC, then prints the startup
+// timings as a single machine-readable line and exits.
+const {app, BrowserWindow, ipcMain} = require('electron')
+const path = require('path')
+
+const RESULT_PREFIX = 'STARTUP_PERF_RESULT '
+
+let firstIpcMs = null
+let finished = false
+
+function maybeFinish () {
+  if (finished || firstIpcMs == null) return
+  const timings = app.getStartupTimings()
+  if (timings.firstWindowShown == null) return
+  finished = true
+  timings.firstIpc = firstIpcMs
+  process.stdout.write(RESULT_PREFIX + JSON.stringify(timings) + '\n')
+  app.exit(0)
+}
+
+ipcMain.once('startup-perf:first-ipc', () => {
+  firstIpcMs = process.uptime() * 1000
+  maybeFinish()
+})
+
+app.once('ready', () => {
+  const win = new BrowserWindow({width: 800, height: 600})
+  win.loadURL(`file://${path.join(__dirname, 'index.html')}`)
+  win.webContents.once('did-finish-load', maybeFinish)
+  // firstWindowShown is recorded asynchronously; poll until both signals
+  // have arrived. Bail out eventually so a broken build fails fast.
+  const poll = setInterval(maybeFinish, 50)
+  setTimeout(() => {
+    clearInterval(poll)
+    if (!finished) {
+      process.stderr.write('startup-perf: timed out waiting for signals\n')
+      app.exit(1)
+    }
+  }, 30 * 1000)
+})
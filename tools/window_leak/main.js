@@ -0,0 +1,116 @@
+// Window lifecycle leak harness used by script/window-leak-check.py.
+// Opens and closes a window N times, snapshotting per-process memory
+// (app.getAppMetrics) and live wrapper counts (the TrackableObject weak
+// maps, observed through getAllWindows/getAllWebContents) after a forced
+// GC at the end of each cycle. Prints the series plus a verdict as one
+// machine-readable line; exits non-zero when growth looks monotonic.
+const {app, BrowserWindow, webContents} = require('electron')
+const v8 = require('v8')
+const vm = require('vm')
+
+const RESULT_PREFIX = 'WINDOW_LEAK_RESULT '
+
+// Cycles before measurement begins; the first windows populate lazily
+// created caches (spare renderers, GPU channels, shader caches) that
+// would otherwise read as growth.
+const WARMUP_CYCLES = 3
+
+// A series is only reported as a leak when it both rises in (nearly)
+// every measured cycle and adds up to real memory; jitter below the
+// floor is ignored.
+const MONOTONIC_FRACTION = 0.9
+const MIN_GROWTH_KB = 2048
+
+v8.setFlagsFromString('--expose_gc')
+const gc = vm.runInNewContext('gc')
+
+function browserMetrics () {
+  for (const metric of app.getAppMetrics()) {
+    if (metric.pid === process.pid) return metric
+  }
+  return null
+}
+
+function snapshot () {
+  gc()
+  const metric = browserMetrics()
+  return {
+    windows: BrowserWindow.getAllWindows().length,
+    webContents: webContents.getAllWebContents().length,
+    heapUsedKB: process.memoryUsage().heapUsed / 1024,
+    workingSetKB: metric ? metric.memory.workingSetSize : 0,
+    privateKB: metric ? (metric.memory.privateBytes || 0) : 0
+  }
+}
+
+function cycle () {
+  return new Promise((resolve, reject) => {
+    const win = new BrowserWindow({show: false, width: 400, height: 300})
+    win.webContents.once('did-finish-load', () => win.close())
+    win.once('closed', () => {
+      // Give the render process teardown a beat before snapshotting.
+      setTimeout(resolve, 250)
+    })
+    win.loadURL('data:text/html,<title>leak-cycle</title>')
+    setTimeout(() => reject(new Error('cycle timed out')), 30 * 1000)
+  })
+}
+
+// True when |values| rises between (nearly) all successive samples and
+// the total increase is above the noise floor.
+function isMonotonicGrowth (values, minGrowth) {
+  if (values.length < 2) return false
+  let rises = 0
+  for (let i = 1; i < values.length; i++) {
+    if (values[i] > values[i - 1]) rises++
+  }
+  return rises >= (values.length - 1) * MONOTONIC_FRACTION &&
+         values[values.length - 1] - values[0] > minGrowth
+}
+
+async function run () {
+  const cycles = parseInt(process.env.WINDOW_LEAK_CYCLES, 10) || 20
+  for (let i = 0; i < WARMUP_CYCLES; i++) {
+    await cycle()
+  }
+
+  const baseline = snapshot()
+  const snapshots = []
+  for (let i = 0; i < cycles; i++) {
+    await cycle()
+    snapshots.push(snapshot())
+  }
+
+  const failures = []
+  const last = snapshots[snapshots.length - 1]
+  if (last.windows > baseline.windows) {
+    failures.push('BrowserWindow wrappers leaked: ' +
+                  `${baseline.windows} -> ${last.windows}`)
+  }
+  if (last.webContents > baseline.webContents) {
+    failures.push('WebContents wrappers leaked: ' +
+                  `${baseline.webContents} -> ${last.webContents}`)
+  }
+  for (const key of ['heapUsedKB', 'workingSetKB', 'privateKB']) {
+    if (isMonotonicGrowth(snapshots.map((s) => s[key]), MIN_GROWTH_KB)) {
+      failures.push(`${key} grows monotonically: ` +
+                    `${snapshots[0][key]} -> ${last[key]}`)
+    }
+  }
+
+  process.stdout.write(RESULT_PREFIX + JSON.stringify({
+    cycles: cycles,
+    baseline: baseline,
+    snapshots: snapshots,
+    failures: failures,
+    passed: failures.length === 0
+  }) + '\n')
+  app.exit(failures.length === 0 ? 0 : 1)
+}
+
+app.once('ready', () => {
+  run().catch((error) => {
+    process.stderr.write(`window-leak: ${error.stack}\n`)
+    app.exit(2)
+  })
+})